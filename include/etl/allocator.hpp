@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <new> //For placement new and bad_alloc
+
 namespace etl {
 /*
  * GCC mangling of vector types (__m128, __m256, ...) is terribly
@@ -52,8 +54,13 @@ struct aligned_allocator {
     template <typename T, std::size_t S = sizeof(T)>
     static T* allocate(std::size_t size, mangling_faker<S> /*unused*/ = mangling_faker<S>()) {
         auto required_bytes = sizeof(T) * size;
-        auto offset         = (A - 1) + sizeof(uintptr_t);
-        auto orig           = malloc(required_bytes + offset);
+
+        if (arena_active()) {
+            return reinterpret_cast<T*>(arena_allocate(required_bytes, A));
+        }
+
+        auto offset = (A - 1) + sizeof(uintptr_t);
+        auto orig   = malloc(required_bytes + offset);
 
         if (!orig) {
             return nullptr;
@@ -66,12 +73,22 @@ struct aligned_allocator {
 
     /*!
      * \brief Release the memory
+     *
+     * Memory allocated while an arena_scope was active is given back to
+     * the arena.
+     *
      * \param ptr The pointer to the memory to be released
      */
     template <typename T, std::size_t S = sizeof(T)>
     static void release(T* ptr, mangling_faker<S> /*unused*/ = mangling_faker<S>()) {
         //Note the const_cast is only to allow compilation
-        free((reinterpret_cast<void**>(const_cast<std::remove_const_t<T>*>(ptr)))[-1]);
+        auto memory = const_cast<std::remove_const_t<T>*>(ptr);
+
+        if (is_arena_block(memory)) {
+            arena_release(memory);
+        } else {
+            free((reinterpret_cast<void**>(memory))[-1]);
+        }
     }
 };
 
@@ -86,6 +103,12 @@ auto allocate(std::size_t size, mangling_faker<S> /*unused*/ = mangling_faker<S>
     return std::make_unique<T[]>(size);
 }
 
+/*!
+ * \brief The alignment of the memory returned by aligned_allocate, large
+ * enough for the aligned loads of all the vector modes
+ */
+constexpr std::size_t aligned_allocate_alignment = 64;
+
 /*!
  * \brief Allocate an aligned rray of the given size for the given type
  * \param size The number of elements
@@ -93,7 +116,7 @@ auto allocate(std::size_t size, mangling_faker<S> /*unused*/ = mangling_faker<S>
  */
 template <typename T, std::size_t S = sizeof(T)>
 T* aligned_allocate(std::size_t size, mangling_faker<S> /*unused*/ = mangling_faker<S>()) {
-    return aligned_allocator<32>::allocate<T>(size);
+    return aligned_allocator<aligned_allocate_alignment>::allocate<T>(size);
 }
 
 /*!
@@ -102,9 +125,112 @@ T* aligned_allocate(std::size_t size, mangling_faker<S> /*unused*/ = mangling_fa
  */
 template <typename T, std::size_t S = sizeof(T)>
 void aligned_release(T* ptr, mangling_faker<S> /*unused*/ = mangling_faker<S>()) {
-    return aligned_allocator<32>::release<T>(ptr);
+    return aligned_allocator<aligned_allocate_alignment>::release<T>(ptr);
 }
 
+/*!
+ * \brief The alignment used to allocate objects with aligned_new
+ */
+template <typename T>
+constexpr std::size_t aligned_new_alignment = alignof(T) > 32 ? alignof(T) : 32;
+
+/*!
+ * \brief Construct a new object in aligned memory.
+ *
+ * The memory comes from the arena of the current thread when an
+ * arena_scope is active. The object must be destroyed with
+ * aligned_delete.
+ *
+ * \param args The arguments of the constructor
+ * \return A pointer to the new object
+ */
+template <typename T, typename... Args>
+T* aligned_new(Args&&... args) {
+    auto memory = aligned_allocator<aligned_new_alignment<T>>::template allocate<char>(sizeof(T));
+
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+
+    try {
+        return new (memory) T(std::forward<Args>(args)...);
+    } catch (...) {
+        aligned_allocator<aligned_new_alignment<T>>::release(memory);
+        throw;
+    }
+}
+
+/*!
+ * \brief Deleter for objects constructed with aligned_new
+ */
+template <typename T>
+struct aligned_delete {
+    /*!
+     * \brief Destroy the object and release its memory
+     * \param ptr The pointer to the object
+     */
+    void operator()(T* ptr) const {
+        ptr->~T();
+        aligned_allocator<aligned_new_alignment<T>>::release(reinterpret_cast<char*>(ptr));
+    }
+};
+
+/*!
+ * \brief Standard allocator using aligned memory, from the arena of the
+ * current thread when an arena_scope is active.
+ */
+template <typename T>
+struct aligned_std_allocator {
+    using value_type = T; ///< The type of the allocated values
+
+    aligned_std_allocator() = default;
+
+    /*!
+     * \brief Construct an allocator from an allocator of another type
+     */
+    template <typename U>
+    aligned_std_allocator(const aligned_std_allocator<U>& /*rhs*/) noexcept {}
+
+    /*!
+     * \brief Allocate memory for n values
+     * \param n The number of values
+     * \return A pointer to the allocated memory
+     */
+    T* allocate(std::size_t n) {
+        auto memory = aligned_allocator<aligned_new_alignment<T>>::template allocate<char>(n * sizeof(T));
+
+        if (!memory) {
+            throw std::bad_alloc();
+        }
+
+        return reinterpret_cast<T*>(memory);
+    }
+
+    /*!
+     * \brief Release memory allocated with allocate
+     * \param ptr The pointer to the memory
+     */
+    void deallocate(T* ptr, std::size_t /*n*/) {
+        aligned_allocator<aligned_new_alignment<T>>::release(reinterpret_cast<char*>(ptr));
+    }
+
+    /*!
+     * \brief Indicates if memory allocated by rhs can be released by this allocator
+     */
+    template <typename U>
+    bool operator==(const aligned_std_allocator<U>& /*rhs*/) const noexcept {
+        return true;
+    }
+
+    /*!
+     * \brief Indicates if memory allocated by rhs cannot be released by this allocator
+     */
+    template <typename U>
+    bool operator!=(const aligned_std_allocator<U>& /*rhs*/) const noexcept {
+        return false;
+    }
+};
+
 /*!
  * \brief RAII wrapper for allocated aligned memory
  */
@@ -0,0 +1,289 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Thread-local arena recycling the memory of temporaries and kernel scratch buffers
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+
+namespace etl {
+
+constexpr std::size_t arena_min_bits     = 6;                          ///< The log2 of the smallest block size of the arena
+constexpr std::size_t arena_sub_classes  = 4;                          ///< The number of size classes per power of two
+constexpr std::size_t arena_classes      = arena_sub_classes * 48;     ///< The number of size classes of the arena
+constexpr std::uintptr_t arena_block_tag = 1;                          ///< The tag of the original pointer of arena blocks
+constexpr std::size_t arena_max_cached   = 64 * 1024 * 1024;           ///< The maximum number of bytes cached by the arena of a thread
+
+/*!
+ * \brief Returns the size class of a block of the given number of bytes.
+ *
+ * There are four size classes per power of two, the memory wasted by
+ * rounding up a block is therefore at most 25%.
+ *
+ * \param bytes The required number of bytes
+ * \return The size class of the block
+ */
+inline std::size_t arena_class(std::size_t bytes) noexcept {
+    if (bytes <= (std::size_t(1) << arena_min_bits)) {
+        return 0;
+    }
+
+    const std::size_t b = bytes - 1;
+
+    std::size_t o = arena_min_bits;
+    while (b >> (o + 1)) {
+        ++o;
+    }
+
+    const std::size_t octave = o - arena_min_bits;
+    const std::size_t sub    = (b >> (o - 2)) + 1 - arena_sub_classes;
+
+    return octave * arena_sub_classes + sub;
+}
+
+/*!
+ * \brief Returns the number of bytes of the blocks of the given size class
+ * \param c The size class
+ * \return The number of bytes of the blocks of the size class
+ */
+inline std::size_t arena_class_size(std::size_t c) noexcept {
+    return (arena_sub_classes + c % arena_sub_classes) << (c / arena_sub_classes + arena_min_bits - 2);
+}
+
+/*!
+ * \brief Thread-local cache of memory blocks, sorted by size class.
+ *
+ * While an arena_scope is active on a thread, the aligned memory
+ * released by this thread is kept in a free list of its size class
+ * instead of being returned to the system, and allocations are served
+ * from these free lists. A steady-state loop running inside a scope
+ * therefore does not allocate any memory after its first iteration.
+ *
+ * A block can be released from any thread. It is cached by the
+ * releasing thread if it has an active scope and freed otherwise. At
+ * most arena_max_cached bytes are cached by a thread, the blocks that do
+ * not fit are freed.
+ *
+ * Only the threads with an active scope use their arena. The workers of
+ * the thread pool open a scope for the duration of a parallel loop
+ * started by a thread with an active scope, so that the scratch memory of
+ * the parallel kernels is also recycled.
+ */
+struct arena {
+    std::size_t depth  = 0; ///< The number of active scopes
+    std::size_t cached = 0; ///< The number of bytes currently cached
+
+    arena() = default;
+
+    arena(const arena& rhs) = delete;
+    arena& operator=(const arena& rhs) = delete;
+
+    /*!
+     * \brief Release all the cached blocks
+     */
+    ~arena() {
+        trim();
+        destroyed() = true;
+    }
+
+    /*!
+     * \brief Returns the arena of the current thread
+     * \return the arena of the current thread or nullptr if it has already
+     * been destroyed (during thread exit)
+     */
+    static arena* local() {
+        if (destroyed()) {
+            return nullptr;
+        }
+
+        static thread_local arena a;
+        return &a;
+    }
+
+    /*!
+     * \brief Returns a cached block of the given size class, if any
+     * \param c The size class
+     * \return A pointer to the block or nullptr if no block is cached
+     */
+    void* pop(std::size_t c) noexcept {
+        void* block = free_lists[c];
+
+        if (block) {
+            free_lists[c] = *reinterpret_cast<void**>(block);
+            cached -= arena_class_size(c);
+        }
+
+        return block;
+    }
+
+    /*!
+     * \brief Put a block of the given size class in the cache, if it fits
+     * \param c The size class
+     * \param block The block to cache
+     * \return true if the block has been cached, false otherwise
+     */
+    bool push(std::size_t c, void* block) noexcept {
+        if (cached + arena_class_size(c) > arena_max_cached) {
+            return false;
+        }
+
+        *reinterpret_cast<void**>(block) = free_lists[c];
+        free_lists[c] = block;
+        cached += arena_class_size(c);
+
+        return true;
+    }
+
+    /*!
+     * \brief Release all the cached blocks to the system
+     */
+    void trim() noexcept {
+        for (std::size_t c = 0; c < arena_classes; ++c) {
+            while (void* block = pop(c)) {
+                free(block);
+            }
+        }
+    }
+
+private:
+    std::array<void*, arena_classes> free_lists{}; ///< The free lists, by size class
+
+    /*!
+     * \brief Indicates if the arena of the current thread has been destroyed
+     */
+    static bool& destroyed() {
+        static thread_local bool value = false;
+        return value;
+    }
+};
+
+/*!
+ * \brief RAII helper activating the arena of the current thread.
+ *
+ * Scopes can be nested. Cached blocks are kept after the outermost scope
+ * ends, so that they can be reused by the next scope, and are released
+ * with arena_trim() or when the thread exits.
+ *
+ * A scope activates the arena of the thread that opens it, and the ones
+ * of the workers of the thread pool while they run the parallel loops
+ * started from this thread.
+ */
+struct arena_scope {
+    /*!
+     * \brief Activate the arena of the current thread
+     */
+    arena_scope() {
+        ++arena::local()->depth;
+    }
+
+    arena_scope(const arena_scope& rhs) = delete;
+    arena_scope& operator=(const arena_scope& rhs) = delete;
+
+    /*!
+     * \brief Deactivate the arena of the current thread
+     */
+    ~arena_scope() {
+        --arena::local()->depth;
+    }
+};
+
+/*!
+ * \brief Indicates if the arena of the current thread is active
+ * \return true if an arena_scope is active on the current thread
+ */
+inline bool arena_active() {
+    auto* a = arena::local();
+    return a && a->depth;
+}
+
+/*!
+ * \brief Returns the number of bytes cached by the arena of the current thread
+ */
+inline std::size_t arena_cached() {
+    auto* a = arena::local();
+    return a ? a->cached : 0;
+}
+
+/*!
+ * \brief Release all the blocks cached by the arena of the current thread
+ */
+inline void arena_trim() {
+    if (auto* a = arena::local()) {
+        a->trim();
+    }
+}
+
+/*!
+ * \brief Allocate an aligned block of memory from the arena of the current thread
+ *
+ * The original pointer of the block is stored tagged just before the
+ * returned pointer, and the size class before it.
+ *
+ * \param bytes The number of bytes
+ * \param align The alignment, a power of two
+ * \return A pointer to the aligned memory or nullptr if the allocation failed
+ */
+inline void* arena_allocate(std::size_t bytes, std::size_t align) {
+    const auto offset = (align - 1) + 2 * sizeof(std::uintptr_t);
+    const auto c      = arena_class(bytes + offset);
+
+    void* orig = nullptr;
+
+    if (c < arena_classes) {
+        orig = arena::local()->pop(c);
+    }
+
+    if (!orig) {
+        orig = malloc(c < arena_classes ? arena_class_size(c) : bytes + offset);
+
+        if (!orig) {
+            return nullptr;
+        }
+    }
+
+    auto aligned = reinterpret_cast<std::uintptr_t*>((reinterpret_cast<std::uintptr_t>(orig) + offset) & ~(align - 1));
+    aligned[-1]  = reinterpret_cast<std::uintptr_t>(orig) | arena_block_tag;
+    aligned[-2]  = c;
+    return aligned;
+}
+
+/*!
+ * \brief Indicates if the given aligned memory has been allocated from an arena
+ * \param ptr The pointer to the aligned memory
+ */
+inline bool is_arena_block(const void* ptr) noexcept {
+    return reinterpret_cast<const std::uintptr_t*>(ptr)[-1] & arena_block_tag;
+}
+
+/*!
+ * \brief Release a block allocated with arena_allocate.
+ *
+ * The block is cached by the current thread if its arena is active and
+ * has room for it, and freed otherwise.
+ *
+ * \param ptr The pointer to the aligned memory
+ */
+inline void arena_release(void* ptr) {
+    auto aligned = reinterpret_cast<std::uintptr_t*>(ptr);
+    auto orig    = reinterpret_cast<void*>(aligned[-1] & ~arena_block_tag);
+    auto c       = aligned[-2];
+
+    auto* a = arena::local();
+
+    if (!(c < arena_classes && a && a->depth && a->push(c, orig))) {
+        free(orig);
+    }
+}
+
+} //end of namespace etl
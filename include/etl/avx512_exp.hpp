@@ -0,0 +1,366 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Contains AVX-512 functions for exp, log, sin and cos
+ *
+ * The algorithms and the coefficients are the ones of the Cephes library,
+ * as in the SSE and AVX versions, but the exponent manipulations are done
+ * with the AVX-512F scalef, getexp and getmant instructions.
+ */
+
+#pragma once
+
+#if defined(__AVX512F__) || defined(ETL_TARGET_AVX512)
+
+#include <immintrin.h>
+
+#include <limits>
+
+#define ETL_INLINE_VEC_512 ETL_STATIC_INLINE(__m512)
+#define ETL_INLINE_VEC_512D ETL_STATIC_INLINE(__m512d)
+
+namespace etl {
+
+/*!
+ * \brief Compute the exponential of each element
+ *
+ * The maximum error is about 1 ulp. Overflow gives +inf and the denormal
+ * results are correctly computed.
+ */
+ETL_INLINE_VEC_512 exp512_ps(__m512 x) {
+    // The NaN inputs are propagated by min/max when passed last
+    x = _mm512_min_ps(_mm512_set1_ps(89.0f), x);
+    x = _mm512_max_ps(_mm512_set1_ps(-104.0f), x);
+
+    /* express exp(x) as exp(r + k * log(2)) */
+    auto k = _mm512_roundscale_ps(_mm512_mul_ps(x, _mm512_set1_ps(1.44269504088896341f)), _MM_FROUND_TO_NEAREST_INT);
+
+    auto r = _mm512_fnmadd_ps(k, _mm512_set1_ps(0.693359375f), x);
+    r      = _mm512_fnmadd_ps(k, _mm512_set1_ps(-2.12194440e-4f), r);
+
+    auto y = _mm512_set1_ps(1.9875691500E-4f);
+    y      = _mm512_fmadd_ps(y, r, _mm512_set1_ps(1.3981999507E-3f));
+    y      = _mm512_fmadd_ps(y, r, _mm512_set1_ps(8.3334519073E-3f));
+    y      = _mm512_fmadd_ps(y, r, _mm512_set1_ps(4.1665795894E-2f));
+    y      = _mm512_fmadd_ps(y, r, _mm512_set1_ps(1.6666665459E-1f));
+    y      = _mm512_fmadd_ps(y, r, _mm512_set1_ps(5.0000001201E-1f));
+    y      = _mm512_fmadd_ps(y, _mm512_mul_ps(r, r), r);
+    y      = _mm512_add_ps(y, _mm512_set1_ps(1.0f));
+
+    return _mm512_scalef_ps(y, k);
+}
+
+/*!
+ * \brief Compute the exponential of each element
+ *
+ * The argument is reduced to r in [-ln(2)/2, ln(2)/2] and e^r is computed
+ * with its Taylor series. The maximum error is about 1 ulp. Overflow gives
+ * +inf and the denormal results are correctly computed.
+ */
+ETL_INLINE_VEC_512D exp512_pd(__m512d x) {
+    // The NaN inputs are propagated by min/max when passed last
+    x = _mm512_min_pd(_mm512_set1_pd(710.0), x);
+    x = _mm512_max_pd(_mm512_set1_pd(-746.0), x);
+
+    /* express exp(x) as exp(r + k * log(2)) */
+    auto k = _mm512_roundscale_pd(_mm512_mul_pd(x, _mm512_set1_pd(1.44269504088896340736)), _MM_FROUND_TO_NEAREST_INT);
+
+    auto r = _mm512_fnmadd_pd(k, _mm512_set1_pd(6.93145751953125E-1), x);
+    r      = _mm512_fnmadd_pd(k, _mm512_set1_pd(1.42860682030941723212E-6), r);
+
+    auto y = _mm512_set1_pd(1.0 / 6227020800.0);
+    y      = _mm512_fmadd_pd(y, r, _mm512_set1_pd(1.0 / 479001600.0));
+    y      = _mm512_fmadd_pd(y, r, _mm512_set1_pd(1.0 / 39916800.0));
+    y      = _mm512_fmadd_pd(y, r, _mm512_set1_pd(1.0 / 3628800.0));
+    y      = _mm512_fmadd_pd(y, r, _mm512_set1_pd(1.0 / 362880.0));
+    y      = _mm512_fmadd_pd(y, r, _mm512_set1_pd(1.0 / 40320.0));
+    y      = _mm512_fmadd_pd(y, r, _mm512_set1_pd(1.0 / 5040.0));
+    y      = _mm512_fmadd_pd(y, r, _mm512_set1_pd(1.0 / 720.0));
+    y      = _mm512_fmadd_pd(y, r, _mm512_set1_pd(1.0 / 120.0));
+    y      = _mm512_fmadd_pd(y, r, _mm512_set1_pd(1.0 / 24.0));
+    y      = _mm512_fmadd_pd(y, r, _mm512_set1_pd(1.0 / 6.0));
+    y      = _mm512_fmadd_pd(y, r, _mm512_set1_pd(0.5));
+    y      = _mm512_fmadd_pd(y, r, _mm512_set1_pd(1.0));
+    y      = _mm512_fmadd_pd(y, r, _mm512_set1_pd(1.0));
+
+    return _mm512_scalef_pd(y, k);
+}
+
+/*!
+ * \brief Compute the natural logarithm of each element
+ *
+ * The maximum error is about 1 ulp. Denormals are supported, log(0) is
+ * -inf and negative arguments give NaN.
+ */
+ETL_INLINE_VEC_512 log512_ps(__m512 x) {
+    auto one  = _mm512_set1_ps(1.0f);
+    auto zero = _mm512_setzero_ps();
+
+    /* x = m * 2^e with m in [0.5, 1) */
+    auto m = _mm512_getmant_ps(x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero);
+    auto e = _mm512_add_ps(_mm512_getexp_ps(x), one);
+
+    /* m in [sqrt(0.5), sqrt(2)) */
+    auto small = _mm512_cmp_ps_mask(m, _mm512_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+    e          = _mm512_mask_sub_ps(e, small, e, one);
+    m          = _mm512_mask_add_ps(m, small, m, m);
+    m          = _mm512_sub_ps(m, one);
+
+    auto z = _mm512_mul_ps(m, m);
+
+    auto y = _mm512_set1_ps(7.0376836292E-2f);
+    y      = _mm512_fmadd_ps(y, m, _mm512_set1_ps(-1.1514610310E-1f));
+    y      = _mm512_fmadd_ps(y, m, _mm512_set1_ps(1.1676998740E-1f));
+    y      = _mm512_fmadd_ps(y, m, _mm512_set1_ps(-1.2420140846E-1f));
+    y      = _mm512_fmadd_ps(y, m, _mm512_set1_ps(1.4249322787E-1f));
+    y      = _mm512_fmadd_ps(y, m, _mm512_set1_ps(-1.6668057665E-1f));
+    y      = _mm512_fmadd_ps(y, m, _mm512_set1_ps(2.0000714765E-1f));
+    y      = _mm512_fmadd_ps(y, m, _mm512_set1_ps(-2.4999993993E-1f));
+    y      = _mm512_fmadd_ps(y, m, _mm512_set1_ps(3.3333331174E-1f));
+    y      = _mm512_mul_ps(_mm512_mul_ps(y, m), z);
+
+    y = _mm512_fmadd_ps(e, _mm512_set1_ps(-2.12194440e-4f), y);
+    y = _mm512_fmadd_ps(z, _mm512_set1_ps(-0.5f), y);
+    y = _mm512_add_ps(m, y);
+    y = _mm512_fmadd_ps(e, _mm512_set1_ps(0.693359375f), y);
+
+    /* special values */
+    auto inf = _mm512_set1_ps(std::numeric_limits<float>::infinity());
+    y        = _mm512_mask_mov_ps(y, _mm512_cmp_ps_mask(x, zero, _CMP_EQ_OQ), _mm512_sub_ps(zero, inf));
+    y        = _mm512_mask_mov_ps(y, _mm512_cmp_ps_mask(x, inf, _CMP_EQ_OQ), inf);
+    y        = _mm512_mask_mov_ps(y, _mm512_cmp_ps_mask(x, zero, _CMP_NGE_UQ), _mm512_set1_ps(std::numeric_limits<float>::quiet_NaN()));
+
+    return y;
+}
+
+/*!
+ * \brief Compute the natural logarithm of each element
+ *
+ * The argument is decomposed into m * 2^e with m in [sqrt(0.5), sqrt(2))
+ * and log(m) is computed with the rational approximation of Cephes. The
+ * maximum error is about 1 ulp. Denormals are supported, log(0) is -inf
+ * and negative arguments give NaN.
+ */
+ETL_INLINE_VEC_512D log512_pd(__m512d x) {
+    auto one  = _mm512_set1_pd(1.0);
+    auto zero = _mm512_setzero_pd();
+
+    /* x = m * 2^e with m in [0.5, 1) */
+    auto m = _mm512_getmant_pd(x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero);
+    auto e = _mm512_add_pd(_mm512_getexp_pd(x), one);
+
+    /* m in [sqrt(0.5), sqrt(2)) */
+    auto small = _mm512_cmp_pd_mask(m, _mm512_set1_pd(0.70710678118654752440), _CMP_LT_OQ);
+    e          = _mm512_mask_sub_pd(e, small, e, one);
+    m          = _mm512_mask_add_pd(m, small, m, m);
+    m          = _mm512_sub_pd(m, one);
+
+    auto z = _mm512_mul_pd(m, m);
+
+    auto p = _mm512_set1_pd(1.01875663804580931796E-4);
+    p      = _mm512_fmadd_pd(p, m, _mm512_set1_pd(4.97494994976747001425E-1));
+    p      = _mm512_fmadd_pd(p, m, _mm512_set1_pd(4.70579119878881725854E0));
+    p      = _mm512_fmadd_pd(p, m, _mm512_set1_pd(1.44989225341610930846E1));
+    p      = _mm512_fmadd_pd(p, m, _mm512_set1_pd(1.79368678507819816313E1));
+    p      = _mm512_fmadd_pd(p, m, _mm512_set1_pd(7.70838733755885391666E0));
+
+    auto q = _mm512_add_pd(m, _mm512_set1_pd(1.12873587189167450590E1));
+    q      = _mm512_fmadd_pd(q, m, _mm512_set1_pd(4.52279145837532221105E1));
+    q      = _mm512_fmadd_pd(q, m, _mm512_set1_pd(8.29875266912776603211E1));
+    q      = _mm512_fmadd_pd(q, m, _mm512_set1_pd(7.11544750618563894466E1));
+    q      = _mm512_fmadd_pd(q, m, _mm512_set1_pd(2.31251620126765340583E1));
+
+    auto y = _mm512_mul_pd(m, _mm512_div_pd(_mm512_mul_pd(z, p), q));
+    y      = _mm512_fmadd_pd(e, _mm512_set1_pd(-2.121944400546905827679e-4), y);
+    y      = _mm512_fmadd_pd(z, _mm512_set1_pd(-0.5), y);
+    y      = _mm512_add_pd(m, y);
+    y      = _mm512_fmadd_pd(e, _mm512_set1_pd(0.693359375), y);
+
+    /* special values */
+    auto inf = _mm512_set1_pd(std::numeric_limits<double>::infinity());
+    y        = _mm512_mask_mov_pd(y, _mm512_cmp_pd_mask(x, zero, _CMP_EQ_OQ), _mm512_sub_pd(zero, inf));
+    y        = _mm512_mask_mov_pd(y, _mm512_cmp_pd_mask(x, inf, _CMP_EQ_OQ), inf);
+    y        = _mm512_mask_mov_pd(y, _mm512_cmp_pd_mask(x, zero, _CMP_NGE_UQ), _mm512_set1_pd(std::numeric_limits<double>::quiet_NaN()));
+
+    return y;
+}
+
+/*!
+ * \brief Compute the sine or the cosine of the argument reduced in
+ * [-Pi/4, Pi/4] from |x| and its octant y
+ * \param x The absolute value of the argument
+ * \param y The (even) octant of the argument
+ * \param cos_mask The mask of the elements using the cosine polynom
+ */
+ETL_INLINE_VEC_512 sincos_reduced512_ps(__m512 x, __m512 y, __mmask16 cos_mask) {
+    /* Extended precision modular arithmetic */
+    x = _mm512_fmadd_ps(y, _mm512_set1_ps(-0.78515625f), x);
+    x = _mm512_fmadd_ps(y, _mm512_set1_ps(-2.4187564849853515625e-4f), x);
+    x = _mm512_fmadd_ps(y, _mm512_set1_ps(-3.77489497744594108e-8f), x);
+
+    auto z = _mm512_mul_ps(x, x);
+
+    auto c = _mm512_set1_ps(2.443315711809948E-005f);
+    c      = _mm512_fmadd_ps(c, z, _mm512_set1_ps(-1.388731625493765E-003f));
+    c      = _mm512_fmadd_ps(c, z, _mm512_set1_ps(4.166664568298827E-002f));
+    c      = _mm512_mul_ps(_mm512_mul_ps(c, z), z);
+    c      = _mm512_add_ps(_mm512_fmadd_ps(z, _mm512_set1_ps(-0.5f), _mm512_set1_ps(1.0f)), c);
+
+    auto s = _mm512_set1_ps(-1.9515295891E-4f);
+    s      = _mm512_fmadd_ps(s, z, _mm512_set1_ps(8.3321608736E-3f));
+    s      = _mm512_fmadd_ps(s, z, _mm512_set1_ps(-1.6666654611E-1f));
+    s      = _mm512_fmadd_ps(_mm512_mul_ps(s, z), x, x);
+
+    return _mm512_mask_blend_ps(cos_mask, s, c);
+}
+
+/*!
+ * \brief Compute the sine of each element
+ *
+ * The maximum absolute error is about 1e-7 for |x| < 8192, the precision
+ * of the argument reduction is lost for larger arguments.
+ */
+ETL_INLINE_VEC_512 sin512_ps(__m512 x) {
+    auto sign_mask = _mm512_set1_epi32(0x80000000);
+
+    auto sign_bit = _mm512_and_epi32(_mm512_castps_si512(x), sign_mask);
+    x             = _mm512_abs_ps(x);
+
+    /* j = (int) (x * 4 / Pi) rounded to the even octant above */
+    auto j = _mm512_cvttps_epi32(_mm512_mul_ps(x, _mm512_set1_ps(1.27323954473516f)));
+    j      = _mm512_and_epi32(_mm512_add_epi32(j, _mm512_set1_epi32(1)), _mm512_set1_epi32(~1));
+
+    auto swap_mask = _mm512_test_epi32_mask(j, _mm512_set1_epi32(4));
+    auto cos_mask  = _mm512_test_epi32_mask(j, _mm512_set1_epi32(2));
+
+    sign_bit = _mm512_mask_xor_epi32(sign_bit, swap_mask, sign_bit, sign_mask);
+
+    auto y = sincos_reduced512_ps(x, _mm512_cvtepi32_ps(j), cos_mask);
+    return _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(y), sign_bit));
+}
+
+/*!
+ * \brief Compute the cosine of each element
+ *
+ * The maximum absolute error is about 1e-7 for |x| < 8192, the precision
+ * of the argument reduction is lost for larger arguments.
+ */
+ETL_INLINE_VEC_512 cos512_ps(__m512 x) {
+    x = _mm512_abs_ps(x);
+
+    /* j = (int) (x * 4 / Pi) rounded to the even octant above */
+    auto j = _mm512_cvttps_epi32(_mm512_mul_ps(x, _mm512_set1_ps(1.27323954473516f)));
+    j      = _mm512_and_epi32(_mm512_add_epi32(j, _mm512_set1_epi32(1)), _mm512_set1_epi32(~1));
+    auto y = _mm512_cvtepi32_ps(j);
+    j      = _mm512_sub_epi32(j, _mm512_set1_epi32(2));
+
+    auto swap_mask = _mm512_testn_epi32_mask(j, _mm512_set1_epi32(4));
+    auto cos_mask  = _mm512_test_epi32_mask(j, _mm512_set1_epi32(2));
+
+    auto r = _mm512_castps_si512(sincos_reduced512_ps(x, y, cos_mask));
+    return _mm512_castsi512_ps(_mm512_mask_xor_epi32(r, swap_mask, r, _mm512_set1_epi32(0x80000000)));
+}
+
+/*!
+ * \brief Compute the sine or the cosine of the argument reduced in
+ * [-Pi/4, Pi/4] from |x| and its octant y
+ * \param x The absolute value of the argument
+ * \param y The (even) octant of the argument
+ * \param cos_mask The mask of the elements using the cosine polynom
+ */
+ETL_INLINE_VEC_512D sincos_reduced512_pd(__m512d x, __m512d y, __mmask8 cos_mask) {
+    /* Extended precision modular arithmetic */
+    x = _mm512_fmadd_pd(y, _mm512_set1_pd(-7.85398125648498535156E-1), x);
+    x = _mm512_fmadd_pd(y, _mm512_set1_pd(-3.77489470793079817668E-8), x);
+    x = _mm512_fmadd_pd(y, _mm512_set1_pd(-2.69515142907905952645E-15), x);
+
+    auto z = _mm512_mul_pd(x, x);
+
+    /* cos(x) = 1 - x^2 / 2 + x^4 C(x^2) */
+    auto c = _mm512_set1_pd(-1.13585365213876817300E-11);
+    c      = _mm512_fmadd_pd(c, z, _mm512_set1_pd(2.08757008419747316778E-9));
+    c      = _mm512_fmadd_pd(c, z, _mm512_set1_pd(-2.75573141792967388112E-7));
+    c      = _mm512_fmadd_pd(c, z, _mm512_set1_pd(2.48015872888517045348E-5));
+    c      = _mm512_fmadd_pd(c, z, _mm512_set1_pd(-1.38888888888730564116E-3));
+    c      = _mm512_fmadd_pd(c, z, _mm512_set1_pd(4.16666666666665929218E-2));
+    c      = _mm512_mul_pd(_mm512_mul_pd(c, z), z);
+    c      = _mm512_add_pd(_mm512_fmadd_pd(z, _mm512_set1_pd(-0.5), _mm512_set1_pd(1.0)), c);
+
+    /* sin(x) = x + x^3 S(x^2) */
+    auto s = _mm512_set1_pd(1.58962301576546568060E-10);
+    s      = _mm512_fmadd_pd(s, z, _mm512_set1_pd(-2.50507477628578072866E-8));
+    s      = _mm512_fmadd_pd(s, z, _mm512_set1_pd(2.75573136213857245213E-6));
+    s      = _mm512_fmadd_pd(s, z, _mm512_set1_pd(-1.98412698295895385996E-4));
+    s      = _mm512_fmadd_pd(s, z, _mm512_set1_pd(8.33333333332211858878E-3));
+    s      = _mm512_fmadd_pd(s, z, _mm512_set1_pd(-1.66666666666666307295E-1));
+    s      = _mm512_fmadd_pd(_mm512_mul_pd(s, z), x, x);
+
+    return _mm512_mask_blend_pd(cos_mask, s, c);
+}
+
+/*!
+ * \brief Compute the sine of each element
+ *
+ * The maximum error is about 1 ulp for |x| < 1e8, the precision of the
+ * argument reduction is lost for larger arguments. Infinite and NaN
+ * arguments give NaN.
+ */
+ETL_INLINE_VEC_512D sin512_pd(__m512d x) {
+    auto sign_mask = _mm512_set1_epi64(0x8000000000000000LL);
+
+    auto sign_bit = _mm512_and_epi64(_mm512_castpd_si512(x), sign_mask);
+    x             = _mm512_abs_pd(x);
+
+    /* j = (int) (x * 4 / Pi) rounded to the even octant above */
+    auto j = _mm512_cvtepi32_epi64(_mm512_cvttpd_epi32(_mm512_mul_pd(x, _mm512_set1_pd(1.27323954473516268615))));
+    j      = _mm512_and_epi64(_mm512_add_epi64(j, _mm512_set1_epi64(1)), _mm512_set1_epi64(~1LL));
+
+    auto swap_mask = _mm512_test_epi64_mask(j, _mm512_set1_epi64(4));
+    auto cos_mask  = _mm512_test_epi64_mask(j, _mm512_set1_epi64(2));
+
+    sign_bit = _mm512_mask_xor_epi64(sign_bit, swap_mask, sign_bit, sign_mask);
+
+    auto y = sincos_reduced512_pd(x, _mm512_cvtepi32_pd(_mm512_cvtepi64_epi32(j)), cos_mask);
+    y      = _mm512_castsi512_pd(_mm512_xor_epi64(_mm512_castpd_si512(y), sign_bit));
+
+    // infinite arg will be NaN
+    return _mm512_mask_mov_pd(y, _mm512_cmp_pd_mask(x, _mm512_set1_pd(std::numeric_limits<double>::infinity()), _CMP_EQ_OQ),
+                              _mm512_set1_pd(std::numeric_limits<double>::quiet_NaN()));
+}
+
+/*!
+ * \brief Compute the cosine of each element
+ *
+ * The maximum error is about 1 ulp for |x| < 1e8, the precision of the
+ * argument reduction is lost for larger arguments. Infinite and NaN
+ * arguments give NaN.
+ */
+ETL_INLINE_VEC_512D cos512_pd(__m512d x) {
+    x = _mm512_abs_pd(x);
+
+    /* j = (int) (x * 4 / Pi) rounded to the even octant above */
+    auto j = _mm512_cvtepi32_epi64(_mm512_cvttpd_epi32(_mm512_mul_pd(x, _mm512_set1_pd(1.27323954473516268615))));
+    j      = _mm512_and_epi64(_mm512_add_epi64(j, _mm512_set1_epi64(1)), _mm512_set1_epi64(~1LL));
+    auto y = _mm512_cvtepi32_pd(_mm512_cvtepi64_epi32(j));
+    j      = _mm512_sub_epi64(j, _mm512_set1_epi64(2));
+
+    auto swap_mask = _mm512_testn_epi64_mask(j, _mm512_set1_epi64(4));
+    auto cos_mask  = _mm512_test_epi64_mask(j, _mm512_set1_epi64(2));
+
+    auto r = _mm512_castpd_si512(sincos_reduced512_pd(x, y, cos_mask));
+    r      = _mm512_mask_xor_epi64(r, swap_mask, r, _mm512_set1_epi64(0x8000000000000000LL));
+
+    // infinite arg will be NaN
+    return _mm512_mask_mov_pd(_mm512_castsi512_pd(r), _mm512_cmp_pd_mask(x, _mm512_set1_pd(std::numeric_limits<double>::infinity()), _CMP_EQ_OQ),
+                              _mm512_set1_pd(std::numeric_limits<double>::quiet_NaN()));
+}
+
+} //end of namespace etl
+
+#endif //__AVX512F__
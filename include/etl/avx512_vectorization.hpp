@@ -10,14 +10,14 @@
  * \brief Contains AVX-512 vectorized functions for the vectorized assignment of expressions
  */
 
-//TODO Implementation of AVX-512 complex multiplication and division
-
 #pragma once
 
-#ifdef __AVX512F__
+#if defined(__AVX512F__) || defined(ETL_TARGET_AVX512)
 
 #include <immintrin.h>
 
+#include "etl/avx512_exp.hpp"
+
 #ifdef VECT_DEBUG
 #include <iostream>
 #endif
@@ -25,7 +25,7 @@
 #define ETL_INLINE_VEC_VOID ETL_STATIC_INLINE(void)
 #define ETL_INLINE_VEC_512 ETL_STATIC_INLINE(__m512)
 #define ETL_INLINE_VEC_512D ETL_STATIC_INLINE(__m512d)
-#define ETL_OUT_VEC_2512ETL_OUT_INLINE(__m512)
+#define ETL_OUT_VEC_512 ETL_OUT_INLINE(__m512)
 #define ETL_OUT_VEC_512D ETL_OUT_INLINE(__m512d)
 
 namespace etl {
@@ -318,6 +318,9 @@ struct avx512_vec {
         _mm512_stream_pd(reinterpret_cast<double*>(memory), value);
     }
 
+    template<typename T>
+    ETL_TMP_INLINE(typename avx512_intrinsic_traits<T>::intrinsic_type) zero();
+
     /*!
      * \brief Load a packed vector from the given aligned memory location
      */
@@ -416,6 +419,38 @@ struct avx512_vec {
         return _mm512_set1_ps(value);
     }
 
+    /*!
+     * \brief Fill a packed vector  by replicating a value
+     */
+    ETL_INLINE_VEC_512 set(std::complex<float> value) {
+        std::complex<float> tmp[]{value, value, value, value, value, value, value, value};
+        return loadu(tmp);
+    }
+
+    /*!
+     * \brief Fill a packed vector  by replicating a value
+     */
+    ETL_INLINE_VEC_512D set(std::complex<double> value) {
+        std::complex<double> tmp[]{value, value, value, value};
+        return loadu(tmp);
+    }
+
+    /*!
+     * \brief Fill a packed vector  by replicating a value
+     */
+    ETL_INLINE_VEC_512 set(etl::complex<float> value) {
+        etl::complex<float> tmp[]{value, value, value, value, value, value, value, value};
+        return loadu(tmp);
+    }
+
+    /*!
+     * \brief Fill a packed vector  by replicating a value
+     */
+    ETL_INLINE_VEC_512D set(etl::complex<double> value) {
+        etl::complex<double> tmp[]{value, value, value, value};
+        return loadu(tmp);
+    }
+
     /*!
      * \brief Add the two given values and return the result.
      */
@@ -439,7 +474,8 @@ struct avx512_vec {
     }
 
     ETL_INLINE_VEC_512D minus(__m512d x) {
-        return _mm512_xor_pd(x, _mm512_set1_pd(-0.f));
+        // _mm512_xor_pd needs AVX512DQ
+        return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(x), _mm512_castpd_si512(_mm512_set1_pd(-0.0))));
     }
 
     /*!
@@ -465,54 +501,77 @@ struct avx512_vec {
     }
 
     ETL_INLINE_VEC_512 minus(__m512 x) {
-        return _mm512_xor_ps(x, _mm512_set1_ps(-0.f));
+        return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(x), _mm512_castps_si512(_mm512_set1_ps(-0.f))));
     }
 
     template <bool Complex = false>
-    ETL_INLINE_VEC_512 mul(__m512 lhs, __m512 rhs) {
+    ETL_TMP_INLINE(__m512) mul(__m512 lhs, __m512 rhs) {
         return _mm512_mul_ps(lhs, rhs);
     }
 
-    template <>
-    ETL_INLINE_VEC_512 mul<true>(__m512 lhs, __m512 rhs) {
-        cpp_unreachable("Not yet implemented");
-        return lhs;
-    }
-
     template <bool Complex = false>
-    ETL_INLINE_VEC_512D mul(__m512d lhs, __m512d rhs) {
+    ETL_TMP_INLINE(__m512d) mul(__m512d lhs, __m512d rhs) {
         return _mm512_mul_pd(lhs, rhs);
     }
 
-    template <>
-    ETL_INLINE_VEC_512D mul<true>(__m512d lhs, __m512d rhs) {
-        cpp_unreachable("Not yet implemented");
-        return lhs;
-    }
+    template <bool Complex = false>
+    ETL_TMP_INLINE(__m512) fmadd(__m512 a, __m512 b, __m512 c);
 
     template <bool Complex = false>
-    ETL_INLINE_VEC_512 div(__m512 lhs, __m512 rhs) {
-        return _mm512_div_ps(lhs, rhs);
-    }
+    ETL_TMP_INLINE(__m512d) fmadd(__m512d a, __m512d b, __m512d c);
 
-    template <>
-    ETL_INLINE_VEC_512 div<true>(__m512 lhs, __m512 rhs) {
-        cpp_unreachable("Not yet implemented");
-        return lhs;
+    template <bool Complex = false>
+    ETL_TMP_INLINE(__m512) div(__m512 lhs, __m512 rhs) {
+        return _mm512_div_ps(lhs, rhs);
     }
 
     template <bool Complex = false>
-    ETL_INLINE_VEC_512D div(__m512d lhs, __m512d rhs) {
+    ETL_TMP_INLINE(__m512d) div(__m512d lhs, __m512d rhs) {
         return _mm512_div_pd(lhs, rhs);
     }
 
-    template <>
-    ETL_INLINE_VEC_512D div<true>(__m512d lhs, __m512d rhs) {
-        cpp_unreachable("Not yet implemented");
-        return lhs;
+    ETL_INLINE_VEC_512D cos(__m512d x) {
+        return etl::cos512_pd(x);
+    }
+
+    ETL_INLINE_VEC_512 cos(__m512 x) {
+        return etl::cos512_ps(x);
+    }
+
+    ETL_INLINE_VEC_512D sin(__m512d x) {
+        return etl::sin512_pd(x);
+    }
+
+    ETL_INLINE_VEC_512 sin(__m512 x) {
+        return etl::sin512_ps(x);
+    }
+
+//The Intel C++ Compiler (icc) has more intrinsics.
+//ETL uses them when compiled with icc
+
+#ifndef __INTEL_COMPILER
+
+    //Exponential
+
+    ETL_INLINE_VEC_512D exp(__m512d x) {
+        return etl::exp512_pd(x);
+    }
+
+    ETL_INLINE_VEC_512 exp(__m512 x) {
+        return etl::exp512_ps(x);
+    }
+
+    //Logarithm
+
+    ETL_INLINE_VEC_512D log(__m512d x) {
+        return etl::log512_pd(x);
+    }
+
+    ETL_INLINE_VEC_512 log(__m512 x) {
+        return etl::log512_ps(x);
     }
 
-#ifdef __INTEL_COMPILER
+#else //__INTEL_COMPILER
 
     //Exponential
 
@@ -534,6 +593,8 @@ struct avx512_vec {
         return _mm512_log_ps(x);
     }
 
+#endif //__INTEL_COMPILER
+
     //Min
 
     ETL_INLINE_VEC_512D min(__m512d lhs, __m512d rhs) {
@@ -554,31 +615,354 @@ struct avx512_vec {
         return _mm512_max_ps(lhs, rhs);
     }
 
-#endif //__INTEL_COMPILER
+    //Absolute value
+
+    ETL_INLINE_VEC_512D abs(__m512d x) {
+        return _mm512_abs_pd(x);
+    }
+
+    ETL_INLINE_VEC_512 abs(__m512 x) {
+        return _mm512_abs_ps(x);
+    }
+
+    //Comparison
+
+    /*!
+     * \brief Compare the two given values
+     * \return a mask set for the elements where lhs < rhs
+     */
+    ETL_STATIC_INLINE(__mmask8) lt(__m512d lhs, __m512d rhs) {
+        return _mm512_cmp_pd_mask(lhs, rhs, _CMP_LT_OQ);
+    }
+
+    /*!
+     * \brief Compare the two given values
+     * \return a mask set for the elements where lhs < rhs
+     */
+    ETL_STATIC_INLINE(__mmask16) lt(__m512 lhs, __m512 rhs) {
+        return _mm512_cmp_ps_mask(lhs, rhs, _CMP_LT_OQ);
+    }
+
+    /*!
+     * \brief Select the elements of lhs where the mask is set and the elements of rhs elsewhere
+     */
+    ETL_INLINE_VEC_512D select(__mmask8 mask, __m512d lhs, __m512d rhs) {
+        return _mm512_mask_blend_pd(mask, rhs, lhs);
+    }
+
+    /*!
+     * \brief Select the elements of lhs where the mask is set and the elements of rhs elsewhere
+     */
+    ETL_INLINE_VEC_512 select(__mmask16 mask, __m512 lhs, __m512 rhs) {
+        return _mm512_mask_blend_ps(mask, rhs, lhs);
+    }
+
+    /*!
+     * \brief Perform an horizontal sum of the given vector.
+     * \param in The input vector type
+     * \return the horizontal sum of the vector
+     */
+    template <typename T = float>
+    static inline T ETL_INLINE_ATTR_VEC hadd(__m512 in) {
+        return _mm512_reduce_add_ps(in);
+    }
+
+    /*!
+     * \brief Perform an horizontal sum of the given vector.
+     * \param in The input vector type
+     * \return the horizontal sum of the vector
+     */
+    template <typename T = double>
+    static inline T ETL_INLINE_ATTR_VEC hadd(__m512d in) {
+        return _mm512_reduce_add_pd(in);
+    }
+
+    /*!
+     * \brief Transpose a 16x16 block of single precision values
+     * \param in The first element of the block
+     * \param in_stride The distance between two rows of the block
+     * \param out The first element of the transposed block
+     * \param out_stride The distance between two rows of the transposed block
+     */
+    ETL_INLINE_VEC_VOID transpose_block(const float* in, std::size_t in_stride, float* out, std::size_t out_stride) {
+        __m512 r[16];
+        __m512 t[16];
+
+        for (std::size_t i = 0; i < 16; ++i) {
+            r[i] = _mm512_loadu_ps(in + i * in_stride);
+        }
+
+        // Interleave the pairs of rows
+
+        for (std::size_t i = 0; i < 8; ++i) {
+            t[2 * i + 0] = _mm512_unpacklo_ps(r[2 * i], r[2 * i + 1]);
+            t[2 * i + 1] = _mm512_unpackhi_ps(r[2 * i], r[2 * i + 1]);
+        }
+
+        // Transpose the 4x4 blocks of each lane
+
+        for (std::size_t i = 0; i < 4; ++i) {
+            r[4 * i + 0] = _mm512_shuffle_ps(t[4 * i + 0], t[4 * i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+            r[4 * i + 1] = _mm512_shuffle_ps(t[4 * i + 0], t[4 * i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+            r[4 * i + 2] = _mm512_shuffle_ps(t[4 * i + 1], t[4 * i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+            r[4 * i + 3] = _mm512_shuffle_ps(t[4 * i + 1], t[4 * i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        // Exchange the lanes, in two steps
+
+        for (std::size_t i = 0; i < 4; ++i) {
+            t[i + 0]  = _mm512_shuffle_f32x4(r[i + 0], r[i + 4], 0x88);
+            t[i + 4]  = _mm512_shuffle_f32x4(r[i + 0], r[i + 4], 0xDD);
+            t[i + 8]  = _mm512_shuffle_f32x4(r[i + 8], r[i + 12], 0x88);
+            t[i + 12] = _mm512_shuffle_f32x4(r[i + 8], r[i + 12], 0xDD);
+        }
+
+        for (std::size_t i = 0; i < 8; ++i) {
+            _mm512_storeu_ps(out + (i + 0) * out_stride, _mm512_shuffle_f32x4(t[i], t[i + 8], 0x88));
+            _mm512_storeu_ps(out + (i + 8) * out_stride, _mm512_shuffle_f32x4(t[i], t[i + 8], 0xDD));
+        }
+    }
+
+    /*!
+     * \brief Transpose a 8x8 block of double precision values
+     * \param in The first element of the block
+     * \param in_stride The distance between two rows of the block
+     * \param out The first element of the transposed block
+     * \param out_stride The distance between two rows of the transposed block
+     */
+    ETL_INLINE_VEC_VOID transpose_block(const double* in, std::size_t in_stride, double* out, std::size_t out_stride) {
+        __m512d r[8];
+        __m512d t[8];
+
+        for (std::size_t i = 0; i < 8; ++i) {
+            r[i] = _mm512_loadu_pd(in + i * in_stride);
+        }
+
+        // Interleave the pairs of rows
+
+        for (std::size_t i = 0; i < 4; ++i) {
+            t[2 * i + 0] = _mm512_unpacklo_pd(r[2 * i], r[2 * i + 1]);
+            t[2 * i + 1] = _mm512_unpackhi_pd(r[2 * i], r[2 * i + 1]);
+        }
+
+        // Exchange the lanes, in two steps
+
+        for (std::size_t i = 0; i < 2; ++i) {
+            r[4 * i + 0] = _mm512_shuffle_f64x2(t[4 * i + 0], t[4 * i + 2], 0x88);
+            r[4 * i + 1] = _mm512_shuffle_f64x2(t[4 * i + 1], t[4 * i + 3], 0x88);
+            r[4 * i + 2] = _mm512_shuffle_f64x2(t[4 * i + 0], t[4 * i + 2], 0xDD);
+            r[4 * i + 3] = _mm512_shuffle_f64x2(t[4 * i + 1], t[4 * i + 3], 0xDD);
+        }
+
+        for (std::size_t i = 0; i < 4; ++i) {
+            _mm512_storeu_pd(out + (i + 0) * out_stride, _mm512_shuffle_f64x2(r[i], r[i + 4], 0x88));
+            _mm512_storeu_pd(out + (i + 4) * out_stride, _mm512_shuffle_f64x2(r[i], r[i + 4], 0xDD));
+        }
+    }
 };
 
+/*!
+ * \brief Perform an horizontal sum of the given vector.
+ * \param in The input vector type
+ * \return the horizontal sum of the vector
+ */
+template <>
+inline std::complex<float> ETL_INLINE_ATTR_VEC avx512_vec::hadd<std::complex<float>>(__m512 in) {
+    //The even elements are the real parts and the odd elements the imaginary parts
+    const __m512 real = _mm512_maskz_mov_ps(0x5555, in);
+    const __m512 imag = _mm512_maskz_mov_ps(0xAAAA, in);
+    return {_mm512_reduce_add_ps(real), _mm512_reduce_add_ps(imag)};
+}
+
+/*!
+ * \brief Perform an horizontal sum of the given vector.
+ * \param in The input vector type
+ * \return the horizontal sum of the vector
+ */
+template <>
+inline std::complex<double> ETL_INLINE_ATTR_VEC avx512_vec::hadd<std::complex<double>>(__m512d in) {
+    //The even elements are the real parts and the odd elements the imaginary parts
+    const __m512d real = _mm512_maskz_mov_pd(0x55, in);
+    const __m512d imag = _mm512_maskz_mov_pd(0xAA, in);
+    return {_mm512_reduce_add_pd(real), _mm512_reduce_add_pd(imag)};
+}
+
+/*!
+ * \brief Perform an horizontal sum of the given vector.
+ * \param in The input vector type
+ * \return the horizontal sum of the vector
+ */
+template <>
+inline etl::complex<float> ETL_INLINE_ATTR_VEC avx512_vec::hadd<etl::complex<float>>(__m512 in) {
+    //The even elements are the real parts and the odd elements the imaginary parts
+    const __m512 real = _mm512_maskz_mov_ps(0x5555, in);
+    const __m512 imag = _mm512_maskz_mov_ps(0xAAAA, in);
+    return {_mm512_reduce_add_ps(real), _mm512_reduce_add_ps(imag)};
+}
+
+/*!
+ * \brief Perform an horizontal sum of the given vector.
+ * \param in The input vector type
+ * \return the horizontal sum of the vector
+ */
+template <>
+inline etl::complex<double> ETL_INLINE_ATTR_VEC avx512_vec::hadd<etl::complex<double>>(__m512d in) {
+    //The even elements are the real parts and the odd elements the imaginary parts
+    const __m512d real = _mm512_maskz_mov_pd(0x55, in);
+    const __m512d imag = _mm512_maskz_mov_pd(0xAA, in);
+    return {_mm512_reduce_add_pd(real), _mm512_reduce_add_pd(imag)};
+}
+
 template <>
 ETL_OUT_VEC_512 avx512_vec::mul<true>(__m512 lhs, __m512 rhs) {
-    cpp_unreachable("Not yet implemented");
-    return lhs;
+    //lhs = [x1.real, x1.img, x2.real, x2.img, ...]
+    //rhs = [y1.real, y1.img, y2.real, y2.img, ...]
+
+    //zmm1 = [y1.real, y1.real, y2.real, y2.real, ...]
+    __m512 zmm1 = _mm512_moveldup_ps(rhs);
+
+    //zmm2 = [x1.img, x1.real, x2.img, x2.real, ...]
+    __m512 zmm2 = _mm512_permute_ps(lhs, 0b10110001);
+
+    //zmm3 = [y1.imag, y1.imag, y2.imag, y2.imag, ...]
+    __m512 zmm3 = _mm512_movehdup_ps(rhs);
+
+    //zmm4 = zmm2 * zmm3
+    __m512 zmm4 = _mm512_mul_ps(zmm2, zmm3);
+
+    //result = [(lhs * zmm1) -+ zmm4];
+    return _mm512_fmaddsub_ps(lhs, zmm1, zmm4);
 }
 
 template <>
 ETL_OUT_VEC_512D avx512_vec::mul<true>(__m512d lhs, __m512d rhs) {
-    cpp_unreachable("Not yet implemented");
-    return lhs;
+    //lhs = [x1.real, x1.img, x2.real, x2.img, ...]
+    //rhs = [y1.real, y1.img, y2.real, y2.img, ...]
+
+    //zmm1 = [y1.real, y1.real, y2.real, y2.real, ...]
+    __m512d zmm1 = _mm512_movedup_pd(rhs);
+
+    //zmm2 = [x1.img, x1.real, x2.img, x2.real, ...]
+    __m512d zmm2 = _mm512_permute_pd(lhs, 0b01010101);
+
+    //zmm3 = [y1.imag, y1.imag, y2.imag, y2.imag, ...]
+    __m512d zmm3 = _mm512_permute_pd(rhs, 0b11111111);
+
+    //zmm4 = zmm2 * zmm3
+    __m512d zmm4 = _mm512_mul_pd(zmm2, zmm3);
+
+    //result = [(lhs * zmm1) -+ zmm4];
+    return _mm512_fmaddsub_pd(lhs, zmm1, zmm4);
+}
+
+template <>
+ETL_OUT_VEC_512 avx512_vec::fmadd<false>(__m512 a, __m512 b, __m512 c) {
+    return _mm512_fmadd_ps(a, b, c);
+}
+
+template <>
+ETL_OUT_VEC_512D avx512_vec::fmadd<false>(__m512d a, __m512d b, __m512d c) {
+    return _mm512_fmadd_pd(a, b, c);
+}
+
+template <>
+ETL_OUT_VEC_512 avx512_vec::fmadd<true>(__m512 a, __m512 b, __m512 c) {
+    return add(mul<true>(a, b), c);
+}
+
+template <>
+ETL_OUT_VEC_512D avx512_vec::fmadd<true>(__m512d a, __m512d b, __m512d c) {
+    return add(mul<true>(a, b), c);
 }
 
 template <>
 ETL_OUT_VEC_512 avx512_vec::div<true>(__m512 lhs, __m512 rhs) {
-    cpp_unreachable("Not yet implemented");
-    return lhs;
+    //lhs = [x1.real, x1.img, x2.real, x2.img ...]
+    //rhs = [y1.real, y1.img, y2.real, y2.img ...]
+
+    //zmm0 = [y1.real, y1.real, y2.real, y2.real, ...]
+    __m512 zmm0 = _mm512_moveldup_ps(rhs);
+
+    //zmm1 = [y1.imag, y1.imag, y2.imag, y2.imag, ...]
+    __m512 zmm1 = _mm512_movehdup_ps(rhs);
+
+    //zmm2 = [x1.img, x1.real, x2.img, x2.real, ...]
+    __m512 zmm2 = _mm512_permute_ps(lhs, 0b10110001);
+
+    //zmm4 = [x.img * y.img, x.real * y.img]
+    __m512 zmm4 = _mm512_mul_ps(zmm2, zmm1);
+
+    //zmm5 = subadd((lhs * zmm0), zmm4)
+    __m512 zmm5 = _mm512_fmsubadd_ps(lhs, zmm0, zmm4);
+
+    //zmm3 = [y.imag^2, y.imag^2]
+    __m512 zmm3 = _mm512_mul_ps(zmm1, zmm1);
+
+    //zmm0 = (zmm0 * zmm0 + zmm3)
+    zmm0 = _mm512_fmadd_ps(zmm0, zmm0, zmm3);
+
+    //result = zmm5 / zmm0
+    return _mm512_div_ps(zmm5, zmm0);
 }
 
 template <>
 ETL_OUT_VEC_512D avx512_vec::div<true>(__m512d lhs, __m512d rhs) {
-    cpp_unreachable("Not yet implemented");
-    return lhs;
+    //lhs = [x1.real, x1.img, x2.real, x2.img, ...]
+    //rhs = [y1.real, y1.img, y2.real, y2.img, ...]
+
+    //zmm0 = [y1.real, y1.real, y2.real, y2.real, ...]
+    __m512d zmm0 = _mm512_movedup_pd(rhs);
+
+    //zmm1 = [y1.imag, y1.imag, y2.imag, y2.imag, ...]
+    __m512d zmm1 = _mm512_permute_pd(rhs, 0b11111111);
+
+    //zmm2 = [x1.img, x1.real, x2.img, x2.real, ...]
+    __m512d zmm2 = _mm512_permute_pd(lhs, 0b01010101);
+
+    //zmm4 = [x.img * y.img, x.real * y.img]
+    __m512d zmm4 = _mm512_mul_pd(zmm2, zmm1);
+
+    //zmm5 = subadd((lhs * zmm0), zmm4)
+    __m512d zmm5 = _mm512_fmsubadd_pd(lhs, zmm0, zmm4);
+
+    //zmm3 = [y.imag^2, y.imag^2]
+    __m512d zmm3 = _mm512_mul_pd(zmm1, zmm1);
+
+    //zmm0 = (zmm0 * zmm0 + zmm3)
+    zmm0 = _mm512_fmadd_pd(zmm0, zmm0, zmm3);
+
+    //result = zmm5 / zmm0
+    return _mm512_div_pd(zmm5, zmm0);
+}
+
+template<>
+ETL_OUT_VEC_512 avx512_vec::zero<float>() {
+    return _mm512_setzero_ps();
+}
+
+template<>
+ETL_OUT_VEC_512D avx512_vec::zero<double>() {
+    return _mm512_setzero_pd();
+}
+
+template<>
+ETL_OUT_VEC_512 avx512_vec::zero<etl::complex<float>>() {
+    return _mm512_setzero_ps();
+}
+
+template<>
+ETL_OUT_VEC_512D avx512_vec::zero<etl::complex<double>>() {
+    return _mm512_setzero_pd();
+}
+
+template<>
+ETL_OUT_VEC_512 avx512_vec::zero<std::complex<float>>() {
+    return _mm512_setzero_ps();
+}
+
+template<>
+ETL_OUT_VEC_512D avx512_vec::zero<std::complex<double>>() {
+    return _mm512_setzero_pd();
 }
 
 } //end of namespace etl
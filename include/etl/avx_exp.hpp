@@ -41,7 +41,9 @@
 
 #pragma once
 
-#ifdef __AVX__
+#if defined(__AVX__) || defined(ETL_TARGET_AVX)
+
+#include <limits>
 
 #define ETL_INLINE_VEC_256 ETL_STATIC_INLINE(__m256)
 #define ETL_INLINE_VEC_256D ETL_STATIC_INLINE(__m256d)
@@ -134,6 +136,7 @@ typedef union imm_xmm_union {
 
 AVX2_BITOP_USING_SSE2(slli_epi32)
 AVX2_BITOP_USING_SSE2(srli_epi32)
+AVX2_BITOP_USING_SSE2(srai_epi32)
 
 #define AVX2_INTOP_USING_SSE2(fn)                                         \
     static inline __m256i _mm256_##fn(__m256i x, __m256i y) {             \
@@ -157,13 +160,51 @@ AVX2_INTOP_USING_SSE2(add_epi32)
 
 #endif /* __AVX2__ */
 
+/*!
+ * \brief Compute a * b + c, fused if possible
+ */
+ETL_INLINE_VEC_256D madd256_pd(__m256d a, __m256d b, __m256d c) {
+#ifdef __FMA__
+    return _mm256_fmadd_pd(a, b, c);
+#else
+    return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+}
+
+/*!
+ * \brief Compute 2^n for integral values of n in [-1023, 1024]
+ */
+ETL_INLINE_VEC_256D pow2n256_pd(__m256d n) {
+    __m256d a = _mm256_add_pd(n, _mm256_set1_pd(1023.0 + 4503599627370496.0));
+    __m256i b = _mm256_castpd_si256(a);
+
+#ifdef __AVX2__
+    __m256i c = _mm256_slli_epi64(b, 52);
+#else
+    auto b1 = _mm_slli_epi64(_mm256_castsi256_si128(b), 52);
+    auto b2 = _mm_slli_epi64(_mm256_extractf128_si256(b, 1), 52);
+
+    __m256i c = _mm256_insertf128_si256(_mm256_castsi128_si256(b1), b2, 1);
+#endif
+
+    return _mm256_castsi256_pd(c);
+}
+
+/*!
+ * \brief Compute the natural logarithm of each element
+ *
+ * This is the log function of Cephes. Denormals are supported, log(0) is
+ * -inf, log(inf) is inf and negative or NaN arguments give NaN.
+ */
 ETL_INLINE_VEC_256 log256_ps(__m256 x) {
     __m256i imm0;
-    __m256 one = *(__m256*)_ps256_1;
-
-    __m256 invalid_mask = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LE_OS);
+    __m256 one  = *(__m256*)_ps256_1;
+    __m256 zero = _mm256_setzero_ps();
+    __m256 x0   = x;
 
-    x = _mm256_max_ps(x, *(__m256*)_ps256_min_norm_pos); /* cut off denormalized stuff */
+    /* scale the denormals into the normal range */
+    __m256 denormal = _mm256_cmp_ps(x, *(__m256*)_ps256_min_norm_pos, _CMP_LT_OS);
+    x               = _mm256_blendv_ps(x, _mm256_mul_ps(x, _mm256_set1_ps(33554432.0f)), denormal);
 
     // can be done with AVX2
     imm0 = _mm256_srli_epi32(_mm256_castps_si256(x), 23);
@@ -177,6 +218,7 @@ ETL_INLINE_VEC_256 log256_ps(__m256 x) {
     __m256 e = _mm256_cvtepi32_ps(imm0);
 
     e = _mm256_add_ps(e, one);
+    e = _mm256_sub_ps(e, _mm256_and_ps(denormal, _mm256_set1_ps(25.0f)));
 
     __m256 mask = _mm256_cmp_ps(x, *(__m256*)_ps256_cephes_SQRTHF, _CMP_LT_OS);
     __m256 tmp  = _mm256_and_ps(x, mask);
@@ -216,12 +258,82 @@ ETL_INLINE_VEC_256 log256_ps(__m256 x) {
     tmp = _mm256_mul_ps(e, *(__m256*)_ps256_cephes_log_q2);
     x   = _mm256_add_ps(x, y);
     x   = _mm256_add_ps(x, tmp);
-    x   = _mm256_or_ps(x, invalid_mask); // negative arg will be NAN
-    return x;
+
+    /* special values */
+    __m256 inf = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+    x          = _mm256_blendv_ps(x, _mm256_sub_ps(zero, inf), _mm256_cmp_ps(x0, zero, _CMP_EQ_OQ));
+    x          = _mm256_blendv_ps(x, inf, _mm256_cmp_ps(x0, inf, _CMP_EQ_OQ));
+    return _mm256_or_ps(x, _mm256_cmp_ps(x0, zero, _CMP_NGE_UQ)); // negative or NaN arg will be NaN
+}
+
+/*!
+ * \brief Compute the natural logarithm of each element
+ *
+ * The argument is decomposed into m * 2^e with m in [sqrt(0.5), sqrt(2))
+ * and log(m) is computed with the rational approximation of Cephes. The
+ * maximum error is about 1 ulp. Denormals are supported, log(0) is -inf
+ * and negative arguments give NaN.
+ */
+ETL_INLINE_VEC_256D log256_pd(__m256d x) {
+    auto one   = _mm256_set1_pd(1.0);
+    auto zero  = _mm256_setzero_pd();
+    auto magic = _mm256_set1_pd(4503599627370496.0);
+
+    /* scale the denormals into the normal range */
+    auto denormal = _mm256_cmp_pd(x, _mm256_set1_pd(2.2250738585072014e-308), _CMP_LT_OQ);
+    auto v        = _mm256_blendv_pd(x, _mm256_mul_pd(x, _mm256_set1_pd(18014398509481984.0)), denormal);
+    auto bias     = _mm256_blendv_pd(_mm256_set1_pd(1022.0), _mm256_set1_pd(1022.0 + 54.0), denormal);
+
+    /* extract the exponent and the mantissa in [0.5, 1) */
+#ifdef __AVX2__
+    __m256i e_bits = _mm256_srli_epi64(_mm256_castpd_si256(v), 52);
+#else
+    auto e1 = _mm_srli_epi64(_mm256_castsi256_si128(_mm256_castpd_si256(v)), 52);
+    auto e2 = _mm_srli_epi64(_mm256_extractf128_si256(_mm256_castpd_si256(v), 1), 52);
+
+    __m256i e_bits = _mm256_insertf128_si256(_mm256_castsi128_si256(e1), e2, 1);
+#endif
+
+    auto e = _mm256_sub_pd(_mm256_sub_pd(_mm256_or_pd(_mm256_castsi256_pd(e_bits), magic), magic), bias);
+
+    auto m = _mm256_and_pd(v, _mm256_castsi256_pd(_mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)));
+    m      = _mm256_or_pd(m, _mm256_set1_pd(0.5));
+
+    /* m in [sqrt(0.5), sqrt(2)) */
+    auto small = _mm256_cmp_pd(m, _mm256_set1_pd(0.70710678118654752440), _CMP_LT_OQ);
+    e          = _mm256_sub_pd(e, _mm256_and_pd(small, one));
+    m          = _mm256_sub_pd(_mm256_add_pd(m, _mm256_and_pd(small, m)), one);
+
+    auto z = _mm256_mul_pd(m, m);
+
+    auto p = _mm256_set1_pd(1.01875663804580931796E-4);
+    p      = madd256_pd(p, m, _mm256_set1_pd(4.97494994976747001425E-1));
+    p      = madd256_pd(p, m, _mm256_set1_pd(4.70579119878881725854E0));
+    p      = madd256_pd(p, m, _mm256_set1_pd(1.44989225341610930846E1));
+    p      = madd256_pd(p, m, _mm256_set1_pd(1.79368678507819816313E1));
+    p      = madd256_pd(p, m, _mm256_set1_pd(7.70838733755885391666E0));
+
+    auto q = _mm256_add_pd(m, _mm256_set1_pd(1.12873587189167450590E1));
+    q      = madd256_pd(q, m, _mm256_set1_pd(4.52279145837532221105E1));
+    q      = madd256_pd(q, m, _mm256_set1_pd(8.29875266912776603211E1));
+    q      = madd256_pd(q, m, _mm256_set1_pd(7.11544750618563894466E1));
+    q      = madd256_pd(q, m, _mm256_set1_pd(2.31251620126765340583E1));
+
+    auto y = _mm256_mul_pd(m, _mm256_div_pd(_mm256_mul_pd(z, p), q));
+    y      = madd256_pd(e, _mm256_set1_pd(-2.121944400546905827679e-4), y);
+    y      = madd256_pd(z, _mm256_set1_pd(-0.5), y);
+    y      = _mm256_add_pd(m, y);
+    y      = madd256_pd(e, _mm256_set1_pd(0.693359375), y);
+
+    /* special values */
+    auto inf = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+    y        = _mm256_blendv_pd(y, _mm256_sub_pd(zero, inf), _mm256_cmp_pd(x, zero, _CMP_EQ_OQ));
+    y        = _mm256_blendv_pd(y, inf, _mm256_cmp_pd(x, inf, _CMP_EQ_OQ));
+    return _mm256_or_pd(y, _mm256_cmp_pd(x, zero, _CMP_NGE_UQ)); // negative or NaN arg will be NaN
 }
 
-ETL_PS_256_CONST(exp_hi, 88.3762626647949f);
-ETL_PS_256_CONST(exp_lo, -88.3762626647949f);
+ETL_PS_256_CONST(exp_hi, 89.0f);
+ETL_PS_256_CONST(exp_lo, -104.0f);
 
 ETL_PS_256_CONST(cephes_LOG2EF, 1.44269504088896341);
 ETL_PS_256_CONST(cephes_exp_C1, 0.693359375);
@@ -234,7 +346,18 @@ ETL_PS_256_CONST(cephes_exp_p3, 4.1665795894E-2);
 ETL_PS_256_CONST(cephes_exp_p4, 1.6666665459E-1);
 ETL_PS_256_CONST(cephes_exp_p5, 5.0000001201E-1);
 
+/*!
+ * \brief Compute the exponential of each element
+ *
+ * The argument is reduced to r in [-ln(2)/2, ln(2)/2] and e^r is computed
+ * with its Taylor series. The maximum error is about 1.5 ulp. Overflow
+ * gives +inf and the denormal results are correctly computed.
+ */
 ETL_INLINE_VEC_256D exp256_pd(__m256d x) {
+    // The NaN inputs are propagated by min/max when passed last
+    x = _mm256_min_pd(_mm256_set1_pd(710.0), x);
+    x = _mm256_max_pd(_mm256_set1_pd(-746.0), x);
+
     auto t1 = _mm256_mul_pd(x, _mm256_set1_pd(1.44269504088896340736));
     auto r = _mm256_round_pd(t1, 8);
 
@@ -284,41 +407,29 @@ ETL_INLINE_VEC_256D exp256_pd(__m256d x) {
     auto z = _mm256_add_pd(_mm256_mul_pd(pt10, x8), pt11);
 #endif
 
-    __m256d a = r + _mm256_set1_pd(1023.0 + 4503599627370496.0);
-    __m256i b = _mm256_castpd_si256(a);
-
-#ifdef __AVX2__
-    __m256i c = _mm256_slli_epi64(b, 52);
-#else
-    // This sucks ass, so much...
+    z = _mm256_add_pd(z, _mm256_set1_pd(1.0));
 
-    auto a1 = _mm256_castsi256_si128(b);
-    auto a2 = _mm256_extractf128_si256(b, 1);
+    /* 2^r is applied in two steps to support overflow and denormals */
+    auto r1 = _mm256_round_pd(_mm256_mul_pd(r, _mm256_set1_pd(0.5)), 8);
+    auto r2 = _mm256_sub_pd(r, r1);
 
-    auto s = _mm_set_epi32(0, 52, 0, 52);
-    auto b1 = _mm_sll_epi64( a1, s);
-    auto b2 = _mm_sll_epi64( a2, s);
-
-    __m256i c  =  _mm256_castsi128_si256 ( b1 );
-    c =  _mm256_insertf128_si256 (  c, b2, 1 );
-#endif
-
-    __m256d n2 = _mm256_castsi256_pd(c);
-
-    auto t5 = _mm256_add_pd(z, _mm256_set1_pd(1.0));
-    z = _mm256_mul_pd(t5, n2);
-
-    return z;
+    return _mm256_mul_pd(_mm256_mul_pd(z, pow2n256_pd(r1)), pow2n256_pd(r2));
 }
 
-
+/*!
+ * \brief Compute the exponential of each element
+ *
+ * This is the exp function of Cephes. Overflow gives +inf, the denormal
+ * results are correctly computed and NaN arguments give NaN.
+ */
 ETL_INLINE_VEC_256 exp256_ps(__m256 x) {
     __m256 tmp, fx;
     __m256i imm0;
     __m256 one = *(__m256*)_ps256_1;
 
-    x = _mm256_min_ps(x, *(__m256*)_ps256_exp_hi);
-    x = _mm256_max_ps(x, *(__m256*)_ps256_exp_lo);
+    // The NaN inputs are propagated by min/max when passed last
+    x = _mm256_min_ps(*(__m256*)_ps256_exp_hi, x);
+    x = _mm256_max_ps(*(__m256*)_ps256_exp_lo, x);
 
     /* express exp(x) as exp(g + n*log(2)) */
     fx = _mm256_mul_ps(x, *(__m256*)_ps256_cephes_LOG2EF);
@@ -370,14 +481,13 @@ ETL_INLINE_VEC_256 exp256_ps(__m256 x) {
 
     y        = _mm256_add_ps(y, one);
 
-    /* build 2^n */
-    imm0 = _mm256_cvttps_epi32(fx);
-    // another two AVX2 instructions
-    imm0         = _mm256_add_epi32(imm0, *(__m256i*)_pi32_256_0x7f);
-    imm0         = _mm256_slli_epi32(imm0, 23);
-    __m256 pow2n = _mm256_castsi256_ps(imm0);
-    y            = _mm256_mul_ps(y, pow2n);
-    return y;
+    /* build 2^n, applied in two steps to support overflow and denormals */
+    imm0          = _mm256_cvttps_epi32(fx);
+    __m256i imm1  = _mm256_srai_epi32(imm0, 1);
+    imm0          = _mm256_sub_epi32(imm0, imm1);
+    __m256 pow2n1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(imm1, *(__m256i*)_pi32_256_0x7f), 23));
+    __m256 pow2n2 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(imm0, *(__m256i*)_pi32_256_0x7f), 23));
+    return _mm256_mul_ps(_mm256_mul_ps(y, pow2n1), pow2n2);
 }
 
 ETL_PS_256_CONST(minus_cephes_DP1, -0.78515625);
@@ -643,6 +753,96 @@ ETL_INLINE_VEC_256 cos256_ps(__m256 x) { // any x
     return y;
 }
 
+/*!
+ * \brief Compute the sine or the cosine of the argument reduced in
+ * [-Pi/4, Pi/4] from |x| and its octant y
+ * \param x The absolute value of the argument
+ * \param y The (even) octant of the argument
+ * \param cos_mask The mask of the elements using the cosine polynom
+ */
+ETL_INLINE_VEC_256D sincos_reduced256_pd(__m256d x, __m256d y, __m256d cos_mask) {
+    /* Extended precision modular arithmetic */
+    x = madd256_pd(y, _mm256_set1_pd(-7.85398125648498535156E-1), x);
+    x = madd256_pd(y, _mm256_set1_pd(-3.77489470793079817668E-8), x);
+    x = madd256_pd(y, _mm256_set1_pd(-2.69515142907905952645E-15), x);
+
+    auto z = _mm256_mul_pd(x, x);
+
+    /* cos(x) = 1 - x^2 / 2 + x^4 C(x^2) */
+    auto c = _mm256_set1_pd(-1.13585365213876817300E-11);
+    c      = madd256_pd(c, z, _mm256_set1_pd(2.08757008419747316778E-9));
+    c      = madd256_pd(c, z, _mm256_set1_pd(-2.75573141792967388112E-7));
+    c      = madd256_pd(c, z, _mm256_set1_pd(2.48015872888517045348E-5));
+    c      = madd256_pd(c, z, _mm256_set1_pd(-1.38888888888730564116E-3));
+    c      = madd256_pd(c, z, _mm256_set1_pd(4.16666666666665929218E-2));
+    c      = _mm256_mul_pd(_mm256_mul_pd(c, z), z);
+    c      = _mm256_add_pd(madd256_pd(z, _mm256_set1_pd(-0.5), _mm256_set1_pd(1.0)), c);
+
+    /* sin(x) = x + x^3 S(x^2) */
+    auto s = _mm256_set1_pd(1.58962301576546568060E-10);
+    s      = madd256_pd(s, z, _mm256_set1_pd(-2.50507477628578072866E-8));
+    s      = madd256_pd(s, z, _mm256_set1_pd(2.75573136213857245213E-6));
+    s      = madd256_pd(s, z, _mm256_set1_pd(-1.98412698295895385996E-4));
+    s      = madd256_pd(s, z, _mm256_set1_pd(8.33333333332211858878E-3));
+    s      = madd256_pd(s, z, _mm256_set1_pd(-1.66666666666666307295E-1));
+    s      = madd256_pd(_mm256_mul_pd(s, z), x, x);
+
+    return _mm256_blendv_pd(s, c, cos_mask);
+}
+
+/*!
+ * \brief Compute the sine of each element
+ *
+ * The maximum error is about 1 ulp for |x| < 1e8, the precision of the
+ * argument reduction is lost for larger arguments. Infinite and NaN
+ * arguments give NaN.
+ */
+ETL_INLINE_VEC_256D sin256_pd(__m256d x) {
+    auto sign_mask = _mm256_set1_pd(-0.0);
+    auto zero      = _mm256_setzero_pd();
+
+    auto sign_bit = _mm256_and_pd(x, sign_mask);
+    x             = _mm256_andnot_pd(sign_mask, x);
+
+    /* j = (int) (x * 4 / Pi) rounded to the even octant above */
+    auto j = _mm256_cvttpd_epi32(_mm256_mul_pd(x, _mm256_set1_pd(1.27323954473516268615)));
+    j      = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+
+    auto swap_mask = _mm256_cmp_pd(_mm256_cvtepi32_pd(_mm_and_si128(j, _mm_set1_epi32(4))), zero, _CMP_NEQ_OQ);
+    auto cos_mask  = _mm256_cmp_pd(_mm256_cvtepi32_pd(_mm_and_si128(j, _mm_set1_epi32(2))), zero, _CMP_NEQ_OQ);
+
+    sign_bit = _mm256_xor_pd(sign_bit, _mm256_and_pd(swap_mask, sign_mask));
+
+    auto y = _mm256_xor_pd(sincos_reduced256_pd(x, _mm256_cvtepi32_pd(j), cos_mask), sign_bit);
+    return _mm256_or_pd(y, _mm256_cmp_pd(x, _mm256_set1_pd(std::numeric_limits<double>::infinity()), _CMP_EQ_OQ)); // infinite arg will be NaN
+}
+
+/*!
+ * \brief Compute the cosine of each element
+ *
+ * The maximum error is about 1 ulp for |x| < 1e8, the precision of the
+ * argument reduction is lost for larger arguments. Infinite and NaN
+ * arguments give NaN.
+ */
+ETL_INLINE_VEC_256D cos256_pd(__m256d x) {
+    auto sign_mask = _mm256_set1_pd(-0.0);
+    auto zero      = _mm256_setzero_pd();
+
+    x = _mm256_andnot_pd(sign_mask, x);
+
+    /* j = (int) (x * 4 / Pi) rounded to the even octant above */
+    auto j = _mm256_cvttpd_epi32(_mm256_mul_pd(x, _mm256_set1_pd(1.27323954473516268615)));
+    j      = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+    auto y = _mm256_cvtepi32_pd(j);
+    j      = _mm_sub_epi32(j, _mm_set1_epi32(2));
+
+    auto swap_mask = _mm256_cmp_pd(_mm256_cvtepi32_pd(_mm_and_si128(j, _mm_set1_epi32(4))), zero, _CMP_EQ_OQ);
+    auto cos_mask  = _mm256_cmp_pd(_mm256_cvtepi32_pd(_mm_and_si128(j, _mm_set1_epi32(2))), zero, _CMP_NEQ_OQ);
+
+    auto r = _mm256_xor_pd(sincos_reduced256_pd(x, y, cos_mask), _mm256_and_pd(swap_mask, sign_mask));
+    return _mm256_or_pd(r, _mm256_cmp_pd(x, _mm256_set1_pd(std::numeric_limits<double>::infinity()), _CMP_EQ_OQ)); // infinite arg will be NaN
+}
+
 } //end of namespace etl
 
 #endif //__AVX__
@@ -12,7 +12,7 @@
 
 #pragma once
 
-#ifdef __AVX__
+#if defined(__AVX__) || defined(ETL_TARGET_AVX)
 
 #include <immintrin.h>
 #include <emmintrin.h>
@@ -532,6 +532,14 @@ struct avx_vec {
         return etl::sin256_ps(x);
     }
 
+    ETL_INLINE_VEC_256D cos(__m256d x) {
+        return etl::cos256_pd(x);
+    }
+
+    ETL_INLINE_VEC_256D sin(__m256d x) {
+        return etl::sin256_pd(x);
+    }
+
 #ifndef __INTEL_COMPILER
 
     //Exponential
@@ -544,6 +552,10 @@ struct avx_vec {
         return etl::exp256_ps(x);
     }
 
+    ETL_INLINE_VEC_256D log(__m256d x) {
+        return etl::log256_pd(x);
+    }
+
     ETL_INLINE_VEC_256 log(__m256 x) {
         return etl::log256_ps(x);
     }
@@ -570,6 +582,8 @@ struct avx_vec {
         return _mm256_log_ps(x);
     }
 
+#endif //__INTEL_COMPILER
+
     //Min
 
     ETL_INLINE_VEC_256D min(__m256d lhs, __m256d rhs) {
@@ -590,7 +604,47 @@ struct avx_vec {
         return _mm256_max_ps(lhs, rhs);
     }
 
-#endif //__INTEL_COMPILER
+    //Absolute value
+
+    ETL_INLINE_VEC_256D abs(__m256d x) {
+        return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+    }
+
+    ETL_INLINE_VEC_256 abs(__m256 x) {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+    }
+
+    //Comparison
+
+    /*!
+     * \brief Compare the two given values
+     * \return a mask set for the elements where lhs < rhs
+     */
+    ETL_STATIC_INLINE(__m256d) lt(__m256d lhs, __m256d rhs) {
+        return _mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ);
+    }
+
+    /*!
+     * \brief Compare the two given values
+     * \return a mask set for the elements where lhs < rhs
+     */
+    ETL_STATIC_INLINE(__m256) lt(__m256 lhs, __m256 rhs) {
+        return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ);
+    }
+
+    /*!
+     * \brief Select the elements of lhs where the mask is set and the elements of rhs elsewhere
+     */
+    ETL_INLINE_VEC_256D select(__m256d mask, __m256d lhs, __m256d rhs) {
+        return _mm256_blendv_pd(rhs, lhs, mask);
+    }
+
+    /*!
+     * \brief Select the elements of lhs where the mask is set and the elements of rhs elsewhere
+     */
+    ETL_INLINE_VEC_256 select(__m256 mask, __m256 lhs, __m256 rhs) {
+        return _mm256_blendv_ps(rhs, lhs, mask);
+    }
 
     /*!
      * \brief Perform an horizontal sum of the given vector.
@@ -616,6 +670,81 @@ struct avx_vec {
         const __m256d t2 = _mm256_hadd_pd(t1, t1);
         return _mm_cvtsd_f64(_mm256_castpd256_pd128(t2));
     }
+
+    /*!
+     * \brief Transpose a 8x8 block of single precision values
+     * \param in The first element of the block
+     * \param in_stride The distance between two rows of the block
+     * \param out The first element of the transposed block
+     * \param out_stride The distance between two rows of the transposed block
+     */
+    ETL_INLINE_VEC_VOID transpose_block(const float* in, std::size_t in_stride, float* out, std::size_t out_stride) {
+        __m256 r0 = _mm256_loadu_ps(in + 0 * in_stride);
+        __m256 r1 = _mm256_loadu_ps(in + 1 * in_stride);
+        __m256 r2 = _mm256_loadu_ps(in + 2 * in_stride);
+        __m256 r3 = _mm256_loadu_ps(in + 3 * in_stride);
+        __m256 r4 = _mm256_loadu_ps(in + 4 * in_stride);
+        __m256 r5 = _mm256_loadu_ps(in + 5 * in_stride);
+        __m256 r6 = _mm256_loadu_ps(in + 6 * in_stride);
+        __m256 r7 = _mm256_loadu_ps(in + 7 * in_stride);
+
+        // Interleave the pairs of rows
+
+        __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+        __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+        __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+        __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+        __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+        __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+        // Transpose the 4x4 blocks of each lane
+
+        __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+        // Exchange the lanes
+
+        _mm256_storeu_ps(out + 0 * out_stride, _mm256_permute2f128_ps(s0, s4, 0x20));
+        _mm256_storeu_ps(out + 1 * out_stride, _mm256_permute2f128_ps(s1, s5, 0x20));
+        _mm256_storeu_ps(out + 2 * out_stride, _mm256_permute2f128_ps(s2, s6, 0x20));
+        _mm256_storeu_ps(out + 3 * out_stride, _mm256_permute2f128_ps(s3, s7, 0x20));
+        _mm256_storeu_ps(out + 4 * out_stride, _mm256_permute2f128_ps(s0, s4, 0x31));
+        _mm256_storeu_ps(out + 5 * out_stride, _mm256_permute2f128_ps(s1, s5, 0x31));
+        _mm256_storeu_ps(out + 6 * out_stride, _mm256_permute2f128_ps(s2, s6, 0x31));
+        _mm256_storeu_ps(out + 7 * out_stride, _mm256_permute2f128_ps(s3, s7, 0x31));
+    }
+
+    /*!
+     * \brief Transpose a 4x4 block of double precision values
+     * \param in The first element of the block
+     * \param in_stride The distance between two rows of the block
+     * \param out The first element of the transposed block
+     * \param out_stride The distance between two rows of the transposed block
+     */
+    ETL_INLINE_VEC_VOID transpose_block(const double* in, std::size_t in_stride, double* out, std::size_t out_stride) {
+        __m256d r0 = _mm256_loadu_pd(in + 0 * in_stride);
+        __m256d r1 = _mm256_loadu_pd(in + 1 * in_stride);
+        __m256d r2 = _mm256_loadu_pd(in + 2 * in_stride);
+        __m256d r3 = _mm256_loadu_pd(in + 3 * in_stride);
+
+        __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+        __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+        __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+        __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+        _mm256_storeu_pd(out + 0 * out_stride, _mm256_permute2f128_pd(t0, t2, 0x20));
+        _mm256_storeu_pd(out + 1 * out_stride, _mm256_permute2f128_pd(t1, t3, 0x20));
+        _mm256_storeu_pd(out + 2 * out_stride, _mm256_permute2f128_pd(t0, t2, 0x31));
+        _mm256_storeu_pd(out + 3 * out_stride, _mm256_permute2f128_pd(t1, t3, 0x31));
+    }
 };
 
 //TODO Vectorize the two following functions
@@ -100,6 +100,32 @@ auto conv_1d_full(A&& a, B&& b, C&& c) {
     return std::forward<C>(c);
 }
 
+/*!
+ * \brief A streaming full 1D convolution with a fixed kernel.
+ *
+ * The signal is given in chunks, as they arrive, and is convolved by
+ * blocks with FFT. Each chunk produces as many samples of the full
+ * convolution as it contains, flush() produces the remaining samples.
+ */
+template <typename T>
+using conv_1d_filter = impl::standard::conv1_ola_filter<T>;
+
+/*!
+ * \brief Creates a streaming full 1D convolution with the given kernel.
+ * \param kernel The kernel expression
+ * \param block The maximum size of the blocks, 0 to choose it automatically
+ * \return the filter
+ */
+template <typename K>
+conv_1d_filter<value_t<K>> make_conv_1d_filter(K&& kernel, std::size_t block = 0) {
+    static_assert(is_etl_expr<K>::value, "Convolution only supported for ETL expressions");
+    static_assert(decay_traits<K>::dimensions() == 1, "Only 1D kernels can be used by a filter");
+
+    decltype(auto) k = make_temporary(std::forward<K>(kernel));
+
+    return {k.memory_start(), etl::size(k), block};
+}
+
 /*!
  * \brief Creates an expression representing the valid 2D convolution of a and b
  * \param a The input expression
@@ -230,6 +256,48 @@ auto conv_2d_valid_flipped(A&& a, B&& b, C&& c, size_t s1, size_t s2, size_t p1
     return std::forward<C>(c);
 }
 
+/*!
+ * \brief The spectrums of a set of 2D kernels, prepared for FFT
+ * convolutions of a fixed size.
+ *
+ * When the same kernels are used for many convolutions, they can be
+ * prepared once and given to the convolution functions instead of the
+ * kernels. Only the inputs are then transformed.
+ */
+template <typename T, std::size_t D>
+using prepared_kernels = impl::standard::prepared_kernels<T, D>;
+
+/*!
+ * \brief Prepare the given kernels for FFT convolutions.
+ *
+ * The kernels are [K, n1, n2] or [K, C, n1, n2] matrices. They are
+ * prepared for full convolutions of s1 x s2 results. For valid
+ * convolutions, this is the size of the full convolution of the padded
+ * input.
+ *
+ * \param kernels The kernels to prepare
+ * \param s1 The first dimension of the full convolution
+ * \param s2 The second dimension of the full convolution
+ * \return the prepared kernels
+ */
+template <typename K>
+prepared_kernels<value_t<K>, decay_traits<K>::dimensions()> prepare_kernels(K&& kernels, std::size_t s1, std::size_t s2) {
+    static constexpr std::size_t D = decay_traits<K>::dimensions();
+
+    static_assert(is_etl_expr<K>::value, "Only ETL expressions can be prepared");
+    static_assert(D == 3 || D == 4, "Only 3D and 4D kernels can be prepared");
+
+    decltype(auto) k = make_temporary(std::forward<K>(kernels));
+
+    std::array<std::size_t, D> dims;
+
+    for (std::size_t d = 0; d < D; ++d) {
+        dims[d] = etl::dim(k, d);
+    }
+
+    return {k.memory_start(), dims, s1, s2};
+}
+
 /*!
  * \brief Creates an expression representing the valid 2D convolution of a and multiple kernels from b
  * \param a The input expression
@@ -250,7 +318,7 @@ auto conv_2d_valid_multi(A&& a, B&& b) -> detail::temporary_binary_helper_op<A,
  * \param c The result
  * \return an expression representing the valid 2D convolution of a and multiple kernels from b
  */
-template <typename A, typename B, typename C>
+template <typename A, typename B, typename C, cpp_enable_if(is_etl_expr<B>::value)>
 auto conv_2d_valid_multi(A&& a, B&& b, C&& c) {
     static_assert(is_etl_expr<A>::value && is_etl_expr<B>::value && is_etl_expr<C>::value, "Convolution only supported for ETL expressions");
 
@@ -287,7 +355,7 @@ auto conv_2d_valid_multi(A&& a, B&& b, size_t s1, size_t s2, size_t p1 = 0, size
  * \param p2 The second dimension padding (top and bottom)
  * \return an expression representing the valid 2D convolution of a and b
  */
-template <typename A, typename B, typename C>
+template <typename A, typename B, typename C, cpp_enable_if(is_etl_expr<B>::value)>
 auto conv_2d_valid_multi(A&& a, B&& b, C&& c, size_t s1, size_t s2, size_t p1, size_t p2){
     static_assert(is_etl_expr<A>::value && is_etl_expr<B>::value && is_etl_expr<C>::value, "Convolution only supported for ETL expressions");
 
@@ -295,6 +363,32 @@ auto conv_2d_valid_multi(A&& a, B&& b, C&& c, size_t s1, size_t s2, size_t p1, s
     return std::forward<C>(c);
 }
 
+/*!
+ * \brief Compute the valid 2D convolution of a and multiple prepared kernels, the result will be stored in c.
+ *
+ * The kernels must be prepared for the full convolution of the padded
+ * input, of (i1 + k1 + 2 * p1 - 1) x (i2 + k2 + 2 * p2 - 1).
+ *
+ * \param a The input expression
+ * \param b The prepared kernels
+ * \param c The result
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding (left and right)
+ * \param p2 The second dimension padding (top and bottom)
+ * \return c
+ */
+template <typename A, typename T, typename C>
+auto conv_2d_valid_multi(A&& a, const prepared_kernels<T, 3>& b, C&& c, size_t s1 = 1, size_t s2 = 1, size_t p1 = 0, size_t p2 = 0) {
+    static_assert(is_etl_expr<A>::value && is_etl_expr<C>::value, "Convolution only supported for ETL expressions");
+    static_assert(etl::dimensions<A>() == 2 && etl::dimensions<C>() == 3, "Invalid number of dimensions for conv2_valid_multi");
+
+    cpp_assert(etl::dim(c, 0) == b.dim(0), "Invalid dimensions for conv2_valid_multi");
+
+    impl::reduc::fft_conv2_valid_multi(a, b, c, s1, s2, p1, p2);
+    return std::forward<C>(c);
+}
+
 /*!
  * \brief Creates an expression representing the valid 2D convolution of a and multiple flipped kernels from b
  * \param a The input expression
@@ -379,7 +473,7 @@ auto conv_2d_valid_multi_multi(A&& a, B&& b) -> detail::temporary_binary_helper_
  * \param b The kernel expression
  * \return an expression representing the valid 2D convolution of multiple images from a and multiple kernels from b
  */
-template <typename A, typename B, typename C>
+template <typename A, typename B, typename C, cpp_enable_if(is_etl_expr<B>::value)>
 auto conv_2d_valid_multi_multi(A&& a, B&& b, C&& c) {
     static_assert(is_etl_expr<A>::value && is_etl_expr<B>::value && is_etl_expr<C>::value, "Convolution only supported for ETL expressions");
 
@@ -443,7 +537,7 @@ auto conv_2d_valid_multi_multi(A&& a, B&& b, size_t s1, size_t s2, size_t p1 = 0
  * \param p2 The second dimension padding (top and bottom)
  * \return an expression representing the valid 2D convolution of a and b
  */
-template <typename A, typename B, typename C>
+template <typename A, typename B, typename C, cpp_enable_if(is_etl_expr<B>::value)>
 auto conv_2d_valid_multi_multi(A&& a, B&& b, C&& c, size_t s1, size_t s2, size_t p1, size_t p2){
     static_assert(is_etl_expr<A>::value && is_etl_expr<B>::value && is_etl_expr<C>::value, "Convolution only supported for ETL expressions");
 
@@ -451,6 +545,32 @@ auto conv_2d_valid_multi_multi(A&& a, B&& b, C&& c, size_t s1, size_t s2, size_t
     return std::forward<C>(c);
 }
 
+/*!
+ * \brief Compute the valid 2D convolution of multiple images from a and multiple prepared kernels, the result will be stored in c.
+ *
+ * The kernels must be prepared for the full convolution of the padded
+ * input, of (i1 + k1 + 2 * p1 - 1) x (i2 + k2 + 2 * p2 - 1).
+ *
+ * \param a The input expression
+ * \param b The prepared kernels
+ * \param c The result
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding (left and right)
+ * \param p2 The second dimension padding (top and bottom)
+ * \return c
+ */
+template <typename A, typename T, typename C>
+auto conv_2d_valid_multi_multi(A&& a, const prepared_kernels<T, 3>& b, C&& c, size_t s1 = 1, size_t s2 = 1, size_t p1 = 0, size_t p2 = 0) {
+    static_assert(is_etl_expr<A>::value && is_etl_expr<C>::value, "Convolution only supported for ETL expressions");
+    static_assert(etl::dimensions<A>() == 3 && etl::dimensions<C>() == 4, "Invalid number of dimensions for conv2_valid_multi_multi");
+
+    cpp_assert(etl::dim(c, 0) == b.dim(0) && etl::dim(c, 1) == etl::dim(a, 0), "Invalid dimensions for conv2_valid_multi_multi");
+
+    impl::reduc::fft_conv2_valid_multi_multi(a, b, c, s1, s2, p1, p2);
+    return std::forward<C>(c);
+}
+
 /*!
  * \brief Creates an expression representing the valid 2D convolution of a and b
  * \param a The input expression
@@ -597,7 +717,7 @@ auto conv_4d_full(A&& a, B&& b) -> detail::temporary_binary_helper<A, B, conv4_f
  *
  * \return c
  */
-template <typename A, typename B, typename C>
+template <typename A, typename B, typename C, cpp_enable_if(is_etl_expr<B>::value)>
 auto conv_4d_full(A&& a, B&& b, C&& c) {
     static_assert(is_etl_expr<A>::value && is_etl_expr<B>::value && is_etl_expr<C>::value, "Convolution only supported for ETL expressions");
 
@@ -605,6 +725,34 @@ auto conv_4d_full(A&& a, B&& b, C&& c) {
     return std::forward<C>(c);
 }
 
+/*!
+ * \brief 4D full convolution of a with prepared kernels
+ *
+ * The 4D matrix a is assumed to be of [N, K, Hi, Wi] dimensions.
+ * The prepared kernels are assumed to be of [K, C, Hf, Wf] dimensions,
+ * prepared for (Hi + Hf - 1) x (Wi + Wf - 1) convolutions.
+ * The 4D matrix c is assumed to be of [N, C, Hi + Hf - 1, Wi + Wf - 1] dimensions.
+ *
+ * \param a The input expression
+ * \param b The prepared kernels
+ * \param c The output expression
+ *
+ * \return c
+ */
+template <typename A, typename T, typename C>
+auto conv_4d_full(A&& a, const prepared_kernels<T, 4>& b, C&& c) {
+    static_assert(is_etl_expr<A>::value && is_etl_expr<C>::value, "Convolution only supported for ETL expressions");
+    static_assert(etl::dimensions<A>() == 4 && etl::dimensions<C>() == 4, "Invalid number of dimensions for conv4_full");
+    static_assert(all_dma<C>::value, "Convolutions with prepared kernels need a direct memory access output");
+
+    cpp_assert(etl::dim(a, 1) == b.dim(0) && etl::dim(c, 0) == etl::dim(a, 0) && etl::dim(c, 1) == b.dim(1), "Invalid dimensions for conv4_full");
+
+    decltype(auto) input = make_temporary(std::forward<A>(a));
+
+    impl::standard::conv4_full_fft(input.direct(), b, c.direct());
+    return std::forward<C>(c);
+}
+
 /*!
  * \brief Generic 4D convolution of a with the kernels from b, the
  * output is assumed to be filters.
@@ -917,7 +1065,7 @@ auto conv_2d_full_multi(A&& a, B&& b) -> detail::temporary_binary_helper<A, B, c
  * \param c The result
  * \return an expression representing the full 2D convolution of a and multiple kernels from b
  */
-template <typename A, typename B, typename C>
+template <typename A, typename B, typename C, cpp_enable_if(is_etl_expr<B>::value)>
 auto conv_2d_full_multi(A&& a, B&& b, C&& c) {
     static_assert(is_etl_expr<A>::value && is_etl_expr<B>::value && is_etl_expr<C>::value, "Convolution only supported for ETL expressions");
 
@@ -925,6 +1073,27 @@ auto conv_2d_full_multi(A&& a, B&& b, C&& c) {
     return std::forward<C>(c);
 }
 
+/*!
+ * \brief Compute the full 2D convolution of a and multiple prepared kernels, the result will be stored in c
+ * \param a The input expression
+ * \param b The prepared kernels
+ * \param c The result
+ * \return c
+ */
+template <typename A, typename T, typename C>
+auto conv_2d_full_multi(A&& a, const prepared_kernels<T, 3>& b, C&& c) {
+    static_assert(is_etl_expr<A>::value && is_etl_expr<C>::value, "Convolution only supported for ETL expressions");
+    static_assert(etl::dimensions<A>() == 2 && etl::dimensions<C>() == 3, "Invalid number of dimensions for conv2_full_multi");
+    static_assert(all_dma<C>::value, "Convolutions with prepared kernels need a direct memory access output");
+
+    cpp_assert(etl::dim(c, 0) == b.dim(0), "Invalid dimensions for conv2_full_multi");
+
+    decltype(auto) input = make_temporary(std::forward<A>(a));
+
+    impl::standard::conv2_full_multi_fft(input.direct(), b, c.direct());
+    return std::forward<C>(c);
+}
+
 /*!
  * \brief Creates an expression representing the full 2D convolution of a and multiple flipped kernels from b
  * \param a The input expression
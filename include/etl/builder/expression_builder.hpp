@@ -18,6 +18,8 @@
 #include "etl/impl/dot.hpp"
 #include "etl/impl/scalar_op.hpp"
 #include "etl/impl/sum.hpp"
+#include "etl/impl/reduc.hpp"
+#include "etl/impl/stats.hpp"
 #include "etl/impl/norm.hpp"
 
 namespace etl {
@@ -520,9 +522,9 @@ auto conj(E&& value) -> unary_expr<value_t<E>, detail::build_type<E>, conj_unary
  * \return an expression representing the input expression plus noise
  */
 template <typename E>
-auto uniform_noise(E&& value) -> detail::unary_helper<E, uniform_noise_unary_op> {
+auto uniform_noise(E&& value) -> detail::stateful_unary_helper<E, uniform_noise_unary_op> {
     static_assert(is_etl_expr<E>::value, "etl::uniform_noise can only be used on ETL expressions");
-    return detail::unary_helper<E, uniform_noise_unary_op>{value};
+    return detail::stateful_unary_helper<E, uniform_noise_unary_op>{value};
 }
 
 /*!
@@ -531,9 +533,9 @@ auto uniform_noise(E&& value) -> detail::unary_helper<E, uniform_noise_unary_op>
  * \return an expression representing the input expression plus noise
  */
 template <typename E>
-auto normal_noise(E&& value) -> detail::unary_helper<E, normal_noise_unary_op> {
+auto normal_noise(E&& value) -> detail::stateful_unary_helper<E, normal_noise_unary_op> {
     static_assert(is_etl_expr<E>::value, "etl::normal_noise can only be used on ETL expressions");
-    return detail::unary_helper<E, normal_noise_unary_op>{value};
+    return detail::stateful_unary_helper<E, normal_noise_unary_op>{value};
 }
 
 /*!
@@ -542,9 +544,9 @@ auto normal_noise(E&& value) -> detail::unary_helper<E, normal_noise_unary_op> {
  * \return an expression representing the input expression plus noise
  */
 template <typename E>
-auto logistic_noise(E&& value) -> detail::unary_helper<E, logistic_noise_unary_op> {
+auto logistic_noise(E&& value) -> detail::stateful_unary_helper<E, logistic_noise_unary_op> {
     static_assert(is_etl_expr<E>::value, "etl::logistic_noise can only be used on ETL expressions");
-    return detail::unary_helper<E, logistic_noise_unary_op>{value};
+    return detail::stateful_unary_helper<E, logistic_noise_unary_op>{value};
 }
 
 /*!
@@ -613,9 +615,9 @@ auto identity_derivative(E&& value) {
  * \return An ETL expression representing the logistic sigmoid of the input.
  */
 template <typename E>
-auto sigmoid(E&& value) -> decltype(1.0 / (1.0 + exp(-value))) {
+auto sigmoid(E&& value) -> detail::unary_helper<E, sigmoid_unary_op> {
     static_assert(is_etl_expr<E>::value, "etl::sigmoid can only be used on ETL expressions");
-    return 1.0 / (1.0 + exp(-value));
+    return detail::unary_helper<E, sigmoid_unary_op>{value};
 }
 
 /*!
@@ -657,32 +659,14 @@ auto hard_sigmoid(E&& x) -> decltype(etl::clip(x * 0.2 + 0.5, 0.0, 1.0)) {
     return etl::clip(x * 0.2 + 0.5, 0.0, 1.0);
 }
 
-/*!
- * \brief Return the softmax function of the given ETL expression.
- * \param e The ETL expression
- * \return An ETL expression representing the softmax function of the input.
- */
-template <typename E>
-auto softmax(E&& e) {
-    static_assert(is_etl_expr<E>::value, "etl::softmax can only be used on ETL expressions");
-    return exp(e) / sum(exp(e));
-}
-
-/*!
- * \brief Returns the softmax function of the given ETL expression.
- * This version is implemented so that numerical stability is preserved.
- * \param e The ETL expression
- * \return An ETL expression representing the softmax function of the input.
- */
-template <typename E>
-auto stable_softmax(E&& e) {
-    static_assert(is_etl_expr<E>::value, "etl::stable_softmax can only be used on ETL expressions");
-    auto m = max(e);
-    return exp(e - m) / sum(exp(e - m));
-}
-
 /*!
  * \brief Return the derivative of the softmax function of the given ETL expression.
+ *
+ * The softmax is used together with the cross-entropy loss, whose
+ * gradient already contains the derivative of the softmax, therefore
+ * nothing needs to be computed. The diagonal of the Jacobian of the
+ * softmax is computed by softmax_jacobian_diag.
+ *
  * \param e The ETL expression
  * \return An ETL expression representing the derivative of the softmax function of the input.
  */
@@ -698,9 +682,9 @@ auto softmax_derivative(E&& e) {
  * \return An ETL expression representing the softplus of the input.
  */
 template <typename E>
-auto softplus(E&& value) -> decltype(log(1.0 + exp(value))) {
+auto softplus(E&& value) -> detail::unary_helper<E, softplus_unary_op> {
     static_assert(is_etl_expr<E>::value, "etl::softplus can only be used on ETL expressions");
-    return log(1.0 + exp(value));
+    return detail::unary_helper<E, softplus_unary_op>{value};
 }
 
 /*!
@@ -709,9 +693,9 @@ auto softplus(E&& value) -> decltype(log(1.0 + exp(value))) {
  * \return an expression representing the Bernoulli sampling of the given expression
  */
 template <typename E>
-auto bernoulli(const E& value) -> detail::unary_helper<E, bernoulli_unary_op> {
+auto bernoulli(const E& value) -> detail::stateful_unary_helper<E, bernoulli_unary_op> {
     static_assert(is_etl_expr<E>::value, "etl::bernoulli can only be used on ETL expressions");
-    return detail::unary_helper<E, bernoulli_unary_op>{value};
+    return detail::stateful_unary_helper<E, bernoulli_unary_op>{value};
 }
 
 /*!
@@ -720,9 +704,9 @@ auto bernoulli(const E& value) -> detail::unary_helper<E, bernoulli_unary_op> {
  * \return an expression representing the Reverse Bernoulli sampling of the given expression
  */
 template <typename E>
-auto r_bernoulli(const E& value) -> detail::unary_helper<E, reverse_bernoulli_unary_op> {
+auto r_bernoulli(const E& value) -> detail::stateful_unary_helper<E, reverse_bernoulli_unary_op> {
     static_assert(is_etl_expr<E>::value, "etl::r_bernoulli can only be used on ETL expressions");
-    return detail::unary_helper<E, reverse_bernoulli_unary_op>{value};
+    return detail::stateful_unary_helper<E, reverse_bernoulli_unary_op>{value};
 }
 
 /*!
@@ -1147,6 +1131,37 @@ value_t<E> mean(E&& values) {
     return sum(values) / size(values);
 }
 
+/*!
+ * \brief Returns the statistics of all the values contained in the given
+ * expression: mean, variance, minimum, maximum and their indices.
+ *
+ * All the statistics are computed in one pass over the expression.
+ *
+ * \param values The expression to reduce
+ * \return The statistics of the values of the expression
+ */
+template <typename E>
+statistics<value_t<E>> stats(E&& values) {
+    static_assert(is_etl_expr<E>::value, "etl::stats can only be used on ETL expressions");
+
+    //Reduction force evaluation
+    force(values);
+
+    return detail::stats_impl::apply(values);
+}
+
+/*!
+ * \brief Returns the variance of all the values contained in the given expression
+ * \param values The expression to reduce
+ * \return The variance of the values of the expression
+ */
+template <typename E>
+value_t<E> variance(E&& values) {
+    static_assert(is_etl_expr<E>::value, "etl::variance can only be used on ETL expressions");
+
+    return stats(values).variance();
+}
+
 /*!
  * \brief Returns the standard deviation of all the values contained in the given expression
  * \param values The expression to reduce
@@ -1156,14 +1171,31 @@ template <typename E>
 value_t<E> stddev(E&& values) {
     static_assert(is_etl_expr<E>::value, "etl::stddev can only be used on ETL expressions");
 
-    auto mean = etl::mean(values);
+    return stats(values).stddev();
+}
 
-    double std = 0.0;
-    for (auto value : values) {
-        std += (value - mean) * (value - mean);
-    }
+/*!
+ * \brief Returns the index of the first maximum element of the expression
+ * \param values The expression to search
+ * \return The index of the maximum element of the expression
+ */
+template <typename E>
+std::size_t argmax(E&& values) {
+    static_assert(is_etl_expr<E>::value, "etl::argmax can only be used on ETL expressions");
 
-    return std::sqrt(std / etl::size(values));
+    return stats(values).argmax;
+}
+
+/*!
+ * \brief Returns the index of the first minimum element of the expression
+ * \param values The expression to search
+ * \return The index of the minimum element of the expression
+ */
+template <typename E>
+std::size_t argmin(E&& values) {
+    static_assert(is_etl_expr<E>::value, "etl::argmin can only be used on ETL expressions");
+
+    return stats(values).argmin;
 }
 
 namespace detail {
@@ -1183,6 +1215,52 @@ using value_return_t =std::conditional_t<
                 value_t<E>>,
             value_t<E>>;
 
+/*!
+ * \brief Returns a reference to the maximum element of an expression
+ * whose elements are stored
+ * \param values The expression to search
+ * \return The maximum element of the expression
+ */
+template <typename E, cpp_enable_if(std::is_reference<value_return_t<E>>::value)>
+value_return_t<E> max_value(std::remove_reference_t<E>& values) {
+    return values[etl::argmax(values)];
+}
+
+/*!
+ * \brief Returns the maximum element of an expression, as computed by
+ * the reduction, since the elements of an expression may not be
+ * computed exactly the same way one by one.
+ * \param values The expression to search
+ * \return The maximum element of the expression
+ */
+template <typename E, cpp_disable_if(std::is_reference<value_return_t<E>>::value)>
+value_return_t<E> max_value(std::remove_reference_t<E>& values) {
+    return etl::stats(values).max;
+}
+
+/*!
+ * \brief Returns a reference to the minimum element of an expression
+ * whose elements are stored
+ * \param values The expression to search
+ * \return The minimum element of the expression
+ */
+template <typename E, cpp_enable_if(std::is_reference<value_return_t<E>>::value)>
+value_return_t<E> min_value(std::remove_reference_t<E>& values) {
+    return values[etl::argmin(values)];
+}
+
+/*!
+ * \brief Returns the minimum element of an expression, as computed by
+ * the reduction, since the elements of an expression may not be
+ * computed exactly the same way one by one.
+ * \param values The expression to search
+ * \return The minimum element of the expression
+ */
+template <typename E, cpp_disable_if(std::is_reference<value_return_t<E>>::value)>
+value_return_t<E> min_value(std::remove_reference_t<E>& values) {
+    return etl::stats(values).min;
+}
+
 } //end of namespace detail
 
 /*!
@@ -1195,18 +1273,7 @@ template <typename E>
 detail::value_return_t<E> max(E&& values) {
     static_assert(is_etl_expr<E>::value, "etl::max can only be used on ETL expressions");
 
-    //Reduction force evaluation
-    force(values);
-
-    std::size_t m = 0;
-
-    for (std::size_t i = 1; i < size(values); ++i) {
-        if (values[i] > values[m]) {
-            m = i;
-        }
-    }
-
-    return values[m];
+    return detail::max_value<E>(values);
 }
 
 /*!
@@ -1219,18 +1286,7 @@ template <typename E>
 detail::value_return_t<E> min(E&& values) {
     static_assert(is_etl_expr<E>::value, "etl::min can only be used on ETL expressions");
 
-    //Reduction force evaluation
-    force(values);
-
-    std::size_t m = 0;
-
-    for (std::size_t i = 1; i < size(values); ++i) {
-        if (values[i] < values[m]) {
-            m = i;
-        }
-    }
-
-    return values[m];
+    return detail::min_value<E>(values);
 }
 
 // Generate data
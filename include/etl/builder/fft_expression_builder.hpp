@@ -38,6 +38,12 @@ using ifft_value_type = std::conditional_t<is_complex<A>::value, value_t<A>, std
 template <typename A>
 using ifft_real_value_type = std::conditional_t<is_complex<A>::value, typename value_t<A>::value_type, value_t<A>>;
 
+/*!
+ * \brief The output value type of an FFT of a real expression
+ */
+template <typename A>
+using rfft_value_type = std::complex<value_t<A>>;
+
 } //end of namespace detail
 
 /*!
@@ -342,4 +348,159 @@ auto ifft_2d_many(A&& a, C&& c) {
     return std::forward<C>(c);
 }
 
+/*!
+ * \brief Creates an expression representing the 1D FFT of the real
+ * expression a. Only the n / 2 + 1 first coefficients of the spectrum
+ * are computed, the others are their conjugates.
+ * \param a The input expression
+ * \return an expression representing the half spectrum of a
+ */
+template <typename A>
+auto rfft_1d(A&& a) -> detail::temporary_unary_helper_type<detail::rfft_value_type<A>, A, rfft1_expr> {
+    static_assert(is_etl_expr<A>::value, "FFT only supported for ETL expressions");
+    static_assert(!is_complex<A>::value, "rfft only supported for real expressions");
+
+    return detail::temporary_unary_helper_type<detail::rfft_value_type<A>, A, rfft1_expr>{a};
+}
+
+/*!
+ * \brief Creates an expression representing the 1D FFT of the real
+ * expression a, the half spectrum will be stored in c
+ * \param a The input expression
+ * \param c The result
+ * \return an expression representing the half spectrum of a
+ */
+template <typename A, typename C>
+auto rfft_1d(A&& a, C&& c) {
+    static_assert(is_etl_expr<A>::value && is_etl_expr<C>::value, "FFT only supported for ETL expressions");
+    cpp_assert(etl::size(c) == etl::size(a) / 2 + 1, "Invalid size for the half spectrum");
+
+    c = rfft_1d(a);
+    return std::forward<C>(c);
+}
+
+/*!
+ * \brief Creates an expression representing the real signal of the half
+ * spectrum a. A spectrum of m coefficients gives a signal of 2 * (m - 1)
+ * values, use irfft_1d(a, c) for signals of odd size.
+ * \param a The input expression
+ * \return an expression representing the real inverse FFT of a
+ */
+template <typename A>
+auto irfft_1d(A&& a) -> detail::temporary_unary_helper_type<detail::ifft_real_value_type<A>, A, irfft1_expr> {
+    static_assert(is_etl_expr<A>::value, "FFT only supported for ETL expressions");
+    static_assert(is_complex<A>::value, "irfft only supported for complex expressions");
+
+    return detail::temporary_unary_helper_type<detail::ifft_real_value_type<A>, A, irfft1_expr>{a};
+}
+
+/*!
+ * \brief Compute the real signal of the half spectrum a and store it in
+ * c. The size of the signal is the size of c.
+ * \param a The input expression
+ * \param c The result
+ * \return c
+ */
+template <typename A, typename C>
+auto irfft_1d(A&& a, C&& c) {
+    static_assert(is_etl_expr<A>::value && is_etl_expr<C>::value, "FFT only supported for ETL expressions");
+    static_assert(is_complex<A>::value, "irfft only supported for complex expressions");
+    cpp_assert(etl::size(a) == etl::size(c) / 2 + 1, "Invalid size for the half spectrum");
+
+    detail::irfft1_impl::apply(make_temporary(std::forward<A>(a)), c);
+    return std::forward<C>(c);
+}
+
+/*!
+ * \brief Creates an expression representing the 2D FFT of the real
+ * expression a. Only the n2 / 2 + 1 first columns of the spectrum are
+ * computed.
+ * \param a The input expression
+ * \return an expression representing the half spectrum of a
+ */
+template <typename A>
+auto rfft_2d(A&& a) -> detail::temporary_unary_helper_type<detail::rfft_value_type<A>, A, rfft2_expr> {
+    static_assert(is_etl_expr<A>::value, "FFT only supported for ETL expressions");
+    static_assert(!is_complex<A>::value, "rfft only supported for real expressions");
+
+    return detail::temporary_unary_helper_type<detail::rfft_value_type<A>, A, rfft2_expr>{a};
+}
+
+/*!
+ * \brief Creates an expression representing the 2D FFT of the real
+ * expression a, the half spectrum will be stored in c
+ * \param a The input expression
+ * \param c The result
+ * \return an expression representing the half spectrum of a
+ */
+template <typename A, typename C>
+auto rfft_2d(A&& a, C&& c) {
+    static_assert(is_etl_expr<A>::value && is_etl_expr<C>::value, "FFT only supported for ETL expressions");
+    cpp_assert(etl::dim<0>(c) == etl::dim<0>(a) && etl::dim<1>(c) == etl::dim<1>(a) / 2 + 1, "Invalid size for the half spectrum");
+
+    c = rfft_2d(a);
+    return std::forward<C>(c);
+}
+
+/*!
+ * \brief Creates an expression representing the real 2D signal of the
+ * half spectrum a. A spectrum of m columns gives a signal of 2 * (m - 1)
+ * columns, use irfft_2d(a, c) for signals with an odd number of columns.
+ * \param a The input expression
+ * \return an expression representing the real inverse FFT of a
+ */
+template <typename A>
+auto irfft_2d(A&& a) -> detail::temporary_unary_helper_type<detail::ifft_real_value_type<A>, A, irfft2_expr> {
+    static_assert(is_etl_expr<A>::value, "FFT only supported for ETL expressions");
+    static_assert(is_complex<A>::value, "irfft only supported for complex expressions");
+
+    return detail::temporary_unary_helper_type<detail::ifft_real_value_type<A>, A, irfft2_expr>{a};
+}
+
+/*!
+ * \brief Compute the real 2D signal of the half spectrum a and store it
+ * in c. The size of the signal is the size of c.
+ * \param a The input expression
+ * \param c The result
+ * \return c
+ */
+template <typename A, typename C>
+auto irfft_2d(A&& a, C&& c) {
+    static_assert(is_etl_expr<A>::value && is_etl_expr<C>::value, "FFT only supported for ETL expressions");
+    static_assert(is_complex<A>::value, "irfft only supported for complex expressions");
+    cpp_assert(etl::dim<0>(a) == etl::dim<0>(c) && etl::dim<1>(a) == etl::dim<1>(c) / 2 + 1, "Invalid size for the half spectrum");
+
+    detail::irfft2_impl::apply(make_temporary(std::forward<A>(a)), c);
+    return std::forward<C>(c);
+}
+
+/*!
+ * \brief A reusable plan for the 1D FFT of a fixed size and direction.
+ *
+ * The plan can be applied to any number of signals of its size with
+ * plan(a, c) or directly on memory with execute and execute_many.
+ */
+template <typename T>
+using fft_plan = impl::standard::fft_plan<T>;
+
+/*!
+ * \brief Returns the shared plan for the 1D FFT of the given size and
+ * direction. Plans are kept in a least-recently-used cache and are
+ * reused by all the standard FFT implementations.
+ */
+using impl::standard::get_fft_plan;
+
+/*!
+ * \brief A reusable plan for the 1D FFT of real signals of a fixed size
+ * and direction, with half spectrums.
+ */
+template <typename T>
+using rfft_plan = impl::standard::rfft_plan<T>;
+
+/*!
+ * \brief Returns the shared plan for the 1D FFT of real signals of the
+ * given size and direction.
+ */
+using impl::standard::get_rfft_plan;
+
 } //end of namespace etl
@@ -0,0 +1,123 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Contains the softmax functions to build expressions.
+*/
+
+#pragma once
+
+#include "etl/expression_helpers.hpp"
+
+namespace etl {
+
+/*!
+ * \brief Return the softmax function of the given ETL expression.
+ * \param e The ETL expression
+ * \return An ETL expression representing the softmax function of the input.
+ */
+template <typename E>
+auto softmax(E&& e) {
+    static_assert(is_etl_expr<E>::value, "etl::softmax can only be used on ETL expressions");
+    return temporary_unary_expr<value_t<E>, detail::build_type<E>, softmax_expr<value_t<E>, decay_traits<E>::dimensions()>>{e};
+}
+
+/*!
+ * \brief Returns the softmax function of the given ETL expression.
+ * This version is implemented so that numerical stability is preserved.
+ * \param e The ETL expression
+ * \return An ETL expression representing the softmax function of the input.
+ */
+template <typename E>
+auto stable_softmax(E&& e) {
+    static_assert(is_etl_expr<E>::value, "etl::stable_softmax can only be used on ETL expressions");
+    return temporary_unary_expr<value_t<E>, detail::build_type<E>, stable_softmax_expr<value_t<E>, decay_traits<E>::dimensions()>>{e};
+}
+
+/*!
+ * \brief Return the diagonal of the Jacobian of the softmax function of the given ETL expression.
+ *
+ * This is s * (1 - s) for each value s of stable_softmax(e). It takes the
+ * input of the softmax, not its output.
+ *
+ * \param e The ETL expression
+ * \return An ETL expression representing the diagonal of the Jacobian of the softmax function of the input.
+ */
+template <typename E>
+auto softmax_jacobian_diag(E&& e) {
+    static_assert(is_etl_expr<E>::value, "etl::softmax_jacobian_diag can only be used on ETL expressions");
+    return temporary_unary_expr<value_t<E>, detail::build_type<E>, softmax_jacobian_diag_expr<value_t<E>, decay_traits<E>::dimensions()>>{e};
+}
+
+/*!
+ * \brief Returns the logarithm of the softmax function of the given ETL expression.
+ * This version is implemented so that numerical stability is preserved.
+ * \param e The ETL expression
+ * \return An ETL expression representing the logarithm of the softmax function of the input.
+ */
+template <typename E>
+auto log_softmax(E&& e) {
+    static_assert(is_etl_expr<E>::value, "etl::log_softmax can only be used on ETL expressions");
+    return temporary_unary_expr<value_t<E>, detail::build_type<E>, log_softmax_expr<value_t<E>, decay_traits<E>::dimensions()>>{e};
+}
+
+/*!
+ * \brief Return the softmax function of each row of the given ETL matrix.
+ * \param e The ETL matrix expression
+ * \return An ETL expression representing the softmax function of each row of the input.
+ */
+template <typename E>
+auto batch_softmax(E&& e) {
+    static_assert(is_etl_expr<E>::value, "etl::batch_softmax can only be used on ETL expressions");
+    static_assert(decay_traits<E>::dimensions() == 2, "etl::batch_softmax is only defined for matrices");
+    static_assert(decay_traits<E>::storage_order == order::RowMajor, "etl::batch_softmax is only defined for row major matrices");
+    return temporary_unary_expr<value_t<E>, detail::build_type<E>, batch_softmax_expr<value_t<E>>>{e};
+}
+
+/*!
+ * \brief Returns the softmax function of each row of the given ETL matrix.
+ * This version is implemented so that numerical stability is preserved.
+ * \param e The ETL matrix expression
+ * \return An ETL expression representing the softmax function of each row of the input.
+ */
+template <typename E>
+auto batch_stable_softmax(E&& e) {
+    static_assert(is_etl_expr<E>::value, "etl::batch_stable_softmax can only be used on ETL expressions");
+    static_assert(decay_traits<E>::dimensions() == 2, "etl::batch_stable_softmax is only defined for matrices");
+    static_assert(decay_traits<E>::storage_order == order::RowMajor, "etl::batch_stable_softmax is only defined for row major matrices");
+    return temporary_unary_expr<value_t<E>, detail::build_type<E>, batch_stable_softmax_expr<value_t<E>>>{e};
+}
+
+/*!
+ * \brief Return the diagonal of the Jacobian of the softmax function of each row of the given ETL matrix.
+ * \param e The ETL matrix expression
+ * \return An ETL expression representing the diagonal of the Jacobian of the softmax function of each row of the input.
+ */
+template <typename E>
+auto batch_softmax_jacobian_diag(E&& e) {
+    static_assert(is_etl_expr<E>::value, "etl::batch_softmax_jacobian_diag can only be used on ETL expressions");
+    static_assert(decay_traits<E>::dimensions() == 2, "etl::batch_softmax_jacobian_diag is only defined for matrices");
+    static_assert(decay_traits<E>::storage_order == order::RowMajor, "etl::batch_softmax_jacobian_diag is only defined for row major matrices");
+    return temporary_unary_expr<value_t<E>, detail::build_type<E>, batch_softmax_jacobian_diag_expr<value_t<E>>>{e};
+}
+
+/*!
+ * \brief Returns the logarithm of the softmax function of each row of the given ETL matrix.
+ * This version is implemented so that numerical stability is preserved.
+ * \param e The ETL matrix expression
+ * \return An ETL expression representing the logarithm of the softmax function of each row of the input.
+ */
+template <typename E>
+auto batch_log_softmax(E&& e) {
+    static_assert(is_etl_expr<E>::value, "etl::batch_log_softmax can only be used on ETL expressions");
+    static_assert(decay_traits<E>::dimensions() == 2, "etl::batch_log_softmax is only defined for matrices");
+    static_assert(decay_traits<E>::storage_order == order::RowMajor, "etl::batch_log_softmax is only defined for row major matrices");
+    return temporary_unary_expr<value_t<E>, detail::build_type<E>, batch_log_softmax_expr<value_t<E>>>{e};
+}
+
+} //end of namespace etl
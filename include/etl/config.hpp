@@ -44,11 +44,18 @@ constexpr bool conv_valid_fft = true;
 constexpr bool conv_valid_fft   = false;                               ///< Boolean flag indicating if temporaries are created
 #endif
 
-//Select the number of threads
+//Select the default number of threads (can be changed with set_parallel_threads)
 #ifdef ETL_PARALLEL_THREADS
 constexpr std::size_t threads = ETL_PARALLEL_THREADS;
 #else
-const std::size_t threads     = std::thread::hardware_concurrency(); ///< Number of threads
+const std::size_t threads     = std::thread::hardware_concurrency(); ///< Default number of threads
+#endif
+
+//Select the number of chunks per thread of parallel loops
+#ifdef ETL_PARALLEL_CHUNKS
+constexpr std::size_t parallel_chunks = ETL_PARALLEL_CHUNKS;
+#else
+constexpr std::size_t parallel_chunks = 4;                           ///< Number of chunks per thread of parallel loops, for load balancing
 #endif
 
 //Indicate that ETL should run in parallel
@@ -164,6 +171,13 @@ constexpr size_t cache_size = ETL_CACHE_SIZE;
 constexpr size_t cache_size = 3 * 1024 * 1024; ///< Cache size on the machine
 #endif
 
+//Flag to configure the number of FFT plans kept in cache
+#ifdef ETL_FFT_PLAN_CACHE_SIZE
+constexpr std::size_t fft_plan_cache_size = ETL_FFT_PLAN_CACHE_SIZE;
+#else
+constexpr std::size_t fft_plan_cache_size = 32; ///< The maximum number of FFT plans kept in cache (per precision)
+#endif
+
 //Flag to disable unrolling of non-vectorized loops
 #ifdef ETL_NO_UNROLL_NON_VECT
 constexpr bool unroll_normal_loops = false;
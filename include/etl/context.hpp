@@ -35,6 +35,7 @@ struct context {
     forced_impl<gemm_impl> gemm_selector;             ///< Forced selector for gemm
     forced_impl<outer_impl> outer_selector;           ///< Forced selector for outer product
     forced_impl<fft_impl> fft_selector;               ///< Forced selector for fft
+    forced_impl<softmax_impl> softmax_selector;       ///< Forced selector for softmax
 };
 
 /*!
@@ -136,6 +137,14 @@ inline forced_impl<fft_impl>& get_forced_impl() {
     return local_context().fft_selector;
 }
 
+/*!
+ * \copydoc get_forced_impl
+ */
+template <>
+inline forced_impl<softmax_impl>& get_forced_impl() {
+    return local_context().softmax_selector;
+}
+
 /*!
  * \brief RAII helper for setting the context to serial
  */
@@ -18,14 +18,15 @@ namespace etl {
  * \brief Enumeration describing the different convolution implementations
  */
 enum class conv_impl {
-    STD,      ///< Standard implementation
-    SSE,      ///< Vectorized SSE implementation
-    AVX,      ///< Vectorized AVX implementation
-    VEC,      ///< Uniform Vectorized Implementation with locality
-    CUDNN,    ///< CUDNN implementation
-    FFT_STD,  ///< FFT reduction (with STD impl)
-    FFT_MKL,  ///< FFT reduction (with MKL impl)
-    FFT_CUFFT ///< FFT reduction (with CUFFT impl)
+    STD,       ///< Standard implementation
+    SSE,       ///< Vectorized SSE implementation
+    AVX,       ///< Vectorized AVX implementation
+    VEC,       ///< Uniform Vectorized Implementation with locality
+    CUDNN,     ///< CUDNN implementation
+    FFT_STD,   ///< FFT reduction (with STD impl)
+    FFT_MKL,   ///< FFT reduction (with MKL impl)
+    FFT_CUFFT, ///< FFT reduction (with CUFFT impl)
+    FFT_OLA    ///< Block FFT reduction with overlap-add (with STD impl)
 };
 
 /*!
@@ -39,7 +40,8 @@ enum class conv4_impl {
     FFT_STD,   ///< FFT reduction (with STD impl)
     FFT_MKL,   ///< FFT reduction (with MKL impl)
     FFT_CUFFT, ///< FFT reduction (with CUFFT impl)
-    BLAS       ///< BLAS reduction
+    BLAS,      ///< BLAS reduction
+    WINOGRAD   ///< Winograd minimal filtering (3x3 kernels, unit strides)
 };
 
 /*!
@@ -54,7 +56,8 @@ enum class conv_multi_impl {
     FFT_MKL,   ///< FFT reduction (with MKL impl)
     FFT_CUFFT, ///< FFT reduction (with CUFFT impl)
     BLAS,      ///< Reduction to BLAS (GEMM)
-    CUDNN      ///< GPU with CUDNN
+    CUDNN,     ///< GPU with CUDNN
+    WINOGRAD   ///< Winograd minimal filtering (3x3 kernels, unit strides)
 };
 
 } //end of namespace etl
@@ -212,7 +212,7 @@ public:
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void store(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) store(const vec_type<V>& in, std::size_t i) noexcept {
         V::storeu(memory_start() + i, in);
     }
 
@@ -223,7 +223,7 @@ public:
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void storeu(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) storeu(const vec_type<V>& in, std::size_t i) noexcept {
         V::storeu(memory_start() + i, in);
     }
 
@@ -234,7 +234,7 @@ public:
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void stream(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) stream(const vec_type<V>& in, std::size_t i) noexcept {
         V::storeu(memory_start() + i, in);
     }
 
@@ -245,7 +245,7 @@ public:
      * \return a vector containing several elements of the matrix
      */
     template<typename V = default_vec>
-    vec_type<V> load(std::size_t i) const noexcept {
+    ETL_STRONG_INLINE(vec_type<V>) load(std::size_t i) const noexcept {
         return V::loadu(_memory + i);
     }
 
@@ -256,7 +256,7 @@ public:
      * \return a vector containing several elements of the matrix
      */
     template<typename V = default_vec>
-    vec_type<V> loadu(std::size_t i) const noexcept {
+    ETL_STRONG_INLINE(vec_type<V>) loadu(std::size_t i) const noexcept {
         return V::loadu(_memory + i);
     }
 
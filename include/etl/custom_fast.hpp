@@ -186,7 +186,7 @@ public:
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void store(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) store(vec_type<V> in, std::size_t i) noexcept {
         V::storeu(memory_start() + i, in);
     }
 
@@ -197,7 +197,7 @@ public:
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void storeu(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) storeu(vec_type<V> in, std::size_t i) noexcept {
         V::storeu(memory_start() + i, in);
     }
 
@@ -208,7 +208,7 @@ public:
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void stream(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) stream(vec_type<V> in, std::size_t i) noexcept {
         V::storeu(memory_start() + i, in);
     }
 
@@ -219,7 +219,7 @@ public:
      * \return a vector containing several elements of the matrix
      */
     template <typename V = default_vec>
-    vec_type<V> load(std::size_t i) const noexcept {
+    ETL_STRONG_INLINE(vec_type<V>) load(std::size_t i) const noexcept {
         return V::loadu(memory_start() + i);
     }
 
@@ -230,7 +230,7 @@ public:
      * \return a vector containing several elements of the matrix
      */
     template <typename V = default_vec>
-    vec_type<V> loadu(std::size_t i) const noexcept {
+    ETL_STRONG_INLINE(vec_type<V>) loadu(std::size_t i) const noexcept {
         return V::loadu(memory_start() + i);
     }
 
@@ -26,11 +26,14 @@
 #include "etl/context.hpp"
 #include "etl/complex.hpp"
 #include "etl/vectorization.hpp"
+#include "etl/isa.hpp"
 #include "etl/random.hpp"
 #include "etl/duration.hpp"
 #include "etl/threshold.hpp"
+#include "etl/thread_pool.hpp"
 #include "etl/parallel.hpp"
 #include "etl/memory.hpp"
+#include "etl/arena.hpp"
 #include "etl/allocator.hpp"
 
 //Forward declarations
@@ -91,6 +94,7 @@
 #include "etl/expr/pooling_expr.hpp"
 #include "etl/expr/pooling_derivative_expr.hpp"
 #include "etl/expr/upsample_expr.hpp"
+#include "etl/expr/softmax_expr.hpp"
 
 // The expressions building
 #include "etl/builder/mul_expression_builder.hpp"
@@ -98,6 +102,7 @@
 #include "etl/builder/fft_expression_builder.hpp"
 #include "etl/builder/inv_expression_builder.hpp"
 #include "etl/builder/pooling_expression_builder.hpp"
+#include "etl/builder/softmax_expression_builder.hpp"
 
 // The optimizer
 #include "etl/optimizer.hpp"
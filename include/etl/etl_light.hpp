@@ -26,11 +26,14 @@
 #include "etl/context.hpp"
 #include "etl/complex.hpp"
 #include "etl/vectorization.hpp"
+#include "etl/isa.hpp"
 #include "etl/random.hpp"
 #include "etl/duration.hpp"
 #include "etl/threshold.hpp"
+#include "etl/thread_pool.hpp"
 #include "etl/parallel.hpp"
 #include "etl/memory.hpp"
+#include "etl/arena.hpp"
 #include "etl/allocator.hpp"
 
 //Forward declarations
@@ -79,6 +82,11 @@
 #include "etl/expr/parallel_expr.hpp"
 #include "etl/expr/timed_expr.hpp"
 
+// The softmax expressions
+#include "etl/expr/detail.hpp"
+#include "etl/expr/softmax_expr.hpp"
+#include "etl/builder/softmax_expression_builder.hpp"
+
 // The optimizer
 #include "etl/optimizer.hpp"
 
@@ -43,20 +43,6 @@ using are_vectorizable = cpp::or_u<
     avx_enabled && are_vectorizable_select<vector_mode_t::AVX, E, R>::value,
     sse3_enabled && are_vectorizable_select<vector_mode_t::SSE3, E, R>::value>;
 
-/*!
- * \brief Select a vector mode for the given assignment type
- * \tparam E The Expression to assign to the result
- * \tparam R The result type
- */
-template <typename E, typename R>
-inline constexpr vector_mode_t select_vector_mode(){
-    return
-          (avx512_enabled && are_vectorizable_select<vector_mode_t::AVX512, E, R>::value) ? vector_mode_t::AVX512
-        : (avx_enabled && are_vectorizable_select<vector_mode_t::AVX, E, R>::value) ? vector_mode_t::AVX
-        : (sse3_enabled && are_vectorizable_select<vector_mode_t::SSE3, E, R>::value) ? vector_mode_t::SSE3
-                                                                                : vector_mode_t::NONE;
-}
-
 //Selectors for assign
 
 /*!
@@ -127,6 +113,122 @@ struct is_direct_transpose_impl<unary_expr<T, transpose_transformer<E>, transfor
         has_direct_access<E>::value,
         decay_traits<unary_expr<T, transpose_transformer<E>, transform_op>>::storage_order == decay_traits<R>::storage_order> {};
 
+/*!
+ * \brief Implementation of an integral constant indicating if a row or
+ * column reduction can be computed directly into the result.
+ */
+template <typename E, typename R>
+struct is_direct_reduc_impl : std::false_type {};
+
+/*!
+ * \copydoc is_direct_reduc_impl
+ */
+template <typename T, typename E, typename R>
+struct is_direct_reduc_impl<unary_expr<T, E, transform_op>, R>
+    : cpp::and_u<
+        is_reduc_transformer<E>::value,
+        has_direct_access<R>::value,
+        decay_traits<unary_expr<T, E, transform_op>>::storage_order == order::RowMajor,
+        decay_traits<R>::storage_order == order::RowMajor> {};
+
+/*!
+ * \brief Traits to inspect an elementwise expression around matrix
+ * multiplications that can be computed by panels of rows.
+ *
+ * valid indicates that the expression only contains values, scalars,
+ * elementwise operations and such multiplications, count is the number
+ * of multiplications.
+ */
+template <typename E, typename Enable = void>
+struct gemm_epilogue_impl {
+    static constexpr bool valid        = false; ///< Indicates if the expression can be evaluated by panels
+    static constexpr std::size_t count = 0;     ///< The number of multiplications in the expression
+};
+
+/*!
+ * \copydoc gemm_epilogue_impl
+ */
+template <typename E>
+struct gemm_epilogue_impl<E, std::enable_if_t<is_etl_value<E>::value>> {
+    static constexpr bool valid        = true; ///< Indicates if the expression can be evaluated by panels
+    static constexpr std::size_t count = 0;    ///< The number of multiplications in the expression
+};
+
+/*!
+ * \copydoc gemm_epilogue_impl
+ */
+template <typename T>
+struct gemm_epilogue_impl<etl::scalar<T>> {
+    static constexpr bool valid        = true; ///< Indicates if the expression can be evaluated by panels
+    static constexpr std::size_t count = 0;    ///< The number of multiplications in the expression
+};
+
+/*!
+ * \copydoc gemm_epilogue_impl
+ */
+template <typename T, typename E, typename Op>
+struct gemm_epilogue_impl<unary_expr<T, E, Op>> {
+    using sub_traits = gemm_epilogue_impl<std::decay_t<E>>; ///< The traits of the sub expression
+
+    static constexpr bool valid        = sub_traits::valid && !std::is_same<Op, identity_op>::value && !std::is_same<Op, transform_op>::value; ///< Indicates if the expression can be evaluated by panels
+    static constexpr std::size_t count = sub_traits::count;                                                                                 ///< The number of multiplications in the expression
+};
+
+/*!
+ * \copydoc gemm_epilogue_impl
+ */
+template <typename T, typename E, typename Op>
+struct gemm_epilogue_impl<unary_expr<T, E, stateful_op<Op>>> {
+    static constexpr bool valid        = false; ///< Indicates if the expression can be evaluated by panels
+    static constexpr std::size_t count = 0;     ///< The number of multiplications in the expression
+};
+
+/*!
+ * \copydoc gemm_epilogue_impl
+ */
+template <typename T, typename L, typename Op, typename R>
+struct gemm_epilogue_impl<binary_expr<T, L, Op, R>> {
+    using left_traits  = gemm_epilogue_impl<std::decay_t<L>>; ///< The traits of the left sub expression
+    using right_traits = gemm_epilogue_impl<std::decay_t<R>>; ///< The traits of the right sub expression
+
+    static constexpr bool valid        = left_traits::valid && right_traits::valid;  ///< Indicates if the expression can be evaluated by panels
+    static constexpr std::size_t count = left_traits::count + right_traits::count; ///< The number of multiplications in the expression
+};
+
+/*!
+ * \copydoc gemm_epilogue_impl
+ */
+template <typename T, typename A, typename B>
+struct gemm_epilogue_impl<temporary_binary_expr<T, A, B, basic_mm_mul_expr<T, mm_mul_impl>>> {
+    static constexpr bool valid        = is_etl_value<A>::value && is_etl_value<B>::value && all_dma<A, B>::value && all_row_major<A, B>::value; ///< Indicates if the expression can be evaluated by panels
+    static constexpr std::size_t count = 1;                                                                                                     ///< The number of multiplications in the expression
+};
+
+/*!
+ * \copydoc gemm_epilogue_impl
+ */
+template <typename T, typename A, typename B>
+struct gemm_epilogue_impl<temporary_binary_expr<T, A, B, basic_mv_mul_expr<T, mv_mul_impl>>> {
+    static constexpr bool valid        = is_etl_value<A>::value && is_etl_value<B>::value && all_dma<A, B>::value && all_row_major<A, B>::value; ///< Indicates if the expression can be evaluated by panels
+    static constexpr std::size_t count = 1;                                                                                                     ///< The number of multiplications in the expression
+};
+
+/*!
+ * \brief Implementation of an integral constant indicating if the
+ * elementwise operations around a matrix multiplication can be fused
+ * into the multiplication.
+ */
+template <typename E, typename R>
+struct is_gemm_epilogue_impl : cpp::and_u<
+        !is_cublas_enabled,
+        is_unary_expr<E>::value || is_binary_expr<E>::value,
+        gemm_epilogue_impl<E>::valid,
+        gemm_epilogue_impl<E>::count == 1,
+        decay_traits<E>::is_linear,
+        all_thread_safe<E>::value,
+        all_dma<R>::value,
+        all_row_major<E, R>::value> {};
+
 } //end of namespace detail
 
 /*!
@@ -135,11 +237,25 @@ struct is_direct_transpose_impl<unary_expr<T, transpose_transformer<E>, transfor
 template <typename E, typename R>
 using is_direct_transpose = detail::is_direct_transpose_impl<std::decay_t<E>, std::decay_t<R>>;
 
+/*!
+ * \brief Integral constant indicating if the elementwise operations
+ * around a matrix multiplication can be fused into the multiplication.
+ */
+template <typename E, typename R>
+using is_gemm_epilogue = detail::is_gemm_epilogue_impl<std::decay_t<E>, std::decay_t<R>>;
+
+/*!
+ * \brief Integral constant indicating if a row or column reduction can be
+ * computed directly into the result by its kernels.
+ */
+template <typename E, typename R>
+using is_direct_reduc = detail::is_direct_reduc_impl<std::decay_t<E>, std::decay_t<R>>;
+
 /*!
  * \brief Integral constant indicating if an optimized evaluation is available
  */
 template <typename E, typename R>
-using has_optimized_evaluation = cpp::or_c<is_direct_transpose<E, R>>;
+using has_optimized_evaluation = cpp::or_c<is_direct_transpose<E, R>, is_gemm_epilogue<E, R>, is_direct_reduc<E, R>>;
 
 } //end of namespace detail
 
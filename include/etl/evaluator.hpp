@@ -37,6 +37,8 @@
 
 // Optimized evaluations
 #include "etl/impl/transpose.hpp"
+#include "etl/impl/isa/kernels.hpp"
+#include "etl/impl/gemm_epilogue.hpp"
 
 namespace etl {
 
@@ -140,41 +142,9 @@ namespace standard_evaluator {
         using RS = decltype(memory_slice(result, 0, n));
         using ES = decltype(memory_slice(expr, 0, n));
 
-        thread_local cpp::default_thread_pool<> pool(threads - 1);
-
-        //Distribute evenly the batches
-
-        auto batch = n / threads;
-
-        for(std::size_t t = 0; t < threads - 1; ++t){
-            pool.do_task(Fun<RS,ES>(memory_slice(result, t * batch, (t+1) * batch), memory_slice(expr, t * batch, (t+1) * batch)));
-        }
-
-        Fun<RS,ES>(memory_slice(result, (threads - 1) * batch, n), memory_slice(expr, (threads - 1) * batch, n))();
-
-        pool.wait();
-    }
-
-    template <template <vector_mode_t, typename, typename> class Fun, vector_mode_t V, typename E, typename R>
-    void par_vec(E&& expr, R&& result) {
-        const auto n = etl::size(result);
-
-        using RS = decltype(memory_slice(result, 0, n));
-        using ES = decltype(memory_slice(expr, 0, n));
-
-        thread_local cpp::default_thread_pool<> pool(threads - 1);
-
-        //Distribute evenly the batches
-
-        auto batch = n / threads;
-
-        for(std::size_t t = 0; t < threads - 1; ++t){
-            pool.do_task(Fun<V, RS, ES>(memory_slice(result, t * batch, (t + 1) * batch), memory_slice(expr, t * batch, (t + 1) * batch)));
-        }
-
-        Fun<V, RS, ES>(memory_slice(result, (threads - 1) * batch, n), memory_slice(expr, (threads - 1) * batch, n))();
-
-        pool.wait();
+        dispatch_1d(true, [&](std::size_t first, std::size_t last) {
+            Fun<RS, ES>(memory_slice(result, first, last), memory_slice(expr, first, last))();
+        }, 0, n);
     }
 
     /*!
@@ -182,6 +152,10 @@ namespace standard_evaluator {
      */
     template <typename E, typename R, cpp_enable_if(detail::direct_assign<E, R>::value)>
     void assign_evaluate_impl(E&& expr, R&& result) {
+        if (impl::isa::assign(expr, result)) {
+            return;
+        }
+
         if(all_thread_safe<E>::value && select_parallel(etl::size(result))){
             par_linear<detail::Assign>(expr, result);
         } else {
@@ -194,12 +168,12 @@ namespace standard_evaluator {
      */
     template <typename E, typename R, cpp_enable_if(detail::vectorized_assign<E, R>::value)>
     void assign_evaluate_impl(E&& expr, R&& result) {
-        constexpr auto V = detail::select_vector_mode<E, R>();
+        if (impl::isa::assign(expr, result)) {
+            return;
+        }
 
-        if(all_thread_safe<E>::value && select_parallel(etl::size(result))){
-            par_vec<detail::VectorizedAssign, V>(expr, result);
-        } else {
-            detail::VectorizedAssign<V, R&, E&>(result, expr)();
+        if (!ETL_ISA_VEC_CALL(vectorized_assign_evaluate(expr, result))) {
+            detail::vectorized_assign_evaluate(expr, result);
         }
     }
 
@@ -230,6 +204,10 @@ namespace standard_evaluator {
         pre_assign(expr);
         post_assign_compound(expr);
 
+        if (impl::isa::compound<impl::isa::add_op>(expr, result)) {
+            return;
+        }
+
         if(all_thread_safe<E>::value && select_parallel(etl::size(result))){
             par_linear<detail::AssignAdd>(expr, result);
         } else {
@@ -244,15 +222,15 @@ namespace standard_evaluator {
      */
     template <typename E, typename R, cpp_enable_if(detail::vectorized_compound<E, R>::value)>
     void add_evaluate(E&& expr, R&& result) {
-        constexpr auto V = detail::select_vector_mode<E, R>();
-
         pre_assign(expr);
         post_assign_compound(expr);
 
-        if(all_thread_safe<E>::value && select_parallel(etl::size(result))){
-            par_vec<detail::VectorizedAssignAdd, V>(expr, result);
-        } else {
-            detail::VectorizedAssignAdd<V, R&, E&>(result, expr)();
+        if (impl::isa::compound<impl::isa::add_op>(expr, result)) {
+            return;
+        }
+
+        if (!ETL_ISA_VEC_CALL(vectorized_add_evaluate(expr, result))) {
+            detail::vectorized_add_evaluate(expr, result);
         }
     }
 
@@ -283,6 +261,10 @@ namespace standard_evaluator {
         pre_assign(expr);
         post_assign_compound(expr);
 
+        if (impl::isa::compound<impl::isa::sub_op>(expr, result)) {
+            return;
+        }
+
         if(all_thread_safe<E>::value && select_parallel(etl::size(result))){
             par_linear<detail::AssignSub>(expr, result);
         } else {
@@ -297,15 +279,15 @@ namespace standard_evaluator {
      */
     template <typename E, typename R, cpp_enable_if(detail::vectorized_compound<E, R>::value)>
     void sub_evaluate(E&& expr, R&& result) {
-        constexpr auto V = detail::select_vector_mode<E, R>();
-
         pre_assign(expr);
         post_assign_compound(expr);
 
-        if(all_thread_safe<E>::value && select_parallel(etl::size(result))){
-            par_vec<detail::VectorizedAssignSub, V>(expr, result);
-        } else {
-            detail::VectorizedAssignSub<V, R&, E&>(result, expr)();
+        if (impl::isa::compound<impl::isa::sub_op>(expr, result)) {
+            return;
+        }
+
+        if (!ETL_ISA_VEC_CALL(vectorized_sub_evaluate(expr, result))) {
+            detail::vectorized_sub_evaluate(expr, result);
         }
     }
 
@@ -336,6 +318,10 @@ namespace standard_evaluator {
         pre_assign(expr);
         post_assign_compound(expr);
 
+        if (impl::isa::compound<impl::isa::mul_op>(expr, result)) {
+            return;
+        }
+
         if(all_thread_safe<E>::value && select_parallel(etl::size(result))){
             par_linear<detail::AssignMul>(expr, result);
         } else {
@@ -350,15 +336,15 @@ namespace standard_evaluator {
      */
     template <typename E, typename R, cpp_enable_if(detail::vectorized_compound<E, R>::value)>
     void mul_evaluate(E&& expr, R&& result) {
-        constexpr auto V = detail::select_vector_mode<E, R>();
-
         pre_assign(expr);
         post_assign_compound(expr);
 
-        if(all_thread_safe<E>::value && select_parallel(etl::size(result))){
-            par_vec<detail::VectorizedAssignMul, V>(expr, result);
-        } else {
-            detail::VectorizedAssignMul<V, R&, E&>(result, expr)();
+        if (impl::isa::compound<impl::isa::mul_op>(expr, result)) {
+            return;
+        }
+
+        if (!ETL_ISA_VEC_CALL(vectorized_mul_evaluate(expr, result))) {
+            detail::vectorized_mul_evaluate(expr, result);
         }
     }
 
@@ -389,6 +375,10 @@ namespace standard_evaluator {
         pre_assign(expr);
         post_assign_compound(expr);
 
+        if (impl::isa::compound<impl::isa::div_op>(expr, result)) {
+            return;
+        }
+
         if(all_thread_safe<E>::value && select_parallel(etl::size(result))){
             par_linear<detail::AssignDiv>(expr, result);
         } else {
@@ -403,15 +393,15 @@ namespace standard_evaluator {
      */
     template <typename E, typename R, cpp_enable_if(detail::vectorized_compound<E, R>::value)>
     void div_evaluate(E&& expr, R&& result) {
-        constexpr auto V = detail::select_vector_mode<E, R>();
-
         pre_assign(expr);
         post_assign_compound(expr);
 
-        if(all_thread_safe<E>::value && select_parallel(etl::size(result))){
-            par_vec<detail::VectorizedAssignDiv, V>(expr, result);
-        } else {
-            detail::VectorizedAssignDiv<V, R&, E&>(result, expr)();
+        if (impl::isa::compound<impl::isa::div_op>(expr, result)) {
+            return;
+        }
+
+        if (!ETL_ISA_VEC_CALL(vectorized_div_evaluate(expr, result))) {
+            detail::vectorized_div_evaluate(expr, result);
         }
     }
 
@@ -551,6 +541,47 @@ void assign_evaluate(Expr&& expr, Result&& result) {
     detail::transpose::apply(expr.value().value(), result);
 }
 
+/*!
+ * \brief Evaluation of the expr into result
+ * \param expr The right hand side expression
+ * \param result The left hand side
+ */
+template <typename Expr, typename Result, cpp_enable_if(detail::is_gemm_epilogue<Expr, Result>::value)>
+void assign_evaluate(Expr&& expr, Result&& result) {
+    // Small results stay in cache between the multiplication and the elementwise pass
+    if (etl::size(result) < gemm_epilogue_threshold) {
+        standard_evaluator::assign_evaluate(expr, result);
+        return;
+    }
+
+    // Compute the multiplication by panels, directly followed by the elementwise operations
+    detail::gemm_epilogue(expr, result);
+
+    standard_evaluator::post_assign(expr, result);
+}
+
+/*!
+ * \brief Evaluation of the expr into result
+ * \param expr The right hand side expression
+ * \param result The left hand side
+ */
+template <typename Expr, typename Result, cpp_enable_if(detail::is_direct_reduc<Expr, Result>::value)>
+void assign_evaluate(Expr&& expr, Result&& result) {
+    if (result.alias(expr)) {
+        standard_evaluator::assign_evaluate(expr, result);
+        return;
+    }
+
+    standard_evaluator::pre_assign(expr);
+
+    // Reduce the rows or the columns of the sub expression with the dedicated kernels
+    using impl_type = typename std::decay_t<decltype(expr.value())>::impl_type;
+
+    impl_type::apply(expr.value().sub, result);
+
+    standard_evaluator::post_assign(expr, result);
+}
+
 /*!
  * \brief Evaluation of the expr into result
  * \param expr The right hand side expression
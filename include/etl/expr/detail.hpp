@@ -111,7 +111,7 @@ struct impl_expr {
      */
     template <typename... Subs, cpp_enable_if(all_fast<Subs...>::value)>
     static result_type<Subs...>* allocate(__attribute__((unused)) Subs&&... args) {
-        return new result_type<Subs...>();
+        return aligned_new<result_type<Subs...>>();
     }
 
     /*!
@@ -121,7 +121,7 @@ struct impl_expr {
      */
     template <typename... Subs, std::size_t... I>
     static result_type<Subs...>* dyn_allocate(std::index_sequence<I...> /*seq*/, Subs&&... subs) {
-        return new result_type<Subs...>(derived_t::dim(subs..., I)...);
+        return aligned_new<result_type<Subs...>>(derived_t::dim(subs..., I)...);
     }
 
     /*!
@@ -172,7 +172,7 @@ struct dyn_impl_expr {
      */
     template <typename... Subs, std::size_t... I>
     result_type<Subs...>* dyn_allocate(std::index_sequence<I...> /*seq*/, Subs&&... subs) const {
-        return new result_type<Subs...>(as_derived().dim(subs..., I)...);
+        return aligned_new<result_type<Subs...>>(as_derived().dim(subs..., I)...);
     }
 
     /*!
@@ -178,4 +178,145 @@ using fft2_many_expr = basic_fft_expr<T, 3, detail::fft2_many_impl>;
 template <typename T>
 using ifft2_many_expr = basic_fft_expr<T, 3, detail::ifft2_many_impl>;
 
+/*!
+ * \brief A configurable expression for the FFT of real signals.
+ *
+ * Only the n / 2 + 1 first coefficients of the spectrum of a real signal
+ * of n values are stored, in the last dimension. The inverse expression
+ * computes signals of 2 * (m - 1) values from m coefficients. Signals of
+ * odd size can be computed by passing the output to the builder.
+ *
+ * \tparam T The value type
+ * \tparam D The number of dimensions of the FFT
+ * \tparam Inverse Indicates if the transform is inverse (half spectrum to real)
+ * \tparam Impl The implementation to use
+ */
+template <typename T, std::size_t D, bool Inverse, typename Impl>
+struct basic_rfft_expr : impl_expr<basic_rfft_expr<T, D, Inverse, Impl>> {
+    using this_type  = basic_rfft_expr<T, D, Inverse, Impl>; ///< The type of this expression
+    using value_type = T;                                    ///< The value type
+
+    static constexpr bool is_gpu = false; ///< Indicate if the expression is executed on GPU
+
+    /*!
+     * \brief The result type for a given sub expression type
+     * \tparam A The sub epxpression type
+     */
+    template <typename A>
+    using result_type = detail::expr_result_t<this_type, A>;
+
+    /*!
+     * \brief Apply the expression
+     * \param a The sub expression
+     * \param c The expression where to store the results
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        static_assert(is_etl_expr<A>::value && is_etl_expr<C>::value, "Fast-Fourrier Transform only supported for ETL expressions");
+
+        Impl::apply(
+            make_temporary(std::forward<A>(a)),
+            std::forward<C>(c));
+    }
+
+    /*!
+     * \brief Returns a textual representation of the operation
+     * \return a textual representation of the operation
+     */
+    static std::string desc() noexcept {
+        return Inverse ? "irfft" : "rfft";
+    }
+
+    /*!
+     * \brief Returns the last dimension of the result for the given last dimension of the input
+     * \param n The last dimension of the input
+     * \return the last dimension of the result
+     */
+    static constexpr std::size_t last_dim(std::size_t n) {
+        return Inverse ? 2 * (n - 1) : n / 2 + 1;
+    }
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \tparam A The sub expression type
+     * \tparam DD The dimension to get
+     * \return the DDth dimension of the expression
+     */
+    template <typename A, std::size_t DD>
+    static constexpr std::size_t dim() {
+        return DD == D - 1 ? last_dim(decay_traits<A>::template dim<DD>()) : decay_traits<A>::template dim<DD>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param a The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    template <typename A>
+    static std::size_t dim(const A& a, std::size_t d) {
+        return d == D - 1 ? last_dim(etl_traits<A>::dim(a, d)) : etl_traits<A>::dim(a, d);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param a The sub expression
+     * \return the size of the expression
+     */
+    template <typename A>
+    static std::size_t size(const A& a) {
+        return (etl::size(a) / etl_traits<A>::dim(a, D - 1)) * last_dim(etl_traits<A>::dim(a, D - 1));
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    template <typename A>
+    static constexpr std::size_t size() {
+        return (etl::decay_traits<A>::size() / decay_traits<A>::template dim<D - 1>()) * last_dim(decay_traits<A>::template dim<D - 1>());
+    }
+
+    /*!
+     * \brief Returns the storage order of the expression.
+     * \return the storage order of the expression
+     */
+    template <typename A>
+    static constexpr etl::order order() {
+        return etl::order::RowMajor;
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr std::size_t dimensions() {
+        return D;
+    }
+};
+
+/*!
+ * \brief Expression for 1D FFT of a real signal
+ */
+template <typename T>
+using rfft1_expr = basic_rfft_expr<T, 1, false, detail::rfft1_impl>;
+
+/*!
+ * \brief Expression for 1D Inverse FFT of a half spectrum
+ */
+template <typename T>
+using irfft1_expr = basic_rfft_expr<T, 1, true, detail::irfft1_impl>;
+
+/*!
+ * \brief Expression for 2D FFT of a real signal
+ */
+template <typename T>
+using rfft2_expr = basic_rfft_expr<T, 2, false, detail::rfft2_impl>;
+
+/*!
+ * \brief Expression for 2D Inverse FFT of a half spectrum
+ */
+template <typename T>
+using irfft2_expr = basic_rfft_expr<T, 2, true, detail::irfft2_impl>;
+
 } //end of namespace etl
@@ -9,9 +9,10 @@
  * \file generator_expr.hpp
  * \brief Contains generator expressions.
  *
- * A generator expression is an expression that yields any number of values, for instance random values. The indexes
- * are not taken into account, but rather the sequence in which the functions are called. This is mostly useful for
- * initializing matrices / vectors.
+ * A generator expression is an expression that yields any number of values, for instance random values. The
+ * generator receives the index of the element, the random generators use it to compute the value of the element while
+ * the sequence generator only takes into account the sequence in which the functions are called. This is mostly useful
+ * for initializing matrices / vectors.
 */
 
 #pragma once
@@ -31,6 +32,12 @@ private:
 public:
     using value_type = typename Generator::value_type; ///< The type of value generated
 
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type = typename V::template vec_type<value_type>;
+
     /*!
      * \brief Construct a generator expression and forward the arguments to the generator
      * \param args The input arguments of the generator
@@ -54,8 +61,7 @@ public:
      * \return a reference to the element at the given index.
      */
     value_type operator[](std::size_t i) const {
-        cpp_unused(i);
-        return generator();
+        return generator(i);
     }
 
     /*!
@@ -65,8 +71,29 @@ public:
      * \return the value at the given index.
      */
     value_type read_flat(std::size_t i) const {
-        cpp_unused(i);
-        return generator();
+        return generator(i);
+    }
+
+    /*!
+     * \brief Load several elements of the expression at once
+     * \param i The position at which to start.
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(std::size_t i) const {
+        return generator.template load<V>(i);
+    }
+
+    /*!
+     * \brief Load several elements of the expression at once
+     * \param i The position at which to start.
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) loadu(std::size_t i) const {
+        return generator.template load<V>(i);
     }
 
     /*!
@@ -106,7 +133,7 @@ struct etl_traits<etl::generator_expr<Generator>> {
     static constexpr bool is_view                 = false;           ///< Indicates if the type is a view
     static constexpr bool is_magic_view           = false;           ///< Indicates if the type is a magic view
     static constexpr bool is_linear               = true;            ///< Indicates if the expression is linear
-    static constexpr bool is_thread_safe          = false;           ///< Indicates if the expression is thread safe
+    static constexpr bool is_thread_safe          = Generator::thread_safe; ///< Indicates if the expression is thread safe
     static constexpr bool is_fast                 = true;            ///< Indicates if the expression is fast
     static constexpr bool is_value                = false;           ///< Indicates if the expression is of value type
     static constexpr bool is_direct               = false;           ///< Indicates if the expression has direct memory access
@@ -123,7 +150,7 @@ struct etl_traits<etl::generator_expr<Generator>> {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = typename Generator::template vectorizable<V>;
 
     /*!
      * \brief Return the size of the expression
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "etl/impl/mmul.hpp"
+#include "etl/impl/common/gemm.hpp"
 
 namespace etl {
 
@@ -119,6 +120,45 @@ void check_mv_mul_sizes(const A& a, const B& b, C& c) {
     cpp_unused(c);
 }
 
+/*!
+ * \brief Traits indicating if the given operand of a multiplication is
+ * the transpose of a matrix with direct memory access.
+ *
+ * Such an operand is given to the kernels as a view of the matrix in
+ * the other storage order instead of being copied into a temporary.
+ */
+template <typename E>
+struct is_gemm_transpose : std::false_type {};
+
+/*!
+ * \copydoc is_gemm_transpose
+ */
+template <typename T, typename E>
+struct is_gemm_transpose<unary_expr<T, transpose_transformer<E>, transform_op>> : cpp::bool_constant<
+        !is_cublas_enabled && has_direct_access<E>::value && decay_traits<E>::dimensions() == 2> {};
+
+/*!
+ * \brief Make an operand of a multiplication usable by the kernels,
+ * without copying the transposed matrices.
+ * \param expr The operand
+ * \return a view of the transposed matrix
+ */
+template <typename E, cpp_enable_if(is_gemm_transpose<std::decay_t<E>>::value)>
+auto make_gemm_operand(E&& expr) {
+    return impl::common::transpose_view(expr.value().sub);
+}
+
+/*!
+ * \brief Make an operand of a multiplication usable by the kernels,
+ * without copying the transposed matrices.
+ * \param expr The operand
+ * \return a temporary of the expression if necessary, otherwise the expression itself
+ */
+template <typename E, cpp_disable_if(is_gemm_transpose<std::decay_t<E>>::value)>
+decltype(auto) make_gemm_operand(E&& expr) {
+    return make_temporary(std::forward<E>(expr));
+}
+
 } //end of namespace detail
 
 /*!
@@ -154,8 +194,8 @@ struct basic_mm_mul_expr : impl_expr<basic_mm_mul_expr<T, Impl>> {
         detail::check_mm_mul_sizes(a, b, c);
 
         Impl::apply(
-            make_temporary(std::forward<A>(a)),
-            make_temporary(std::forward<B>(b)),
+            detail::make_gemm_operand(std::forward<A>(a)),
+            detail::make_gemm_operand(std::forward<B>(b)),
             std::forward<C>(c));
     }
 
@@ -273,8 +313,8 @@ struct basic_vm_mul_expr : impl_expr<basic_vm_mul_expr<T, Impl>> {
         detail::check_vm_mul_sizes(a, b, c);
 
         Impl::apply(
-            make_temporary(std::forward<A>(a)),
-            make_temporary(std::forward<B>(b)),
+            detail::make_gemm_operand(std::forward<A>(a)),
+            detail::make_gemm_operand(std::forward<B>(b)),
             std::forward<C>(c));
     }
 
@@ -387,8 +427,8 @@ struct basic_mv_mul_expr : impl_expr<basic_mv_mul_expr<T, Impl>> {
         detail::check_mv_mul_sizes(a, b, c);
 
         Impl::apply(
-            make_temporary(std::forward<A>(a)),
-            make_temporary(std::forward<B>(b)),
+            detail::make_gemm_operand(std::forward<A>(a)),
+            detail::make_gemm_operand(std::forward<B>(b)),
             std::forward<C>(c));
     }
 
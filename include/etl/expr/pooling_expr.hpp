@@ -164,22 +164,51 @@ struct basic_deep_pool_2d_expr : impl_expr<basic_deep_pool_2d_expr<T, C1, C2, S1
 
     /*!
      * \brief Apply the expression on a and store the result in c
+     *
+     * The independent sub matrices are pooled in parallel.
+     *
      * \param a The input expression
      * \param c The output expression
      */
     template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() == 3))>
     static void apply_impl(const A& a, C&& c) {
-        for(size_t i = 0; i < etl::dim<0>(a); ++i){
-            Impl::template apply<C1, C2, S1, S2, P1, P2>(a(i), c(i));
-        }
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                Impl::template apply<C1, C2, S1, S2, P1, P2>(a(i), c(i));
+            }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(a), pooling_parallel_threshold), batch_fun, 0, etl::dim<0>(a));
     }
 
     /*!
      * \brief Apply the expression on a and store the result in c
+     *
+     * The independent sub matrices of the two first dimensions
+     * (batch and channels) are pooled in parallel.
+     *
      * \param a The input expression
      * \param c The output expression
      */
-    template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() > 3))>
+    template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() == 4))>
+    static void apply_impl(const A& a, C&& c) {
+        const size_t K = etl::dim<1>(a);
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t nk = first; nk < last; ++nk) {
+                Impl::template apply<C1, C2, S1, S2, P1, P2>(a(nk / K)(nk % K), c(nk / K)(nk % K));
+            }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(a), pooling_parallel_threshold), batch_fun, 0, etl::dim<0>(a) * K);
+    }
+
+    /*!
+     * \brief Apply the expression on a and store the result in c
+     * \param a The input expression
+     * \param c The output expression
+     */
+    template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() > 4))>
     static void apply_impl(const A& a, C&& c) {
         for(size_t i = 0; i < etl::dim<0>(a); ++i){
             apply_impl(a(i), c(i));
@@ -437,22 +466,51 @@ struct basic_pool_deep_3d_expr : impl_expr<basic_pool_deep_3d_expr<T, C1, C2, C3
 
     /*!
      * \brief Apply the expression on a and store the result in c
+     *
+     * The independent sub matrices are pooled in parallel.
+     *
      * \param a The input expression
      * \param c The output expression
      */
     template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() == 4))>
     static void apply_impl(const A& a, C&& c) {
-        for(size_t i = 0; i < etl::dim<0>(a); ++i){
-            Impl::template apply<C1, C2, C3, S1, S2, S3, P1, P2, P3>(a(i), c(i));
-        }
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                Impl::template apply<C1, C2, C3, S1, S2, S3, P1, P2, P3>(a(i), c(i));
+            }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(a), pooling_parallel_threshold), batch_fun, 0, etl::dim<0>(a));
     }
 
     /*!
      * \brief Apply the expression on a and store the result in c
+     *
+     * The independent sub matrices of the two first dimensions
+     * (batch and channels) are pooled in parallel.
+     *
      * \param a The input expression
      * \param c The output expression
      */
-    template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() > 4))>
+    template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() == 5))>
+    static void apply_impl(const A& a, C&& c) {
+        const size_t K = etl::dim<1>(a);
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t nk = first; nk < last; ++nk) {
+                Impl::template apply<C1, C2, C3, S1, S2, S3, P1, P2, P3>(a(nk / K)(nk % K), c(nk / K)(nk % K));
+            }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(a), pooling_parallel_threshold), batch_fun, 0, etl::dim<0>(a) * K);
+    }
+
+    /*!
+     * \brief Apply the expression on a and store the result in c
+     * \param a The input expression
+     * \param c The output expression
+     */
+    template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() > 5))>
     static void apply_impl(const A& a, C&& c) {
         for(size_t i = 0; i < etl::dim<0>(a); ++i){
             apply_impl(a(i), c(i));
@@ -717,22 +775,51 @@ struct basic_dyn_deep_pool_2d_expr : dyn_impl_expr<basic_dyn_deep_pool_2d_expr<T
 
     /*!
      * \brief Apply the expression on a and store the result in c
+     *
+     * The independent sub matrices are pooled in parallel.
+     *
      * \param a The input expression
      * \param c The output expression
      */
     template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() == 3))>
     void apply_impl(const A& a, C&& c) const {
-        for(size_t i = 0; i < etl::dim<0>(a); ++i){
-            Impl::apply(a(i), c(i), c1, c2, s1, s2, p1, p2);
-        }
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                Impl::apply(a(i), c(i), c1, c2, s1, s2, p1, p2);
+            }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(a), pooling_parallel_threshold), batch_fun, 0, etl::dim<0>(a));
     }
 
     /*!
      * \brief Apply the expression on a and store the result in c
+     *
+     * The independent sub matrices of the two first dimensions
+     * (batch and channels) are pooled in parallel.
+     *
      * \param a The input expression
      * \param c The output expression
      */
-    template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() > 3))>
+    template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() == 4))>
+    void apply_impl(const A& a, C&& c) const {
+        const size_t K = etl::dim<1>(a);
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t nk = first; nk < last; ++nk) {
+                Impl::apply(a(nk / K)(nk % K), c(nk / K)(nk % K), c1, c2, s1, s2, p1, p2);
+            }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(a), pooling_parallel_threshold), batch_fun, 0, etl::dim<0>(a) * K);
+    }
+
+    /*!
+     * \brief Apply the expression on a and store the result in c
+     * \param a The input expression
+     * \param c The output expression
+     */
+    template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() > 4))>
     void apply_impl(const A& a, C&& c) const {
         for(size_t i = 0; i < etl::dim<0>(a); ++i){
             apply_impl(a(i), c(i));
@@ -966,22 +1053,51 @@ struct basic_dyn_deep_pool_3d_expr : dyn_impl_expr<basic_dyn_deep_pool_3d_expr<T
 
     /*!
      * \brief Apply the expression on a and store the result in c
+     *
+     * The independent sub matrices are pooled in parallel.
+     *
      * \param a The input expression
      * \param c The output expression
      */
     template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() == 4))>
     void apply_impl(const A& a, C&& c) const {
-        for(size_t i = 0; i < etl::dim<0>(a); ++i){
-            Impl::apply(a(i), c(i), c1, c2, c3, s1, s2, s3, p1, p2, p3);
-        }
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                Impl::apply(a(i), c(i), c1, c2, c3, s1, s2, s3, p1, p2, p3);
+            }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(a), pooling_parallel_threshold), batch_fun, 0, etl::dim<0>(a));
     }
 
     /*!
      * \brief Apply the expression on a and store the result in c
+     *
+     * The independent sub matrices of the two first dimensions
+     * (batch and channels) are pooled in parallel.
+     *
      * \param a The input expression
      * \param c The output expression
      */
-    template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() > 4))>
+    template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() == 5))>
+    void apply_impl(const A& a, C&& c) const {
+        const size_t K = etl::dim<1>(a);
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t nk = first; nk < last; ++nk) {
+                Impl::apply(a(nk / K)(nk % K), c(nk / K)(nk % K), c1, c2, c3, s1, s2, s3, p1, p2, p3);
+            }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(a), pooling_parallel_threshold), batch_fun, 0, etl::dim<0>(a) * K);
+    }
+
+    /*!
+     * \brief Apply the expression on a and store the result in c
+     * \param a The input expression
+     * \param c The output expression
+     */
+    template <typename A, typename C, cpp_enable_if((etl::decay_traits<A>::dimensions() > 5))>
     void apply_impl(const A& a, C&& c) const {
         for(size_t i = 0; i < etl::dim<0>(a); ++i){
             apply_impl(a(i), c(i));
@@ -0,0 +1,170 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Contains the softmax expressions.
+*/
+
+#pragma once
+
+//Get the implementations
+#include "etl/impl/softmax.hpp"
+
+namespace etl {
+
+/*!
+ * \brief A basic configurable expression for softmax
+ * \tparam T The value type
+ * \tparam D The number of dimensions of the expression
+ * \tparam Impl The softmax implementation
+ */
+template <typename T, std::size_t D, typename Impl>
+struct basic_softmax_expr : impl_expr<basic_softmax_expr<T, D, Impl>> {
+    using this_type  = basic_softmax_expr<T, D, Impl>; ///< The type of the expression
+    using value_type = T;                              ///< The type of the values
+
+    static constexpr bool is_gpu = false; ///< Indicate if the expression can be computed on GPU
+
+    /*!
+     * \brief The result type for a given sub expression type
+     * \tparam A The sub epxpression type
+     */
+    template <typename A>
+    using result_type = detail::expr_result_t<this_type, A>;
+
+    /*!
+     * \brief Apply the expression
+     * \param a The sub expression
+     * \param c The expression where to store the results
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        static_assert(is_etl_expr<A>::value && is_etl_expr<C>::value, "Softmax only supported for ETL expressions");
+        cpp_assert(etl::size(a) == etl::size(c), "Invalid sizes for softmax");
+
+        Impl::apply(
+            make_temporary(std::forward<A>(a)),
+            std::forward<C>(c));
+    }
+
+    /*!
+     * \brief Returns a textual representation of the operation
+     * \return a textual representation of the operation
+     */
+    static std::string desc() noexcept {
+        return Impl::desc();
+    }
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \tparam A The sub expression type
+     * \tparam DD The dimension to get
+     * \return the DDth dimension of the expression
+     */
+    template <typename A, std::size_t DD>
+    static constexpr std::size_t dim() {
+        return decay_traits<A>::template dim<DD>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param a The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    template <typename A>
+    static std::size_t dim(const A& a, std::size_t d) {
+        return etl_traits<A>::dim(a, d);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param a The sub expression
+     * \return the size of the expression
+     */
+    template <typename A>
+    static std::size_t size(const A& a) {
+        return etl::size(a);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    template <typename A>
+    static constexpr std::size_t size() {
+        return etl::decay_traits<A>::size();
+    }
+
+    /*!
+     * \brief Returns the storage order of the expression.
+     * \return the storage order of the expression
+     */
+    template <typename A>
+    static constexpr etl::order order() {
+        return decay_traits<A>::storage_order;
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr std::size_t dimensions() {
+        return D;
+    }
+};
+
+/*!
+ * \brief Expression for the softmax of all the elements
+ */
+template <typename T, std::size_t D>
+using softmax_expr = basic_softmax_expr<T, D, detail::softmax<false>>;
+
+/*!
+ * \brief Expression for the stable softmax of all the elements
+ */
+template <typename T, std::size_t D>
+using stable_softmax_expr = basic_softmax_expr<T, D, detail::stable_softmax<false>>;
+
+/*!
+ * \brief Expression for the diagonal of the Jacobian of the softmax of all the elements
+ */
+template <typename T, std::size_t D>
+using softmax_jacobian_diag_expr = basic_softmax_expr<T, D, detail::softmax_jacobian_diag<false>>;
+
+/*!
+ * \brief Expression for the logarithm of the softmax of all the elements
+ */
+template <typename T, std::size_t D>
+using log_softmax_expr = basic_softmax_expr<T, D, detail::log_softmax<false>>;
+
+/*!
+ * \brief Expression for the softmax of each row of a matrix
+ */
+template <typename T>
+using batch_softmax_expr = basic_softmax_expr<T, 2, detail::softmax<true>>;
+
+/*!
+ * \brief Expression for the stable softmax of each row of a matrix
+ */
+template <typename T>
+using batch_stable_softmax_expr = basic_softmax_expr<T, 2, detail::stable_softmax<true>>;
+
+/*!
+ * \brief Expression for the diagonal of the Jacobian of the softmax of each row of a matrix
+ */
+template <typename T>
+using batch_softmax_jacobian_diag_expr = basic_softmax_expr<T, 2, detail::softmax_jacobian_diag<true>>;
+
+/*!
+ * \brief Expression for the logarithm of the softmax of each row of a matrix
+ */
+template <typename T>
+using batch_log_softmax_expr = basic_softmax_expr<T, 2, detail::log_softmax<true>>;
+
+} //end of namespace etl
@@ -39,10 +39,15 @@ public:
 
     /*!
      * \brief Resets the pointer to a new value.
+     *
+     * The new value must have been constructed with aligned_new. The
+     * control block is allocated in aligned memory as well, so that both
+     * come from the arena when an arena_scope is active.
+     *
      * \param new_value The new value of the pointer
      */
     void reset(T* new_value) const {
-        ptr.reset(new_value);
+        ptr.reset(new_value, aligned_delete<T>(), aligned_std_allocator<T>());
     }
 
     /*!
@@ -147,6 +152,24 @@ public:
         }
     }
 
+    /*!
+     * \brief Evaluate the expression with the given functor, piece by piece.
+     *
+     * The expression is considered evaluated before the functor is
+     * called, the functor is responsible to compute every part of the
+     * temporary before reading it back.
+     *
+     * Will fail if not previously allocated
+     *
+     * \param functor The functor computing the temporary
+     */
+    template <typename Functor>
+    void evaluate_by(Functor&& functor) const {
+        cpp_assert(allocated, "The result has not been allocated");
+        evaluated = true;
+        functor(*_c);
+    }
+
     /*!
      * \brief Allocate the necessary temporaries, if necessary
      */
@@ -239,7 +262,7 @@ public:
      * \return a vector containing several results of the expression
      */
     template <typename VV = default_vec>
-    vec_type<VV> load(std::size_t i) const noexcept {
+    ETL_STRONG_INLINE(vec_type<VV>) load(std::size_t i) const noexcept {
         return VV::loadu(memory_start() + i);
     }
 
@@ -250,7 +273,7 @@ public:
      * \return a vector containing several results of the expression
      */
     template <typename VV = default_vec>
-    vec_type<VV> loadu(std::size_t i) const noexcept {
+    ETL_STRONG_INLINE(vec_type<VV>) loadu(std::size_t i) const noexcept {
         return VV::loadu(memory_start() + i);
     }
 
@@ -45,11 +45,14 @@ struct transform_op {
 
     /*!
      * \brief Indicates if the expression is vectorizable using the
-     * given vector mode
+     * given vector mode.
+     *
+     * The transformer itself decides if it can be vectorized.
+     *
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = std::true_type;
 };
 
 /*!
@@ -75,6 +78,25 @@ struct stateful_op {
     using vectorizable = typename Sub::template vectorizable<V>;
 };
 
+namespace detail {
+
+/*!
+ * \brief Traits indicating if a stateful operator needs the index of the
+ * elements on which it is applied.
+ *
+ * Such operators have an apply(x, i) and a load(x, i) functions.
+ */
+template <typename Op, typename Enable = void>
+struct is_indexed_op : std::false_type {};
+
+/*!
+ * \copydoc is_indexed_op
+ */
+template <typename Op>
+struct is_indexed_op<Op, std::enable_if_t<Op::indexed>> : std::true_type {};
+
+} //end of namespace detail
+
 /*!
  * \brief An unary expression
  *
@@ -161,7 +183,7 @@ public:
      * \return a vector containing several elements of the matrix
      */
     template <typename V = default_vec>
-    vec_type<V> load(std::size_t i) const {
+    ETL_STRONG_INLINE(vec_type<V>) load(std::size_t i) const {
         return UnaryOp::template load<V>(value().template load<V>(i));
     }
 
@@ -172,7 +194,7 @@ public:
      * \return a vector containing several elements of the matrix
      */
     template <typename V = default_vec>
-    vec_type<V> loadu(std::size_t i) const {
+    ETL_STRONG_INLINE(vec_type<V>) loadu(std::size_t i) const {
         return UnaryOp::template load<V>(value().template loadu<V>(i));
     }
 
@@ -494,7 +516,7 @@ public:
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void store(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) store(vec_type<V> in, std::size_t i) noexcept {
         return value().template store<V>(in, i);
     }
 
@@ -505,7 +527,7 @@ public:
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void storeu(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) storeu(vec_type<V> in, std::size_t i) noexcept {
         return value().template storeu<V>(in, i);
     }
 
@@ -516,7 +538,7 @@ public:
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void stream(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) stream(vec_type<V> in, std::size_t i) noexcept {
         return value().template stream<V>(in, i);
     }
 
@@ -527,7 +549,7 @@ public:
      * \return a vector containing several elements of the matrix
      */
     template <typename V = default_vec>
-    auto load(std::size_t i) const noexcept {
+    ETL_STRONG_INLINE(auto) load(std::size_t i) const noexcept {
         return value().template load<V>(i);
     }
 
@@ -538,7 +560,7 @@ public:
      * \return a vector containing several elements of the matrix
      */
     template <typename V = default_vec>
-    auto loadu(std::size_t i) const noexcept {
+    ETL_STRONG_INLINE(auto) loadu(std::size_t i) const noexcept {
         return value().template loadu<V>(i);
     }
 
@@ -780,6 +802,12 @@ public:
     using const_memory_type = void; ///< The const memory type of the expression
     using expr_t            = Expr; ///< The sub expression type
 
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     /*!
      * \brief Construct a new unary_expr from the given sub-expression
      * \param l The sub expression
@@ -831,6 +859,34 @@ public:
         return value().read_flat(i);
     }
 
+    /*!
+     * \brief Perform several operations at once.
+     *
+     * This is only available for the vectorizable transformers.
+     *
+     * \param i The index at which to perform the operation
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several results of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(std::size_t i) const {
+        return value().template load<V>(i);
+    }
+
+    /*!
+     * \brief Perform several operations at once.
+     *
+     * This is only available for the vectorizable transformers.
+     *
+     * \param i The index at which to perform the operation
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several results of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) loadu(std::size_t i) const {
+        return value().template loadu<V>(i);
+    }
+
     /*!
      * \brief Creates a sub view of the matrix, effectively removing the first dimension and fixing it to the given index.
      * \param i The index to use
@@ -945,7 +1001,7 @@ public:
      * \return a reference to the element at the given index.
      */
     value_type operator[](std::size_t i) const {
-        return op.apply(value()[i]);
+        return apply_op(value()[i], i);
     }
 
     /*!
@@ -955,7 +1011,7 @@ public:
      * \return the value at the given index.
      */
     value_type read_flat(std::size_t i) const {
-        return op.apply(value().read_flat(i));
+        return apply_op(value().read_flat(i), i);
     }
 
     /*!
@@ -965,8 +1021,8 @@ public:
      * \return a vector containing several elements of the matrix
      */
     template <typename V = default_vec>
-    vec_type<V> load(std::size_t i) const {
-        return op.template load<V>(value().template load<V>(i));
+    ETL_STRONG_INLINE(vec_type<V>) load(std::size_t i) const {
+        return load_op<V>(value().template load<V>(i), i);
     }
 
     /*!
@@ -976,8 +1032,8 @@ public:
      * \return a vector containing several elements of the matrix
      */
     template <typename V = default_vec>
-    vec_type<V> loadu(std::size_t i) const {
-        return op.template load<V>(value().template loadu<V>(i));
+    ETL_STRONG_INLINE(vec_type<V>) loadu(std::size_t i) const {
+        return load_op<V>(value().template loadu<V>(i), i);
     }
 
     /*!
@@ -989,7 +1045,7 @@ public:
     std::enable_if_t<sizeof...(S) == sub_size_compare<this_type>::value, value_type> operator()(S... args) const {
         static_assert(cpp::all_convertible_to<std::size_t, S...>::value, "Invalid size types");
 
-        return op.apply(value()(args...));
+        return apply_at(args...);
     }
 
     /*!
@@ -1017,6 +1073,72 @@ public:
     iterator<const this_type, false, false> end() const noexcept {
         return {*this, size(*this)};
     }
+
+private:
+    /*!
+     * \brief Apply the operator on the element i of value x
+     */
+    template <typename O = Op, cpp_enable_if(detail::is_indexed_op<O>::value)>
+    value_type apply_op(value_type x, std::size_t i) const {
+        return op.apply(x, i);
+    }
+
+    /*!
+     * \copydoc apply_op
+     */
+    template <typename O = Op, cpp_disable_if(detail::is_indexed_op<O>::value)>
+    value_type apply_op(value_type x, std::size_t i) const {
+        cpp_unused(i);
+        return op.apply(x);
+    }
+
+    /*!
+     * \brief Apply the operator on the vector x of the elements starting at i
+     */
+    template <typename V, typename O = Op, cpp_enable_if(detail::is_indexed_op<O>::value)>
+    ETL_STRONG_INLINE(vec_type<V>) load_op(vec_type<V> x, std::size_t i) const {
+        return op.template load<V>(x, i);
+    }
+
+    /*!
+     * \copydoc load_op
+     */
+    template <typename V, typename O = Op, cpp_disable_if(detail::is_indexed_op<O>::value)>
+    ETL_STRONG_INLINE(vec_type<V>) load_op(vec_type<V> x, std::size_t i) const {
+        cpp_unused(i);
+        return op.template load<V>(x);
+    }
+
+    /*!
+     * \brief Apply the operator on the element at the position (args...)
+     */
+    template <typename O = Op, typename... S, cpp_enable_if(detail::is_indexed_op<O>::value)>
+    value_type apply_at(S... args) const {
+        const std::size_t indices[] = {std::size_t(args)...};
+
+        // Compute the flat index in the storage order of the expression
+        std::size_t i = 0;
+
+        if (decay_traits<this_type>::storage_order == order::RowMajor) {
+            for (std::size_t d = 0; d < sizeof...(S); ++d) {
+                i = i * etl::dim(*this, d) + indices[d];
+            }
+        } else {
+            for (std::size_t d = sizeof...(S); d > 0; --d) {
+                i = i * etl::dim(*this, d - 1) + indices[d - 1];
+            }
+        }
+
+        return op.apply(value()(args...), i);
+    }
+
+    /*!
+     * \copydoc apply_at
+     */
+    template <typename O = Op, typename... S, cpp_disable_if(detail::is_indexed_op<O>::value)>
+    value_type apply_at(S... args) const {
+        return op.apply(value()(args...));
+    }
 };
 
 /*!
@@ -58,6 +58,28 @@ struct temporary_binary_expr;
 template <typename T, typename AExpr, typename BExpr, typename Op>
 struct temporary_binary_expr_state;
 
+template <typename T, typename Impl>
+struct basic_mm_mul_expr;
+
+template <typename T, typename Impl>
+struct basic_mv_mul_expr;
+
+namespace detail {
+
+struct mm_mul_impl;
+
+struct mv_mul_impl;
+
+struct sum_r_impl;
+
+struct mean_r_impl;
+
+struct sum_l_impl;
+
+struct mean_l_impl;
+
+} //end of namespace detail
+
 template <typename T, std::size_t D>
 struct dim_view;
 
@@ -75,6 +75,12 @@ using right_binary_helper_op = binary_expr<value_t<RE>, build_type<LE>, OP, buil
 template <typename E, template <typename> class OP>
 using unary_helper = unary_expr<value_t<E>, build_type<E>, OP<value_t<E>>>;
 
+/*!
+ * \brief Helper to create an unary expression with a stateful operator
+ */
+template <typename E, template <typename> class OP>
+using stateful_unary_helper = unary_expr<value_t<E>, build_type<E>, stateful_op<OP<value_t<E>>>>;
+
 /*!
  * \brief Helper to create an identity unary expression
  */
@@ -23,4 +23,12 @@ enum class fft_impl {
     CUFFT ///< The NVidia CuFFT implementation
 };
 
+/*!
+ * \brief The direction of a FFT
+ */
+enum class fft_direction {
+    FORWARD, ///< The forward transform
+    INVERSE  ///< The inverse transform, normalized by the size of the transform
+};
+
 } //end of namespace etl
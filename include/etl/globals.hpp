@@ -389,4 +389,145 @@ bool lu(const AT& A, LT& L, UT& U, PT& P) {
     return true;
 }
 
+/*!
+ * \brief Decompose the symmetric positive definite matrix A so that
+ * A = L * L^T.
+ *
+ * Only the lower part of A is used.
+ *
+ * \param A The A matrix
+ * \param L The L matrix (Lower Diagonal)
+ * \return true if the decomposition suceeded, false if the matrices are
+ * not square or if A is not positive definite
+ */
+template <typename AT, typename LT>
+bool cholesky(const AT& A, LT& L) {
+    if (!is_square(A) || !is_square(L) || etl::dim(A, 0) != etl::dim(L, 0)) {
+        return false;
+    }
+
+    return detail::cholesky_impl::apply(A, L);
+}
+
+/*!
+ * \brief Decompose the matrix so that A = Q * R, with Householder
+ * reflectors.
+ * \param A The A matrix (M x N)
+ * \param Q The Q matrix (Orthogonal, M x M)
+ * \param R The R matrix (Upper Triangular, M x N)
+ * \return true if the decomposition suceeded, false if the dimensions are
+ * not correct
+ */
+template <typename AT, typename QT, typename RT>
+bool qr(const AT& A, QT& Q, RT& R) {
+    if (decay_traits<AT>::dimensions() != 2 || !is_square(Q) || etl::dim(Q, 0) != etl::dim(A, 0)) {
+        return false;
+    }
+
+    if (etl::dim(R, 0) != etl::dim(A, 0) || etl::dim(R, 1) != etl::dim(A, 1)) {
+        return false;
+    }
+
+    detail::qr_impl::apply(A, Q, R);
+
+    return true;
+}
+
+/*!
+ * \brief Decompose the matrix so that the rows perm of A are equal to L * U.
+ *
+ * L and U are stored in the same matrix: the strict lower part of LU
+ * contains L, whose diagonal is implicitly one, and the upper part contains
+ * U. The row i of L * U is the row perm[i] of A.
+ *
+ * \param A The A matrix
+ * \param LU The LU matrix (output)
+ * \param perm The permutation of the rows (output)
+ * \return true if the decomposition suceeded, false if the matrices are
+ * not square or if A is singular
+ */
+template <typename AT, typename LUT>
+bool lu_factor(const AT& A, LUT& LU, std::vector<std::size_t>& perm) {
+    if (!is_square(A) || !is_square(LU) || etl::dim(A, 0) != etl::dim(LU, 0)) {
+        return false;
+    }
+
+    etl::dyn_matrix<value_t<AT>> lu(etl::dim(A, 0), etl::dim(A, 0));
+
+    lu = A;
+
+    const bool regular = detail::lu_factor_impl::apply(lu, perm);
+
+    LU = lu;
+
+    return regular;
+}
+
+/*!
+ * \brief Solve A X = B in place, given the decomposition of A computed by
+ * lu_factor.
+ *
+ * B can be a vector or a matrix with one column per right-hand side.
+ *
+ * \param LU The LU decomposition of A
+ * \param perm The permutation of the rows of the decomposition
+ * \param B The B matrix, replaced by X
+ */
+template <typename LUT, typename BT>
+void lu_solve(const LUT& LU, const std::vector<std::size_t>& perm, BT&& B) {
+    static constexpr bool row_major = decay_traits<BT>::storage_order == order::RowMajor;
+
+    cpp_assert(is_square(LU) && etl::dim(LU, 0) == etl::dim(B, 0), "Invalid dimensions for lu_solve");
+
+    const auto n = etl::dim(B, 0);
+    const auto r = etl::size(B) / n;
+
+    etl::dyn_matrix<value_t<BT>> x(n, r);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < r; ++j) {
+            x(i, j) = B[row_major ? i * r + j : j * n + i];
+        }
+    }
+
+    detail::lu_solve_impl::apply(LU, perm, x);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < r; ++j) {
+            B[row_major ? i * r + j : j * n + i] = x(i, j);
+        }
+    }
+}
+
+/*!
+ * \brief Solve the linear system A X = B.
+ *
+ * B can be a vector or a matrix with one column per right-hand side.
+ * lu_factor and lu_solve must be used directly to handle a singular A.
+ *
+ * \param A The A matrix, must be square and regular
+ * \param B The B matrix
+ * \return X, the solution of the system
+ */
+template <typename AT, typename BT>
+auto solve(const AT& A, const BT& B) {
+    cpp_assert(is_square(A) && etl::dim(A, 0) == etl::dim(B, 0), "Invalid dimensions for solve");
+
+    auto X = force_temporary(B);
+
+    etl::dyn_matrix<value_t<AT>> lu(etl::dim(A, 0), etl::dim(A, 0));
+    std::vector<std::size_t> perm;
+
+    lu = A;
+
+    const bool regular = detail::lu_factor_impl::apply(lu, perm);
+
+    cpp_assert(regular, "Singular matrix in solve");
+    cpp_unused(regular);
+
+    lu_solve(lu, perm, X);
+
+    return X;
+}
+
 } //end of namespace etl
@@ -25,11 +25,15 @@ namespace blas {
 
 template <typename A, typename B, typename C, cpp_enable_if(all_single_precision<A, B, C>::value)>
 void gemm(A&& a, B&& b, C&& c) {
-    bool row_major = decay_traits<A>::storage_order == order::RowMajor;
+    // The operands stored in the other order are used transposed
+    bool row_major   = decay_traits<C>::storage_order == order::RowMajor;
+    bool transpose_a = decay_traits<A>::storage_order != decay_traits<C>::storage_order;
+    bool transpose_b = decay_traits<B>::storage_order != decay_traits<C>::storage_order;
 
     cblas_sgemm(
         row_major ? CblasRowMajor : CblasColMajor,
-        CblasNoTrans, CblasNoTrans,
+        transpose_a ? CblasTrans : CblasNoTrans,
+        transpose_b ? CblasTrans : CblasNoTrans,
         etl::rows(a), etl::columns(b), etl::columns(a),
         1.0f,
         a.memory_start(), major_stride(a),
@@ -40,11 +44,15 @@ void gemm(A&& a, B&& b, C&& c) {
 
 template <typename A, typename B, typename C, cpp_enable_if(all_double_precision<A, B, C>::value)>
 void gemm(A&& a, B&& b, C&& c) {
-    bool row_major = decay_traits<A>::storage_order == order::RowMajor;
+    // The operands stored in the other order are used transposed
+    bool row_major   = decay_traits<C>::storage_order == order::RowMajor;
+    bool transpose_a = decay_traits<A>::storage_order != decay_traits<C>::storage_order;
+    bool transpose_b = decay_traits<B>::storage_order != decay_traits<C>::storage_order;
 
     cblas_dgemm(
         row_major ? CblasRowMajor : CblasColMajor,
-        CblasNoTrans, CblasNoTrans,
+        transpose_a ? CblasTrans : CblasNoTrans,
+        transpose_b ? CblasTrans : CblasNoTrans,
         etl::rows(a), etl::columns(b), etl::columns(a),
         1.0,
         a.memory_start(), major_stride(a),
@@ -55,14 +63,18 @@ void gemm(A&& a, B&& b, C&& c) {
 
 template <typename A, typename B, typename C, cpp_enable_if(all_complex_single_precision<A, B, C>::value)>
 void gemm(A&& a, B&& b, C&& c) {
-    bool row_major = decay_traits<A>::storage_order == order::RowMajor;
+    // The operands stored in the other order are used transposed
+    bool row_major   = decay_traits<C>::storage_order == order::RowMajor;
+    bool transpose_a = decay_traits<A>::storage_order != decay_traits<C>::storage_order;
+    bool transpose_b = decay_traits<B>::storage_order != decay_traits<C>::storage_order;
 
     std::complex<float> alpha(1.0, 0.0);
     std::complex<float> beta(0.0, 0.0);
 
     cblas_cgemm(
         row_major ? CblasRowMajor : CblasColMajor,
-        CblasNoTrans, CblasNoTrans,
+        transpose_a ? CblasTrans : CblasNoTrans,
+        transpose_b ? CblasTrans : CblasNoTrans,
         etl::rows(a), etl::columns(b), etl::columns(a),
         &alpha,
         a.memory_start(), major_stride(a),
@@ -73,14 +85,18 @@ void gemm(A&& a, B&& b, C&& c) {
 
 template <typename A, typename B, typename C, cpp_enable_if(all_complex_double_precision<A, B, C>::value)>
 void gemm(A&& a, B&& b, C&& c) {
-    bool row_major = decay_traits<A>::storage_order == order::RowMajor;
+    // The operands stored in the other order are used transposed
+    bool row_major   = decay_traits<C>::storage_order == order::RowMajor;
+    bool transpose_a = decay_traits<A>::storage_order != decay_traits<C>::storage_order;
+    bool transpose_b = decay_traits<B>::storage_order != decay_traits<C>::storage_order;
 
     std::complex<double> alpha(1.0, 0.0);
     std::complex<double> beta(0.0, 0.0);
 
     cblas_zgemm(
         row_major ? CblasRowMajor : CblasColMajor,
-        CblasNoTrans, CblasNoTrans,
+        transpose_a ? CblasTrans : CblasNoTrans,
+        transpose_b ? CblasTrans : CblasNoTrans,
         etl::rows(a), etl::columns(b), etl::columns(a),
         &alpha,
         a.memory_start(), major_stride(a),
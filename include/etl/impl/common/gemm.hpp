@@ -0,0 +1,39 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace common {
+
+/*!
+ * \brief Returns a view of the transpose of the given matrix.
+ *
+ * The view uses the same memory as the matrix, in the other storage
+ * order, so that nothing is copied.
+ *
+ * \param e The matrix to transpose, must have direct memory access
+ * \return a view of the transpose of the matrix
+ */
+template <typename E>
+auto transpose_view(E&& e) {
+    using T = value_t<E>;
+
+    static constexpr order SO = decay_traits<E>::storage_order == order::RowMajor ? order::ColumnMajor : order::RowMajor;
+
+    // Note: the const_cast is only here to allow the view, views of inputs are only read
+    return custom_dyn_matrix_impl<T, SO, 2>(const_cast<T*>(e.memory_start()), etl::dim<1>(e), etl::dim<0>(e));
+}
+
+} //end of namespace common
+
+} //end of namespace impl
+
+} //end of namespace etl
@@ -0,0 +1,45 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Contains the exponential shared by the softmax implementations
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace common {
+
+/*!
+ * \brief The smallest argument of the exponential in the softmax kernels.
+ *
+ * The vectorized double precision exponential is not defined below -709.
+ * All the implementations clamp the arguments at this value so that they
+ * compute the same results.
+ */
+template <typename T>
+constexpr T softmax_exp_min = T(-708);
+
+/*!
+ * \brief Compute the exponential of x, as done by the softmax kernels
+ * \param x The argument
+ * \return The exponential of x, clamped at exp(softmax_exp_min)
+ */
+template <typename T>
+inline T softmax_exp(T x) {
+    return std::exp(std::max(x, softmax_exp_min<T>));
+}
+
+} //end of namespace common
+
+} //end of namespace impl
+
+} //end of namespace etl
@@ -0,0 +1,118 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Contains the result type of the statistics reduction
+ */
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief The statistics of a set of values, computed in one pass.
+ *
+ * The moments are kept as a mean and a sum of squared deviations from the
+ * mean (Welford), so that partial statistics can be merged (Chan). For
+ * integral types, the moments are computed in double precision.
+ */
+template <typename T>
+struct statistics {
+    using value_type  = T;                                                                  ///< The type of the values
+    using moment_type = std::conditional_t<std::is_floating_point<T>::value, T, double>; ///< The type of the moments
+
+    std::size_t count  = 0;              ///< The number of values
+    moment_type mean   = moment_type(0); ///< The mean of the values
+    moment_type m2     = moment_type(0); ///< The sum of the squared deviations from the mean
+    value_type min     = value_type(0);  ///< The minimum value
+    value_type max     = value_type(0);  ///< The maximum value
+    std::size_t argmin = 0;              ///< The index of the first minimum value
+    std::size_t argmax = 0;              ///< The index of the first maximum value
+
+    /*!
+     * \brief Returns the (population) variance of the values
+     * \return the variance of the values
+     */
+    moment_type variance() const {
+        return count ? m2 / moment_type(count) : moment_type(0);
+    }
+
+    /*!
+     * \brief Returns the (population) standard deviation of the values
+     * \return the standard deviation of the values
+     */
+    moment_type stddev() const {
+        return std::sqrt(variance());
+    }
+
+    /*!
+     * \brief Add the value at the given index to the statistics.
+     *
+     * The indices must be pushed in increasing order.
+     *
+     * \param i The index of the value
+     * \param value The value
+     */
+    void push(std::size_t i, value_type value) {
+        if (!count) {
+            min    = value;
+            max    = value;
+            argmin = i;
+            argmax = i;
+        } else if (value < min) {
+            min    = value;
+            argmin = i;
+        } else if (value > max) {
+            max    = value;
+            argmax = i;
+        }
+
+        ++count;
+
+        const moment_type delta = moment_type(value) - mean;
+        mean += delta / moment_type(count);
+        m2 += delta * (moment_type(value) - mean);
+    }
+
+    /*!
+     * \brief Merge the statistics of the values following the values of
+     * these statistics.
+     * \param rhs The statistics of the following values
+     */
+    void merge(const statistics& rhs) {
+        if (!rhs.count) {
+            return;
+        }
+
+        if (!count) {
+            *this = rhs;
+            return;
+        }
+
+        const moment_type n     = moment_type(count) + moment_type(rhs.count);
+        const moment_type delta = rhs.mean - mean;
+
+        mean += delta * (moment_type(rhs.count) / n);
+        m2 += rhs.m2 + delta * delta * (moment_type(count) * moment_type(rhs.count) / n);
+
+        count += rhs.count;
+
+        // On ties, the first values win
+        if (rhs.min < min) {
+            min    = rhs.min;
+            argmin = rhs.argmin;
+        }
+
+        if (rhs.max > max) {
+            max    = rhs.max;
+            argmax = rhs.argmax;
+        }
+    }
+};
+
+} //end of namespace etl
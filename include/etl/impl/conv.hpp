@@ -27,6 +27,7 @@
 #include "etl/impl/avx/conv.hpp"
 #include "etl/impl/vec/conv.hpp"
 #include "etl/impl/reduc/conv_multi.hpp"
+#include "etl/impl/winograd/conv.hpp"
 #include "etl/impl/cudnn/conv.hpp"
 
 #include "etl/impl/conv_select.hpp" // The selection functions
@@ -41,6 +41,8 @@ struct conv1_full_impl {
             }, 0, size(conv));
         } else if (impl == etl::conv_impl::FFT_STD) {
             impl::standard::conv1_full_fft(input, kernel, conv);
+        } else if (impl == etl::conv_impl::FFT_OLA) {
+            impl::standard::conv1_full_fft_ola(input, kernel, conv);
         } else if (impl == etl::conv_impl::FFT_MKL) {
             impl::blas::conv1_full(input, kernel, conv);
         } else if (impl == etl::conv_impl::FFT_CUFFT) {
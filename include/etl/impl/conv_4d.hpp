@@ -27,7 +27,7 @@ struct conv4_valid_impl {
      */
     template <typename I, typename K, typename C>
     static void apply(const I& input, const K& kernel, C&& conv) {
-        auto impl = select_conv4_valid_impl<I, K, C>();
+        auto impl = select_conv4_valid_impl<I, K, C>(winograd_conv(etl::dim<2>(kernel), etl::dim<3>(kernel), S1, S2), etl::dim<0>(kernel) * etl::dim<1>(kernel));
 
         if (impl == etl::conv4_impl::CUDNN) {
             impl::cudnn::conv4_valid(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
@@ -37,6 +37,8 @@ struct conv4_valid_impl {
             impl::avx::conv4_valid(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::SSE) {
             impl::sse::conv4_valid(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
+        } else if (impl == etl::conv4_impl::WINOGRAD) {
+            impl::winograd::conv4_valid(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::STD) {
             impl::standard::conv4_valid(input, kernel, conv, S1, S2, P1, P2);
         } else {
@@ -138,7 +140,7 @@ struct conv4_valid_flipped_impl : conv4_valid_impl<S1, S2, P1, P2> {
      */
     template <typename I, typename K, typename C>
     static void apply(const I& input, const K& kernel, C&& conv) {
-        auto impl = select_conv4_valid_impl<I, K, C>();
+        auto impl = select_conv4_valid_impl<I, K, C>(winograd_conv(etl::dim<2>(kernel), etl::dim<3>(kernel), S1, S2), etl::dim<0>(kernel) * etl::dim<1>(kernel));
 
         if (impl == etl::conv4_impl::CUDNN) {
             impl::cudnn::conv4_valid_flipped(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
@@ -148,6 +150,8 @@ struct conv4_valid_flipped_impl : conv4_valid_impl<S1, S2, P1, P2> {
             impl::avx::conv4_valid_flipped(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::SSE) {
             impl::sse::conv4_valid_flipped(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
+        } else if (impl == etl::conv4_impl::WINOGRAD) {
+            impl::winograd::conv4_valid_flipped(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::STD) {
             impl::standard::conv4_valid_flipped(input, kernel, conv, S1, S2, P1, P2);
         } else {
@@ -49,7 +49,7 @@ struct conv2_valid_multi_impl {
      */
     template <typename I, typename K, typename C>
     static void apply(const I& input, const K& kernel, C&& conv) {
-        auto impl = select_conv_valid_multi_impl<I, K, C>();
+        auto impl = select_conv_valid_multi_impl<I, K, C>(winograd_conv(etl::dim<1>(kernel), etl::dim<2>(kernel), S1, S2));
 
         if (impl == etl::conv_multi_impl::BLAS) {
             impl::reduc::blas_conv2_valid_multi(input, kernel, conv, S1, S2, P1, P2);
@@ -61,6 +61,8 @@ struct conv2_valid_multi_impl {
             impl::avx::conv2_valid_multi(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
         } else if (impl == etl::conv_multi_impl::SSE) {
             impl::sse::conv2_valid_multi(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
+        } else if (impl == etl::conv_multi_impl::WINOGRAD) {
+            impl::winograd::conv2_valid_multi(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
         } else if (impl == etl::conv_multi_impl::STD){
             impl::standard::conv2_valid_multi(input, kernel, conv, S1, S2, P1, P2);
         } else {
@@ -153,7 +155,7 @@ struct conv2_valid_multi_flipped_impl : conv2_valid_multi_impl<S1, S2, P1, P2> {
      */
     template <typename I, typename K, typename C>
     static void apply(const I& input, const K& kernel, C&& conv) {
-        auto impl = select_conv_valid_multi_impl<I, K, C>();
+        auto impl = select_conv_valid_multi_impl<I, K, C>(winograd_conv(etl::dim<1>(kernel), etl::dim<2>(kernel), S1, S2));
 
         if (impl == etl::conv_multi_impl::BLAS) {
             impl::reduc::blas_conv2_valid_multi_flipped(input, kernel, conv, S1, S2, P1, P2);
@@ -165,6 +167,8 @@ struct conv2_valid_multi_flipped_impl : conv2_valid_multi_impl<S1, S2, P1, P2> {
             impl::avx::conv2_valid_multi_flipped(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
         } else if (impl == etl::conv_multi_impl::SSE) {
             impl::sse::conv2_valid_multi_flipped(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
+        } else if (impl == etl::conv_multi_impl::WINOGRAD) {
+            impl::winograd::conv2_valid_multi_flipped(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
         } else if (impl == etl::conv_multi_impl::STD){
             impl::standard::conv2_valid_multi_flipped(input, kernel, conv, S1, S2, P1, P2);
         } else {
@@ -193,7 +197,7 @@ struct conv2_valid_multi_multi_impl {
      */
     template <typename I, typename K, typename C>
     static void apply(const I& input, const K& kernel, C&& conv) {
-        auto impl = select_conv_valid_multi_multi_impl<I, K, C>();
+        auto impl = select_conv_valid_multi_multi_impl<I, K, C>(winograd_conv(etl::dim<1>(kernel), etl::dim<2>(kernel), S1, S2));
 
         if (impl == etl::conv_multi_impl::BLAS) {
             impl::reduc::blas_conv2_valid_multi_multi(input, kernel, conv, S1, S2, P1, P2);
@@ -203,6 +207,8 @@ struct conv2_valid_multi_multi_impl {
             impl::avx::conv2_valid_multi_multi(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
         } else if (impl == etl::conv_multi_impl::SSE) {
             impl::sse::conv2_valid_multi_multi(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
+        } else if (impl == etl::conv_multi_impl::WINOGRAD) {
+            impl::winograd::conv2_valid_multi_multi(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
         } else if (impl == etl::conv_multi_impl::STD){
             impl::standard::conv2_valid_multi_multi(input, kernel, conv, S1, S2, P1, P2);
         } else {
@@ -300,7 +306,7 @@ struct conv2_valid_multi_multi_flipped_impl : conv2_valid_multi_multi_impl<S1, S
      */
     template <typename I, typename K, typename C>
     static void apply(const I& input, const K& kernel, C&& conv) {
-        auto impl = select_conv_valid_multi_multi_impl<I, K, C>();
+        auto impl = select_conv_valid_multi_multi_impl<I, K, C>(winograd_conv(etl::dim<1>(kernel), etl::dim<2>(kernel), S1, S2));
 
         if (impl == etl::conv_multi_impl::BLAS) {
             impl::reduc::blas_conv2_valid_multi_multi_flipped(input, kernel, conv, S1, S2, P1, P2);
@@ -310,6 +316,8 @@ struct conv2_valid_multi_multi_flipped_impl : conv2_valid_multi_multi_impl<S1, S
             impl::avx::conv2_valid_multi_multi_flipped(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
         } else if (impl == etl::conv_multi_impl::SSE) {
             impl::sse::conv2_valid_multi_multi_flipped(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
+        } else if (impl == etl::conv_multi_impl::WINOGRAD) {
+            impl::winograd::conv2_valid_multi_multi_flipped(input.direct(), kernel.direct(), conv.direct(), S1, S2, P1, P2);
         } else if (impl == etl::conv_multi_impl::STD){
             impl::standard::conv2_valid_multi_multi_flipped(input, kernel, conv, S1, S2, P1, P2);
         } else {
@@ -353,7 +361,7 @@ struct dyn_conv2_valid_multi_impl {
      */
     template <typename I, typename K, typename C>
     void apply(const I& input, const K& kernel, C&& conv) const {
-        auto impl = select_conv_valid_multi_impl<I, K, C>();
+        auto impl = select_conv_valid_multi_impl<I, K, C>(winograd_conv(etl::dim<1>(kernel), etl::dim<2>(kernel), s1, s2));
 
         if (impl == etl::conv_multi_impl::BLAS) {
             impl::reduc::blas_conv2_valid_multi(input, kernel, conv, s1, s2, p1, p2);
@@ -365,6 +373,8 @@ struct dyn_conv2_valid_multi_impl {
             impl::avx::conv2_valid_multi(input.direct(), kernel.direct(), conv.direct(), s1, s2, p1, p2);
         } else if (impl == etl::conv_multi_impl::SSE) {
             impl::sse::conv2_valid_multi(input.direct(), kernel.direct(), conv.direct(), s1, s2, p1, p2);
+        } else if (impl == etl::conv_multi_impl::WINOGRAD) {
+            impl::winograd::conv2_valid_multi(input.direct(), kernel.direct(), conv.direct(), s1, s2, p1, p2);
         } else if (impl == etl::conv_multi_impl::STD){
             impl::standard::conv2_valid_multi(input, kernel, conv, s1, s2, p1, p2);
         } else {
@@ -439,7 +449,7 @@ struct dyn_conv2_valid_multi_flipped_impl : dyn_conv2_valid_multi_impl {
      */
     template <typename I, typename K, typename C>
     void apply(const I& input, const K& kernel, C&& conv) const {
-        auto impl = select_conv_valid_multi_impl<I, K, C>();
+        auto impl = select_conv_valid_multi_impl<I, K, C>(winograd_conv(etl::dim<1>(kernel), etl::dim<2>(kernel), s1, s2));
 
         if (impl == etl::conv_multi_impl::BLAS) {
             impl::reduc::blas_conv2_valid_multi_flipped(input, kernel, conv, s1, s2, p1, p2);
@@ -451,6 +461,8 @@ struct dyn_conv2_valid_multi_flipped_impl : dyn_conv2_valid_multi_impl {
             impl::avx::conv2_valid_multi_flipped(input.direct(), kernel.direct(), conv.direct(), s1, s2, p1, p2);
         } else if (impl == etl::conv_multi_impl::SSE) {
             impl::sse::conv2_valid_multi_flipped(input.direct(), kernel.direct(), conv.direct(), s1, s2, p1, p2);
+        } else if (impl == etl::conv_multi_impl::WINOGRAD) {
+            impl::winograd::conv2_valid_multi_flipped(input.direct(), kernel.direct(), conv.direct(), s1, s2, p1, p2);
         } else if (impl == etl::conv_multi_impl::STD){
             impl::standard::conv2_valid_multi_flipped(input, kernel, conv, s1, s2, p1, p2);
         } else {
@@ -494,7 +506,7 @@ struct dyn_conv2_valid_multi_multi_impl {
      */
     template <typename I, typename K, typename C>
     void apply(const I& input, const K& kernel, C&& conv) const {
-        auto impl = select_conv_valid_multi_impl<I, K, C>();
+        auto impl = select_conv_valid_multi_impl<I, K, C>(winograd_conv(etl::dim<1>(kernel), etl::dim<2>(kernel), s1, s2));
 
         if (impl == etl::conv_multi_impl::BLAS) {
             impl::reduc::blas_conv2_valid_multi_multi(input, kernel, conv, s1, s2, p1, p2);
@@ -504,6 +516,8 @@ struct dyn_conv2_valid_multi_multi_impl {
             impl::avx::conv2_valid_multi_multi(input.direct(), kernel.direct(), conv.direct(), s1, s2, p1, p2);
         } else if (impl == etl::conv_multi_impl::SSE) {
             impl::sse::conv2_valid_multi_multi(input.direct(), kernel.direct(), conv.direct(), s1, s2, p1, p2);
+        } else if (impl == etl::conv_multi_impl::WINOGRAD) {
+            impl::winograd::conv2_valid_multi_multi(input.direct(), kernel.direct(), conv.direct(), s1, s2, p1, p2);
         } else if (impl == etl::conv_multi_impl::STD){
             impl::standard::conv2_valid_multi_multi(input, kernel, conv, s1, s2, p1, p2);
         } else {
@@ -579,7 +593,7 @@ struct dyn_conv2_valid_multi_multi_flipped_impl : dyn_conv2_valid_multi_multi_im
      */
     template <typename I, typename K, typename C>
     void apply(const I& input, const K& kernel, C&& conv) const {
-        auto impl = select_conv_valid_multi_impl<I, K, C>();
+        auto impl = select_conv_valid_multi_impl<I, K, C>(winograd_conv(etl::dim<1>(kernel), etl::dim<2>(kernel), s1, s2));
 
         if (impl == etl::conv_multi_impl::BLAS) {
             impl::reduc::blas_conv2_valid_multi_multi_flipped(input, kernel, conv, s1, s2, p1, p2);
@@ -589,6 +603,8 @@ struct dyn_conv2_valid_multi_multi_flipped_impl : dyn_conv2_valid_multi_multi_im
             impl::avx::conv2_valid_multi_multi_flipped(input.direct(), kernel.direct(), conv.direct(), s1, s2, p1, p2);
         } else if (impl == etl::conv_multi_impl::SSE) {
             impl::sse::conv2_valid_multi_multi_flipped(input.direct(), kernel.direct(), conv.direct(), s1, s2, p1, p2);
+        } else if (impl == etl::conv_multi_impl::WINOGRAD) {
+            impl::winograd::conv2_valid_multi_multi_flipped(input.direct(), kernel.direct(), conv.direct(), s1, s2, p1, p2);
         } else if (impl == etl::conv_multi_impl::STD){
             impl::standard::conv2_valid_multi_multi_flipped(input, kernel, conv, s1, s2, p1, p2);
         } else {
@@ -37,6 +37,33 @@ constexpr bool is_multi(conv_type type){
 
 namespace detail {
 
+/*!
+ * \brief Traits indicating if the Winograd implementation can be used
+ * for the convolution of I and K in C.
+ *
+ * The dimensions must also be checked at runtime, with winograd_conv.
+ */
+template <typename I, typename K, typename C>
+using winograd_able = cpp::and_u<
+    all_dma<I, K, C>::value,
+    cpp::or_u<all_single_precision<I, K, C>::value, all_double_precision<I, K, C>::value>::value,
+    decay_traits<I>::storage_order == order::RowMajor,
+    decay_traits<K>::storage_order == order::RowMajor,
+    decay_traits<C>::storage_order == order::RowMajor>;
+
+/*!
+ * \brief Indicates if a convolution can be computed with the Winograd
+ * implementation, based on its dimensions.
+ * \param k1 The first dimension of the kernel
+ * \param k2 The second dimension of the kernel
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \return true if the Winograd implementation can be used, false otherwise
+ */
+inline bool winograd_conv(std::size_t k1, std::size_t k2, std::size_t s1, std::size_t s2) {
+    return k1 == 3 && k2 == 3 && s1 == 1 && s2 == 1;
+}
+
 /*!
  * \brief Select the implementation of the conv of I and K in C
  *
@@ -250,10 +277,12 @@ inline etl::conv_impl select_conv_impl() {
  * \tparam I The input type
  * \tparam K The kernel type
  * \tparam C The conv type
+ * \param winograd Indicates if the dimensions of the convolution allow the Winograd implementation
+ * \param channels The number of kernels times the number of channels
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-inline etl::conv4_impl select_default_conv4_valid_impl() {
+inline etl::conv4_impl select_default_conv4_valid_impl(bool winograd = false, std::size_t channels = 0) {
     //Note: since the constexpr values will be known at compile time, the
     //conditions will be a lot simplified
 
@@ -274,6 +303,18 @@ inline etl::conv4_impl select_default_conv4_valid_impl() {
         return etl::conv4_impl::CUDNN;
     }
 
+    //With enough channels and kernels, the transformations of the Winograd implementation
+    //are amortized and its multiplications are done by GEMM
+    if (winograd && winograd_able<I, K, C>::value && channels >= conv4_winograd_min_channels) {
+        return etl::conv4_impl::WINOGRAD;
+    }
+
+    //The GEMM of the BLAS implementation is dispatched to AVX-512 on hosts
+    //wider than the binary, which is faster than the pinned AVX kernels
+    if (vectorize_impl && isa_avx512()) {
+        return etl::conv4_impl::BLAS;
+    }
+
     if (conv4_prefer_blas) {
         if (is_cublas_enabled || is_mkl_enabled) {
             return etl::conv4_impl::BLAS;
@@ -300,10 +341,12 @@ inline etl::conv4_impl select_default_conv4_valid_impl() {
  * \tparam I The input type
  * \tparam K The kernel type
  * \tparam C The conv type
+ * \param winograd Indicates if the dimensions of the convolution allow the Winograd implementation
+ * \param channels The number of kernels times the number of channels
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-inline etl::conv4_impl select_conv4_valid_impl() {
+inline etl::conv4_impl select_conv4_valid_impl(bool winograd = false, std::size_t channels = 0) {
     if (local_context().conv4_selector.forced) {
         auto forced = local_context().conv4_selector.impl;
 
@@ -312,7 +355,7 @@ inline etl::conv4_impl select_conv4_valid_impl() {
             case conv4_impl::SSE:
                 if (!sse3_enabled) {                                                                                               // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to SSE conv implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_impl<I, K, C>();                                                                   // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_impl<I, K, C>(winograd, channels);                                                                   // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                 // COVERAGE_EXCLUDE_LINE
 
                 return forced;
@@ -321,7 +364,7 @@ inline etl::conv4_impl select_conv4_valid_impl() {
             case conv4_impl::AVX:
                 if (!avx_enabled) {                                                                                               // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to AVX conv implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_impl<I, K, C>();                                                                   // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_impl<I, K, C>(winograd, channels);                                                                   // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                 // COVERAGE_EXCLUDE_LINE
 
                 return forced;
@@ -330,17 +373,26 @@ inline etl::conv4_impl select_conv4_valid_impl() {
             case conv4_impl::CUDNN:
                 if (!is_cudnn_enabled) {                                                                                               // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to CUDNN conv implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_impl<I, K, C>();                                                                   // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_impl<I, K, C>(winograd, channels);                                                                   // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                 // COVERAGE_EXCLUDE_LINE
 
                 return forced;
 
+            //WINOGRAD cannot always be used
+            case conv4_impl::WINOGRAD:
+                if (!winograd || !winograd_able<I, K, C>::value) {                                                                     // COVERAGE_EXCLUDE_LINE
+                    std::cerr << "Forced selection to WINOGRAD conv implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_impl<I, K, C>(winograd, channels);                                                           // COVERAGE_EXCLUDE_LINE
+                }                                                                                                                   // COVERAGE_EXCLUDE_LINE
+
+                return forced;
+
             default:
                 return forced;
         }
     }
 
-    return select_default_conv4_valid_impl<I, K, C>();
+    return select_default_conv4_valid_impl<I, K, C>(winograd, channels);
 }
 
 /*!
@@ -460,10 +512,11 @@ inline etl::conv4_impl select_conv4_full_impl() {
  * \tparam I The input type
  * \tparam K The kernel type
  * \tparam C The conv type
+ * \param winograd Indicates if the dimensions of the convolution allow the Winograd implementation
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-inline etl::conv_multi_impl select_default_conv_valid_multi() {
+inline etl::conv_multi_impl select_default_conv_valid_multi(bool winograd = false) {
     //Note: since the constexpr values will be known at compile time, the
     //conditions will be a lot simplified
 
@@ -491,12 +544,22 @@ inline etl::conv_multi_impl select_default_conv_valid_multi() {
         return etl::conv_multi_impl::BLAS;
     }
 
+    //The GEMM of the BLAS implementation is dispatched to AVX-512 on hosts
+    //wider than the binary
+    if (vectorize_impl && isa_avx512()) {
+        return etl::conv_multi_impl::BLAS;
+    }
+
     if (avx) {
         return etl::conv_multi_impl::AVX;
     } else if (sse) {
         return etl::conv_multi_impl::SSE;
     }
 
+    if (winograd && winograd_able<I, K, C>::value) {
+        return etl::conv_multi_impl::WINOGRAD;
+    }
+
     return etl::conv_multi_impl::STD;
 }
 
@@ -508,10 +571,11 @@ inline etl::conv_multi_impl select_default_conv_valid_multi() {
  * \tparam I The input type
  * \tparam K The kernel type
  * \tparam C The conv type
+ * \param winograd Indicates if the dimensions of the convolution allow the Winograd implementation
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-inline etl::conv_multi_impl select_default_conv_valid_multi_multi_impl() {
+inline etl::conv_multi_impl select_default_conv_valid_multi_multi_impl(bool winograd = false) {
     //Note: since the constexpr values will be known at compile time, the
     //conditions will be a lot simplified
 
@@ -527,6 +591,12 @@ inline etl::conv_multi_impl select_default_conv_valid_multi_multi_impl() {
     static constexpr bool sse = vectorize_impl && vector_mode == vector_mode_t::SSE3;
     static constexpr bool avx = vectorize_impl && vector_mode == vector_mode_t::AVX;
 
+    //The GEMM of the BLAS implementation is dispatched to AVX-512 on hosts
+    //wider than the binary
+    if (vectorize_impl && isa_avx512()) {
+        return etl::conv_multi_impl::BLAS;
+    }
+
     if (avx) {
         return etl::conv_multi_impl::AVX;
     } else if (sse) {
@@ -539,6 +609,10 @@ inline etl::conv_multi_impl select_default_conv_valid_multi_multi_impl() {
         return etl::conv_multi_impl::FFT;
     }
 
+    if (winograd && winograd_able<I, K, C>::value) {
+        return etl::conv_multi_impl::WINOGRAD;
+    }
+
     return etl::conv_multi_impl::STD;
 }
 
@@ -547,10 +621,11 @@ inline etl::conv_multi_impl select_default_conv_valid_multi_multi_impl() {
  * \tparam I The input type
  * \tparam K The kernel type
  * \tparam C The conv type
+ * \param winograd Indicates if the dimensions of the convolution allow the Winograd implementation
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-inline etl::conv_multi_impl select_conv_valid_multi_impl() {
+inline etl::conv_multi_impl select_conv_valid_multi_impl(bool winograd = false) {
     if (local_context().conv_multi_selector.forced) {
         auto forced = local_context().conv_multi_selector.impl;
 
@@ -559,7 +634,7 @@ inline etl::conv_multi_impl select_conv_valid_multi_impl() {
             case conv_multi_impl::CUDNN:
                 if (!is_cudnn_enabled) {                                                                                               // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to CUDNN conv implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv_valid_multi<I, K, C>();                                                                   // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv_valid_multi<I, K, C>(winograd);                                                                   // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                 // COVERAGE_EXCLUDE_LINE
 
                 return forced;
@@ -568,7 +643,7 @@ inline etl::conv_multi_impl select_conv_valid_multi_impl() {
             case conv_multi_impl::AVX:
                 if (!avx_enabled) {
                     std::cerr << "Forced selection to AVX conv implementation, but not possible for this expression" << std::endl;
-                    return select_default_conv_valid_multi<I, K, C>();                                                                   // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv_valid_multi<I, K, C>(winograd);                                                                   // COVERAGE_EXCLUDE_LINE
                 }
 
                 return forced;
@@ -577,7 +652,16 @@ inline etl::conv_multi_impl select_conv_valid_multi_impl() {
             case conv_multi_impl::SSE:
                 if (!sse3_enabled) {
                     std::cerr << "Forced selection to SSE conv implementation, but not possible for this expression" << std::endl;
-                    return select_default_conv_valid_multi<I, K, C>();                                                                   // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv_valid_multi<I, K, C>(winograd);                                                                   // COVERAGE_EXCLUDE_LINE
+                }
+
+                return forced;
+
+            //WINOGRAD cannot always be used
+            case conv_multi_impl::WINOGRAD:
+                if (!winograd || !winograd_able<I, K, C>::value) {
+                    std::cerr << "Forced selection to WINOGRAD conv implementation, but not possible for this expression" << std::endl;
+                    return select_default_conv_valid_multi<I, K, C>(winograd); // COVERAGE_EXCLUDE_LINE
                 }
 
                 return forced;
@@ -589,7 +673,7 @@ inline etl::conv_multi_impl select_conv_valid_multi_impl() {
         }
     }
 
-    return select_default_conv_valid_multi<I, K, C>();
+    return select_default_conv_valid_multi<I, K, C>(winograd);
 }
 
 /*!
@@ -597,10 +681,11 @@ inline etl::conv_multi_impl select_conv_valid_multi_impl() {
  * \tparam I The input type
  * \tparam K The kernel type
  * \tparam C The conv type
+ * \param winograd Indicates if the dimensions of the convolution allow the Winograd implementation
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-inline etl::conv_multi_impl select_conv_valid_multi_multi_impl() {
+inline etl::conv_multi_impl select_conv_valid_multi_multi_impl(bool winograd = false) {
     if (local_context().conv_multi_selector.forced) {
         auto forced = local_context().conv_multi_selector.impl;
 
@@ -609,7 +694,7 @@ inline etl::conv_multi_impl select_conv_valid_multi_multi_impl() {
             case conv_multi_impl::AVX:
                 if (!avx_enabled) {
                     std::cerr << "Forced selection to AVX conv implementation, but not possible for this expression" << std::endl;
-                    return select_default_conv_valid_multi_multi_impl<I, K, C>();                                                                   // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv_valid_multi_multi_impl<I, K, C>(winograd);                                                                   // COVERAGE_EXCLUDE_LINE
                 }
 
                 return forced;
@@ -618,7 +703,16 @@ inline etl::conv_multi_impl select_conv_valid_multi_multi_impl() {
             case conv_multi_impl::SSE:
                 if (!sse3_enabled) {
                     std::cerr << "Forced selection to SSE conv implementation, but not possible for this expression" << std::endl;
-                    return select_default_conv_valid_multi_multi_impl<I, K, C>();                                                                   // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv_valid_multi_multi_impl<I, K, C>(winograd);                                                                   // COVERAGE_EXCLUDE_LINE
+                }
+
+                return forced;
+
+            //WINOGRAD cannot always be used
+            case conv_multi_impl::WINOGRAD:
+                if (!winograd || !winograd_able<I, K, C>::value) {
+                    std::cerr << "Forced selection to WINOGRAD conv implementation, but not possible for this expression" << std::endl;
+                    return select_default_conv_valid_multi_multi_impl<I, K, C>(winograd); // COVERAGE_EXCLUDE_LINE
                 }
 
                 return forced;
@@ -630,7 +724,7 @@ inline etl::conv_multi_impl select_conv_valid_multi_multi_impl() {
         }
     }
 
-    return select_default_conv_valid_multi_multi_impl<I, K, C>();
+    return select_default_conv_valid_multi_multi_impl<I, K, C>(winograd);
 }
 
 /*!
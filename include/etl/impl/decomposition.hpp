@@ -7,20 +7,78 @@
 
 /*!
  * \file
- * \brief Selector for the decompositions implementation
+ * \brief Selector for the decompositions implementation (LU, Cholesky and QR)
+ *
+ * The decompositions and the solves work on row major temporaries. The
+ * blocked and vectorized implementation is used for single and double
+ * precision, the standard implementation otherwise.
  */
 
 #pragma once
 
 //Include the implementations
 #include "etl/impl/std/decomposition.hpp"
+#include "etl/impl/vec/decomposition.hpp"
 
 namespace etl {
 
 namespace detail {
 
 /*!
- * \brief Functor for euclidean norm
+ * \brief Functor for the in-place LU decomposition
+ */
+struct lu_factor_impl {
+    /*!
+     * \brief Decompose lu in place
+     * \param lu The row major matrix to decompose, replaced by its decomposition
+     * \param perm The permutation of the rows (output)
+     * \return false if the matrix is singular, true otherwise
+     */
+    template <typename LU>
+    static bool apply(LU& lu, std::vector<std::size_t>& perm) {
+        if (impl::vec::decomposition_vectorizable<LU>::value) {
+            return etl::impl::vec::lu_factor(lu, perm);
+        } else {
+            return etl::impl::standard::lu_factor(lu, perm);
+        }
+    }
+};
+
+/*!
+ * \brief Functor for the in-place solve with a LU decomposition
+ */
+struct lu_solve_impl {
+    /*!
+     * \brief Solve A X = B in place
+     * \param lu The LU decomposition of A
+     * \param perm The permutation of the rows of the decomposition
+     * \param x The row major matrix containing B, replaced by X
+     */
+    template <typename LU, typename X, cpp_enable_if(all_dma<LU>::value, all_row_major<LU>::value)>
+    static void apply(const LU& lu, const std::vector<std::size_t>& perm, X& x) {
+        if (impl::vec::decomposition_vectorizable<LU>::value) {
+            etl::impl::vec::lu_solve(lu, perm, x);
+        } else {
+            etl::impl::standard::lu_solve(lu, perm, x);
+        }
+    }
+
+    /*!
+     * \copydoc apply
+     */
+    template <typename LU, typename X, cpp_disable_if(all_dma<LU>::value && all_row_major<LU>::value)>
+    static void apply(const LU& lu, const std::vector<std::size_t>& perm, X& x) {
+        // The decomposition is first stored in a row major temporary
+        etl::dyn_matrix<value_t<LU>> lu_rm(etl::dim<0>(lu), etl::dim<1>(lu));
+
+        lu_rm = lu;
+
+        apply(lu_rm, perm, x);
+    }
+};
+
+/*!
+ * \brief Functor for the PA=LU decomposition
  */
 struct lu_impl {
     /*!
@@ -32,7 +90,97 @@ struct lu_impl {
      */
     template <typename AT, typename LT, typename UT, typename PT>
     static void apply(const AT& A, LT& L, UT& U, PT& P) {
-        etl::impl::standard::lu(A, L, U, P);
+        const auto n = etl::dim<0>(A);
+
+        etl::dyn_matrix<value_t<AT>> lu(n, n);
+        std::vector<std::size_t> perm(n);
+
+        lu = A;
+
+        lu_factor_impl::apply(lu, perm);
+
+        L = 0;
+        U = 0;
+        P = 0;
+
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < i; ++j) {
+                L(i, j) = lu(i, j);
+            }
+
+            L(i, i) = 1;
+
+            for (std::size_t j = i; j < n; ++j) {
+                U(i, j) = lu(i, j);
+            }
+
+            P(i, perm[i]) = 1;
+        }
+    }
+};
+
+/*!
+ * \brief Functor for the Cholesky decomposition
+ */
+struct cholesky_impl {
+    /*!
+     * \brief Apply the functor to A, L
+     * \param A The input matrix
+     * \param L The L decomposition (output)
+     * \return false if A is not positive definite, true otherwise
+     */
+    template <typename AT, typename LT>
+    static bool apply(const AT& A, LT& L) {
+        const auto n = etl::dim<0>(A);
+
+        etl::dyn_matrix<value_t<AT>> l(n, n);
+
+        l = A;
+
+        bool spd;
+
+        if (impl::vec::decomposition_vectorizable<AT>::value) {
+            spd = etl::impl::vec::cholesky(l);
+        } else {
+            spd = etl::impl::standard::cholesky(l);
+        }
+
+        if (spd) {
+            L = l;
+        }
+
+        return spd;
+    }
+};
+
+/*!
+ * \brief Functor for the QR decomposition
+ */
+struct qr_impl {
+    /*!
+     * \brief Apply the functor to A, Q, R
+     * \param A The input matrix
+     * \param Q The Q decomposition (output)
+     * \param R The R decomposition (output)
+     */
+    template <typename AT, typename QT, typename RT>
+    static void apply(const AT& A, QT& Q, RT& R) {
+        const auto m = etl::dim<0>(A);
+        const auto n = etl::dim<1>(A);
+
+        etl::dyn_matrix<value_t<AT>> r(m, n);
+        etl::dyn_matrix<value_t<AT>> q(m, m);
+
+        r = A;
+
+        if (impl::vec::decomposition_vectorizable<AT>::value) {
+            etl::impl::vec::qr(r, q);
+        } else {
+            etl::impl::standard::qr(r, q);
+        }
+
+        Q = q;
+        R = r;
     }
 };
 
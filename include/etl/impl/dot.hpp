@@ -16,6 +16,7 @@
 #include "etl/impl/std/dot.hpp"
 #include "etl/impl/blas/dot.hpp"
 #include "etl/impl/vec/dot.hpp"
+#include "etl/impl/isa/kernels.hpp"
 
 namespace etl {
 
@@ -98,6 +99,8 @@ struct dot_impl {
 
         if (impl == etl::dot_impl::BLAS) {
             return etl::impl::blas::dot(a, b);
+        } else if (etl::impl::isa::isa_able<A, B>::value && !local_context().dot_selector.forced && isa_dispatch()) {
+            return etl::impl::isa::dot(a, b);
         } else if (impl == etl::dot_impl::VEC) {
             return etl::impl::vec::dot(a, b);
         } else {
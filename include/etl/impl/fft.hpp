@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "etl/impl/vec/fft.hpp"
 #include "etl/impl/std/fft.hpp"
 #include "etl/impl/blas/fft.hpp"
 #include "etl/impl/cufft/fft.hpp"
@@ -484,11 +485,9 @@ struct fft1_many_impl {
 
         fft_impl impl = select_fft1_many_impl(transforms, etl::dim<1>(c));
 
-        thread_local cpp::default_thread_pool<> pool(threads - 1);
-
         if (impl == fft_impl::STD) {
             if (parallel_dispatch) {
-                dispatch_1d(pool, parallel_dispatch, [&](std::size_t first, std::size_t last) {
+                dispatch_1d(parallel_dispatch, [&](std::size_t first, std::size_t last) {
                     etl::impl::standard::fft1_many(a.slice(first, last).direct(), c.slice(first, last).direct());
                 }, 0, transforms);
             } else {
@@ -496,7 +495,7 @@ struct fft1_many_impl {
             }
         } else if (impl == fft_impl::MKL) {
             if (parallel_dispatch) {
-                dispatch_1d(pool, parallel_dispatch, [&](std::size_t first, std::size_t last) {
+                dispatch_1d(parallel_dispatch, [&](std::size_t first, std::size_t last) {
                     etl::impl::blas::fft1_many(a.slice(first, last).direct(), c.slice(first, last).direct());
                 }, 0, transforms);
             } else {
@@ -526,13 +525,11 @@ struct fft2_many_impl {
 
         fft_impl impl = select_fft2_many_impl(etl::dim<0>(c), etl::dim<1>(c), etl::dim<2>(c));
 
-        thread_local cpp::default_thread_pool<> pool(threads - 1);
-
         if (impl == fft_impl::STD) {
             etl::impl::standard::fft2_many(a, c);
         } else if (impl == fft_impl::MKL) {
             if (parallel_dispatch) {
-                dispatch_1d(pool, parallel_dispatch, [&](std::size_t first, std::size_t last) {
+                dispatch_1d(parallel_dispatch, [&](std::size_t first, std::size_t last) {
                     etl::impl::blas::fft2_many(a.slice(first, last), c.slice(first, last));
                 }, 0, transforms);
             } else {
@@ -590,6 +587,68 @@ struct ifft2_many_impl {
     }
 };
 
+/*!
+ * \brief Functor for 1D FFT of real signals, with half spectrums
+ *
+ * Only the standard implementation stores half spectrums.
+ */
+struct rfft1_impl {
+    /*!
+     * \brief Apply the functor
+     * \param a The input sub expression
+     * \param c The output sub expression
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        etl::impl::standard::rfft1(a, c);
+    }
+};
+
+/*!
+ * \brief Functor for 1D Inverse FFT of half spectrums
+ */
+struct irfft1_impl {
+    /*!
+     * \brief Apply the functor
+     * \param a The input sub expression
+     * \param c The output sub expression
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        etl::impl::standard::irfft1(a, c);
+    }
+};
+
+/*!
+ * \brief Functor for 2D FFT of real signals, with half spectrums
+ */
+struct rfft2_impl {
+    /*!
+     * \brief Apply the functor
+     * \param a The input sub expression
+     * \param c The output sub expression
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        etl::impl::standard::rfft2(a, c);
+    }
+};
+
+/*!
+ * \brief Functor for 2D Inverse FFT of half spectrums
+ */
+struct irfft2_impl {
+    /*!
+     * \brief Apply the functor
+     * \param a The input sub expression
+     * \param c The output sub expression
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        etl::impl::standard::irfft2(a, c);
+    }
+};
+
 } //end of namespace detail
 
 } //end of namespace etl
@@ -0,0 +1,326 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Fusion of elementwise operations into matrix multiplication.
+ *
+ * An expression such as sigmoid(b + A * B) or alpha * (A * B) + beta * C
+ * is evaluated part by part of the multiplication. The VEC GEMM kernel
+ * calls back the elementwise operations on each MCxNC block of the
+ * result as soon as it is complete, the other kernels are called on
+ * panels of rows.
+ * Either way, the elementwise operations are applied while the result is
+ * still in cache, instead of doing a second pass over a complete
+ * temporary.
+ *
+ * When the result is not used in the expression, the multiplication is
+ * directly computed inside the result and no temporary is allocated at
+ * all: the elementwise operations are then applied in place.
+ */
+
+#pragma once
+
+#include "etl/impl/mmul.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Assign a range of the flat elements of expr to result, in a vectorized way
+ * \param expr The right hand side expression
+ * \param result The left hand side
+ * \param first The first element to assign
+ * \param last The last element to assign (exclusive)
+ */
+template <typename E, typename R, cpp_enable_if(vectorized_assign<E, R>::value)>
+void epilogue_assign(E& expr, R& result, std::size_t first, std::size_t last) {
+    constexpr auto V = select_vector_mode<E, R>();
+
+    using RS = decltype(memory_slice(result, first, last));
+    using ES = decltype(memory_slice(expr, first, last));
+
+    VectorizedAssign<V, RS, ES>(memory_slice(result, first, last), memory_slice(expr, first, last))();
+}
+
+/*!
+ * \brief Assign a range of the flat elements of expr to result
+ * \param expr The right hand side expression
+ * \param result The left hand side
+ * \param first The first element to assign
+ * \param last The last element to assign (exclusive)
+ */
+template <typename E, typename R, cpp_disable_if(vectorized_assign<E, R>::value)>
+void epilogue_assign(E& expr, R& result, std::size_t first, std::size_t last) {
+    using RS = decltype(memory_slice(result, first, last));
+    using ES = decltype(memory_slice(expr, first, last));
+
+    Assign<RS, ES>(memory_slice(result, first, last), memory_slice(expr, first, last))();
+}
+
+/*!
+ * \brief Rebuild an elementwise expression, replacing its matrix
+ * multiplication by a view of the memory holding its result.
+ */
+struct gemm_epilogue_rebind {
+    /*!
+     * \brief Rebuild a value, i.e. keep it
+     * \param e The value
+     * \param c The view of the result of the multiplication
+     * \return a reference to the value
+     */
+    template <typename E, typename C, cpp_enable_if(is_etl_value<E>::value)>
+    static const E& apply(const E& e, const C& c) {
+        cpp_unused(c);
+        return e;
+    }
+
+    /*!
+     * \brief Rebuild a scalar, i.e. copy it
+     * \param e The scalar
+     * \param c The view of the result of the multiplication
+     * \return a copy of the scalar
+     */
+    template <typename T, typename C>
+    static etl::scalar<T> apply(const etl::scalar<T>& e, const C& c) {
+        cpp_unused(c);
+        return e;
+    }
+
+    /*!
+     * \brief Rebuild the multiplication, i.e. replace it by the view
+     * \param e The multiplication
+     * \param c The view of the result of the multiplication
+     * \return a reference to the view
+     */
+    template <typename T, typename A, typename B, typename Op, typename C>
+    static const C& apply(const temporary_binary_expr<T, A, B, Op>& e, const C& c) {
+        cpp_unused(e);
+        return c;
+    }
+
+    /*!
+     * \brief Rebuild an unary expression
+     * \param e The unary expression
+     * \param c The view of the result of the multiplication
+     * \return the rebuilt unary expression
+     */
+    template <typename T, typename E, typename Op, typename C>
+    static auto apply(const unary_expr<T, E, Op>& e, const C& c) {
+        using sub_type = decltype(apply(e.value(), c));
+
+        return unary_expr<T, sub_type, Op>(apply(e.value(), c));
+    }
+
+    /*!
+     * \brief Rebuild a binary expression
+     * \param e The binary expression
+     * \param c The view of the result of the multiplication
+     * \return the rebuilt binary expression
+     */
+    template <typename T, typename L, typename Op, typename R, typename C>
+    static auto apply(const binary_expr<T, L, Op, R>& e, const C& c) {
+        using left_type  = decltype(apply(e.lhs(), c));
+        using right_type = decltype(apply(e.rhs(), c));
+
+        return binary_expr<T, left_type, Op, right_type>(apply(e.lhs(), c), apply(e.rhs(), c));
+    }
+};
+
+/*!
+ * \brief Compute C = A * B inside c and call the epilogue on each
+ * complete part of C
+ * \param a The lhs of the multiplication
+ * \param b The rhs of the multiplication
+ * \param c The result of the multiplication
+ * \param epilogue The functor to call on each complete part, with its range of flat elements
+ */
+template <typename Impl, typename A, typename B, typename C, typename Epilogue>
+void gemm_epilogue_mm(const A& a, const B& b, C& c, Epilogue&& epilogue) {
+    using T = value_t<C>;
+
+    const std::size_t m = etl::dim<0>(a);
+    const std::size_t k = etl::dim<1>(a);
+    const std::size_t n = etl::dim<1>(b);
+
+    if (select_gemm_impl<A, B, C>(m, k, n) == gemm_impl::VEC) {
+        // The kernel calls the epilogue on each block of C once it is complete
+        etl::impl::vec::gemm(a, b, c, [&](std::size_t first_row, std::size_t last_row, std::size_t first_column, std::size_t last_column) {
+            for (std::size_t i = first_row; i < last_row; ++i) {
+                epilogue(i * n + first_column, i * n + last_column);
+            }
+        });
+
+        return;
+    }
+
+    // Keep enough rows for the panels to remain matrix-matrix multiplications
+    const std::size_t rows = std::max(gemm_epilogue_panel / n, std::size_t(16));
+
+    for (std::size_t first = 0; first < m; first += rows) {
+        const std::size_t last = std::min(first + rows, m);
+
+        // Note: a_panel is only read, the const_cast is only here to allow the view
+        custom_dyn_matrix<T> a_panel(const_cast<T*>(a.memory_start()) + first * k, last - first, k);
+        custom_dyn_matrix<T> c_panel(c.memory_start() + first * n, last - first, n);
+
+        Impl::apply(a_panel, b, c_panel);
+
+        epilogue(first * n, last * n);
+    }
+}
+
+/*!
+ * \brief Compute c = A * b inside c and call the epilogue on each
+ * complete part of c
+ * \param a The lhs of the multiplication
+ * \param b The rhs of the multiplication
+ * \param c The result of the multiplication
+ * \param epilogue The functor to call on each complete part, with its range of flat elements
+ */
+template <typename Impl, typename A, typename B, typename C, typename Epilogue>
+void gemm_epilogue_mv(const A& a, const B& b, C& c, Epilogue&& epilogue) {
+    using T = value_t<C>;
+
+    const std::size_t m = etl::dim<0>(a);
+    const std::size_t k = etl::dim<1>(a);
+
+    for (std::size_t first = 0; first < m; first += gemm_epilogue_panel) {
+        const std::size_t last = std::min(first + gemm_epilogue_panel, m);
+
+        // Note: a_panel is only read, the const_cast is only here to allow the view
+        custom_dyn_matrix<T> a_panel(const_cast<T*>(a.memory_start()) + first * k, last - first, k);
+        custom_dyn_vector<T> c_panel(c.memory_start() + first, last - first);
+
+        Impl::apply(a_panel, b, c_panel);
+
+        epilogue(first, last);
+    }
+}
+
+/*!
+ * \brief Visitor evaluating the matrix multiplication of an expression
+ * part by part and assigning each part of the expression to the result.
+ *
+ * The expression must contain a single multiplication, as checked by
+ * is_gemm_epilogue.
+ */
+template <typename E, typename R>
+struct gemm_epilogue_static_visitor : etl_visitor<gemm_epilogue_static_visitor<E, R>, false, true> {
+    using etl_visitor<gemm_epilogue_static_visitor<E, R>, false, true>::operator();
+
+    E& expr;   ///< The complete expression
+    R& result; ///< The result of the complete expression
+
+    /*!
+     * \brief Construct a new gemm_epilogue_static_visitor
+     * \param expr The complete expression
+     * \param result The result of the complete expression
+     */
+    gemm_epilogue_static_visitor(E& expr, R& result) : expr(expr), result(result) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Compute the matrix-matrix multiplication and the elementwise
+     * operations part by part
+     * \param v The matrix-matrix multiplication expression
+     */
+    template <typename T, typename A, typename B, typename Impl>
+    void operator()(const temporary_binary_expr<T, A, B, basic_mm_mul_expr<T, Impl>>& v) const {
+        auto& a = v.a();
+        auto& b = v.b();
+
+        cpp_assert(etl::dim<0>(b) == etl::dim<1>(a), "Invalid sizes for multiplication");
+
+        // The result is not used by the expression, the multiplication can be computed inside it
+        if (!expr.alias(result)) {
+            custom_dyn_matrix<T> c(result.memory_start(), etl::dim<0>(a), etl::dim<1>(b));
+
+            auto epilogue = gemm_epilogue_rebind::apply(expr, c);
+
+            gemm_epilogue_mm<Impl>(a, b, c, [&](std::size_t first, std::size_t last) {
+                epilogue_assign(epilogue, result, first, last);
+            });
+
+            return;
+        }
+
+        v.allocate_temporary();
+
+        // The parts of the result would overwrite the inputs
+        if (result.alias(a) || result.alias(b)) {
+            v.evaluate();
+            epilogue_assign(expr, result, 0, etl::size(result));
+            return;
+        }
+
+        v.evaluate_by([&](auto& c) {
+            gemm_epilogue_mm<Impl>(a, b, c, [&](std::size_t first, std::size_t last) {
+                epilogue_assign(expr, result, first, last);
+            });
+        });
+    }
+
+    /*!
+     * \brief Compute the matrix-vector multiplication and the elementwise
+     * operations part by part
+     * \param v The matrix-vector multiplication expression
+     */
+    template <typename T, typename A, typename B, typename Impl>
+    void operator()(const temporary_binary_expr<T, A, B, basic_mv_mul_expr<T, Impl>>& v) const {
+        auto& a = v.a();
+        auto& b = v.b();
+
+        cpp_assert(etl::dim<0>(b) == etl::dim<1>(a), "Invalid sizes for multiplication");
+
+        // The result is not used by the expression, the multiplication can be computed inside it
+        if (!expr.alias(result)) {
+            custom_dyn_vector<T> c(result.memory_start(), etl::dim<0>(a));
+
+            auto epilogue = gemm_epilogue_rebind::apply(expr, c);
+
+            gemm_epilogue_mv<Impl>(a, b, c, [&](std::size_t first, std::size_t last) {
+                epilogue_assign(epilogue, result, first, last);
+            });
+
+            return;
+        }
+
+        v.allocate_temporary();
+
+        // The parts of the result would overwrite the inputs
+        if (result.alias(a) || result.alias(b)) {
+            v.evaluate();
+            epilogue_assign(expr, result, 0, etl::size(result));
+            return;
+        }
+
+        v.evaluate_by([&](auto& c) {
+            gemm_epilogue_mv<Impl>(a, b, c, [&](std::size_t first, std::size_t last) {
+                epilogue_assign(expr, result, first, last);
+            });
+        });
+    }
+};
+
+/*!
+ * \brief Evaluate the expression into result, fusing its elementwise
+ * operations into its matrix multiplication.
+ * \param expr The right hand side expression
+ * \param result The left hand side
+ */
+template <typename E, typename R>
+void gemm_epilogue(E& expr, R& result) {
+    gemm_epilogue_static_visitor<E, R> visitor(expr, result);
+    visitor(expr);
+}
+
+} //end of namespace detail
+
+} //end of namespace etl
@@ -0,0 +1,83 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Instantiate kernels for the instruction sets wider than the
+ * baseline of the binary.
+ *
+ * ETL_ISA_KERNELS must be defined to the name of a file containing kernels
+ * of etl::impl::vec. The file is included in the etl::impl::vec::avx512
+ * and etl::impl::vec::avx namespaces inside #pragma GCC target regions, so
+ * that the templates it contains are compiled for these instruction sets
+ * when they are instantiated. In these namespaces, default_vec and the
+ * configuration of the vector modes are the ones of the instruction set.
+ *
+ * The kernels can only access the operands through functions that are
+ * always inlined, the functions compiled for the baseline cannot receive
+ * or return the vectors of a wider instruction set.
+ *
+ * This file has no include guard, it is included once per file of kernels.
+ */
+
+#ifdef ETL_ISA_AVX512
+
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx2,fma")
+
+#define ETL_TARGET_AVX512
+#define ETL_TARGET_AVX
+#define ETL_TARGET_SSE3
+
+namespace etl {
+namespace impl {
+namespace vec {
+namespace avx512 {
+
+#include ETL_ISA_KERNELS
+
+} //end of namespace avx512
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
+
+#undef ETL_TARGET_AVX512
+#undef ETL_TARGET_AVX
+#undef ETL_TARGET_SSE3
+
+#pragma GCC pop_options
+
+#endif
+
+#ifdef ETL_ISA_AVX
+
+#pragma GCC push_options
+#pragma GCC target("avx")
+
+#define ETL_TARGET_AVX
+#define ETL_TARGET_SSE3
+
+namespace etl {
+namespace impl {
+namespace vec {
+namespace avx {
+
+#include ETL_ISA_KERNELS
+
+} //end of namespace avx
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
+
+#undef ETL_TARGET_AVX
+#undef ETL_TARGET_SSE3
+
+#pragma GCC pop_options
+
+#endif
+
+#undef ETL_ISA_KERNELS
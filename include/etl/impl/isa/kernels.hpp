@@ -0,0 +1,475 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Kernels on raw memory, compiled for several instruction sets and
+ * dispatched at runtime.
+ *
+ * The kernels are simple loops written so that they are auto-vectorized with
+ * the instruction set of each version of target_clones. The kernels using the
+ * intrinsics of the vector implementations are instantiated for each
+ * instruction set in target regions instead (see impl/isa/instantiate.hpp).
+ * Each kernel works on blocks of 128 bytes, with the loads of a block done
+ * before its stores, so that they are vectorized even when the memory of the
+ * result aliases the memory of the operands.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace isa {
+
+namespace detail {
+
+/*!
+ * \brief The number of elements of type T processed in each block
+ */
+template <typename T>
+constexpr std::size_t block_size = 128 / sizeof(T);
+
+/*!
+ * \brief Compute the sum of the n elements of a
+ */
+template <typename T>
+ETL_STRONG_INLINE(T) sum_kernel(const T* a, std::size_t n) {
+    constexpr std::size_t B = block_size<T>;
+
+    T acc[B] = {};
+
+    std::size_t i = 0;
+
+    for (; i + B <= n; i += B) {
+        for (std::size_t j = 0; j < B; ++j) {
+            acc[j] += a[i + j];
+        }
+    }
+
+    T r(0);
+
+    for (; i < n; ++i) {
+        r += a[i];
+    }
+
+    for (std::size_t j = 0; j < B; ++j) {
+        r += acc[j];
+    }
+
+    return r;
+}
+
+/*!
+ * \brief Compute the dot product of the n elements of a and b
+ */
+template <typename T>
+ETL_STRONG_INLINE(T) dot_kernel(const T* a, const T* b, std::size_t n) {
+    constexpr std::size_t B = block_size<T>;
+
+    T acc[B] = {};
+
+    std::size_t i = 0;
+
+    for (; i + B <= n; i += B) {
+        for (std::size_t j = 0; j < B; ++j) {
+            acc[j] += a[i + j] * b[i + j];
+        }
+    }
+
+    T r(0);
+
+    for (; i < n; ++i) {
+        r += a[i] * b[i];
+    }
+
+    for (std::size_t j = 0; j < B; ++j) {
+        r += acc[j];
+    }
+
+    return r;
+}
+
+/*!
+ * \brief Compute r[i] = a[i] op b[i] for the n elements of r
+ */
+template <typename Op, typename T>
+ETL_STRONG_INLINE(void) binary_kernel(T* r, const T* a, const T* b, std::size_t n) {
+    constexpr std::size_t B = block_size<T>;
+
+    std::size_t i = 0;
+
+    for (; i + B <= n; i += B) {
+        T t[B];
+
+        for (std::size_t j = 0; j < B; ++j) {
+            t[j] = Op::apply(a[i + j], b[i + j]);
+        }
+
+        for (std::size_t j = 0; j < B; ++j) {
+            r[i + j] = t[j];
+        }
+    }
+
+    for (; i < n; ++i) {
+        r[i] = Op::apply(a[i], b[i]);
+    }
+}
+
+/*!
+ * \brief Scalar addition
+ */
+struct add_scalar {
+    template <typename T>
+    static T apply(T a, T b) {
+        return a + b;
+    }
+};
+
+/*!
+ * \brief Scalar subtraction
+ */
+struct sub_scalar {
+    template <typename T>
+    static T apply(T a, T b) {
+        return a - b;
+    }
+};
+
+/*!
+ * \brief Scalar multiplication
+ */
+struct mul_scalar {
+    template <typename T>
+    static T apply(T a, T b) {
+        return a * b;
+    }
+};
+
+/*!
+ * \brief Scalar division
+ */
+struct div_scalar {
+    template <typename T>
+    static T apply(T a, T b) {
+        return a / b;
+    }
+};
+
+} //end of namespace detail
+
+// target_clones is not supported on function templates by all compilers,
+// the kernels are therefore overloaded for each type
+
+/*!
+ * \brief Compute the sum of the n elements of a
+ */
+inline ETL_ISA_CLONES float sum(const float* a, std::size_t n) {
+    return detail::sum_kernel(a, n);
+}
+
+/*!
+ * \copydoc sum
+ */
+inline ETL_ISA_CLONES double sum(const double* a, std::size_t n) {
+    return detail::sum_kernel(a, n);
+}
+
+/*!
+ * \brief Compute the dot product of the n elements of a and b
+ */
+inline ETL_ISA_CLONES float dot(const float* a, const float* b, std::size_t n) {
+    return detail::dot_kernel(a, b, n);
+}
+
+/*!
+ * \copydoc dot
+ */
+inline ETL_ISA_CLONES double dot(const double* a, const double* b, std::size_t n) {
+    return detail::dot_kernel(a, b, n);
+}
+
+/*!
+ * \brief Compute r = a + b on n elements
+ */
+inline ETL_ISA_CLONES void add(float* r, const float* a, const float* b, std::size_t n) {
+    detail::binary_kernel<detail::add_scalar>(r, a, b, n);
+}
+
+/*!
+ * \copydoc add
+ */
+inline ETL_ISA_CLONES void add(double* r, const double* a, const double* b, std::size_t n) {
+    detail::binary_kernel<detail::add_scalar>(r, a, b, n);
+}
+
+/*!
+ * \brief Compute r = a - b on n elements
+ */
+inline ETL_ISA_CLONES void sub(float* r, const float* a, const float* b, std::size_t n) {
+    detail::binary_kernel<detail::sub_scalar>(r, a, b, n);
+}
+
+/*!
+ * \copydoc sub
+ */
+inline ETL_ISA_CLONES void sub(double* r, const double* a, const double* b, std::size_t n) {
+    detail::binary_kernel<detail::sub_scalar>(r, a, b, n);
+}
+
+/*!
+ * \brief Compute r = a * b (element-wise) on n elements
+ */
+inline ETL_ISA_CLONES void mul(float* r, const float* a, const float* b, std::size_t n) {
+    detail::binary_kernel<detail::mul_scalar>(r, a, b, n);
+}
+
+/*!
+ * \copydoc mul
+ */
+inline ETL_ISA_CLONES void mul(double* r, const double* a, const double* b, std::size_t n) {
+    detail::binary_kernel<detail::mul_scalar>(r, a, b, n);
+}
+
+/*!
+ * \brief Compute r = a / b on n elements
+ */
+inline ETL_ISA_CLONES void div(float* r, const float* a, const float* b, std::size_t n) {
+    detail::binary_kernel<detail::div_scalar>(r, a, b, n);
+}
+
+/*!
+ * \copydoc div
+ */
+inline ETL_ISA_CLONES void div(double* r, const double* a, const double* b, std::size_t n) {
+    detail::binary_kernel<detail::div_scalar>(r, a, b, n);
+}
+
+/*!
+ * \brief Functor for the dispatched addition
+ */
+struct add_op {
+    /*!
+     * \brief Compute r = a + b on n elements
+     */
+    template <typename T>
+    static void apply(T* r, const T* a, const T* b, std::size_t n) {
+        add(r, a, b, n);
+    }
+};
+
+/*!
+ * \brief Functor for the dispatched subtraction
+ */
+struct sub_op {
+    /*!
+     * \brief Compute r = a - b on n elements
+     */
+    template <typename T>
+    static void apply(T* r, const T* a, const T* b, std::size_t n) {
+        sub(r, a, b, n);
+    }
+};
+
+/*!
+ * \brief Functor for the dispatched element-wise multiplication
+ */
+struct mul_op {
+    /*!
+     * \brief Compute r = a * b on n elements
+     */
+    template <typename T>
+    static void apply(T* r, const T* a, const T* b, std::size_t n) {
+        mul(r, a, b, n);
+    }
+};
+
+/*!
+ * \brief Functor for the dispatched division
+ */
+struct div_op {
+    /*!
+     * \brief Compute r = a / b on n elements
+     */
+    template <typename T>
+    static void apply(T* r, const T* a, const T* b, std::size_t n) {
+        div(r, a, b, n);
+    }
+};
+
+/*!
+ * \brief Traits indicating if the given expressions can be handled by the
+ * dispatched kernels.
+ *
+ * All the expressions must have direct memory access, the same storage
+ * order and either all be in single-precision or all be in
+ * double-precision.
+ */
+template <typename E, typename... R>
+using isa_able = cpp::and_u<
+    runtime_dispatch,
+    all_dma<E, R...>::value,
+    cpp::or_u<all_single_precision<E, R...>::value, all_double_precision<E, R...>::value>::value,
+    cpp::and_u<true, (decay_traits<R>::storage_order == decay_traits<E>::storage_order)...>::value>;
+
+/*!
+ * \brief Traits to get the dispatched functor of a binary operator
+ */
+template <typename BinaryOp>
+struct isa_binary_op {
+    using type = void; ///< The dispatched functor
+};
+
+/*!
+ * \copydoc isa_binary_op
+ */
+template <typename T>
+struct isa_binary_op<plus_binary_op<T>> {
+    using type = add_op; ///< The dispatched functor
+};
+
+/*!
+ * \copydoc isa_binary_op
+ */
+template <typename T>
+struct isa_binary_op<minus_binary_op<T>> {
+    using type = sub_op; ///< The dispatched functor
+};
+
+/*!
+ * \copydoc isa_binary_op
+ */
+template <typename T>
+struct isa_binary_op<mul_binary_op<T>> {
+    using type = mul_op; ///< The dispatched functor
+};
+
+/*!
+ * \copydoc isa_binary_op
+ */
+template <typename T>
+struct isa_binary_op<div_binary_op<T>> {
+    using type = div_op; ///< The dispatched functor
+};
+
+/*!
+ * \brief Compute the sum of the elements [first, last) of e
+ */
+template <typename E, cpp_enable_if((isa_able<E>::value))>
+value_t<E> sum(const E& e, std::size_t first, std::size_t last) {
+    return sum(e.memory_start() + first, last - first);
+}
+
+/*!
+ * \brief Compute the sum of the elements [first, last) of e
+ */
+template <typename E, cpp_disable_if((isa_able<E>::value))>
+value_t<E> sum(const E& e, std::size_t first, std::size_t last) {
+    cpp_unused(e);
+    cpp_unused(first);
+    cpp_unused(last);
+    cpp_unreachable("Dispatched sum called with an unsupported expression");
+    return value_t<E>(0);
+}
+
+/*!
+ * \brief Compute the dot product of a and b
+ */
+template <typename A, typename B, cpp_enable_if((isa_able<A, B>::value))>
+value_t<A> dot(const A& a, const B& b) {
+    return dot(a.memory_start(), b.memory_start(), etl::size(a));
+}
+
+/*!
+ * \brief Compute the dot product of a and b
+ */
+template <typename A, typename B, cpp_disable_if((isa_able<A, B>::value))>
+value_t<A> dot(const A& a, const B& b) {
+    cpp_unused(a);
+    cpp_unused(b);
+    cpp_unreachable("Dispatched dot called with an unsupported expression");
+    return value_t<A>(0);
+}
+
+/*!
+ * \brief Compute result = result op expr with the dispatched kernels, if
+ * possible.
+ *
+ * \param expr The right hand side expression
+ * \param result The left hand side
+ * \return true if the operation has been done, false otherwise
+ */
+template <typename Op, typename E, typename R, cpp_enable_if((isa_able<E, R>::value))>
+bool compound(E& expr, R& result) {
+    if (!isa_dispatch()) {
+        return false;
+    }
+
+    auto* r       = result.memory_start();
+    const auto* a = expr.memory_start();
+
+    dispatch_1d(select_parallel(etl::size(result)), [&](std::size_t first, std::size_t last) {
+        Op::apply(r + first, r + first, a + first, last - first);
+    }, 0, etl::size(result));
+
+    return true;
+}
+
+/*!
+ * \copydoc compound
+ */
+template <typename Op, typename E, typename R, cpp_disable_if((isa_able<E, R>::value))>
+bool compound(E& expr, R& result) {
+    cpp_unused(expr);
+    cpp_unused(result);
+    return false;
+}
+
+/*!
+ * \brief Compute result = expr with the dispatched kernels, if possible.
+ *
+ * Only binary expressions with a dispatched operator and direct access
+ * operands can be computed this way.
+ *
+ * \param expr The right hand side expression
+ * \param result The left hand side
+ * \return true if the assignment has been done, false otherwise
+ */
+template <typename T, typename L, typename BinaryOp, typename RE, typename R,
+          cpp_enable_if((isa_able<L, RE, R>::value && !std::is_void<typename isa_binary_op<BinaryOp>::type>::value))>
+bool assign(const binary_expr<T, L, BinaryOp, RE>& expr, R& result) {
+    if (!isa_dispatch()) {
+        return false;
+    }
+
+    using op = typename isa_binary_op<BinaryOp>::type;
+
+    auto* r       = result.memory_start();
+    const auto* a = expr.lhs().memory_start();
+    const auto* b = expr.rhs().memory_start();
+
+    dispatch_1d(select_parallel(etl::size(result)), [&](std::size_t first, std::size_t last) {
+        op::apply(r + first, a + first, b + first, last - first);
+    }, 0, etl::size(result));
+
+    return true;
+}
+
+/*!
+ * \copydoc assign
+ */
+template <typename E, typename R>
+bool assign(const E& expr, R& result) {
+    cpp_unused(expr);
+    cpp_unused(result);
+    return false;
+}
+
+} //end of namespace isa
+} //end of namespace impl
+} //end of namespace etl
@@ -0,0 +1,56 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Views of the operands of the kernels compiled for another
+ * instruction set.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace isa {
+
+/*!
+ * \brief Returns a view of the given expression, with dimensions I
+ * \param e The expression, must have direct memory access
+ * \return a view of the expression
+ */
+template <typename E, std::size_t... I>
+auto view(E&& e, std::index_sequence<I...> /*seq*/) {
+    using T = value_t<E>;
+
+    // Note: the const_cast is only here to allow the view, views of inputs are only read
+    return custom_dyn_matrix_impl<T, decay_traits<E>::storage_order, sizeof...(I)>(const_cast<T*>(e.memory_start()), etl::dim<I>(e)...);
+}
+
+/*!
+ * \brief Returns a view of the given expression for the kernels compiled
+ * for another instruction set.
+ *
+ * The loads and stores of the view are unaligned, since the expression is
+ * only aligned for the vector mode of the binary, and always inlined, so
+ * that the vectors never cross a function compiled for another instruction
+ * set.
+ *
+ * \param e The expression, must have direct memory access
+ * \return a view of the expression
+ */
+template <typename E>
+auto view(E&& e) {
+    return view(e, std::make_index_sequence<decay_traits<E>::dimensions()>());
+}
+
+} //end of namespace isa
+
+} //end of namespace impl
+
+} //end of namespace etl
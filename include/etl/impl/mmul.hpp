@@ -9,6 +9,7 @@
 
 //The implementations
 #include "etl/impl/std/mmul.hpp"
+#include "etl/impl/std/sparse_mmul.hpp"
 #include "etl/impl/std/strassen_mmul.hpp"
 #include "etl/impl/blas/gemm.hpp"
 #include "etl/impl/vec/gemm.hpp"
@@ -273,7 +274,18 @@ struct mm_mul_impl {
      * \param b The rhs of the multiplication
      * \param c The target of the multiplication
      */
-    template <typename A, typename B, typename C>
+    template <typename A, typename B, typename C, cpp_enable_if(etl::impl::standard::is_sparse_mul<A, B, C>::value)>
+    static void apply(A&& a, B&& b, C&& c) {
+        etl::impl::standard::mm_mul(a, b, c);
+    }
+
+    /*!
+     * \brief Apply the function C = A * B
+     * \param a The lhs of the multiplication
+     * \param b The rhs of the multiplication
+     * \param c The target of the multiplication
+     */
+    template <typename A, typename B, typename C, cpp_disable_if(etl::impl::standard::is_sparse_mul<A, B, C>::value)>
     static void apply(A&& a, B&& b, C&& c) {
         gemm_impl impl = select_gemm_impl<A, B, C>(etl::dim<0>(a), etl::dim<1>(a), etl::dim<1>(c));
 
@@ -299,7 +311,18 @@ struct vm_mul_impl {
      * \param b The rhs of the multiplication
      * \param c The target of the multiplication
      */
-    template <typename A, typename B, typename C>
+    template <typename A, typename B, typename C, cpp_enable_if(etl::impl::standard::is_sparse_mul<A, B, C>::value)>
+    static void apply(A&& a, B&& b, C&& c) {
+        etl::impl::standard::vm_mul(a, b, c);
+    }
+
+    /*!
+     * \brief Apply the function C = A * B
+     * \param a The lhs of the multiplication
+     * \param b The rhs of the multiplication
+     * \param c The target of the multiplication
+     */
+    template <typename A, typename B, typename C, cpp_disable_if(etl::impl::standard::is_sparse_mul<A, B, C>::value)>
     static void apply(A&& a, B&& b, C&& c) {
         gemm_impl impl = select_gevm_impl<A, B, C>(etl::dim<0>(b), etl::dim<1>(b));
 
@@ -325,7 +348,18 @@ struct mv_mul_impl {
      * \param b The rhs of the multiplication
      * \param c The target of the multiplication
      */
-    template <typename A, typename B, typename C>
+    template <typename A, typename B, typename C, cpp_enable_if(etl::impl::standard::is_sparse_mul<A, B, C>::value)>
+    static void apply(A&& a, B&& b, C&& c) {
+        etl::impl::standard::mv_mul(a, b, c);
+    }
+
+    /*!
+     * \brief Apply the function C = A * B
+     * \param a The lhs of the multiplication
+     * \param b The rhs of the multiplication
+     * \param c The target of the multiplication
+     */
+    template <typename A, typename B, typename C, cpp_disable_if(etl::impl::standard::is_sparse_mul<A, B, C>::value)>
     static void apply(A&& a, B&& b, C&& c) {
         gemm_impl impl = select_gemv_impl<A, B, C>(etl::dim<0>(a), etl::dim<1>(a));
 
@@ -11,6 +11,186 @@ namespace etl {
 
 namespace impl {
 
+namespace detail {
+
+/*!
+ * \brief Reduction operations of the vectorized pooling kernel
+ * \tparam Max true for max pooling, false for average pooling
+ */
+template <bool Max>
+struct pool_2d_vec_op;
+
+/*!
+ * \copydoc pool_2d_vec_op
+ */
+template <>
+struct pool_2d_vec_op<true> {
+    template <typename V, typename M>
+    static M vec(M lhs, M rhs) {
+        return V::max(lhs, rhs);
+    }
+
+    template <typename T>
+    static T scalar(T lhs, T rhs) {
+        return std::max(lhs, rhs);
+    }
+
+    template <size_t C, typename T>
+    static T finish(T value) {
+        return value;
+    }
+};
+
+/*!
+ * \copydoc pool_2d_vec_op
+ */
+template <>
+struct pool_2d_vec_op<false> {
+    template <typename V, typename M>
+    static M vec(M lhs, M rhs) {
+        return V::add(lhs, rhs);
+    }
+
+    template <typename T>
+    static T scalar(T lhs, T rhs) {
+        return lhs + rhs;
+    }
+
+    template <size_t C, typename T>
+    static T finish(T value) {
+        return value / (C * C);
+    }
+};
+
+/*!
+ * \brief Vectorized kernel for CxC pooling with a stride of C and no padding.
+ *
+ * The C input rows of each output row are first reduced together with
+ * vector operations and then the blocks of C columns of the reduced row
+ * are reduced into the output. The rows are processed by blocks of
+ * columns so that the reduced row fits in a small buffer on the stack.
+ *
+ * \param in The input memory (row-major)
+ * \param out The output memory (row-major)
+ * \param n2 The number of columns of the input
+ * \param o1 The number of rows of the output
+ * \param o2 The number of columns of the output
+ * \tparam C The pooling ratio
+ * \tparam Max true for max pooling, false for average pooling
+ */
+template <size_t C, bool Max, typename T>
+void pool_2d_vec_kernel(const T* in, T* out, size_t n2, size_t o1, size_t o2) {
+    using vec_type = default_vec;
+    using op       = pool_2d_vec_op<Max>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    // Number of output columns processed per block
+    static constexpr size_t OB = 64;
+
+    T row[OB * C];
+
+    for (size_t j = 0; j < o1; ++j) {
+        for (size_t kb = 0; kb < o2; kb += OB) {
+            const size_t ob = std::min(OB, o2 - kb);
+            const size_t w  = ob * C;
+
+            const T* first = in + j * C * n2 + kb * C;
+
+            size_t k = 0;
+
+            for (; k + vec_size - 1 < w; k += vec_size) {
+                auto r = vec_type::loadu(first + k);
+
+                for (size_t jj = 1; jj < C; ++jj) {
+                    r = op::template vec<vec_type>(r, vec_type::loadu(first + jj * n2 + k));
+                }
+
+                vec_type::storeu(row + k, r);
+            }
+
+            for (; k < w; ++k) {
+                auto r = first[k];
+
+                for (size_t jj = 1; jj < C; ++jj) {
+                    r = op::scalar(r, first[jj * n2 + k]);
+                }
+
+                row[k] = r;
+            }
+
+            for (size_t k = 0; k < ob; ++k) {
+                auto r = row[k * C];
+
+                for (size_t kk = 1; kk < C; ++kk) {
+                    r = op::scalar(r, row[k * C + kk]);
+                }
+
+                out[j * o2 + kb + k] = op::template finish<C>(r);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Traits indicating if the vectorized pooling kernel can be used
+ * for the given input and output types
+ */
+template <typename A, typename M>
+using pool_2d_vec_able = cpp::bool_constant<
+        vec_enabled
+    &&  intrinsic_traits<value_t<A>>::vectorizable
+    &&  all_dma<A, M>::value
+    &&  all_row_major<A, M>::value
+    &&  std::is_floating_point<value_t<A>>::value
+    &&  std::is_same<value_t<A>, value_t<M>>::value>;
+
+/*!
+ * \brief Try to pool sub into m with the vectorized kernel.
+ *
+ * The vectorized kernel is only used for 2x2 and 3x3 pooling with a
+ * stride equal to the pooling ratio and no padding.
+ *
+ * \return true if the pooling has been done, false otherwise
+ */
+template <bool Max, typename A, typename M, cpp_enable_if((pool_2d_vec_able<A, M>::value))>
+bool pool_2d_vec(const A& sub, M& m, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+    if (c1 != c2 || c1 != s1 || c2 != s2 || p1 || p2) {
+        return false;
+    }
+
+    const size_t o1 = etl::dim<0>(sub) / c1;
+    const size_t o2 = etl::dim<1>(sub) / c2;
+
+    if (c1 == 2) {
+        pool_2d_vec_kernel<2, Max>(sub.memory_start(), m.memory_start(), etl::dim<1>(sub), o1, o2);
+        return true;
+    } else if (c1 == 3) {
+        pool_2d_vec_kernel<3, Max>(sub.memory_start(), m.memory_start(), etl::dim<1>(sub), o1, o2);
+        return true;
+    }
+
+    return false;
+}
+
+/*!
+ * \copydoc pool_2d_vec
+ */
+template <bool Max, typename A, typename M, cpp_disable_if((pool_2d_vec_able<A, M>::value))>
+bool pool_2d_vec(const A& sub, M& m, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_unused(sub);
+    cpp_unused(m);
+    cpp_unused(c1);
+    cpp_unused(c2);
+    cpp_unused(s1);
+    cpp_unused(s2);
+    cpp_unused(p1);
+    cpp_unused(p2);
+    return false;
+}
+
+} //end of namespace detail
+
 /*!
  * \brief Functor for 2D Max Pooling
  */
@@ -67,6 +247,10 @@ struct max_pool_2d {
      */
     template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename M>
     static void apply(const A& sub, M&& m) {
+        if (detail::pool_2d_vec<true>(sub, m, C1, C2, S1, S2, P1, P2)) {
+            return;
+        }
+
         const size_t o1 = (etl::dim<0>(sub) - C1 + 2 * P1) / S1 + 1;
         const size_t o2 = (etl::dim<1>(sub) - C2 + 2 * P2) / S2 + 1;
 
@@ -133,6 +317,10 @@ struct max_pool_2d {
      */
     template <typename A, typename M>
     static void apply(const A& sub, M&& m, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+        if (detail::pool_2d_vec<true>(sub, m, c1, c2, s1, s2, p1, p2)) {
+            return;
+        }
+
         const size_t o1 = (etl::dim<0>(sub) - c1 + 2 * p1) / s1 + 1;
         const size_t o2 = (etl::dim<1>(sub) - c2 + 2 * p2) / s2 + 1;
 
@@ -222,6 +410,10 @@ struct avg_pool_2d {
      */
     template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename M>
     static void apply(const A& sub, M&& m) {
+        if (detail::pool_2d_vec<false>(sub, m, C1, C2, S1, S2, P1, P2)) {
+            return;
+        }
+
         const size_t o1 = (etl::dim<0>(sub) - C1 + 2 * P1) / S1 + 1;
         const size_t o2 = (etl::dim<1>(sub) - C2 + 2 * P2) / S2 + 1;
 
@@ -288,6 +480,10 @@ struct avg_pool_2d {
      */
     template <typename A, typename M>
     static void apply(const A& sub, M&& m, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+        if (detail::pool_2d_vec<false>(sub, m, c1, c2, s1, s2, p1, p2)) {
+            return;
+        }
+
         const size_t o1 = (etl::dim<0>(sub) - c1 + 2 * p1) / s1 + 1;
         const size_t o2 = (etl::dim<1>(sub) - c2 + 2 * p2) / s2 + 1;
 
@@ -812,11 +1008,15 @@ struct max_pool_derivative_2d {
      */
     template <size_t C1, size_t C2, typename A, typename B, typename M>
     static void apply(A&& in, B&& out, M& m) {
-        for (size_t j = 0; j < etl::dim<0>(out); ++j) {
-            for (size_t k = 0; k < etl::dim<1>(out); ++k) {
-                pool_derivative_block<C1, C2>(in, out, m, j, k);
+        auto fun_j = [&](const size_t first, const size_t last) {
+            for (size_t j = first; j < last; ++j) {
+                for (size_t k = 0; k < etl::dim<1>(out); ++k) {
+                    pool_derivative_block<C1, C2>(in, out, m, j, k);
+                }
             }
-        }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(in), pooling_parallel_threshold), fun_j, 0, etl::dim<0>(out));
     }
 
     /*!
@@ -854,11 +1054,15 @@ struct max_pool_derivative_2d {
      */
     template <typename A, typename B, typename M>
     static void apply(A&& in, B&& out, M& m, size_t c1, size_t c2) {
-        for (size_t j = 0; j < etl::dim<0>(out); ++j) {
-            for (size_t k = 0; k < etl::dim<1>(out); ++k) {
-                pool_derivative_block(in, out, m, j, k, c1, c2);
+        auto fun_j = [&](const size_t first, const size_t last) {
+            for (size_t j = first; j < last; ++j) {
+                for (size_t k = 0; k < etl::dim<1>(out); ++k) {
+                    pool_derivative_block(in, out, m, j, k, c1, c2);
+                }
             }
-        }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(in), pooling_parallel_threshold), fun_j, 0, etl::dim<0>(out));
     }
 };
 
@@ -905,13 +1109,17 @@ struct max_pool_derivative_3d {
      */
     template <size_t C1, size_t C2, size_t C3, typename A, typename B, typename M>
     static void apply(A&& in, B&& out, M& m) {
-        for (size_t i = 0; i < etl::dim<0>(out); ++i) {
-            for (size_t j = 0; j < etl::dim<1>(out); ++j) {
-                for (size_t k = 0; k < etl::dim<2>(out); ++k) {
-                    pool_derivative_block<C1, C2, C3>(in, out, m, i, j, k);
+        auto fun_i = [&](const size_t first, const size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                for (size_t j = 0; j < etl::dim<1>(out); ++j) {
+                    for (size_t k = 0; k < etl::dim<2>(out); ++k) {
+                        pool_derivative_block<C1, C2, C3>(in, out, m, i, j, k);
+                    }
                 }
             }
-        }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(in), pooling_parallel_threshold), fun_i, 0, etl::dim<0>(out));
     }
 
     /*!
@@ -953,13 +1161,17 @@ struct max_pool_derivative_3d {
      */
     template <typename A, typename B, typename M>
     static void apply(A&& in, B&& out, M& m, size_t c1, size_t c2, size_t c3) {
-        for (size_t i = 0; i < etl::dim<0>(out); ++i) {
-            for (size_t j = 0; j < etl::dim<1>(out); ++j) {
-                for (size_t k = 0; k < etl::dim<2>(out); ++k) {
-                    pool_derivative_block(in, out, m, i, j, k, c1, c2, c3);
+        auto fun_i = [&](const size_t first, const size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                for (size_t j = 0; j < etl::dim<1>(out); ++j) {
+                    for (size_t k = 0; k < etl::dim<2>(out); ++k) {
+                        pool_derivative_block(in, out, m, i, j, k, c1, c2, c3);
+                    }
                 }
             }
-        }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(in), pooling_parallel_threshold), fun_i, 0, etl::dim<0>(out));
     }
 };
 
@@ -995,11 +1207,15 @@ struct upsample_2d {
      */
     template <size_t C1, size_t C2, typename A, typename M>
     static void apply(A&& in, M& m) {
-        for (size_t j = 0; j < etl::dim<0>(in); ++j) {
-            for (size_t k = 0; k < etl::dim<1>(in); ++k) {
-                upsample_block<C1, C2>(in, m, j, k);
+        auto fun_j = [&](const size_t first, const size_t last) {
+            for (size_t j = first; j < last; ++j) {
+                for (size_t k = 0; k < etl::dim<1>(in); ++k) {
+                    upsample_block<C1, C2>(in, m, j, k);
+                }
             }
-        }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(m), pooling_parallel_threshold), fun_j, 0, etl::dim<0>(in));
     }
 
     /*!
@@ -1030,11 +1246,15 @@ struct upsample_2d {
      */
     template <typename A, typename M>
     static void apply(A&& in, M& m, size_t c1, size_t c2) {
-        for (size_t j = 0; j < etl::dim<0>(in); ++j) {
-            for (size_t k = 0; k < etl::dim<1>(in); ++k) {
-                upsample_block(in, m, j, k, c1, c2);
+        auto fun_j = [&](const size_t first, const size_t last) {
+            for (size_t j = first; j < last; ++j) {
+                for (size_t k = 0; k < etl::dim<1>(in); ++k) {
+                    upsample_block(in, m, j, k, c1, c2);
+                }
             }
-        }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(m), pooling_parallel_threshold), fun_j, 0, etl::dim<0>(in));
     }
 };
 
@@ -1076,13 +1296,17 @@ struct upsample_3d {
      */
     template <size_t C1, size_t C2, size_t C3, typename A, typename M>
     static void apply(A&& in, M& m) {
-        for (size_t i = 0; i < etl::dim<0>(in); ++i) {
-            for (size_t j = 0; j < etl::dim<1>(in); ++j) {
-                for (size_t k = 0; k < etl::dim<2>(in); ++k) {
-                    upsample_block<C1, C2, C3>(in, m, i, j, k);
+        auto fun_i = [&](const size_t first, const size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                for (size_t j = 0; j < etl::dim<1>(in); ++j) {
+                    for (size_t k = 0; k < etl::dim<2>(in); ++k) {
+                        upsample_block<C1, C2, C3>(in, m, i, j, k);
+                    }
                 }
             }
-        }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(m), pooling_parallel_threshold), fun_i, 0, etl::dim<0>(in));
     }
 
     /*!
@@ -1119,13 +1343,17 @@ struct upsample_3d {
      */
     template <typename A, typename M>
     static void apply(A&& in, M& m, size_t c1, size_t c2, size_t c3) {
-        for (size_t i = 0; i < etl::dim<0>(in); ++i) {
-            for (size_t j = 0; j < etl::dim<1>(in); ++j) {
-                for (size_t k = 0; k < etl::dim<2>(in); ++k) {
-                    upsample_block(in, m, i, j, k, c1, c2, c3);
+        auto fun_i = [&](const size_t first, const size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                for (size_t j = 0; j < etl::dim<1>(in); ++j) {
+                    for (size_t k = 0; k < etl::dim<2>(in); ++k) {
+                        upsample_block(in, m, i, j, k, c1, c2, c3);
+                    }
                 }
             }
-        }
+        };
+
+        dispatch_1d_any(select_parallel(etl::size(m), pooling_parallel_threshold), fun_i, 0, etl::dim<0>(in));
     }
 };
 
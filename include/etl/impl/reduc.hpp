@@ -0,0 +1,158 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the row (sum_r, mean_r) and column (sum_l, mean_l)
+ * reductions.
+ *
+ * The rows are reduced with the "sum" kernels on their range of flat
+ * elements. The columns are reduced by streaming the rows. The rows,
+ * respectively the blocks of columns, are distributed to the threads of
+ * the pool.
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/sum.hpp"
+#include "etl/impl/std/reduc.hpp"
+#include "etl/impl/vec/reduc.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Compute the sum of the flat elements [first, last) of e, serially,
+ * with the selected sum implementation.
+ * \param e The expression to sum
+ * \param first The first element
+ * \param last The last element (exclusive)
+ * \return the sum of the elements of the range
+ */
+template <typename E>
+value_t<E> range_sum(const E& e, std::size_t first, std::size_t last) {
+    if (impl::isa::isa_able<E>::value && !local_context().sum_selector.forced && isa_dispatch()) {
+        return impl::isa::sum(e, first, last);
+    } else if (select_sum_impl<E>() == etl::sum_impl::VEC) {
+        return impl::vec::sum(e, first, last);
+    } else {
+        return impl::standard::sum(e, first, last);
+    }
+}
+
+/*!
+ * \brief Functor for the sums of the rows of a matrix
+ */
+struct sum_r_impl {
+    /*!
+     * \brief Compute the sum of each row of a and store them in c
+     * \param a The input expression
+     * \param c The output expression
+     */
+    template <typename A, typename C>
+    static void apply(const A& a, C&& c) {
+        const std::size_t m = etl::dim<0>(a);
+
+        if (!m) {
+            return;
+        }
+
+        const std::size_t n = etl::size(a) / m;
+
+        auto batch_fun = [&](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                c[i] = range_sum(a, i * n, (i + 1) * n);
+            }
+        };
+
+        dispatch_1d_any(all_thread_safe<A>::value && etl::select_parallel(etl::size(a), sum_parallel_threshold), batch_fun, 0, m);
+    }
+};
+
+/*!
+ * \brief Functor for the means of the rows of a matrix
+ */
+struct mean_r_impl {
+    /*!
+     * \brief Compute the mean of each row of a and store them in c
+     * \param a The input expression
+     * \param c The output expression
+     */
+    template <typename A, typename C>
+    static void apply(const A& a, C&& c) {
+        sum_r_impl::apply(a, c);
+
+        const std::size_t n = etl::size(a) / etl::dim<0>(a);
+
+        for (std::size_t i = 0; i < etl::size(c); ++i) {
+            c[i] = c[i] / n;
+        }
+    }
+};
+
+/*!
+ * \brief Functor for the sums of the columns of a matrix
+ */
+struct sum_l_impl {
+    /*!
+     * \brief Compute the sum of each column of a and store them in c
+     * \param a The input expression
+     * \param c The output expression
+     */
+    template <typename A, typename C>
+    static void apply(const A& a, C&& c) {
+        const auto impl = select_sum_impl<A>();
+
+        const std::size_t m = etl::dim<0>(a);
+
+        if (!m) {
+            return;
+        }
+
+        const std::size_t n = etl::size(a) / m;
+
+        auto batch_fun = [&](std::size_t first, std::size_t last) {
+            if (impl == etl::sum_impl::VEC) {
+                impl::vec::sum_l(a, c, first, last);
+            } else {
+                impl::standard::sum_l(a, c, first, last);
+            }
+        };
+
+        // Each thread streams all the rows, it needs enough columns to be worth it
+        const bool parallel = all_thread_safe<A>::value && etl::select_parallel_2d(etl::size(a), sum_parallel_threshold, n, sum_l_parallel_threshold);
+
+        dispatch_1d_any(parallel, batch_fun, 0, n);
+    }
+};
+
+/*!
+ * \brief Functor for the means of the columns of a matrix
+ */
+struct mean_l_impl {
+    /*!
+     * \brief Compute the mean of each column of a and store them in c
+     * \param a The input expression
+     * \param c The output expression
+     */
+    template <typename A, typename C>
+    static void apply(const A& a, C&& c) {
+        sum_l_impl::apply(a, c);
+
+        const std::size_t m = etl::dim<0>(a);
+
+        for (std::size_t j = 0; j < etl::size(c); ++j) {
+            c[j] = c[j] / m;
+        }
+    }
+};
+
+} //end of namespace detail
+
+} //end of namespace etl
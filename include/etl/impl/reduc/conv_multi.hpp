@@ -88,26 +88,49 @@ void pad_3d_input(const F1& in, F2&& out, size_t p1, size_t p2) {
 }
 
 /*!
- * \brief FFT implementation of a 2D 'valid' convolution C = I * K, with multiple kernels.
+ * \brief Prepare the kernels of a 2D 'valid' convolution by FFT.
+ *
+ * The kernels are prepared for the full convolution of the padded input.
+ *
+ * \param input The input matrix
+ * \param kernels The kernel matrix
+ * \param p1 The first dimension extra padding of the convolution
+ * \param p2 The second dimension extra padding of the convolution
+ * \return the prepared kernels
+ */
+template <typename I, typename K_T>
+impl::standard::prepared_kernels<value_t<K_T>, 3> fft_prepare_valid_kernels(const I& input, const K_T& kernels, size_t p1, size_t p2) {
+    const std::size_t i1 = etl::dim<decay_traits<I>::dimensions() - 2>(input);
+    const std::size_t i2 = etl::dim<decay_traits<I>::dimensions() - 1>(input);
+    const std::size_t k1 = etl::dim<1>(kernels);
+    const std::size_t k2 = etl::dim<2>(kernels);
+
+    decltype(auto) k = make_temporary(kernels);
+
+    return {k.memory_start(), {{etl::dim<0>(kernels), k1, k2}}, i1 + k1 + 2 * p1 - 1, i2 + k2 + 2 * p2 - 1};
+}
+
+/*!
+ * \brief FFT implementation of a 2D 'valid' convolution C = I * K, with multiple prepared kernels.
  *
  * This works by doing a full convolution by FFT and then extracting
  * only the valid part of the convolution.
  *
  * \param input The input matrix
- * \param kernels The kernel matrix
+ * \param kernels The prepared kernels
  * \param conv The output matrix
  */
-template <typename I, typename K_T, typename C>
-void fft_conv2_valid_multi(const I& input, const K_T& kernels, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
-    const std::size_t K = etl::dim<0>(kernels);
+template <typename I, typename T, typename C>
+void fft_conv2_valid_multi(const I& input, const impl::standard::prepared_kernels<T, 3>& kernels, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    const std::size_t K = kernels.dim(0);
     const std::size_t i1 = etl::dim<0>(input);
     const std::size_t i2 = etl::dim<1>(input);
-    const std::size_t k1 = etl::dim<1>(kernels);
-    const std::size_t k2 = etl::dim<2>(kernels);
+    const std::size_t k1 = kernels.dim(1);
+    const std::size_t k2 = kernels.dim(2);
 
     // Dimensions of the final valid convolution (stride,padding)
     const std::size_t c1 = (i1 - k1 + 2 * p1) / s1 + 1;
-    const std::size_t c2 = (i2 - k2 + 2 * p2) / s1 + 1;
+    const std::size_t c2 = (i2 - k2 + 2 * p2) / s2 + 1;
 
     //Dimensions of the valid convolution (unit strided)
     const std::size_t v1 = (i1 - k1 + 2 * p1) + 1;
@@ -117,32 +140,57 @@ void fft_conv2_valid_multi(const I& input, const K_T& kernels, C&& conv, size_t
     const std::size_t t1 = (i1 + k1 + 2 * p1) - 1;
     const std::size_t t2 = (i2 + k2 + 2 * p2) - 1;
 
+    cpp_assert(kernels.conv_dim(0) == t1 && kernels.conv_dim(1) == t2, "Invalid input size for the prepared kernels");
+
     // Dimensions of the 'full' borders
     const std::size_t b1 = (t1 - v1) / 2;
     const std::size_t b2 = (t2 - v2) / 2;
 
-    etl::dyn_matrix<std::complex<value_t<I>>> input_padded(t1, t2);
-    etl::dyn_matrix<std::complex<value_t<I>>, 3> kernels_padded(K, t1, t2);
-    etl::dyn_matrix<std::complex<value_t<I>>, 3> tmp_result(K, t1, t2);
+    // Dimensions of the real transforms
+    const std::size_t f2 = impl::standard::detail::rfft_conv_size(t2);
+    const std::size_t h2 = f2 / 2 + 1;
 
-    pad_2d_input(input, input_padded, p1, p2);
-    complex_pad_3d(kernels, kernels_padded);
+    etl::dyn_matrix<etl::complex<T>> input_spectrum(h2, t1);
 
-    input_padded.fft2_inplace();
-    kernels_padded.fft2_many_inplace();
+    {
+        etl::dyn_matrix<T> input_padded(t1, f2);
+        etl::dyn_matrix<etl::complex<T>> tmp(t1, h2);
 
-    for (std::size_t k = 0; k < K; ++k) {
-        tmp_result(k) = input_padded >> kernels_padded(k);
+        input_padded = T(0);
+
+        pad_2d_input(input, input_padded, p1, p2);
+
+        impl::standard::detail::rfft2_t_kernel(input_padded.memory_start(), t1, f2, input_spectrum.memory_start(), tmp.memory_start());
     }
 
-    tmp_result.ifft2_many_inplace();
+    auto batch_fun_k = [&](const size_t first, const size_t last) {
+        if (last - first) {
+            SERIAL_SECTION {
+                etl::dyn_matrix<etl::complex<T>> spectrum(h2, t1);
+                etl::dyn_matrix<etl::complex<T>> tmp(t1, h2);
+                etl::dyn_matrix<T> result(t1, f2);
+
+                for (std::size_t k = first; k < last; ++k) {
+                    spectrum = input_spectrum >> kernels.spectrum(k);
 
-    for (std::size_t k = 0; k < K; ++k) {
-        for (std::size_t i = 0; i < c1; ++i) {
-            for (std::size_t j = 0; j < c2; ++j) {
-                conv(k, i, j) = tmp_result(k, i * s1 + b1, j * s2 + b2).real();
+                    impl::standard::detail::irfft2_t_kernel(spectrum.memory_start(), t1, f2, result.memory_start(), tmp.memory_start());
+
+                    const T* r = result.memory_start();
+
+                    for (std::size_t i = 0; i < c1; ++i) {
+                        for (std::size_t j = 0; j < c2; ++j) {
+                            conv(k, i, j) = r[(i * s1 + b1) * f2 + j * s2 + b2];
+                        }
+                    }
+                }
             }
         }
+    };
+
+    if (etl::is_parallel) {
+        dispatch_1d_threads(select_parallel(K, 2), batch_fun_k, 0, K);
+    } else {
+        batch_fun_k(0, K);
     }
 }
 
@@ -157,18 +205,33 @@ void fft_conv2_valid_multi(const I& input, const K_T& kernels, C&& conv, size_t
  * \param conv The output matrix
  */
 template <typename I, typename K_T, typename C>
-void fft_conv2_valid_multi_multi(const I& input, const K_T& kernels, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+void fft_conv2_valid_multi(const I& input, const K_T& kernels, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    fft_conv2_valid_multi(input, fft_prepare_valid_kernels(input, kernels, p1, p2), conv, s1, s2, p1, p2);
+}
+
+/*!
+ * \brief FFT implementation of a 2D 'valid' convolution C = I * K, with multiple prepared kernels.
+ *
+ * This works by doing a full convolution by FFT and then extracting
+ * only the valid part of the convolution.
+ *
+ * \param input The input matrix
+ * \param kernels The prepared kernels
+ * \param conv The output matrix
+ */
+template <typename I, typename T, typename C>
+void fft_conv2_valid_multi_multi(const I& input, const impl::standard::prepared_kernels<T, 3>& kernels, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
     const std::size_t N = etl::dim<0>(input);
     const std::size_t i1 = etl::dim<1>(input);
     const std::size_t i2 = etl::dim<2>(input);
 
-    const std::size_t K = etl::dim<0>(kernels);
-    const std::size_t k1 = etl::dim<1>(kernels);
-    const std::size_t k2 = etl::dim<2>(kernels);
+    const std::size_t K = kernels.dim(0);
+    const std::size_t k1 = kernels.dim(1);
+    const std::size_t k2 = kernels.dim(2);
 
     // Dimensions of the final valid convolution (stride,padding)
     const std::size_t c1 = (i1 - k1 + 2 * p1) / s1 + 1;
-    const std::size_t c2 = (i2 - k2 + 2 * p2) / s1 + 1;
+    const std::size_t c2 = (i2 - k2 + 2 * p2) / s2 + 1;
 
     //Dimensions of the valid convolution (unit strided)
     const std::size_t v1 = (i1 - k1 + 2 * p1) + 1;
@@ -178,39 +241,86 @@ void fft_conv2_valid_multi_multi(const I& input, const K_T& kernels, C&& conv, s
     const std::size_t t1 = (i1 + k1 + 2 * p1) - 1;
     const std::size_t t2 = (i2 + k2 + 2 * p2) - 1;
 
+    cpp_assert(kernels.conv_dim(0) == t1 && kernels.conv_dim(1) == t2, "Invalid input size for the prepared kernels");
+
     // Dimensions of the 'full' borders
     const std::size_t b1 = (t1 - v1) / 2;
     const std::size_t b2 = (t2 - v2) / 2;
 
-    etl::dyn_matrix<std::complex<value_t<I>>, 3> input_padded(N, t1, t2);
-    etl::dyn_matrix<std::complex<value_t<I>>, 3> kernels_padded(K, t1, t2);
-    etl::dyn_matrix<std::complex<value_t<I>>, 4> tmp_result(K, N, t1, t2);
+    // Dimensions of the real transforms
+    const std::size_t f2 = impl::standard::detail::rfft_conv_size(t2);
+    const std::size_t h2 = f2 / 2 + 1;
+
+    etl::dyn_matrix<T, 3> input_padded(N, t1, f2);
+
+    input_padded = T(0);
 
     pad_3d_input(input, input_padded, p1, p2);
-    complex_pad_3d(kernels, kernels_padded);
 
-    input_padded.fft2_many_inplace();
-    kernels_padded.fft2_many_inplace();
+    etl::dyn_matrix<etl::complex<T>, 3> input_spectrums(N, h2, t1);
 
-    for (std::size_t k = 0; k < K; ++k) {
-        for (std::size_t n = 0; n < N; ++n) {
-            tmp_result(k)(n) = input_padded(n) >> kernels_padded(k);
+    auto spectrum_fun = [&](const size_t first, const size_t last) {
+        if (last - first) {
+            SERIAL_SECTION {
+                etl::dyn_matrix<etl::complex<T>> tmp(t1, h2);
+
+                for (std::size_t n = first; n < last; ++n) {
+                    impl::standard::detail::rfft2_t_kernel(input_padded(n).memory_start(), t1, f2, input_spectrums(n).memory_start(), tmp.memory_start());
+                }
+            }
         }
-    }
+    };
+
+    auto batch_fun_k = [&](const size_t first, const size_t last) {
+        if (last - first) {
+            SERIAL_SECTION {
+                etl::dyn_matrix<etl::complex<T>> spectrum(h2, t1);
+                etl::dyn_matrix<etl::complex<T>> tmp(t1, h2);
+                etl::dyn_matrix<T> result(t1, f2);
+
+                for (std::size_t k = first; k < last; ++k) {
+                    for (std::size_t n = 0; n < N; ++n) {
+                        spectrum = input_spectrums(n) >> kernels.spectrum(k);
 
-    tmp_result.ifft2_many_inplace();
+                        impl::standard::detail::irfft2_t_kernel(spectrum.memory_start(), t1, f2, result.memory_start(), tmp.memory_start());
 
-    for (std::size_t k = 0; k < K; ++k) {
-        for (std::size_t n = 0; n < N; ++n) {
-            for (std::size_t i = 0; i < c1; ++i) {
-                for (std::size_t j = 0; j < c2; ++j) {
-                    conv(k, n, i, j) = tmp_result(k, n, i * s1 + b1, j * s2 + b2).real();
+                        const T* r = result.memory_start();
+
+                        for (std::size_t i = 0; i < c1; ++i) {
+                            for (std::size_t j = 0; j < c2; ++j) {
+                                conv(k, n, i, j) = r[(i * s1 + b1) * f2 + j * s2 + b2];
+                            }
+                        }
+                    }
                 }
             }
         }
+    };
+
+    if (etl::is_parallel) {
+        dispatch_1d_any(select_parallel(N, 2), spectrum_fun, 0, N);
+        dispatch_1d_threads(select_parallel(K, 2), batch_fun_k, 0, K);
+    } else {
+        spectrum_fun(0, N);
+        batch_fun_k(0, K);
     }
 }
 
+/*!
+ * \brief FFT implementation of a 2D 'valid' convolution C = I * K, with multiple kernels.
+ *
+ * This works by doing a full convolution by FFT and then extracting
+ * only the valid part of the convolution.
+ *
+ * \param input The input matrix
+ * \param kernels The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I, typename K_T, typename C>
+void fft_conv2_valid_multi_multi(const I& input, const K_T& kernels, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    fft_conv2_valid_multi_multi(input, fft_prepare_valid_kernels(input, kernels, p1, p2), conv, s1, s2, p1, p2);
+}
+
 /*!
  * \brief BLAS implementation of a 2D 'valid' convolution C = I * K, with multiple kernels
  * \param input The input matrix
@@ -548,7 +658,7 @@ void blas_conv4_valid_prepared(const I_T& input, const K_T& kernel, const KS_T&
         }
     };
 
-    dispatch_1d_any(select_parallel(N, 2), batch_fun_n, 0, N);
+    dispatch_1d_threads(select_parallel(N, 2), batch_fun_n, 0, N);
 }
 
 template <typename I_T, typename K_T, typename C_T>
@@ -0,0 +1,244 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the softmax implementations.
+ *
+ * The functions are responsible for selecting the most efficient
+ * implementation for each case, based on what is available. The selection of
+ * parallel versus serial is also done at this level. The implementation
+ * functions should never be used directly, only functions of this header can
+ * be used directly.
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/common/softmax.hpp"
+#include "etl/impl/std/softmax.hpp"
+#include "etl/impl/vec/softmax.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Select the softmax implementation for an expression of type A and C
+ *
+ * This does not take the local context into account.
+ *
+ * \tparam A The type of rhs expression
+ * \tparam C The type of lhs expression
+ * \return The implementation to use
+ */
+template <typename A, typename C>
+cpp14_constexpr softmax_impl select_default_softmax_impl() {
+    if (impl::vec::softmax_vectorizable<A, C>::value) {
+        return softmax_impl::VEC;
+    }
+
+    return softmax_impl::STD;
+}
+
+/*!
+ * \brief Select the softmax implementation for an expression of type A and C
+ * \tparam A The type of rhs expression
+ * \tparam C The type of lhs expression
+ * \return The implementation to use
+ */
+template <typename A, typename C>
+softmax_impl select_softmax_impl() {
+    if (local_context().softmax_selector.forced) {
+        auto forced = local_context().softmax_selector.impl;
+
+        switch (forced) {
+            //VEC cannot always be used
+            case softmax_impl::VEC:
+                if (!impl::vec::softmax_vectorizable<A, C>::value) {
+                    std::cerr << "Forced selection to VEC softmax implementation, but not possible for this expression" << std::endl;
+                    return select_default_softmax_impl<A, C>();
+                }
+
+                return forced;
+
+            //In other cases, simply use the forced impl
+            default:
+                return forced;
+        }
+    }
+
+    return select_default_softmax_impl<A, C>();
+}
+
+/*!
+ * \brief Apply a softmax kernel on the whole expression or, in batch
+ * mode, on each row of the expression.
+ *
+ * The rows are distributed to the threads of the pool.
+ *
+ * \param a The input expression
+ * \param kernel The kernel to apply on a range of flat elements
+ */
+template <bool Batch, typename A, typename Kernel>
+void softmax_dispatch(const A& a, Kernel&& kernel) {
+    if (Batch) {
+        const std::size_t rows = etl::dim<0>(a);
+
+        if (!rows) {
+            return;
+        }
+
+        const std::size_t n = etl::size(a) / rows;
+
+        auto batch_fun = [&](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                kernel(i * n, (i + 1) * n);
+            }
+        };
+
+        dispatch_1d_any(etl::select_parallel(etl::size(a)), batch_fun, 0, rows);
+    } else if (etl::size(a)) {
+        kernel(0, etl::size(a));
+    }
+}
+
+/*!
+ * \brief Functor for softmax
+ * \tparam Batch Indicates if the softmax is computed on each row
+ */
+template <bool Batch>
+struct softmax {
+    /*!
+     * \brief Compute the softmax of a and store the result in c
+     * \param a The input expression
+     * \param c The output expression
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        const auto impl = select_softmax_impl<A, C>();
+
+        softmax_dispatch<Batch>(a, [&](std::size_t first, std::size_t last) {
+            if (impl == softmax_impl::VEC) {
+                etl::impl::vec::softmax(a, c, first, last);
+            } else {
+                etl::impl::standard::softmax(a, c, first, last);
+            }
+        });
+    }
+
+    /*!
+     * \brief Returns a textual representation of the operation
+     * \return a textual representation of the operation
+     */
+    static std::string desc() noexcept {
+        return Batch ? "batch_softmax" : "softmax";
+    }
+};
+
+/*!
+ * \brief Functor for stable softmax
+ * \tparam Batch Indicates if the softmax is computed on each row
+ */
+template <bool Batch>
+struct stable_softmax {
+    /*!
+     * \brief Compute the stable softmax of a and store the result in c
+     * \param a The input expression
+     * \param c The output expression
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        const auto impl = select_softmax_impl<A, C>();
+
+        softmax_dispatch<Batch>(a, [&](std::size_t first, std::size_t last) {
+            if (impl == softmax_impl::VEC) {
+                etl::impl::vec::stable_softmax(a, c, first, last);
+            } else {
+                etl::impl::standard::stable_softmax(a, c, first, last);
+            }
+        });
+    }
+
+    /*!
+     * \brief Returns a textual representation of the operation
+     * \return a textual representation of the operation
+     */
+    static std::string desc() noexcept {
+        return Batch ? "batch_stable_softmax" : "stable_softmax";
+    }
+};
+
+/*!
+ * \brief Functor for the diagonal of the Jacobian of the softmax
+ * \tparam Batch Indicates if the softmax is computed on each row
+ */
+template <bool Batch>
+struct softmax_jacobian_diag {
+    /*!
+     * \brief Compute the diagonal of the Jacobian of the softmax of a and store the result in c
+     * \param a The input expression
+     * \param c The output expression
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        const auto impl = select_softmax_impl<A, C>();
+
+        softmax_dispatch<Batch>(a, [&](std::size_t first, std::size_t last) {
+            if (impl == softmax_impl::VEC) {
+                etl::impl::vec::softmax_jacobian_diag(a, c, first, last);
+            } else {
+                etl::impl::standard::softmax_jacobian_diag(a, c, first, last);
+            }
+        });
+    }
+
+    /*!
+     * \brief Returns a textual representation of the operation
+     * \return a textual representation of the operation
+     */
+    static std::string desc() noexcept {
+        return Batch ? "batch_softmax_jacobian_diag" : "softmax_jacobian_diag";
+    }
+};
+
+/*!
+ * \brief Functor for the logarithm of the softmax
+ * \tparam Batch Indicates if the softmax is computed on each row
+ */
+template <bool Batch>
+struct log_softmax {
+    /*!
+     * \brief Compute the logarithm of the softmax of a and store the result in c
+     * \param a The input expression
+     * \param c The output expression
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        const auto impl = select_softmax_impl<A, C>();
+
+        softmax_dispatch<Batch>(a, [&](std::size_t first, std::size_t last) {
+            if (impl == softmax_impl::VEC) {
+                etl::impl::vec::log_softmax(a, c, first, last);
+            } else {
+                etl::impl::standard::log_softmax(a, c, first, last);
+            }
+        });
+    }
+
+    /*!
+     * \brief Returns a textual representation of the operation
+     * \return a textual representation of the operation
+     */
+    static std::string desc() noexcept {
+        return Batch ? "batch_log_softmax" : "log_softmax";
+    }
+};
+
+} //end of namespace detail
+
+} //end of namespace etl
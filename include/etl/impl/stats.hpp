@@ -0,0 +1,80 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the "stats" reduction implementations.
+ *
+ * The statistics (mean, variance, minimum, maximum and their indices) are
+ * computed in one pass over the expression. The selection of the
+ * implementation follows the one of the "sum" reduction. In parallel, each
+ * thread computes the statistics of its range and the partial statistics
+ * are merged in order.
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/common/stats.hpp"
+#include "etl/impl/std/stats.hpp"
+#include "etl/impl/vec/stats.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Select the stats implementation for an expression of type E
+ * \tparam E The type of expression
+ * \return The implementation to use
+ */
+template <typename E>
+etl::sum_impl select_stats_impl() {
+    // The vectorized kernel is only available for floating point
+    if (!std::is_floating_point<value_t<E>>::value) {
+        return etl::sum_impl::STD;
+    }
+
+    return select_sum_impl<E>();
+}
+
+/*!
+ * \brief Stats operation implementation
+ */
+struct stats_impl {
+    /*!
+     * \brief Apply the functor to e
+     */
+    template <typename E>
+    static statistics<value_t<E>> apply(const E& e) {
+        auto impl = select_stats_impl<E>();
+
+        bool parallel_dispatch = select_parallel(e);
+
+        statistics<value_t<E>> acc;
+
+        auto acc_functor = [&acc](const statistics<value_t<E>>& value) {
+            acc.merge(value);
+        };
+
+        if (impl == etl::sum_impl::VEC) {
+            dispatch_1d_acc<statistics<value_t<E>>>(parallel_dispatch, [&e](std::size_t first, std::size_t last) -> statistics<value_t<E>> {
+                return impl::vec::stats(e, first, last);
+            }, acc_functor, 0, size(e));
+        } else {
+            dispatch_1d_acc<statistics<value_t<E>>>(parallel_dispatch, [&e](std::size_t first, std::size_t last) -> statistics<value_t<E>> {
+                return impl::standard::stats(e, first, last);
+            }, acc_functor, 0, size(e));
+        }
+
+        return acc;
+    }
+};
+
+} //end of namespace detail
+
+} //end of namespace etl
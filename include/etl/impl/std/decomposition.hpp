@@ -19,68 +19,261 @@ namespace impl {
 namespace standard {
 
 /*!
- * \brief Performs the PA=LU decomposition of the matrix A
- * \param A The matrix to decompose
- * \param L The resulting L matrix
- * \param U The resulting U matrix
- * \param P The resulting P matrix
+ * \brief Compute the LU decomposition of the given matrix in place, with
+ * partial pivoting.
+ *
+ * After the decomposition, the strict lower part of lu contains L (with an
+ * implicit unit diagonal) and the upper part contains U. The row i of L * U
+ * is the row perm[i] of the input matrix.
+ *
+ * \param lu The matrix to decompose, replaced by its decomposition
+ * \param perm The permutation of the rows (output)
+ * \return false if the matrix is singular, true otherwise
  */
-template <typename AT, typename LT, typename UT, typename PT>
-void lu(const AT& A, LT& L, UT& U, PT& P) {
-    const auto n = etl::dim(A, 0);
+template <typename LU>
+bool lu_factor(LU& lu, std::vector<std::size_t>& perm) {
+    const auto n = etl::dim<0>(lu);
 
-    L = 0;
-    U = 0;
-    P = 0;
+    perm.resize(n);
 
-    // 1. Create the pivot matrix
-
-    for(std::size_t i = 0; i < n; ++i){
-        P(i, i) = 1;
+    for (std::size_t i = 0; i < n; ++i) {
+        perm[i] = i;
     }
 
-    for(std::size_t i = 0; i < n; ++i){
-        auto max_j = i;
+    bool regular = true;
+
+    for (std::size_t j = 0; j < n; ++j) {
+        auto p = j;
 
-        for(std::size_t j = i; j < n; ++j){
-            if(std::abs(A(j, i)) > A(max_j, i)){
-                max_j = j;
+        for (std::size_t i = j + 1; i < n; ++i) {
+            if (std::abs(lu(i, j)) > std::abs(lu(p, j))) {
+                p = i;
             }
         }
 
-        if(max_j != i){
-            for(std::size_t k = 0; k < n; ++k){
+        if (p != j) {
+            for (std::size_t k = 0; k < n; ++k) {
                 using std::swap;
-                swap(P(i, k), P(max_j, k));
+                swap(lu(j, k), lu(p, k));
             }
+
+            std::swap(perm[j], perm[p]);
+        }
+
+        if (lu(j, j) == value_t<LU>(0)) {
+            regular = false;
+            continue;
         }
-    }
 
-    auto Ap = etl::force_temporary(P * A);
+        for (std::size_t i = j + 1; i < n; ++i) {
+            lu(i, j) /= lu(j, j);
 
-    for(std::size_t i = 0; i < n; ++i){
-        L(i, i) = 1;
+            for (std::size_t k = j + 1; k < n; ++k) {
+                lu(i, k) -= lu(i, j) * lu(j, k);
+            }
+        }
     }
 
+    return regular;
+}
+
+/*!
+ * \brief Solve A X = B in place, given the LU decomposition of A.
+ * \param lu The LU decomposition of A, as computed by lu_factor
+ * \param perm The permutation of the rows of the decomposition
+ * \param x The matrix (n x r, row major) containing B, replaced by X
+ */
+template <typename LU, typename X>
+void lu_solve(const LU& lu, const std::vector<std::size_t>& perm, X& x) {
+    const auto n = etl::dim<0>(lu);
+    const auto r = etl::dim<1>(x);
+
+    auto b = force_temporary(x);
+
     for (std::size_t i = 0; i < n; ++i) {
-        for (std::size_t j = 0; j < n; ++j) {
-            if (j <= i) {
-                value_t<AT> s = 0;
+        for (std::size_t c = 0; c < r; ++c) {
+            x(i, c) = b(perm[i], c);
+        }
+    }
+
+    // Forward substitution with L
+
+    for (std::size_t i = 1; i < n; ++i) {
+        for (std::size_t p = 0; p < i; ++p) {
+            for (std::size_t c = 0; c < r; ++c) {
+                x(i, c) -= lu(i, p) * x(p, c);
+            }
+        }
+    }
+
+    // Backward substitution with U
+
+    for (std::size_t i = n; i-- > 0;) {
+        for (std::size_t p = i + 1; p < n; ++p) {
+            for (std::size_t c = 0; c < r; ++c) {
+                x(i, c) -= lu(i, p) * x(p, c);
+            }
+        }
+
+        for (std::size_t c = 0; c < r; ++c) {
+            x(i, c) /= lu(i, i);
+        }
+    }
+}
+
+/*!
+ * \brief Compute the Cholesky decomposition of the given matrix in place.
+ *
+ * Only the lower part of the matrix is read. After the decomposition, the
+ * lower part contains L and the strict upper part is zero.
+ *
+ * \param l The matrix to decompose, replaced by its decomposition
+ * \return false if the matrix is not positive definite, true otherwise
+ */
+template <typename L>
+bool cholesky(L& l) {
+    using T = value_t<L>;
+
+    const auto n = etl::dim<0>(l);
+
+    for (std::size_t j = 0; j < n; ++j) {
+        T d = l(j, j);
+
+        for (std::size_t k = 0; k < j; ++k) {
+            d -= l(j, k) * l(j, k);
+        }
+
+        if (!(d > T(0))) {
+            return false;
+        }
+
+        l(j, j) = std::sqrt(d);
+
+        // The rows below the diagonal are independent
+
+        auto fun = [&l, j](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                T s = l(i, j);
+
                 for (std::size_t k = 0; k < j; ++k) {
-                    s += L(j, k) * U(k, i);
+                    s -= l(i, k) * l(j, k);
+                }
+
+                l(i, j) = s / l(j, j);
+            }
+        };
+
+        dispatch_1d(select_parallel((n - j - 1) * j, parallel_threshold), fun, j + 1, n);
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = i + 1; j < n; ++j) {
+            l(i, j) = T(0);
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Compute the QR decomposition of the given matrix, with Householder
+ * reflectors.
+ * \param r The matrix to decompose (m x n), replaced by R
+ * \param q The Q matrix (m x m, output)
+ */
+template <typename R, typename Q>
+void qr(R& r, Q& q) {
+    using T = value_t<R>;
+
+    const std::size_t m = etl::dim<0>(r);
+    const std::size_t n = etl::dim<1>(r);
+    const std::size_t p = m ? std::min(m - 1, n) : 0;
+
+    // The reflector k is H_k = I - tau[k] v v^T, v(k) = 1 and the rest
+    // of v is stored below the diagonal of r
+
+    std::vector<T> tau(p);
+
+    for (std::size_t k = 0; k < p; ++k) {
+        T xnorm = T(0);
+
+        for (std::size_t i = k + 1; i < m; ++i) {
+            xnorm += r(i, k) * r(i, k);
+        }
+
+        tau[k] = T(0);
+
+        if (xnorm == T(0)) {
+            continue;
+        }
+
+        const T alpha = r(k, k);
+        const T beta  = -std::copysign(std::sqrt(alpha * alpha + xnorm), alpha);
+
+        tau[k] = (beta - alpha) / beta;
+
+        for (std::size_t i = k + 1; i < m; ++i) {
+            r(i, k) /= alpha - beta;
+        }
+
+        r(k, k) = beta;
+
+        // The columns are independent
+
+        auto fun = [&r, &tau, k, m](std::size_t first, std::size_t last) {
+            for (std::size_t j = first; j < last; ++j) {
+                T s = r(k, j);
+
+                for (std::size_t i = k + 1; i < m; ++i) {
+                    s += r(i, k) * r(i, j);
                 }
 
-                U(j, i) = Ap(j, i) - s;
+                s *= tau[k];
+
+                r(k, j) -= s;
+
+                for (std::size_t i = k + 1; i < m; ++i) {
+                    r(i, j) -= s * r(i, k);
+                }
             }
+        };
+
+        dispatch_1d(select_parallel((m - k) * (n - k - 1), parallel_threshold), fun, k + 1, n);
+    }
 
-            if (j >= i) {
-                value_t<AT> s = 0;
-                for (std::size_t k = 0; k < i; ++k) {
-                    s += L(j, k) * U(k, i);
+    // Accumulate Q = H_0 ... H_(p-1), starting from the last reflector
+
+    q = T(0);
+
+    for (std::size_t i = 0; i < m; ++i) {
+        q(i, i) = T(1);
+    }
+
+    for (std::size_t k = p; k-- > 0;) {
+        auto fun = [&q, &r, &tau, k, m](std::size_t first, std::size_t last) {
+            for (std::size_t j = first; j < last; ++j) {
+                T s = q(k, j);
+
+                for (std::size_t i = k + 1; i < m; ++i) {
+                    s += r(i, k) * q(i, j);
                 }
 
-                L(j, i) = (Ap(j, i) - s) / U(i, i);
+                s *= tau[k];
+
+                q(k, j) -= s;
+
+                for (std::size_t i = k + 1; i < m; ++i) {
+                    q(i, j) -= s * r(i, k);
+                }
             }
+        };
+
+        dispatch_1d(select_parallel((m - k) * (m - k), parallel_threshold), fun, k, m);
+    }
+
+    for (std::size_t i = 1; i < m; ++i) {
+        for (std::size_t j = 0; j < std::min(i, n); ++j) {
+            r(i, j) = T(0);
         }
     }
 }
@@ -14,12 +14,6 @@
 
 namespace etl {
 
-/*!
- * \copydoc etl::lu
- */
-template <typename AT, typename LT, typename UT, typename PT>
-bool lu(const AT& A, LT& L, UT& U, PT& P);
-
 namespace impl {
 
 namespace standard {
@@ -53,13 +47,33 @@ value_t<AT> det(const AT& A) {
         return det;
     }
 
-    auto L = force_temporary_dim_only(A);
-    auto U = force_temporary_dim_only(A);
-    auto P = force_temporary_dim_only(A);
+    etl::dyn_matrix<value_t<AT>> lu(n, n);
+    std::vector<std::size_t> perm;
+
+    lu = A;
 
-    etl::lu(A, L, U, P);
+    etl::detail::lu_factor_impl::apply(lu, perm);
+
+    value_t<AT> det(1.0);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        det *= lu(i, i);
+    }
+
+    // Each cycle of length l of the permutation is made of l - 1 swaps
+
+    std::vector<bool> visited(n, false);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = perm[i]; !visited[i] && j != i; j = perm[j]) {
+            visited[j] = true;
+            det = -det;
+        }
+
+        visited[i] = true;
+    }
 
-    return det(L) * det(U) * det(P);
+    return det;
 }
 
 } //end of namespace standard
@@ -7,6 +7,12 @@
 
 #pragma once
 
+#include <atomic>     //For the scratch of the plans
+#include <functional> //For the kernels of the plans
+#include <list>       //For the cache of plans
+#include <memory>     //For the shared plans
+#include <mutex>      //For the cache of plans
+
 namespace etl {
 
 namespace impl {
@@ -24,6 +30,12 @@ namespace detail {
  */
 constexpr std::size_t MAX_FACTORS = 32;
 
+/*!
+ * \brief The operations used by the power of two kernels, vectorized if
+ * the implementations are vectorized
+ */
+using fft_vec = std::conditional_t<vectorize_impl && vec_enabled, typename get_vector_impl<vector_mode>::type, impl::vec::scalar_fft_vec>;
+
 /*!
  * \brief Transform module for a FFT with 2 points
  * \param in The input vector
@@ -473,14 +485,13 @@ std::unique_ptr<etl::complex<T>[]> twiddle_compute(const std::size_t n, std::siz
  * \param factors The factors
  * \param n_factors The number of factors
  * \param twiddle The output twiddle factors (pointers inside the main twiddle factors array)
+ * \param tmp A scratch buffer of n complex numbers
  */
 template <typename In, typename T>
-void fft_perform(const In* r_in, etl::complex<T>* r_out, const std::size_t n, std::size_t* factors, std::size_t n_factors, etl::complex<T>** twiddle) {
-    auto tmp = etl::allocate<etl::complex<T>>(n);
+void fft_perform(const In* r_in, etl::complex<T>* r_out, const std::size_t n, const std::size_t* factors, std::size_t n_factors, etl::complex<T>* const* twiddle, etl::complex<T>* tmp) {
+    std::copy_n(r_in, n, tmp);
 
-    std::copy_n(r_in, n, tmp.get());
-
-    auto* in  = tmp.get();
+    auto* in  = tmp;
     auto* out = r_out;
 
     std::size_t product = 1;
@@ -516,165 +527,803 @@ void fft_perform(const In* r_in, etl::complex<T>* r_out, const std::size_t n, st
     }
 }
 
+} //end of namespace detail
+
 /*!
- * \brief Compute the general FFT of r_in
- * \param r_in The input signal
- * \param r_out The output signal
- * \param n The size of the tranform
+ * \brief A precomputed plan for 1D FFT of a fixed size and direction.
+ *
+ * The plan holds the factorization of the size, the twiddle factors
+ * and a scratch buffer. Once built, it can be executed any number of
+ * times, concurrently from several threads. The inverse transform is
+ * normalized by the size of the transform.
+ *
+ * The power of two sizes are transformed with the vectorized Stockham
+ * kernels, the other sizes with the mixed-radix transform modules. When
+ * the size has a large prime factor, for which the generic module is
+ * quadratic, the transform is computed with the algorithm of Bluestein.
  */
-template <typename In, typename T>
-void fft_n(const In* r_in, etl::complex<T>* r_out, const std::size_t n) {
-    //0. Factorize
+template <typename T>
+struct fft_plan {
+    using value_type   = T;               ///< The precision of the transform
+    using complex_type = etl::complex<T>; ///< The complex type used by the plan
+
+    /*!
+     * \brief Construct a new plan
+     * \param n The size of the transform
+     * \param direction The direction of the transform
+     */
+    explicit fft_plan(std::size_t n, fft_direction direction = fft_direction::FORWARD) : n(n), dir(direction) {
+        cpp_assert(n > 0, "Invalid FFT size");
+
+        const T sign = direction == fft_direction::FORWARD ? T(-1) : T(1);
+
+        if (math::is_power_of_two(n)) {
+            prepare_kernel(true, sign);
+        } else {
+            detail::fft_factorize(n, factors, n_factors);
 
-    std::size_t factors[MAX_FACTORS];
-    std::size_t n_factors = 0;
+            // The generic module is in O(n * p) for a prime factor p,
+            // Bluestein is in O(n log n). The factors are sorted, the
+            // last one is the largest
+            std::size_t log_n = 0;
 
-    fft_factorize(n, factors, n_factors);
+            while ((std::size_t(1) << (log_n + 1)) <= n) {
+                ++log_n;
+            }
 
-    //1. Precompute twiddle factors (stored in trig)
+            if (factors[n_factors - 1] >= fft_bluestein_threshold * log_n) {
+                prepare_kernel(false, sign);
+            } else {
+                trig         = detail::twiddle_compute<T>(n, factors, n_factors, twiddle);
+                scratch_size = n;
+            }
+        }
 
-    etl::complex<T>* twiddle[MAX_FACTORS];
+        scratch = etl::allocate<complex_type>(scratch_size);
+    }
 
-    auto trig = twiddle_compute(n, factors, n_factors, twiddle);
+    fft_plan(const fft_plan& rhs) = delete;
+    fft_plan& operator=(const fft_plan& rhs) = delete;
 
-    //2. Perform the FFT itself
+    /*!
+     * \brief Returns the size of the transform
+     */
+    std::size_t size() const noexcept {
+        return n;
+    }
 
-    fft_perform(r_in, r_out, n, factors, n_factors, twiddle);
-}
+    /*!
+     * \brief Returns the direction of the transform
+     */
+    fft_direction direction() const noexcept {
+        return dir;
+    }
+
+    /*!
+     * \brief Transform the n elements of in and store the result in out
+     * \param in The input signal (real or complex)
+     * \param out The output signal, may alias the input
+     */
+    template <typename In>
+    void execute(const In* in, complex_type* out) const {
+        with_scratch([&](complex_type* tmp) { execute_one(in, out, tmp); });
+    }
+
+    /*!
+     * \copydoc execute
+     */
+    template <typename In>
+    void execute(const In* in, std::complex<T>* out) const {
+        execute(in, reinterpret_cast<complex_type*>(out));
+    }
+
+    /*!
+     * \brief Transform batch consecutive signals of in and store the results in out
+     * \param in The input signals (real or complex)
+     * \param out The output signals, may alias the input
+     * \param batch The number of signals
+     */
+    template <typename In>
+    void execute_many(const In* in, complex_type* out, std::size_t batch) const {
+        auto batch_fun_b = [&](const size_t first, const size_t last) {
+            with_scratch([&](complex_type* tmp) {
+                for (std::size_t b = first; b < last; ++b) {
+                    execute_one(in + b * n, out + b * n, tmp);
+                }
+            });
+        };
+
+        dispatch_1d_any(select_parallel(batch, 8), batch_fun_b, 0, batch);
+    }
+
+    /*!
+     * \copydoc execute_many
+     */
+    template <typename In>
+    void execute_many(const In* in, std::complex<T>* out, std::size_t batch) const {
+        execute_many(in, reinterpret_cast<complex_type*>(out), batch);
+    }
+
+    /*!
+     * \brief Transform the expression a and store the result in c.
+     *
+     * If a contains several signals of the size of the plan, they
+     * are all transformed.
+     *
+     * \param a The input expression
+     * \param c The output expression
+     */
+    template <typename A, typename C>
+    void operator()(A&& a, C&& c) const {
+        static_assert(all_dma<A, C>::value, "FFT plans can only be executed on direct memory access expressions");
+
+        cpp_assert(etl::size(a) % n == 0, "Invalid input size for FFT plan");
+        cpp_assert(etl::size(a) == etl::size(c), "Invalid output size for FFT plan");
+
+        execute_many(a.memory_start(), c.memory_start(), etl::size(a) / n);
+    }
+
+private:
+    /*!
+     * \brief Prepare the vectorized kernel of the transform, compiled for
+     * the best instruction set of the host
+     * \param power_of_two Indicates if the power of two kernel or the Bluestein kernel is used
+     * \param sign The sign of the exponent of the transform (-1 forward, 1 inverse)
+     */
+    void prepare_kernel(bool power_of_two, T sign) {
+#ifdef ETL_ISA_AVX512
+        if (vectorize_impl && isa_avx512()) {
+            prepare_kernel<impl::vec::avx512::pow2_fft, impl::vec::avx512::bluestein_fft, avx512_vec>(power_of_two, sign);
+            return;
+        }
+#endif
+
+#ifdef ETL_ISA_AVX
+        if (vectorize_impl && isa_avx()) {
+            prepare_kernel<impl::vec::avx::pow2_fft, impl::vec::avx::bluestein_fft, avx_vec>(power_of_two, sign);
+            return;
+        }
+#endif
+
+        prepare_kernel<impl::vec::pow2_fft, impl::vec::bluestein_fft, detail::fft_vec>(power_of_two, sign);
+    }
+
+    /*!
+     * \brief Prepare the vectorized kernel of the transform with the
+     * given kernels and vectorization mode
+     * \param power_of_two Indicates if the power of two kernel or the Bluestein kernel is used
+     * \param sign The sign of the exponent of the transform (-1 forward, 1 inverse)
+     */
+    template <template <typename, typename> class Pow2, template <typename, typename> class Bluestein, typename V>
+    void prepare_kernel(bool power_of_two, T sign) {
+        if (power_of_two) {
+            set_kernel(std::make_shared<const Pow2<V, T>>(n, sign));
+        } else {
+            set_kernel(std::make_shared<const Bluestein<V, T>>(n, sign));
+        }
+    }
+
+    /*!
+     * \brief Use the given vectorized kernel for the transform
+     */
+    template <typename Kernel>
+    void set_kernel(std::shared_ptr<const Kernel> k) {
+        kernel       = [k](const complex_type* in, complex_type* out, complex_type* tmp) { k->execute(in, out, tmp); };
+        scratch_size = k->work_size();
+    }
+
+    /*!
+     * \brief Run the given functor with a scratch buffer. The scratch
+     * of the plan is used when available, otherwise a new one is
+     * allocated.
+     */
+    template <typename Functor>
+    void with_scratch(Functor&& functor) const {
+        if (!scratch_busy.test_and_set(std::memory_order_acquire)) {
+            functor(scratch.get());
+            scratch_busy.clear(std::memory_order_release);
+        } else {
+            auto tmp = etl::allocate<complex_type>(scratch_size);
+            functor(tmp.get());
+        }
+    }
+
+    /*!
+     * \brief Transform one signal with the kernel of the plan
+     */
+    template <typename In>
+    void execute_one(const In* in, complex_type* out, complex_type* tmp) const {
+        if (kernel) {
+            execute_kernel(in, out, tmp);
+        } else {
+            execute_general(in, out, tmp);
+        }
+    }
+
+    /*!
+     * \brief Perform a transform with a vectorized kernel, the twiddle
+     * factors of the kernel already contain the direction
+     */
+    void execute_kernel(const complex_type* in, complex_type* out, complex_type* tmp) const {
+        kernel(in, out, tmp);
+
+        if (dir == fft_direction::INVERSE) {
+            // The normalization is done on the real and imaginary parts
+            T* values     = reinterpret_cast<T*>(out);
+            const T scale = T(1) / T(n);
+
+            for (std::size_t i = 0; i < 2 * n; ++i) {
+                values[i] *= scale;
+            }
+        }
+    }
+
+    /*!
+     * \copydoc execute_kernel
+     */
+    void execute_kernel(const std::complex<T>* in, complex_type* out, complex_type* tmp) const {
+        execute_kernel(reinterpret_cast<const complex_type*>(in), out, tmp);
+    }
+
+    /*!
+     * \brief Perform a transform of a real signal, or of a signal of
+     * another precision, with a vectorized kernel, after converting it
+     * to the output
+     */
+    template <typename In>
+    void execute_kernel(const In* in, complex_type* out, complex_type* tmp) const {
+        std::copy_n(in, n, out);
+        execute_kernel(const_cast<const complex_type*>(out), out, tmp);
+    }
+
+    /*!
+     * \brief Perform a mixed-radix transform. The transform modules
+     * only compute forward transforms, the inverse is computed by
+     * conjugating before and after the forward transform
+     */
+    template <typename In>
+    void execute_general(const In* in, complex_type* out, complex_type* tmp) const {
+        if (dir == fft_direction::FORWARD) {
+            detail::fft_perform(in, out, n, factors, n_factors, twiddle, tmp);
+        } else {
+            std::copy_n(in, n, out);
+
+            for (std::size_t i = 0; i < n; ++i) {
+                out[i] = conj(out[i]);
+            }
+
+            detail::fft_perform(out, out, n, factors, n_factors, twiddle, tmp);
+
+            for (std::size_t i = 0; i < n; ++i) {
+                out[i] = conj(out[i]) / T(n);
+            }
+        }
+    }
+
+    std::size_t n;                                ///< The size of the transform
+    fft_direction dir;                            ///< The direction of the transform
+    std::size_t factors[detail::MAX_FACTORS];     ///< The factors of n
+    std::size_t n_factors = 0;                    ///< The number of factors
+    complex_type* twiddle[detail::MAX_FACTORS];   ///< Pointers to the twiddle factors of each factor
+    std::unique_ptr<complex_type[]> trig;         ///< The twiddle factors of the mixed-radix transform
+    std::function<void(const complex_type*, complex_type*, complex_type*)> kernel; ///< The vectorized transform, if n is a power of two or has a large prime factor
+    std::size_t scratch_size;                     ///< The size of the scratch buffer
+    std::unique_ptr<complex_type[]> scratch;      ///< The scratch buffer of the plan
+    mutable std::atomic_flag scratch_busy = ATOMIC_FLAG_INIT; ///< Indicates if the scratch buffer is in use
+};
 
 /*!
- * \brief Compute many general FFT of all the signals in r_in
- * \param r_in The input signal
- * \param r_out The output signal
- * \param batch The number of signals
- * \param n The size of the tranform
+ * \brief A thread-safe least-recently-used cache of FFT plans
+ * \tparam T The precision of the plans
+ * \tparam Plan The type of plans
  */
-template <typename In, typename T>
-void fft_n_many(const In* r_in, etl::complex<T>* r_out, const std::size_t batch, const std::size_t n) {
-    const std::size_t distance = n; //in/out distance between samples
+template <typename T, typename Plan = fft_plan<T>>
+struct fft_plan_cache {
+    using plan_ptr = std::shared_ptr<const Plan>; ///< The type of plan handed out by the cache
+
+    /*!
+     * \brief Returns the plan for the given size and direction, building it if necessary
+     * \param n The size of the transform
+     * \param direction The direction of the transform
+     * \return the plan for the transform
+     */
+    plan_ptr get(std::size_t n, fft_direction direction) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if (auto plan = find(n, direction)) {
+                return plan;
+            }
+        }
 
-    //0. Factorize
+        // The plan is built outside of the lock
+        auto plan = std::make_shared<const Plan>(n, direction);
 
-    std::size_t factors[MAX_FACTORS];
-    std::size_t n_factors = 0;
+        std::lock_guard<std::mutex> lock(mutex);
 
-    fft_factorize(n, factors, n_factors);
+        // Another thread may have built the same plan in between
+        if (auto existing = find(n, direction)) {
+            return existing;
+        }
 
-    //1. Precompute twiddle factors (stored in trig)
+        plans.push_front(plan);
 
-    etl::complex<T>* twiddle[MAX_FACTORS];
+        if (plans.size() > fft_plan_cache_size) {
+            plans.pop_back();
+        }
 
-    auto trig = twiddle_compute(n, factors, n_factors, twiddle);
+        return plan;
+    }
 
-    //2. Perform all the FFT itself
+    /*!
+     * \brief Returns the number of plans currently cached
+     */
+    std::size_t size() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return plans.size();
+    }
 
-    auto batch_fun_b = [&](const size_t first, const size_t last) {
-        for (std::size_t b = first; b < last; ++b) {
-            fft_perform(r_in + b * distance, r_out + b * distance, n, factors, n_factors, twiddle);
+    /*!
+     * \brief Release all the cached plans. Plans still in use are
+     * released by their last user.
+     */
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        plans.clear();
+    }
+
+    /*!
+     * \brief Returns the cache for the precision T and the type of plans
+     */
+    static fft_plan_cache& instance() {
+        static fft_plan_cache cache;
+        return cache;
+    }
+
+private:
+    /*!
+     * \brief Find a plan and mark it as the most recently used. The
+     * lock must be held.
+     */
+    plan_ptr find(std::size_t n, fft_direction direction) {
+        for (auto it = plans.begin(); it != plans.end(); ++it) {
+            if ((*it)->size() == n && (*it)->direction() == direction) {
+                plans.splice(plans.begin(), plans, it);
+                return plans.front();
+            }
         }
-    };
 
-    dispatch_1d_any(select_parallel(batch, 8), batch_fun_b, 0, batch);
+        return nullptr;
+    }
+
+    std::mutex mutex;          ///< The mutex protecting the plans
+    std::list<plan_ptr> plans; ///< The plans, most recently used first
+};
+
+/*!
+ * \brief Returns the cached plan for a transform of the given size and direction
+ * \param n The size of the transform
+ * \param direction The direction of the transform
+ * \return the plan for the transform
+ */
+template <typename T>
+std::shared_ptr<const fft_plan<T>> get_fft_plan(std::size_t n, fft_direction direction = fft_direction::FORWARD) {
+    return fft_plan_cache<T>::instance().get(n, direction);
 }
 
+/*!
+ * \brief A precomputed plan for the 1D FFT of a real signal of a fixed
+ * size and direction.
+ *
+ * The spectrum of a real signal of n values is conjugate symmetric, only
+ * its n / 2 + 1 first coefficients are stored. The forward transform
+ * computes them from the signal and the inverse transform computes the
+ * signal back from them, normalized by the size of the transform.
+ *
+ * For even sizes, the n real values are packed into n / 2 complex
+ * numbers, transformed with a complex FFT of half the size and then
+ * separated into the transforms of the even and odd values. For odd
+ * sizes, the plan falls back to a complex FFT of the full size.
+ */
 template <typename T>
-void inplace_radix2_fft1(etl::complex<T>* x, std::size_t N) {
-    using complex_t = etl::complex<T>;
+struct rfft_plan {
+    using value_type   = T;               ///< The precision of the transform
+    using complex_type = etl::complex<T>; ///< The complex type used by the plan
+
+    /*!
+     * \brief Construct a new plan
+     * \param n The size of the real signal
+     * \param direction The direction of the transform
+     */
+    explicit rfft_plan(std::size_t n, fft_direction direction = fft_direction::FORWARD) : n(n), dir(direction) {
+        cpp_assert(n > 0, "Invalid FFT size");
+
+        if (n % 2 == 0) {
+            const std::size_t half = n / 2;
+
+            plan  = get_fft_plan<T>(half, direction);
+            roots = etl::allocate<complex_type>(half / 2 + 1);
+
+            for (std::size_t k = 0; k <= half / 2; ++k) {
+                const double theta = -2.0 * M_PI * double(k) / double(n);
+                roots[k]           = complex_type{T(std::cos(theta)), T(std::sin(theta))};
+            }
+        } else {
+            plan = get_fft_plan<T>(n, direction);
+        }
+    }
+
+    rfft_plan(const rfft_plan& rhs) = delete;
+    rfft_plan& operator=(const rfft_plan& rhs) = delete;
 
-    //Decimate
-    for (std::size_t a = 0, b = 0; a < N; ++a) {
-        if (b > a) {
-            std::swap(x[a], x[b]);
+    /*!
+     * \brief Returns the size of the real signal
+     */
+    std::size_t size() const noexcept {
+        return n;
+    }
+
+    /*!
+     * \brief Returns the number of coefficients of the half spectrum
+     */
+    std::size_t spectrum_size() const noexcept {
+        return n / 2 + 1;
+    }
+
+    /*!
+     * \brief Returns the direction of the transform
+     */
+    fft_direction direction() const noexcept {
+        return dir;
+    }
+
+    /*!
+     * \brief Compute the half spectrum of a real signal
+     * \param in The n values of the signal
+     * \param out The n / 2 + 1 first coefficients of the spectrum
+     */
+    void execute(const T* in, complex_type* out) const {
+        cpp_assert(dir == fft_direction::FORWARD, "Real signals can only be transformed by forward plans");
+
+        if (n % 2 == 0) {
+            forward_packed(in, out);
+        } else {
+            forward_full(in, out);
         }
+    }
 
-        std::size_t bit = N;
-        do {
-            bit >>= 1;
-            b ^= bit;
-        } while ((b & bit) == 0 && bit != 1);
+    /*!
+     * \copydoc execute(const T*, complex_type*) const
+     */
+    void execute(const T* in, std::complex<T>* out) const {
+        execute(in, reinterpret_cast<complex_type*>(out));
     }
 
-    constexpr T pi = M_PIl;
+    /*!
+     * \brief Compute the real signal of a half spectrum
+     * \param in The n / 2 + 1 first coefficients of the spectrum
+     * \param out The n values of the signal, may alias the input
+     */
+    void execute(const complex_type* in, T* out) const {
+        cpp_assert(dir == fft_direction::INVERSE, "Real signals can only be computed by inverse plans");
 
-    const auto NN = size_t(1) << size_t(std::log2(N));
+        if (n % 2 == 0) {
+            inverse_packed(in, out);
+        } else {
+            inverse_full(in, out);
+        }
+    }
 
-    for (std::size_t s = 1; s <= std::log2(N); ++s) {
-        auto m = size_t(1) << s;
-        complex_t w(1.0, 0.0);
-        complex_t wm(cos(2 * -pi / m), sin(2 * -pi / m));
-        for (std::size_t j = 0; j < m / 2; ++j) {
-            for (std::size_t k = j; k < NN; k += m) {
-                auto t = w * x[k + m / 2];
+    /*!
+     * \copydoc execute(const complex_type*, T*) const
+     */
+    void execute(const std::complex<T>* in, T* out) const {
+        execute(reinterpret_cast<const complex_type*>(in), out);
+    }
+
+    /*!
+     * \brief Transform batch consecutive signals (or half spectrums) of
+     * in and store the results in out. The input and the output must not
+     * overlap.
+     * \param in The input signals
+     * \param out The output signals
+     * \param batch The number of signals
+     */
+    template <typename In, typename Out>
+    void execute_many(const In* in, Out* out, std::size_t batch) const {
+        const std::size_t in_n  = dir == fft_direction::FORWARD ? n : spectrum_size();
+        const std::size_t out_n = dir == fft_direction::FORWARD ? spectrum_size() : n;
 
-                complex_t u  = x[k];
-                x[k]         = u + t;
-                x[k + m / 2] = u - t;
+        auto batch_fun_b = [&](const size_t first, const size_t last) {
+            for (std::size_t b = first; b < last; ++b) {
+                execute(in + b * in_n, out + b * out_n);
             }
+        };
+
+        dispatch_1d_any(select_parallel(batch, 8), batch_fun_b, 0, batch);
+    }
+
+    /*!
+     * \brief Transform the expression a and store the result in c.
+     *
+     * If a contains several signals (or half spectrums) of the size of
+     * the plan, they are all transformed.
+     *
+     * \param a The input expression
+     * \param c The output expression
+     */
+    template <typename A, typename C>
+    void operator()(A&& a, C&& c) const {
+        static_assert(all_dma<A, C>::value, "FFT plans can only be executed on direct memory access expressions");
+
+        const std::size_t in_n  = dir == fft_direction::FORWARD ? n : spectrum_size();
+        const std::size_t out_n = dir == fft_direction::FORWARD ? spectrum_size() : n;
+
+        cpp_assert(etl::size(a) % in_n == 0, "Invalid input size for rfft plan");
+        cpp_assert(etl::size(c) == (etl::size(a) / in_n) * out_n, "Invalid output size for rfft plan");
+        cpp_unused(out_n);
+
+        execute_many(a.memory_start(), c.memory_start(), etl::size(a) / in_n);
+    }
+
+private:
+    /*!
+     * \brief Forward transform of an even size. The values are packed
+     * as z[j] = x[2j] + i x[2j+1] and the spectrum of z is separated
+     * in the spectrums of the even and odd values, E and O, with
+     * E[k] = (Z[k] + conj(Z[h-k])) / 2 and O[k] = (Z[k] - conj(Z[h-k])) / 2i.
+     */
+    void forward_packed(const T* in, complex_type* out) const {
+        const std::size_t half = n / 2;
+
+        auto* packed = reinterpret_cast<T*>(out);
+
+        if (packed != in) {
+            std::copy_n(in, n, packed);
+        }
+
+        plan->execute(out, out);
+
+        const T r0 = out[0].real;
+        const T i0 = out[0].imag;
+
+        out[0]    = complex_type(r0 + i0, T(0));
+        out[half] = complex_type(r0 - i0, T(0));
+
+        // X[k] = E[k] + w^k O[k] and X[h-k] = conj(E[k] - w^k O[k])
+        for (std::size_t k = 1; k <= half / 2; ++k) {
+            const auto a = out[k];
+            const auto b = conj(out[half - k]);
+
+            const auto even = T(0.5) * (a + b);
+            const auto odd  = roots[k] * (T(0.5) * complex_type(a.imag - b.imag, b.real - a.real));
+
+            out[k]        = even + odd;
+            out[half - k] = conj(even - odd);
+        }
+    }
+
+    /*!
+     * \brief Inverse transform of an even size. The spectrums of the
+     * even and odd values are recombined into the spectrum of the
+     * packed signal which is then transformed in place in out.
+     */
+    void inverse_packed(const complex_type* in, T* out) const {
+        const std::size_t half = n / 2;
+
+        auto* packed = reinterpret_cast<complex_type*>(out);
+
+        // Read the extremities first since out may alias in
+        const T x0 = in[0].real;
+        const T xh = in[half].real;
+
+        for (std::size_t k = 1; k <= half / 2; ++k) {
+            const auto a = in[k];
+            const auto b = conj(in[half - k]);
+
+            const auto even = T(0.5) * (a + b);
+            const auto odd  = conj(roots[k]) * (T(0.5) * (a - b));
+
+            // Z[k] = E[k] + i O[k] and Z[h-k] = conj(E[k]) + i conj(O[k])
+            packed[k]        = complex_type(even.real - odd.imag, even.imag + odd.real);
+            packed[half - k] = complex_type(even.real + odd.imag, odd.real - even.imag);
+        }
+
+        packed[0] = complex_type(T(0.5) * (x0 + xh), T(0.5) * (x0 - xh));
+
+        plan->execute(packed, packed);
+    }
+
+    /*!
+     * \brief Forward transform of an odd size
+     */
+    void forward_full(const T* in, complex_type* out) const {
+        auto tmp = etl::allocate<complex_type>(n);
+
+        plan->execute(in, tmp.get());
+
+        std::copy_n(tmp.get(), spectrum_size(), out);
+    }
+
+    /*!
+     * \brief Inverse transform of an odd size. The full spectrum is
+     * rebuilt from its symmetry.
+     */
+    void inverse_full(const complex_type* in, T* out) const {
+        auto tmp = etl::allocate<complex_type>(n);
+
+        tmp[0] = in[0];
+
+        for (std::size_t k = 1; k < spectrum_size(); ++k) {
+            tmp[k]     = in[k];
+            tmp[n - k] = conj(in[k]);
+        }
+
+        plan->execute(tmp.get(), tmp.get());
 
-            w *= wm;
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = tmp[i].real;
         }
     }
+
+    std::size_t n;                                  ///< The size of the real signal
+    fft_direction dir;                              ///< The direction of the transform
+    std::shared_ptr<const fft_plan<T>> plan;        ///< The complex plan (of half the size for even sizes)
+    std::unique_ptr<complex_type[]> roots;          ///< The roots of unity used to separate the packed spectrum
+};
+
+/*!
+ * \brief Returns the cached plan for a real transform of the given size and direction
+ * \param n The size of the real signal
+ * \param direction The direction of the transform
+ * \return the plan for the transform
+ */
+template <typename T>
+std::shared_ptr<const rfft_plan<T>> get_rfft_plan(std::size_t n, fft_direction direction = fft_direction::FORWARD) {
+    return fft_plan_cache<T, rfft_plan<T>>::instance().get(n, direction);
 }
 
+namespace detail {
+
 /*!
- * \brief Kernel for 1D FFT. This kernel selects the best
- * implementation between general FFT and radix 2 FFT
+ * \brief Kernel for 1D FFT, using the cached plan for the size.
  * \param a The input signal
  * \param n The size of the tranform
  * \param c The output signal
  */
 template <typename T1, typename T>
 void fft1_kernel(const T1* a, std::size_t n, std::complex<T>* c) {
-    if (n <= 131072 && math::is_power_of_two(n)) {
-        std::copy_n(a, n, c);
-
-        detail::inplace_radix2_fft1(reinterpret_cast<etl::complex<T>*>(c), n);
-    } else {
-        detail::fft_n(a, reinterpret_cast<etl::complex<T>*>(c), n);
-    }
+    get_fft_plan<T>(n)->execute(a, c);
 }
 
 /*!
- * \brief Kernel for Inverse 1D FFT. This kernel selects the best
- * implementation between general FFT and radix 2 FFT
+ * \brief Kernel for Inverse 1D FFT, using the cached plan for the size.
  * \param a The input signal
  * \param n The size of the tranform
  * \param c The output signal
  */
 template <typename T>
 void ifft1_kernel(const std::complex<T>* a, std::size_t n, std::complex<T>* c) {
-    using complex_t = std::complex<T>;
+    get_fft_plan<T>(n, fft_direction::INVERSE)->execute(a, c);
+}
 
-    if (n <= 131072 && math::is_power_of_two(n)) {
-        //Conjugate the complex numbers
-        for (std::size_t i = 0; i < n; ++i) {
-            c[i] = std::conj(a[i]);
-        }
+/*!
+ * \brief Complete the half spectrum of a real signal with the conjugates
+ * of its coefficients
+ * \param c The spectrum, with its n / 2 + 1 first coefficients computed
+ * \param n The size of the transform
+ */
+template <typename T>
+void hermitian_mirror(etl::complex<T>* c, std::size_t n) {
+    for (std::size_t k = n / 2 + 1; k < n; ++k) {
+        c[k] = conj(c[n - k]);
+    }
+}
 
-        // Forward FFT
-        detail::inplace_radix2_fft1(reinterpret_cast<etl::complex<T>*>(c), n);
-    } else {
-        auto a_complex = allocate<complex_t>(n);
-        auto x         = a_complex.get();
+/*!
+ * \brief Transpose a complex matrix
+ * \param in The n1 x n2 input matrix
+ * \param n1 The first dimension of the input
+ * \param n2 The second dimension of the input
+ * \param out The n2 x n1 output matrix
+ */
+template <typename T>
+void transpose_complex(const etl::complex<T>* in, std::size_t n1, std::size_t n2, etl::complex<T>* out) {
+    constexpr std::size_t block = 16;
 
-        //Conjugate the complex numbers
-        for (std::size_t i = 0; i < n; ++i) {
-            x[i] = std::conj(a[i]);
-        }
+    for (std::size_t ii = 0; ii < n1; ii += block) {
+        const std::size_t i_end = std::min(ii + block, n1);
 
-        //Foward FFT
-        detail::fft_n(a_complex.get(), reinterpret_cast<etl::complex<T>*>(c), n);
-    }
+        for (std::size_t jj = 0; jj < n2; jj += block) {
+            const std::size_t j_end = std::min(jj + block, n2);
 
-    //Conjugate the complex numbers again
-    for (std::size_t i = 0; i < n; ++i) {
-        c[i] = std::conj(c[i]);
+            for (std::size_t i = ii; i < i_end; ++i) {
+                for (std::size_t j = jj; j < j_end; ++j) {
+                    out[j * n1 + i] = in[i * n2 + j];
+                }
+            }
+        }
     }
+}
+
+/*!
+ * \brief Returns the size of the real transforms used for a convolution
+ * of the given size. Odd sizes are padded to use the packed transform.
+ * \param n The size of the convolution
+ * \return The size of the transform
+ */
+inline std::size_t rfft_conv_size(std::size_t n) {
+    return n + n % 2;
+}
 
-    //Scale the numbers
-    for (std::size_t i = 0; i < n; ++i) {
-        c[i] /= double(n);
+/*!
+ * \brief Compute the half spectrum of a real 2D signal.
+ *
+ * The spectrum is stored transposed, i.e. its n2 / 2 + 1 columns are
+ * the rows of c. Elementwise products of spectra can be computed in this
+ * layout and transformed back with irfft2_t_kernel, without any
+ * transposition.
+ *
+ * \param a The n1 x n2 input signal
+ * \param n1 The first dimension of the signal
+ * \param n2 The second dimension of the signal
+ * \param c The (n2 / 2 + 1) x n1 output spectrum
+ * \param tmp A scratch buffer of n1 x (n2 / 2 + 1) complex numbers
+ */
+template <typename T>
+void rfft2_t_kernel(const T* a, std::size_t n1, std::size_t n2, etl::complex<T>* c, etl::complex<T>* tmp) {
+    const std::size_t h2 = n2 / 2 + 1;
+
+    get_rfft_plan<T>(n2)->execute_many(a, tmp, n1);
+
+    transpose_complex(tmp, n1, h2, c);
+
+    get_fft_plan<T>(n1)->execute_many(c, c, h2);
+}
+
+/*!
+ * \brief Compute a real 2D signal from its transposed half spectrum, as
+ * computed by rfft2_t_kernel. The spectrum is overwritten.
+ *
+ * \param a The (n2 / 2 + 1) x n1 input spectrum
+ * \param n1 The first dimension of the signal
+ * \param n2 The second dimension of the signal
+ * \param c The n1 x n2 output signal
+ * \param tmp A scratch buffer of n1 x (n2 / 2 + 1) complex numbers
+ */
+template <typename T>
+void irfft2_t_kernel(etl::complex<T>* a, std::size_t n1, std::size_t n2, T* c, etl::complex<T>* tmp) {
+    const std::size_t h2 = n2 / 2 + 1;
+
+    get_fft_plan<T>(n1, fft_direction::INVERSE)->execute_many(a, a, h2);
+
+    transpose_complex(a, h2, n1, tmp);
+
+    get_rfft_plan<T>(n2, fft_direction::INVERSE)->execute_many(tmp, c, n1);
+}
+
+/*!
+ * \brief Compute the transposed half spectrum of a real 2D signal,
+ * zero-padded to a larger size.
+ *
+ * \param a The m1 x m2 input signal
+ * \param m1 The first dimension of the signal
+ * \param m2 The second dimension of the signal
+ * \param s1 The first dimension of the padded signal
+ * \param s2 The second dimension of the padded signal
+ * \param padded A buffer of s1 x s2 values for the padded signal
+ * \param c The (s2 / 2 + 1) x s1 output spectrum
+ * \param tmp A scratch buffer of s1 x (s2 / 2 + 1) complex numbers
+ */
+template <typename T>
+void rfft2_padded_kernel(const T* a, std::size_t m1, std::size_t m2, std::size_t s1, std::size_t s2, T* padded, etl::complex<T>* c, etl::complex<T>* tmp) {
+    std::fill_n(padded, s1 * s2, T(0));
+
+    for (std::size_t i = 0; i < m1; ++i) {
+        direct_copy_n(a + i * m2, padded + i * s2, m2);
     }
+
+    rfft2_t_kernel(padded, s1, s2, c, tmp);
 }
 
 /*!
@@ -688,23 +1337,82 @@ void ifft1_kernel(const std::complex<T>* a, std::size_t n, std::complex<T>* c) {
 template<typename T>
 void conv1_full_kernel(const T* a, std::size_t m, const T* b, std::size_t n, T* c){
     const std::size_t size = m + n - 1;
+    const std::size_t s    = rfft_conv_size(size);
+
+    // 0. Pad a and b to the size of the transform
+
+    dyn_matrix<T, 1> a_padded(s);
+    dyn_matrix<T, 1> b_padded(s);
 
-    dyn_matrix<etl::complex<T>, 1> a_padded(size);
-    dyn_matrix<etl::complex<T>, 1> b_padded(size);
+    a_padded = T(0);
+    b_padded = T(0);
 
     direct_copy(a, a + m, a_padded.memory_start());
     direct_copy(b, b + n, b_padded.memory_start());
 
-    detail::fft1_kernel(reinterpret_cast<std::complex<T>*>(a_padded.memory_start()), size, reinterpret_cast<std::complex<T>*>(a_padded.memory_start()));
-    detail::fft1_kernel(reinterpret_cast<std::complex<T>*>(b_padded.memory_start()), size, reinterpret_cast<std::complex<T>*>(b_padded.memory_start()));
+    // 1. Half spectrums of a and b
+
+    dyn_matrix<etl::complex<T>, 1> a_spectrum(s / 2 + 1);
+    dyn_matrix<etl::complex<T>, 1> b_spectrum(s / 2 + 1);
+
+    auto forward = get_rfft_plan<T>(s);
+
+    forward->execute(a_padded.memory_start(), a_spectrum.memory_start());
+    forward->execute(b_padded.memory_start(), b_spectrum.memory_start());
+
+    // 2. Elementwise multiplication of a and b
+
+    a_spectrum *= b_spectrum;
+
+    // 3. Inverse FFT of a, already normalized and real
+
+    auto inverse = get_rfft_plan<T>(s, fft_direction::INVERSE);
 
-    a_padded *= b_padded;
+    if (s == size) {
+        inverse->execute(a_spectrum.memory_start(), c);
+    } else {
+        inverse->execute(a_spectrum.memory_start(), a_padded.memory_start());
+        direct_copy_n(a_padded.memory_start(), c, size);
+    }
+}
 
-    detail::ifft1_kernel(reinterpret_cast<std::complex<T>*>(a_padded.memory_start()), size, reinterpret_cast<std::complex<T>*>(a_padded.memory_start()));
+/*!
+ * \brief Returns the size of the transforms of an overlap-add
+ * convolution with a kernel of the given size.
+ *
+ * Each transform of size s produces s - n + 1 samples of the
+ * convolution. The power of two minimizing the cost per sample is
+ * chosen, within the bounds of the thresholds. The transform is not
+ * larger than needed for a signal of the given length.
+ *
+ * \param n The size of the kernel
+ * \param length The length of the signal, 0 if unknown
+ * \return The size of the transforms
+ */
+inline std::size_t conv1_ola_transform_size(std::size_t n, std::size_t length) {
+    auto cost = [n](std::size_t s) {
+        return double(s) * std::log2(double(s)) / double(s - n + 1);
+    };
+
+    std::size_t best = conv1_ola_min_transform;
+
+    while (best < 2 * n) {
+        best *= 2;
+    }
+
+    for (std::size_t s = 2 * best; s <= conv1_ola_max_transform; s *= 2) {
+        if (cost(s) < cost(best)) {
+            best = s;
+        }
+    }
 
-    for (std::size_t i = 0; i < size; ++i) {
-        c[i] = a_padded[i].real;
+    if (length) {
+        while (best / 2 >= length + n - 1) {
+            best /= 2;
+        }
     }
+
+    return best;
 }
 
 /*!
@@ -722,61 +1430,38 @@ template<typename T>
 void conv2_full_kernel(const T* a, std::size_t m1, std::size_t m2, const T* b, std::size_t n1, std::size_t n2, T* c, T beta){
     const std::size_t s1 = m1 + n1 - 1;
     const std::size_t s2 = m2 + n2 - 1;
-    const std::size_t n = s1 * s2;
-
-    // 0. Pad a and b to the size of c
-
-    dyn_matrix<etl::complex<T>, 2> a_padded(s1, s2);
-    dyn_matrix<etl::complex<T>, 2> b_padded(s1, s2);
-
-    for (std::size_t i = 0; i < m1; ++i) {
-        direct_copy_n(a + i * m2, a_padded.memory_start() + i * s2, m2);
-    }
-
-    for (std::size_t i = 0; i < n1; ++i) {
-        direct_copy_n(b + i * n2, b_padded.memory_start() + i * s2, n2);
-    }
-
-    // 1. FFT of a and b
+    const std::size_t t2 = rfft_conv_size(s2);
+    const std::size_t h2 = t2 / 2 + 1;
 
-    // a = fft2(a)
-    detail::fft_n_many(a_padded.memory_start(), a_padded.memory_start(), s1, s2);
-    a_padded.transpose_inplace();
-    detail::fft_n_many(a_padded.memory_start(), a_padded.memory_start(), s2, s1);
-    a_padded.transpose_inplace();
+    dyn_matrix<T, 2> padded(s1, t2);
+    dyn_matrix<etl::complex<T>, 2> a_spectrum(h2, s1);
+    dyn_matrix<etl::complex<T>, 2> b_spectrum(h2, s1);
+    dyn_matrix<etl::complex<T>, 2> tmp(s1, h2);
 
-    // b = fft2(b)
-    detail::fft_n_many(b_padded.memory_start(), b_padded.memory_start(), s1, s2);
-    b_padded.transpose_inplace();
-    detail::fft_n_many(b_padded.memory_start(), b_padded.memory_start(), s2, s1);
-    b_padded.transpose_inplace();
+    // 1. Pad a and b to the size of c and compute their half spectrums
 
-    // 2. Elementwise multiplication of and b
+    rfft2_padded_kernel(a, m1, m2, s1, t2, padded.memory_start(), a_spectrum.memory_start(), tmp.memory_start());
+    rfft2_padded_kernel(b, n1, n2, s1, t2, padded.memory_start(), b_spectrum.memory_start(), tmp.memory_start());
 
-    a_padded >>= b_padded;
+    // 2. Elementwise multiplication of a and b
 
-    // 3. Inverse FFT of a
+    a_spectrum >>= b_spectrum;
 
-    // a = conj(a)
-    a_padded = conj(a_padded);
+    // 3. Inverse FFT of a, already normalized and real
 
-    // a = fft2(a)
-    detail::fft_n_many(a_padded.memory_start(), a_padded.memory_start(), s1, s2);
-    a_padded.transpose_inplace();
-    detail::fft_n_many(a_padded.memory_start(), a_padded.memory_start(), s2, s1);
-    a_padded.transpose_inplace();
+    irfft2_t_kernel(a_spectrum.memory_start(), s1, t2, padded.memory_start(), tmp.memory_start());
 
-    // 4. Keep only the real part of the inverse FFT
+    // 4. Remove the padding of the transform
 
-    // c = real(conj(a) / n)
-    // Note: Since the conjugate does not change the real part, it is not necessary
     if(beta == T(0.0)){
-        for (std::size_t i = 0; i < n; ++i) {
-            c[i] = a_padded[i].real / T(n);
+        for (std::size_t i = 0; i < s1; ++i) {
+            direct_copy_n(padded.memory_start() + i * t2, c + i * s2, s2);
         }
     } else {
-        for (std::size_t i = 0; i < n; ++i) {
-            c[i] = beta * c[i] + a_padded[i].real / T(n);
+        for (std::size_t i = 0; i < s1; ++i) {
+            for (std::size_t j = 0; j < s2; ++j) {
+                c[i * s2 + j] = beta * c[i * s2 + j] + padded(i, j);
+            }
         }
     }
 }
@@ -788,11 +1473,33 @@ void conv2_full_kernel(const T* a, std::size_t m1, std::size_t m2, const T* b, s
  * \param a The input expression
  * \param c The output expression
  */
-template <typename A, typename C>
+template <typename A, typename C, cpp_enable_if(is_complex<A>::value)>
 void fft1(A&& a, C&& c) {
     detail::fft1_kernel(a.memory_start(), etl::size(a), c.memory_start());
 }
 
+/*!
+ * \brief Perform the 1D FFT on the real a and store the result in c.
+ *
+ * Only the first half of the spectrum is computed, the second half is
+ * conjugate symmetric.
+ *
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <typename A, typename C, cpp_disable_if(is_complex<A>::value)>
+void fft1(A&& a, C&& c) {
+    using T = value_t<A>;
+
+    const std::size_t n = etl::size(a);
+
+    auto* cc = reinterpret_cast<etl::complex<T>*>(c.memory_start());
+
+    get_rfft_plan<T>(n)->execute(a.memory_start(), cc);
+
+    detail::hermitian_mirror(cc, n);
+}
+
 /*!
  * \brief Perform the 1D Inverse FFT on a and store the result in c
  * \param a The input expression
@@ -812,9 +1519,12 @@ void ifft1(A&& a, C&& c) {
  */
 template <typename A, typename C>
 void ifft1_many(A&& a, C&& c) {
-    for (std::size_t k = 0; k < etl::dim<0>(a); ++k) {
-        detail::ifft1_kernel(a(k).memory_start(), etl::dim<1>(a), c(k).memory_start());
-    }
+    using T = value_t<value_t<C>>;
+
+    std::size_t n     = etl::dim<1>(a);   //Size of the transform
+    std::size_t batch = etl::dim<0>(a);   //Number of batch
+
+    get_fft_plan<T>(n, fft_direction::INVERSE)->execute_many(a.memory_start(), c.memory_start(), batch);
 }
 
 /*!
@@ -845,30 +1555,43 @@ void ifft1_real(A&& a, C&& c) {
  *
  * The first dimension of a and c are considered batch dimensions
  */
-template <std::size_t N, typename A, typename C>
+template <std::size_t N, typename A, typename C, cpp_enable_if(is_complex_t<A>::value)>
 void fft1_many(const opaque_memory<A, N>& a, const opaque_memory<C, N>& c) {
-    std::size_t n        = a.template dim<N - 1>(); //Size of the transform
-    std::size_t batch    = a.size() / n;            //Number of batch
-    std::size_t distance = n;                       //Distance between samples
-
-    if (n <= 65536 && math::is_power_of_two(n)) {
-        //Copy a -> c (if not aliasing)
-        if (reinterpret_cast<const void*>(a.memory_start()) != reinterpret_cast<const void*>(c.memory_start())) {
-            direct_copy(a.memory_start(), a.memory_end(), c.memory_start());
-        }
+    using T = typename C::value_type;
 
-        auto* m = c.memory_start();
+    std::size_t n     = a.template dim<N - 1>(); //Size of the transform
+    std::size_t batch = a.size() / n;            //Number of batch
 
-        auto batch_fun_b = [&](const size_t first, const size_t last) {
-            for (std::size_t i = first; i < last; ++i) {
-                detail::inplace_radix2_fft1(reinterpret_cast<etl::complex<typename C::value_type>*>(m + i * distance), n);
-            }
-        };
+    get_fft_plan<T>(n)->execute_many(a.memory_start(), c.memory_start(), batch);
+}
 
-        dispatch_1d_any(select_parallel(batch, 8), batch_fun_b, 0, batch);
-    } else {
-        detail::fft_n_many(a.memory_start(), reinterpret_cast<etl::complex<typename C::value_type>*>(c.memory_start()), batch, n);
-    }
+/*!
+ * \brief Perform many 1D FFT on the real a and store the result in c
+ * \param a The input expression
+ * \param c The output expression
+ *
+ * The first dimension of a and c are considered batch dimensions
+ */
+template <std::size_t N, typename A, typename C, cpp_disable_if(is_complex_t<A>::value)>
+void fft1_many(const opaque_memory<A, N>& a, const opaque_memory<C, N>& c) {
+    using T = typename C::value_type;
+
+    std::size_t n     = a.template dim<N - 1>(); //Size of the transform
+    std::size_t batch = a.size() / n;            //Number of batch
+
+    auto plan = get_rfft_plan<T>(n);
+
+    const A* in = a.memory_start();
+    auto* out   = reinterpret_cast<etl::complex<T>*>(c.memory_start());
+
+    auto batch_fun_b = [&](const size_t first, const size_t last) {
+        for (std::size_t b = first; b < last; ++b) {
+            plan->execute(in + b * n, out + b * n);
+            detail::hermitian_mirror(out + b * n, n);
+        }
+    };
+
+    dispatch_1d_any(select_parallel(batch, 8), batch_fun_b, 0, batch);
 }
 
 /*!
@@ -964,6 +1687,76 @@ void ifft2_real(A&& a, C&& c) {
     c = real(w);
 }
 
+/*!
+ * \brief Perform the 1D FFT of the real a and store the n / 2 + 1 first
+ * coefficients of its spectrum in c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void rfft1(A&& a, C&& c) {
+    using T = value_t<A>;
+
+    get_rfft_plan<T>(etl::size(a))->execute(a.memory_start(), c.memory_start());
+}
+
+/*!
+ * \brief Perform the 1D Inverse FFT of the half spectrum a and store the
+ * real signal in c. The size of the transform is the size of c.
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void irfft1(A&& a, C&& c) {
+    using T = value_t<C>;
+
+    get_rfft_plan<T>(etl::size(c), fft_direction::INVERSE)->execute(a.memory_start(), c.memory_start());
+}
+
+/*!
+ * \brief Perform the 2D FFT of the real a and store the n2 / 2 + 1 first
+ * columns of its spectrum in c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void rfft2(A&& a, C&& c) {
+    using T = value_t<A>;
+
+    const std::size_t n1 = etl::dim<0>(a);
+    const std::size_t n2 = etl::dim<1>(a);
+    const std::size_t h2 = n2 / 2 + 1;
+
+    dyn_matrix<etl::complex<T>, 2> spectrum(h2, n1);
+    dyn_matrix<etl::complex<T>, 2> tmp(n1, h2);
+
+    detail::rfft2_t_kernel(a.memory_start(), n1, n2, spectrum.memory_start(), tmp.memory_start());
+
+    detail::transpose_complex(spectrum.memory_start(), h2, n1, reinterpret_cast<etl::complex<T>*>(c.memory_start()));
+}
+
+/*!
+ * \brief Perform the 2D Inverse FFT of the half spectrum a and store the
+ * real signal in c. The size of the transform is the size of c.
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void irfft2(A&& a, C&& c) {
+    using T = value_t<C>;
+
+    const std::size_t n1 = etl::dim<0>(c);
+    const std::size_t n2 = etl::dim<1>(c);
+    const std::size_t h2 = n2 / 2 + 1;
+
+    dyn_matrix<etl::complex<T>, 2> spectrum(h2, n1);
+    dyn_matrix<etl::complex<T>, 2> tmp(n1, h2);
+
+    detail::transpose_complex(reinterpret_cast<const etl::complex<T>*>(a.memory_start()), n1, h2, spectrum.memory_start());
+
+    detail::irfft2_t_kernel(spectrum.memory_start(), n1, n2, c.memory_start(), tmp.memory_start());
+}
+
 /*!
  * \copydoc fft2_many
  */
@@ -994,6 +1787,194 @@ void conv1_full_fft(A&& a, B&& b, C&& c) {
     detail::conv1_full_kernel(a.memory_start(), etl::size(a), b.memory_start(), etl::size(b), c.memory_start());
 }
 
+/*!
+ * \brief A streaming 1D full convolution with a fixed kernel, computed
+ * by FFT with the overlap-add method.
+ *
+ * The signal is cut in blocks of at most block_size() samples. The
+ * convolution of each block is computed with real transforms of
+ * transform_size() and the last n - 1 samples are added to the
+ * convolution of the next blocks. The memory used only depends on the
+ * size of the transforms, not on the length of the signal.
+ *
+ * The signal can be given in chunks of any size. Each chunk produces as
+ * many samples of the convolution as it contains, flush() produces the
+ * n - 1 remaining samples. The filter is stateful and must not be shared
+ * between threads.
+ *
+ * \tparam T The value type
+ */
+template <typename T>
+struct conv1_ola_filter {
+    using value_type   = T;               ///< The value type
+    using complex_type = etl::complex<T>; ///< The type of the spectrums
+
+    /*!
+     * \brief Construct a filter for the given kernel
+     * \param kernel The kernel
+     * \param n The size of the kernel
+     * \param block The maximum size of the blocks, 0 to choose it automatically
+     * \param length The length of the signal, 0 if unknown
+     */
+    conv1_ola_filter(const T* kernel, std::size_t n, std::size_t block = 0, std::size_t length = 0) : n(n) {
+        cpp_assert(n > 0, "The kernel of a filter cannot be empty");
+
+        if (block) {
+            s = 1;
+
+            while (s < block + n - 1) {
+                s *= 2;
+            }
+        } else {
+            s = detail::conv1_ola_transform_size(n, length);
+        }
+
+        forward = get_rfft_plan<T>(s);
+        inverse = get_rfft_plan<T>(s, fft_direction::INVERSE);
+
+        padded          = etl::allocate<T>(s);
+        spectrum        = etl::allocate<complex_type>(s / 2 + 1);
+        kernel_spectrum = etl::allocate<complex_type>(s / 2 + 1);
+        overlap         = etl::allocate<T>(n);
+
+        std::fill_n(padded.get(), s, T(0));
+        direct_copy_n(kernel, padded.get(), n);
+
+        forward->execute(padded.get(), kernel_spectrum.get());
+
+        reset();
+    }
+
+    /*!
+     * \brief Returns the size of the kernel
+     */
+    std::size_t kernel_size() const noexcept {
+        return n;
+    }
+
+    /*!
+     * \brief Returns the maximum number of samples processed by one transform
+     */
+    std::size_t block_size() const noexcept {
+        return s - n + 1;
+    }
+
+    /*!
+     * \brief Returns the size of the transforms
+     */
+    std::size_t transform_size() const noexcept {
+        return s;
+    }
+
+    /*!
+     * \brief Discard the state of the filter, to start a new signal
+     */
+    void reset() {
+        std::fill_n(overlap.get(), n, T(0));
+    }
+
+    /*!
+     * \brief Process the next m samples of the signal
+     * \param in The samples, may alias out
+     * \param m The number of samples
+     * \param out The next m samples of the convolution
+     */
+    void process(const T* in, std::size_t m, T* out) {
+        const std::size_t h = s / 2 + 1;
+
+        while (m) {
+            const std::size_t k = std::min(m, block_size());
+
+            direct_copy_n(in, padded.get(), k);
+            std::fill_n(padded.get() + k, s - k, T(0));
+
+            forward->execute(padded.get(), spectrum.get());
+            if (!(vectorize_impl && ETL_ISA_VEC_CALL(fft_multiply_kernel(spectrum.get(), kernel_spectrum.get(), spectrum.get(), h)))) {
+                impl::vec::fft_multiply<detail::fft_vec>(spectrum.get(), kernel_spectrum.get(), spectrum.get(), h);
+            }
+            inverse->execute(spectrum.get(), padded.get());
+
+            // Add the tail of the previous blocks
+
+            for (std::size_t i = 0; i < n - 1; ++i) {
+                padded[i] += overlap[i];
+            }
+
+            direct_copy_n(padded.get(), out, k);
+            direct_copy_n(padded.get() + k, overlap.get(), n - 1);
+
+            in += k;
+            out += k;
+            m -= k;
+        }
+    }
+
+    /*!
+     * \brief Produce the last n - 1 samples of the convolution and reset
+     * the filter
+     * \param out The last n - 1 samples of the convolution
+     */
+    void flush(T* out) {
+        direct_copy_n(overlap.get(), out, n - 1);
+        reset();
+    }
+
+    /*!
+     * \brief Process the next samples of the signal
+     * \param a The samples
+     * \param c The next samples of the convolution, of the size of a
+     */
+    template <typename A, typename C>
+    void process(A&& a, C&& c) {
+        static_assert(all_dma<A, C>::value, "Filters can only be executed on direct memory access expressions");
+
+        cpp_assert(etl::size(a) == etl::size(c), "Invalid output size for filter");
+
+        process(a.memory_start(), etl::size(a), c.memory_start());
+    }
+
+    /*!
+     * \brief Produce the last n - 1 samples of the convolution and reset
+     * the filter
+     * \param c The last n - 1 samples of the convolution
+     */
+    template <typename C, cpp_enable_if(is_etl_expr<C>::value)>
+    void flush(C&& c) {
+        static_assert(all_dma<C>::value, "Filters can only be executed on direct memory access expressions");
+
+        cpp_assert(etl::size(c) == n - 1, "Invalid output size for filter");
+
+        flush(c.memory_start());
+    }
+
+private:
+    std::size_t n;                                   ///< The size of the kernel
+    std::size_t s;                                   ///< The size of the transforms
+    std::shared_ptr<const rfft_plan<T>> forward;     ///< The forward transform
+    std::shared_ptr<const rfft_plan<T>> inverse;     ///< The inverse transform
+    std::unique_ptr<T[]> padded;                     ///< The padded block and its convolution
+    std::unique_ptr<complex_type[]> spectrum;        ///< The spectrum of the block
+    std::unique_ptr<complex_type[]> kernel_spectrum; ///< The spectrum of the kernel
+    std::unique_ptr<T[]> overlap;                    ///< The tail of the convolution of the previous blocks
+};
+
+/*!
+ * \brief Perform the 1D full convolution of a with b and store the result
+ * in c, by blocks with the overlap-add method
+ * \param a The input matrix
+ * \param b The kernel matrix
+ * \param c The output matrix
+ */
+template <typename A, typename B, typename C>
+void conv1_full_fft_ola(A&& a, B&& b, C&& c) {
+    const std::size_t m = etl::size(a);
+
+    conv1_ola_filter<value_t<A>> filter(b.memory_start(), etl::size(b), 0, m);
+
+    filter.process(a.memory_start(), m, c.memory_start());
+    filter.flush(c.memory_start() + m);
+}
+
 /*!
  * \brief Perform the 2D full convolution of a with b and store the result in c
  * \param a The input matrix
@@ -1025,98 +2006,187 @@ void conv2_full_fft_flipped(const opaque_memory<T, 2>& a, const opaque_memory<T,
 }
 
 /*!
- * \brief Perform the 2D full convolution of a with multiple kernels of b and store the result in c
+ * \brief The spectrums of a set of 2D kernels, prepared for FFT
+ * convolutions of a fixed size.
+ *
+ * Each 2D kernel is padded to the size of the full convolution and its
+ * half spectrum is computed once, in the transposed layout of
+ * rfft2_t_kernel. The convolutions with prepared kernels only transform
+ * their input. The kernels are [K, n1, n2] (D = 3) or [K, C, n1, n2]
+ * (D = 4) matrices.
+ *
+ * \tparam T The value type of the kernels
+ * \tparam D The number of dimensions of the kernels
+ */
+template <typename T, std::size_t D>
+struct prepared_kernels {
+    static_assert(D == 3 || D == 4, "Only 3D and 4D kernels can be prepared");
+
+    using value_type   = T;               ///< The value type of the kernels
+    using complex_type = etl::complex<T>; ///< The type of the spectrums
+
+    /*!
+     * \brief Prepare the given kernels
+     * \param kernels The memory of the kernels
+     * \param dims The dimensions of the kernels
+     * \param s1 The first dimension of the full convolution
+     * \param s2 The second dimension of the full convolution
+     */
+    prepared_kernels(const T* kernels, const std::array<std::size_t, D>& dims, std::size_t s1, std::size_t s2)
+            : dims(dims), s1(s1), s2(s2), spectrums(count(dims), detail::rfft_conv_size(s2) / 2 + 1, s1) {
+        const std::size_t n1 = dims[D - 2];
+        const std::size_t n2 = dims[D - 1];
+
+        cpp_assert(s1 >= n1 && s2 >= n2, "The convolution must be larger than the kernels");
+
+        const std::size_t t2 = detail::rfft_conv_size(s2);
+        const std::size_t h2 = t2 / 2 + 1;
+
+        auto batch_fun_k = [&](const size_t first, const size_t last) {
+            if (last - first) {
+                SERIAL_SECTION {
+                    dyn_matrix<T, 2> padded(s1, t2);
+                    dyn_matrix<complex_type, 2> tmp(s1, h2);
+
+                    for (std::size_t k = first; k < last; ++k) {
+                        detail::rfft2_padded_kernel(kernels + k * n1 * n2, n1, n2, s1, t2, padded.memory_start(), spectrums(k).memory_start(), tmp.memory_start());
+                    }
+                }
+            }
+        };
+
+        const std::size_t K = count(dims);
+
+        if (etl::is_parallel) {
+            dispatch_1d_threads(select_parallel(K, 2), batch_fun_k, 0, K);
+        } else {
+            batch_fun_k(0, K);
+        }
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the kernels
+     */
+    std::size_t dim(std::size_t d) const noexcept {
+        return dims[d];
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the full convolution the
+     * kernels are prepared for
+     */
+    std::size_t conv_dim(std::size_t d) const noexcept {
+        return d == 0 ? s1 : s2;
+    }
+
+    /*!
+     * \brief Returns the transposed half spectrum of the kth 2D kernel,
+     * in the order of the kernels in memory
+     */
+    decltype(auto) spectrum(std::size_t k) const {
+        return spectrums(k);
+    }
+
+private:
+    /*!
+     * \brief Returns the number of 2D kernels
+     */
+    static std::size_t count(const std::array<std::size_t, D>& dims) {
+        return D == 3 ? dims[0] : dims[0] * dims[1];
+    }
+
+    std::array<std::size_t, D> dims;         ///< The dimensions of the kernels
+    std::size_t s1;                          ///< The first dimension of the full convolution
+    std::size_t s2;                          ///< The second dimension of the full convolution
+    dyn_matrix<complex_type, 3> spectrums;   ///< The spectrums of the kernels
+};
+
+/*!
+ * \brief Perform the 2D full convolution of a with multiple prepared kernels and store the result in c
  * \param input The input matrix
- * \param kernel The kernel matrix
+ * \param kernels The prepared kernels
  * \param conv The output matrix
  */
 template <typename T>
-void conv2_full_multi_fft(const opaque_memory<T, 2>& input, const opaque_memory<T, 3>& kernel, const opaque_memory<T, 3>& conv) {
-    const auto K = kernel.dim(0);
+void conv2_full_multi_fft(const opaque_memory<T, 2>& input, const prepared_kernels<T, 3>& kernels, const opaque_memory<T, 3>& conv) {
+    const auto K = kernels.dim(0);
 
     if(K){
-        const auto k_s = kernel.dim(1) * kernel.dim(2);
         const auto c_s = conv.dim(1) * conv.dim(2);
 
         const auto m1 = input.dim(0);
         const auto m2 = input.dim(1);
 
-        const auto n1 = kernel.dim(1);
-        const auto n2 = kernel.dim(2);
+        const auto s1 = kernels.conv_dim(0);
+        const auto s2 = kernels.conv_dim(1);
+        const auto t2 = detail::rfft_conv_size(s2);
+        const auto h2 = t2 / 2 + 1;
 
-        const auto s1  = m1 + n1 - 1;
-        const auto s2  = m2 + n2 - 1;
-        const auto n   = s1 * s2;
+        cpp_assert(s1 == m1 + kernels.dim(1) - 1 && s2 == m2 + kernels.dim(2) - 1, "Invalid input size for the prepared kernels");
 
-        dyn_matrix<etl::complex<T>, 2> a_padded(s1, s2);
+        // a = rfft2(a)
 
-        for (std::size_t i = 0; i < m1; ++i) {
-            direct_copy_n(input.memory_start() + i * m2, a_padded.memory_start() + i * s2, m2);
-        }
+        dyn_matrix<etl::complex<T>, 2> a_spectrum(h2, s1);
 
-        // a = fft2(a)
-        detail::fft_n_many(a_padded.memory_start(), a_padded.memory_start(), s1, s2);
-        a_padded.transpose_inplace();
-        detail::fft_n_many(a_padded.memory_start(), a_padded.memory_start(), s2, s1);
-        a_padded.transpose_inplace();
+        {
+            dyn_matrix<T, 2> a_padded(s1, t2);
+            dyn_matrix<etl::complex<T>, 2> tmp(s1, h2);
 
-        auto batch_fun_k = [&](const size_t first, const size_t last) {
-            SERIAL_SECTION {
-                for (std::size_t k = first; k < last; ++k) {
-                    const T* b = kernel.memory_start() + k * k_s;
-                    T* c       = conv.memory_start() + k * c_s;
-
-                    // 0. Pad a and b to the size of c
-
-                    dyn_matrix<etl::complex<T>, 2> b_padded(s1, s2);
-
-                    for (std::size_t i = 0; i < n1; ++i) {
-                        direct_copy_n(b + i * n2, b_padded.memory_start() + i * s2, n2);
-                    }
-
-                    // 1. FFT of a and b
-
-                    // b = fft2(b)
-                    detail::fft_n_many(b_padded.memory_start(), b_padded.memory_start(), s1, s2);
-                    b_padded.transpose_inplace();
-                    detail::fft_n_many(b_padded.memory_start(), b_padded.memory_start(), s2, s1);
-                    b_padded.transpose_inplace();
+            detail::rfft2_padded_kernel(input.memory_start(), m1, m2, s1, t2, a_padded.memory_start(), a_spectrum.memory_start(), tmp.memory_start());
+        }
 
-                    // 2. Elementwise multiplication of and b
+        auto batch_fun_k = [&](const size_t first, const size_t last) {
+            if (last - first) {
+                SERIAL_SECTION {
+                    dyn_matrix<T, 2> c_padded(s1, t2);
+                    dyn_matrix<etl::complex<T>, 2> c_spectrum(h2, s1);
+                    dyn_matrix<etl::complex<T>, 2> tmp(s1, h2);
 
-                    b_padded >>= a_padded;
+                    for (std::size_t k = first; k < last; ++k) {
+                        T* c = conv.memory_start() + k * c_s;
 
-                    // 3. Inverse FFT of a
+                        // 1. Elementwise multiplication of a and b
 
-                    // a = conj(a)
-                    b_padded = conj(b_padded);
+                        c_spectrum = a_spectrum >> kernels.spectrum(k);
 
-                    // a = fft2(a)
-                    detail::fft_n_many(b_padded.memory_start(), b_padded.memory_start(), s1, s2);
-                    b_padded.transpose_inplace();
-                    detail::fft_n_many(b_padded.memory_start(), b_padded.memory_start(), s2, s1);
-                    b_padded.transpose_inplace();
+                        // 2. Inverse FFT of c, already normalized and real
 
-                    // 4. Keep only the real part of the inverse FFT
+                        detail::irfft2_t_kernel(c_spectrum.memory_start(), s1, t2, c_padded.memory_start(), tmp.memory_start());
 
-                    // c = real(conj(a) / n)
-                    // Note: Since the conjugate does not change the real part, it is not necessary
+                        // 3. Remove the padding of the transform
 
-                    for (std::size_t i = 0; i < etl::size(b_padded); ++i){
-                        c[i] = b_padded[i].real / T(n);
+                        for (std::size_t i = 0; i < s1; ++i) {
+                            direct_copy_n(c_padded.memory_start() + i * t2, c + i * s2, s2);
+                        }
                     }
                 }
             }
         };
 
         if (etl::is_parallel) {
-            dispatch_1d_any(select_parallel(K, 2), batch_fun_k, 0, K);
+            dispatch_1d_threads(select_parallel(K, 2), batch_fun_k, 0, K);
         } else {
             batch_fun_k(0, K);
         }
     }
 }
 
+/*!
+ * \brief Perform the 2D full convolution of a with multiple kernels of b and store the result in c
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename T>
+void conv2_full_multi_fft(const opaque_memory<T, 2>& input, const opaque_memory<T, 3>& kernel, const opaque_memory<T, 3>& conv) {
+    const std::size_t s1 = input.dim(0) + kernel.dim(1) - 1;
+    const std::size_t s2 = input.dim(1) + kernel.dim(2) - 1;
+
+    const prepared_kernels<T, 3> prepared(kernel.memory_start(), {{kernel.dim(0), kernel.dim(1), kernel.dim(2)}}, s1, s2);
+
+    conv2_full_multi_fft(input, prepared, conv);
+}
+
 /*!
  * \brief Perform the 2D full convolution of a with multiple kernels of b and store the result in c
  * \param input The input matrix
@@ -1135,101 +2205,74 @@ void conv2_full_multi_flipped_fft(const opaque_memory<T, 2>& input, const opaque
 }
 
 /*!
- * \brief Perform the 4D full convolution of a with b and store the result in c
+ * \brief Perform the 4D full convolution of a with the prepared kernels and store the result in c
  * \param input The input matrix
- * \param kernel The kernel matrix
+ * \param kernels The prepared kernels
  * \param conv The output matrix
  */
 template <typename T>
-void conv4_full_fft(const opaque_memory<T, 4>& input, const opaque_memory<T, 4>& kernel, const opaque_memory<T, 4>& conv) {
-    if (kernel.dim(1) > 0) {
+void conv4_full_fft(const opaque_memory<T, 4>& input, const prepared_kernels<T, 4>& kernels, const opaque_memory<T, 4>& conv) {
+    if (kernels.dim(1) > 0) {
         auto conv_i_inc = conv.dim(1) * conv.dim(2) * conv.dim(3);
         auto conv_c_inc = conv.dim(2) * conv.dim(3);
 
-        auto kernel_k_inc = kernel.dim(1) * kernel.dim(2) * kernel.dim(3);
-        auto kernel_c_inc = kernel.dim(2) * kernel.dim(3);
-
         auto input_i_inc = input.dim(1) * input.dim(2) * input.dim(3);
         auto input_k_inc = input.dim(2) * input.dim(3);
 
-        std::size_t m1 = input.dim(2);
-        std::size_t m2 = input.dim(3);
+        const std::size_t N = input.dim(0);
+        const std::size_t K = kernels.dim(0);
+        const std::size_t C = kernels.dim(1);
 
-        std::size_t n1 = kernel.dim(2);
-        std::size_t n2 = kernel.dim(3);
+        const std::size_t m1 = input.dim(2);
+        const std::size_t m2 = input.dim(3);
 
-        const std::size_t s1 = m1 + n1 - 1;
-        const std::size_t s2 = m2 + n2 - 1;
-        const std::size_t n  = s1 * s2;
+        const std::size_t s1 = kernels.conv_dim(0);
+        const std::size_t s2 = kernels.conv_dim(1);
+        const std::size_t t2 = detail::rfft_conv_size(s2);
+        const std::size_t h2 = t2 / 2 + 1;
 
-        const std::size_t N = input.dim(0);
+        cpp_assert(s1 == m1 + kernels.dim(2) - 1 && s2 == m2 + kernels.dim(3) - 1, "Invalid input size for the prepared kernels");
 
-        std::fill(conv.memory_start(), conv.memory_end(), 0);
+        // For each image, the products with the kernels are accumulated
+        // over k in the frequency domain, with one inverse FFT per output
 
         auto batch_fun_n = [&](const size_t first, const size_t last) {
             if (last - first) {
                 SERIAL_SECTION {
-                    for (std::size_t i = first; i < last; ++i) {
-                        for (std::size_t k = 0; k < kernel.dim(0); ++k) {
-                            const T* a = input.memory_start() + i * input_i_inc + k * input_k_inc; //input(i)(k)
-
-                            dyn_matrix<etl::complex<T>, 2> a_padded(s1, s2);
-                            dyn_matrix<etl::complex<T>, 2> b_padded(s1, s2);
-                            dyn_matrix<etl::complex<T>, 2> tmp(s1, s2);
-
-                            a_padded = 0;
-
-                            for (std::size_t i = 0; i < m1; ++i) {
-                                direct_copy_n(a + i * m2, a_padded.memory_start() + i * s2, m2);
-                            }
-
-                            // a = fft2(a)
-                            detail::fft_n_many(a_padded.memory_start(), a_padded.memory_start(), s1, s2);
-                            a_padded.transpose_inplace();
-                            detail::fft_n_many(a_padded.memory_start(), a_padded.memory_start(), s2, s1);
-                            a_padded.transpose_inplace();
-
-                            for (std::size_t c = 0; c < kernel.dim(1); ++c) {
-                                const T* b = kernel.memory_start() + k * kernel_k_inc + c * kernel_c_inc; //kernel(k)(c)
-                                T* cc      = conv.memory_start() + i * conv_i_inc + c * conv_c_inc;       //conv(i)(c)
+                    dyn_matrix<T, 2> padded(s1, t2);
+                    dyn_matrix<etl::complex<T>, 3> a_spectrums(K, h2, s1);
+                    dyn_matrix<etl::complex<T>, 2> acc(h2, s1);
+                    dyn_matrix<etl::complex<T>, 2> tmp(s1, h2);
 
-                                // 0. Pad a and b to the size of cc
+                    const std::size_t n = h2 * s1;
 
-                                b_padded = 0;
-                                for (std::size_t i = 0; i < n1; ++i) {
-                                    direct_copy_n(b + i * n2, b_padded.memory_start() + i * s2, n2);
-                                }
+                    for (std::size_t i = first; i < last; ++i) {
+                        for (std::size_t k = 0; k < K; ++k) {
+                            const T* a = input.memory_start() + i * input_i_inc + k * input_k_inc; //input(i)(k)
 
-                                // 1. FFT of a and b
+                            detail::rfft2_padded_kernel(a, m1, m2, s1, t2, padded.memory_start(), a_spectrums(k).memory_start(), tmp.memory_start());
+                        }
 
-                                // b = fft2(b)
-                                detail::fft_n_many(b_padded.memory_start(), b_padded.memory_start(), s1, s2);
-                                b_padded.transpose_inplace();
-                                detail::fft_n_many(b_padded.memory_start(), b_padded.memory_start(), s2, s1);
-                                b_padded.transpose_inplace();
+                        for (std::size_t c = 0; c < C; ++c) {
+                            T* cc = conv.memory_start() + i * conv_i_inc + c * conv_c_inc; //conv(i)(c)
 
-                                // 2. Elementwise multiplication of and b
+                            auto* acc_m = acc.memory_start();
 
-                                tmp = a_padded >> b_padded;
+                            std::fill_n(acc_m, n, etl::complex<T>(0, 0));
 
-                                // 3. Inverse FFT of a
+                            for (std::size_t k = 0; k < K; ++k) {
+                                const auto* a_m = a_spectrums(k).memory_start();
+                                const auto* b_m = kernels.spectrum(k * C + c).memory_start();
 
-                                // a = conj(a)
-                                for (std::size_t i = 0; i < n; ++i) {
-                                    tmp[i] = etl::conj(tmp[i]);
+                                for (std::size_t j = 0; j < n; ++j) {
+                                    acc_m[j] += a_m[j] * b_m[j];
                                 }
+                            }
 
-                                // a = fft2(a)
-                                detail::fft_n_many(tmp.memory_start(), tmp.memory_start(), s1, s2);
-                                tmp.transpose_inplace();
-                                detail::fft_n_many(tmp.memory_start(), tmp.memory_start(), s2, s1);
-                                tmp.transpose_inplace();
-
-                                // 4. Keep only the real part of the inverse FFT
+                            detail::irfft2_t_kernel(acc_m, s1, t2, padded.memory_start(), tmp.memory_start());
 
-                                for (std::size_t i = 0; i < n; ++i) {
-                                    cc[i] += tmp[i].real / T(n);
-                                }
+                            for (std::size_t r = 0; r < s1; ++r) {
+                                direct_copy_n(padded.memory_start() + r * t2, cc + r * s2, s2);
                             }
                         }
                     }
@@ -1238,13 +2281,33 @@ void conv4_full_fft(const opaque_memory<T, 4>& input, const opaque_memory<T, 4>&
         };
 
         if (etl::is_parallel) {
-            dispatch_1d_any(select_parallel(N, 2), batch_fun_n, 0, N);
+            dispatch_1d_threads(select_parallel(N, 2), batch_fun_n, 0, N);
         } else {
             batch_fun_n(0, N);
         }
     }
 }
 
+/*!
+ * \brief Perform the 4D full convolution of a with b and store the result in c
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename T>
+void conv4_full_fft(const opaque_memory<T, 4>& input, const opaque_memory<T, 4>& kernel, const opaque_memory<T, 4>& conv) {
+    if (kernel.dim(1) > 0) {
+        const std::size_t s1 = input.dim(2) + kernel.dim(2) - 1;
+        const std::size_t s2 = input.dim(3) + kernel.dim(3) - 1;
+
+        // The spectrums of the kernels are shared by all the images
+
+        const prepared_kernels<T, 4> prepared(kernel.memory_start(), {{kernel.dim(0), kernel.dim(1), kernel.dim(2), kernel.dim(3)}}, s1, s2);
+
+        conv4_full_fft(input, prepared, conv);
+    }
+}
+
 /*!
  * \brief Perform the 4D full convolution of a with b and store the result in c
  * \param input The input matrix
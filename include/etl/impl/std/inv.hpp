@@ -9,12 +9,6 @@
 
 namespace etl {
 
-/*
- * \copydoc etl::lu
- */
-template <typename AT, typename LT, typename UT, typename PT>
-bool lu(const AT& A, LT& L, UT& U, PT& P);
-
 namespace impl {
 
 namespace standard {
@@ -90,13 +84,25 @@ void inv(A&& a, C&& c) {
         return;
     }
 
-    auto L = force_temporary_dim_only(a);
-    auto U = force_temporary_dim_only(a);
-    auto P = force_temporary_dim_only(a);
+    // Solve A X = I with the LU decomposition of A
+
+    etl::dyn_matrix<value_t<A>> lu(n, n);
+    etl::dyn_matrix<value_t<A>> x(n, n);
+    std::vector<std::size_t> perm;
+
+    lu = a;
+
+    etl::detail::lu_factor_impl::apply(lu, perm);
+
+    x = 0;
+
+    for (std::size_t i = 0; i < n; ++i) {
+        x(i, i) = 1;
+    }
 
-    etl::lu(a, L, U, P);
+    etl::detail::lu_solve_impl::apply(lu, perm, x);
 
-    c = inv(U) * inv(L) * P;
+    c = x;
 }
 
 } //end of namespace standard
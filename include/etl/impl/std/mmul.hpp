@@ -13,15 +13,26 @@ namespace impl {
 
 namespace standard {
 
+/*!
+ * \brief Traits indicating if the multiplication of A and B into C can
+ * use a sparse kernel: one of the operands is a compressed sparse matrix
+ * and the others are row-major with direct memory access.
+ */
+template <typename A, typename B, typename C>
+using is_sparse_mul = cpp::or_u<
+    is_compressed_sparse_matrix<A>::value && all_dma<B, C>::value && all_row_major<B, C>::value,
+    is_compressed_sparse_matrix<B>::value && all_dma<A, C>::value && all_row_major<A, C>::value>;
+
 /*!
  * \brief Standard implementation of a matrix-matrix multiplication
  * \param a The left input matrix
  * \param b The right input matrix
  * \param c The output matrix
  */
-template <typename A, typename B, typename C>
+template <typename A, typename B, typename C, cpp_disable_if(is_sparse_mul<A, B, C>::value)>
 static void mm_mul(A&& a, B&& b, C&& c) {
-    static constexpr bool row_major = decay_traits<A>::storage_order == order::RowMajor;
+    // The loops follow the storage order of the result
+    static constexpr bool row_major = decay_traits<C>::storage_order == order::RowMajor;
 
     c = 0;
 
@@ -78,7 +89,7 @@ inline void add_mul(std::complex<T>& c, std::complex<T> a, std::complex<T> b) {
  * \param b The right input matrix
  * \param c The output matrix
  */
-template <typename A, typename B, typename C>
+template <typename A, typename B, typename C, cpp_disable_if(is_sparse_mul<A, B, C>::value)>
 static void vm_mul(A&& a, B&& b, C&& c) {
     static constexpr bool row_major = decay_traits<B>::storage_order == order::RowMajor;
 
@@ -107,7 +118,7 @@ static void vm_mul(A&& a, B&& b, C&& c) {
  * \param b The right vector matrix
  * \param c The output matrix
  */
-template <typename A, typename B, typename C>
+template <typename A, typename B, typename C, cpp_disable_if(is_sparse_mul<A, B, C>::value)>
 static void mv_mul(A&& a, B&& b, C&& c) {
     static constexpr bool row_major = decay_traits<A>::storage_order == order::RowMajor;
 
@@ -0,0 +1,51 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the column reductions
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief Compute the sums of the columns [first, last) of a.
+ *
+ * The rows are streamed one after another and added into the output.
+ *
+ * \param a The input expression, seen as a matrix of rows
+ * \param c The output expression, with one element per column
+ * \param first The first column
+ * \param last The last column (exclusive)
+ */
+template <typename A, typename C>
+void sum_l(const A& a, C&& c, std::size_t first, std::size_t last) {
+    using T = value_t<A>;
+
+    const std::size_t m = etl::dim<0>(a);
+    const std::size_t n = etl::size(a) / m;
+
+    for (std::size_t j = first; j < last; ++j) {
+        c[j] = T(0);
+    }
+
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = first; j < last; ++j) {
+            c[j] += a.read_flat(i * n + j);
+        }
+    }
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
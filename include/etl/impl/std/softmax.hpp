@@ -0,0 +1,131 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the softmax functions
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief Compute the softmax of the elements [first, last) of a
+ * \param a The input expression
+ * \param c The output expression
+ * \param first The first element
+ * \param last The last element (exclusive)
+ */
+template <typename A, typename C>
+void softmax(const A& a, C&& c, std::size_t first, std::size_t last) {
+    using T = value_t<A>;
+
+    T sum(0);
+
+    for (std::size_t i = first; i < last; ++i) {
+        c[i] = common::softmax_exp(a[i]);
+        sum += c[i];
+    }
+
+    const T scale = T(1) / sum;
+
+    for (std::size_t i = first; i < last; ++i) {
+        c[i] *= scale;
+    }
+}
+
+/*!
+ * \brief Compute the stable softmax of the elements [first, last) of a
+ *
+ * If Diag is true, the diagonal of the Jacobian, s * (1 - s) for each
+ * softmax value s, is stored instead.
+ *
+ * \param a The input expression
+ * \param c The output expression
+ * \param first The first element
+ * \param last The last element (exclusive)
+ */
+template <bool Diag = false, typename A, typename C>
+void stable_softmax(const A& a, C&& c, std::size_t first, std::size_t last) {
+    using T = value_t<A>;
+
+    T max = a[first];
+
+    for (std::size_t i = first + 1; i < last; ++i) {
+        max = std::max(max, a[i]);
+    }
+
+    T sum(0);
+
+    for (std::size_t i = first; i < last; ++i) {
+        c[i] = common::softmax_exp(a[i] - max);
+        sum += c[i];
+    }
+
+    const T scale = T(1) / sum;
+
+    for (std::size_t i = first; i < last; ++i) {
+        if (Diag) {
+            const T s = c[i] * scale;
+            c[i]      = s * (T(1) - s);
+        } else {
+            c[i] *= scale;
+        }
+    }
+}
+
+/*!
+ * \brief Compute the diagonal of the Jacobian of the stable softmax of
+ * the elements [first, last) of a
+ * \param a The input expression
+ * \param c The output expression
+ * \param first The first element
+ * \param last The last element (exclusive)
+ */
+template <typename A, typename C>
+void softmax_jacobian_diag(const A& a, C&& c, std::size_t first, std::size_t last) {
+    stable_softmax<true>(a, c, first, last);
+}
+
+/*!
+ * \brief Compute the logarithm of the softmax of the elements [first, last) of a
+ * \param a The input expression
+ * \param c The output expression
+ * \param first The first element
+ * \param last The last element (exclusive)
+ */
+template <typename A, typename C>
+void log_softmax(const A& a, C&& c, std::size_t first, std::size_t last) {
+    using T = value_t<A>;
+
+    T max = a[first];
+
+    for (std::size_t i = first + 1; i < last; ++i) {
+        max = std::max(max, a[i]);
+    }
+
+    T sum(0);
+
+    for (std::size_t i = first; i < last; ++i) {
+        sum += common::softmax_exp(a[i] - max);
+    }
+
+    const T shift = max + std::log(sum);
+
+    for (std::size_t i = first; i < last; ++i) {
+        c[i] = a[i] - shift;
+    }
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
@@ -0,0 +1,410 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Kernels for the multiplication of compressed sparse matrices
+ * (CSR or CSC) with dense matrices and vectors.
+ *
+ * The kernels that gather their results (CSR * dense, dense * CSC)
+ * are parallel over the rows (columns) of the result and compute the
+ * sparse dot products by packed blocks of gathered elements. The
+ * kernels that scatter their results are parallel over the columns of
+ * the result when there are several, otherwise each thread scatters a
+ * block of the sparse matrix into its own accumulator and the
+ * accumulators are summed at the end.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+namespace detail {
+
+/*!
+ * \brief Traits indicating if the sparse kernels can be vectorized for the given type
+ */
+template <typename T>
+using sparse_vectorizable = cpp::bool_constant<vec_enabled && vectorize_impl && intrinsic_traits<T>::vectorizable && !is_complex_t<T>::value>;
+
+/*!
+ * \brief Compute y += alpha * x, vectorized
+ * \param n The number of elements
+ * \param alpha The scalar multiplier
+ * \param x The input vector
+ * \param y The output vector
+ */
+template <typename T, cpp_enable_if(sparse_vectorizable<T>::value)>
+void axpy(std::size_t n, T alpha, const T* x, T* y) {
+    using vec_type = typename get_vector_impl<vector_mode>::type;
+
+    static constexpr std::size_t vec_size = vec_type::template traits<T>::size;
+
+    auto a1 = vec_type::set(alpha);
+
+    std::size_t i = 0;
+
+    for (; i + 2 * vec_size - 1 < n; i += 2 * vec_size) {
+        auto y1 = vec_type::loadu(y + i);
+        auto y2 = vec_type::loadu(y + i + vec_size);
+
+        y1 = vec_type::template fmadd<false>(a1, vec_type::loadu(x + i), y1);
+        y2 = vec_type::template fmadd<false>(a1, vec_type::loadu(x + i + vec_size), y2);
+
+        vec_type::storeu(y + i, y1);
+        vec_type::storeu(y + i + vec_size, y2);
+    }
+
+    for (; i + vec_size - 1 < n; i += vec_size) {
+        vec_type::storeu(y + i, vec_type::template fmadd<false>(a1, vec_type::loadu(x + i), vec_type::loadu(y + i)));
+    }
+
+    for (; i < n; ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+/*!
+ * \copydoc axpy
+ */
+template <typename T, cpp_disable_if(sparse_vectorizable<T>::value)>
+void axpy(std::size_t n, T alpha, const T* x, T* y) {
+    for (std::size_t i = 0; i < n; ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+/*!
+ * \brief Compute the dot product of the sparse vector [first, last)
+ * of a compressed matrix and the dense vector x.
+ *
+ * The elements of x are gathered into a small buffer so that the
+ * products can be computed by packed blocks.
+ *
+ * \param values The non-zero values of the compressed matrix
+ * \param inner The inner indices of the compressed matrix
+ * \param first The first non-zero of the sparse vector
+ * \param last The end of the non-zeros of the sparse vector
+ * \param x The dense vector
+ * \return The dot product
+ */
+template <typename T, typename Index, cpp_enable_if(sparse_vectorizable<T>::value)>
+T sparse_dot(const T* values, const Index* inner, std::size_t first, std::size_t last, const T* x) {
+    using vec_type = typename get_vector_impl<vector_mode>::type;
+
+    static constexpr std::size_t vec_size = vec_type::template traits<T>::size;
+
+    T g1[vec_size];
+    T g2[vec_size];
+
+    auto r1 = vec_type::template zero<T>();
+    auto r2 = vec_type::template zero<T>();
+
+    std::size_t n = first;
+
+    for (; n + 2 * vec_size - 1 < last; n += 2 * vec_size) {
+        for (std::size_t l = 0; l < vec_size; ++l) {
+            g1[l] = x[inner[n + l]];
+            g2[l] = x[inner[n + vec_size + l]];
+        }
+
+        r1 = vec_type::template fmadd<false>(vec_type::loadu(values + n), vec_type::loadu(g1), r1);
+        r2 = vec_type::template fmadd<false>(vec_type::loadu(values + n + vec_size), vec_type::loadu(g2), r2);
+    }
+
+    for (; n + vec_size - 1 < last; n += vec_size) {
+        for (std::size_t l = 0; l < vec_size; ++l) {
+            g1[l] = x[inner[n + l]];
+        }
+
+        r1 = vec_type::template fmadd<false>(vec_type::loadu(values + n), vec_type::loadu(g1), r1);
+    }
+
+    T v = vec_type::template hadd<T>(vec_type::add(r1, r2));
+
+    for (; n < last; ++n) {
+        v += values[n] * x[inner[n]];
+    }
+
+    return v;
+}
+
+/*!
+ * \copydoc sparse_dot
+ */
+template <typename T, typename Index, cpp_disable_if(sparse_vectorizable<T>::value)>
+T sparse_dot(const T* values, const Index* inner, std::size_t first, std::size_t last, const T* x) {
+    T v(0);
+
+    for (std::size_t n = first; n < last; ++n) {
+        v += values[n] * x[inner[n]];
+    }
+
+    return v;
+}
+
+/*!
+ * \brief Compute y = A * x by scattering the K sparse vectors of the
+ * compressed matrix A into the M elements of y.
+ *
+ * In parallel, each thread scatters a block of the sparse vectors into
+ * its own accumulator and the accumulators are then summed into y.
+ *
+ * \param values The non-zero values of the compressed matrix
+ * \param inner The inner indices of the compressed matrix
+ * \param outer The outer indices of the compressed matrix
+ * \param K The number of sparse vectors
+ * \param x The dense vector, of K elements
+ * \param y The output vector, of M elements
+ * \param M The number of elements of the output
+ * \param p Indicates if the scatter must be done in parallel
+ */
+template <typename T, typename Index>
+void sparse_scatter(const T* values, const Index* inner, const Index* outer, std::size_t K, const T* x, T* y, std::size_t M, bool p) {
+    auto scatter = [&](T* acc, std::size_t first, std::size_t last) {
+        for (std::size_t k = first; k < last; ++k) {
+            const T xk = x[k];
+
+            if (xk != T(0)) {
+                for (std::size_t n = outer[k]; n < outer[k + 1]; ++n) {
+                    acc[inner[n]] += values[n] * xk;
+                }
+            }
+        }
+    };
+
+    if (p && K > 1) {
+        const std::size_t grain  = parallel_thread_grain(K);
+        const std::size_t chunks = (K + grain - 1) / grain;
+
+        dyn_matrix<T, 2> partial(chunks, M);
+
+        dispatch_1d_threads(true, [&](std::size_t first, std::size_t last) {
+            T* acc = partial.memory_start() + (first / grain) * M;
+
+            std::fill_n(acc, M, T(0));
+
+            scatter(acc, first, last);
+        }, 0, K);
+
+        dispatch_1d_any(M > 1, [&](std::size_t first, std::size_t last) {
+            std::copy(partial.memory_start() + first, partial.memory_start() + last, y + first);
+
+            for (std::size_t c = 1; c < chunks; ++c) {
+                axpy(last - first, T(1), partial.memory_start() + c * M + first, y + first);
+            }
+        }, 0, M);
+    } else {
+        std::fill_n(y, M, T(0));
+
+        scatter(y, 0, K);
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Sparse implementation of a matrix-matrix multiplication
+ * with a compressed sparse left matrix and a dense right matrix
+ * \param a The left sparse matrix
+ * \param b The right input matrix
+ * \param c The output matrix
+ */
+template <typename A, typename B, typename C, cpp_enable_if(is_compressed_sparse_matrix<A>::value && is_sparse_mul<A, B, C>::value)>
+void mm_mul(A&& a, B&& b, C&& c) {
+    using T = value_t<C>;
+
+    const std::size_t M = etl::dim<0>(a);
+    const std::size_t K = etl::dim<1>(a);
+    const std::size_t N = etl::dim<1>(b);
+
+    const auto* values = a.values();
+    const auto* inner  = a.inner_index();
+    const auto* outer  = a.outer_index();
+
+    const T* bb = b.memory_start();
+    T* cc       = c.memory_start();
+
+    const bool p = select_parallel(a.non_zeros() * N, sparse_mul_parallel_threshold);
+
+    if (std::decay_t<A>::storage_format == sparse_storage::CSR) {
+        // Each row of C is a combination of the rows of B
+        auto batch_fun_i = [&](const size_t first, const size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                T* ci = cc + i * N;
+
+                std::fill_n(ci, N, T(0));
+
+                for (std::size_t n = outer[i]; n < outer[i + 1]; ++n) {
+                    detail::axpy(N, T(values[n]), bb + inner[n] * N, ci);
+                }
+            }
+        };
+
+        dispatch_1d_any(p && M > 1, batch_fun_i, 0, M);
+    } else {
+        // Each column k of A scatters the row k of B into C, the
+        // columns of C are split between the threads
+        auto batch_fun_j = [&](const size_t first, const size_t last) {
+            for (std::size_t i = 0; i < M; ++i) {
+                std::fill(cc + i * N + first, cc + i * N + last, T(0));
+            }
+
+            for (std::size_t k = 0; k < K; ++k) {
+                for (std::size_t n = outer[k]; n < outer[k + 1]; ++n) {
+                    detail::axpy(last - first, T(values[n]), bb + k * N + first, cc + inner[n] * N + first);
+                }
+            }
+        };
+
+        dispatch_1d_any(p && N > 1, batch_fun_j, 0, N);
+    }
+}
+
+/*!
+ * \brief Sparse implementation of a matrix-matrix multiplication
+ * with a dense left matrix and a compressed sparse right matrix
+ * \param a The left input matrix
+ * \param b The right sparse matrix
+ * \param c The output matrix
+ */
+template <typename A, typename B, typename C, cpp_enable_if(is_compressed_sparse_matrix<B>::value && is_sparse_mul<A, B, C>::value)>
+void mm_mul(A&& a, B&& b, C&& c) {
+    using T = value_t<C>;
+
+    const std::size_t M = etl::dim<0>(a);
+    const std::size_t K = etl::dim<1>(a);
+    const std::size_t N = etl::dim<1>(b);
+
+    const auto* values = b.values();
+    const auto* inner  = b.inner_index();
+    const auto* outer  = b.outer_index();
+
+    const T* aa = a.memory_start();
+    T* cc       = c.memory_start();
+
+    const bool p = select_parallel(b.non_zeros() * M, sparse_mul_parallel_threshold);
+
+    if (std::decay_t<B>::storage_format == sparse_storage::CSR) {
+        // Each row of C is a combination of the rows of B
+        auto batch_fun_i = [&](const size_t first, const size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                const T* ai = aa + i * K;
+                T* ci       = cc + i * N;
+
+                std::fill_n(ci, N, T(0));
+
+                for (std::size_t k = 0; k < K; ++k) {
+                    const T aik = ai[k];
+
+                    if (aik != T(0)) {
+                        for (std::size_t n = outer[k]; n < outer[k + 1]; ++n) {
+                            ci[inner[n]] += aik * values[n];
+                        }
+                    }
+                }
+            }
+        };
+
+        dispatch_1d_any(p, batch_fun_i, 0, M);
+    } else {
+        // Each element of C is the sparse dot product of a row of A and a column of B
+        auto batch_fun_i = [&](const size_t first, const size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                const T* ai = aa + i * K;
+
+                for (std::size_t j = 0; j < N; ++j) {
+                    cc[i * N + j] = detail::sparse_dot(values, inner, outer[j], outer[j + 1], ai);
+                }
+            }
+        };
+
+        dispatch_1d_any(p, batch_fun_i, 0, M);
+    }
+}
+
+/*!
+ * \brief Sparse implementation of a matrix-vector multiplication
+ * with a compressed sparse matrix
+ * \param a The left sparse matrix
+ * \param b The right vector
+ * \param c The output vector
+ */
+template <typename A, typename B, typename C, cpp_enable_if(is_compressed_sparse_matrix<A>::value && is_sparse_mul<A, B, C>::value)>
+void mv_mul(A&& a, B&& b, C&& c) {
+    using T = value_t<C>;
+
+    const std::size_t M = etl::dim<0>(a);
+    const std::size_t K = etl::dim<1>(a);
+
+    const auto* values = a.values();
+    const auto* inner  = a.inner_index();
+    const auto* outer  = a.outer_index();
+
+    const T* bb = b.memory_start();
+    T* cc       = c.memory_start();
+
+    const bool p = select_parallel(a.non_zeros(), sparse_mul_parallel_threshold);
+
+    if (std::decay_t<A>::storage_format == sparse_storage::CSR) {
+        auto batch_fun_i = [&](const size_t first, const size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                cc[i] = detail::sparse_dot(values, inner, outer[i], outer[i + 1], bb);
+            }
+        };
+
+        dispatch_1d_any(p, batch_fun_i, 0, M);
+    } else {
+        detail::sparse_scatter(values, inner, outer, K, bb, cc, M, p);
+    }
+}
+
+/*!
+ * \brief Sparse implementation of a vector-matrix multiplication
+ * with a compressed sparse matrix (transposed matrix-vector multiplication)
+ * \param a The left vector
+ * \param b The right sparse matrix
+ * \param c The output vector
+ */
+template <typename A, typename B, typename C, cpp_enable_if(is_compressed_sparse_matrix<B>::value && is_sparse_mul<A, B, C>::value)>
+void vm_mul(A&& a, B&& b, C&& c) {
+    using T = value_t<C>;
+
+    const std::size_t K = etl::dim<0>(b);
+    const std::size_t N = etl::dim<1>(b);
+
+    const auto* values = b.values();
+    const auto* inner  = b.inner_index();
+    const auto* outer  = b.outer_index();
+
+    const T* aa = a.memory_start();
+    T* cc       = c.memory_start();
+
+    const bool p = select_parallel(b.non_zeros(), sparse_mul_parallel_threshold);
+
+    if (std::decay_t<B>::storage_format == sparse_storage::CSC) {
+        auto batch_fun_j = [&](const size_t first, const size_t last) {
+            for (std::size_t j = first; j < last; ++j) {
+                cc[j] = detail::sparse_dot(values, inner, outer[j], outer[j + 1], aa);
+            }
+        };
+
+        dispatch_1d_any(p, batch_fun_j, 0, N);
+    } else {
+        detail::sparse_scatter(values, inner, outer, K, aa, cc, N, p);
+    }
+}
+
+} //end of namespace standard
+
+} //end of namespace impl
+
+} //end of namespace etl
@@ -0,0 +1,41 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the "stats" reduction
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief Compute the statistics of the input in the given range
+ * \param input The input expression
+ * \param first The beginning of the range
+ * \param last The end of the range
+ * \return the statistics of the range
+ */
+template <typename E>
+statistics<value_t<E>> stats(const E& input, std::size_t first, std::size_t last) {
+    statistics<value_t<E>> result;
+
+    for (std::size_t i = first; i < last; ++i) {
+        result.push(i, input[i]);
+    }
+
+    return result;
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
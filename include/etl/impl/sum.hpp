@@ -25,6 +25,7 @@
 //Include the implementations
 #include "etl/impl/std/sum.hpp"
 #include "etl/impl/vec/sum.hpp"
+#include "etl/impl/isa/kernels.hpp"
 
 namespace etl {
 
@@ -114,7 +115,14 @@ struct sum_impl {
 
         //TODO Make it so that dispatching aligns the sub parts
 
-        if (impl == etl::sum_impl::VEC) {
+        // If the host supports a wider instruction set than the one the
+        // program was compiled for, use the runtime dispatched kernel
+
+        if (impl::isa::isa_able<E>::value && !local_context().sum_selector.forced && isa_dispatch()) {
+            dispatch_1d_acc<value_t<E>>(parallel_dispatch, [&e](std::size_t first, std::size_t last) -> value_t<E> {
+                return impl::isa::sum(e, first, last);
+            }, acc_functor, 0, size(e));
+        } else if (impl == etl::sum_impl::VEC) {
             dispatch_1d_acc<value_t<E>>(parallel_dispatch, [&e](std::size_t first, std::size_t last) -> value_t<E> {
                 return impl::vec::sum(e, first, last);
             }, acc_functor, 0, size(e));
@@ -14,6 +14,7 @@
 
 //Include the implementations
 #include "etl/impl/std/transpose.hpp"
+#include "etl/impl/vec/transpose.hpp"
 #include "etl/impl/blas/transpose.hpp"
 
 namespace etl {
@@ -34,6 +35,8 @@ cpp14_constexpr transpose_impl select_default_transpose_impl() {
     if (all_dma<A, C>::value && all_floating<A, C>::value) {
         if (is_mkl_enabled) {
             return transpose_impl::MKL;
+        } else if (vec_enabled) {
+            return transpose_impl::VEC;
         } else {
             return transpose_impl::STD;
         }
@@ -63,6 +66,15 @@ transpose_impl select_transpose_impl() {
 
                 return forced;
 
+            //VEC cannot always be used
+            case transpose_impl::VEC:
+                if (!vec_enabled || !all_dma<A, C>::value || !all_floating<A, C>::value) {
+                    std::cerr << "Forced selection to VEC transpose implementation, but not possible for this expression" << std::endl;
+                    return select_default_transpose_impl<A, C>();
+                }
+
+                return forced;
+
             //In other cases, simply use the forced impl
             default:
                 return forced;
@@ -86,6 +98,8 @@ struct inplace_square_transpose {
 
         if (impl == transpose_impl::MKL) {
             etl::impl::blas::inplace_square_transpose(c);
+        } else if (impl == transpose_impl::VEC) {
+            etl::impl::vec::inplace_square_transpose(c);
         } else {
             etl::impl::standard::inplace_square_transpose(c);
         }
@@ -106,6 +120,8 @@ struct inplace_rectangular_transpose {
 
         if (impl == transpose_impl::MKL) {
             etl::impl::blas::inplace_rectangular_transpose(c);
+        } else if (impl == transpose_impl::VEC) {
+            etl::impl::vec::inplace_rectangular_transpose(c);
         } else {
             etl::impl::standard::inplace_rectangular_transpose(c);
         }
@@ -127,6 +143,8 @@ struct transpose {
 
         if (impl == transpose_impl::MKL) {
             etl::impl::blas::transpose(a, c);
+        } else if (impl == transpose_impl::VEC) {
+            etl::impl::vec::transpose(a, c);
         } else {
             etl::impl::standard::transpose(a, c);
         }
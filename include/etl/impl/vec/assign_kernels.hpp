@@ -0,0 +1,480 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized functors of the evaluator.
+ *
+ * This file has no include guard, it is included in etl::detail by
+ * eval_functors.hpp and included again for the other instruction sets by
+ * impl/isa/instantiate.hpp, with runtime dispatch. The loads and stores of
+ * all the expressions are forced inline so that the complete expression is
+ * compiled with the instruction set of the functor.
+ */
+
+/*!
+ * \brief Select a vector mode for the given assignment type
+ * \tparam E The Expression to assign to the result
+ * \tparam R The result type
+ */
+template <typename E, typename R>
+inline constexpr vector_mode_t select_vector_mode(){
+    return
+          (avx512_enabled && etl::detail::are_vectorizable_select<vector_mode_t::AVX512, E, R>::value) ? vector_mode_t::AVX512
+        : (avx_enabled && etl::detail::are_vectorizable_select<vector_mode_t::AVX, E, R>::value) ? vector_mode_t::AVX
+        : (sse3_enabled && etl::detail::are_vectorizable_select<vector_mode_t::SSE3, E, R>::value) ? vector_mode_t::SSE3
+                                                                                : vector_mode_t::NONE;
+}
+
+/*!
+ * \brief Common base for vectorized functors
+ */
+template <vector_mode_t V, typename L_Expr, typename R_Expr, typename Base>
+struct vectorized_base {
+    using derived_t   = Base;             ///< The derived type
+    using memory_type = value_t<L_Expr>*; ///< The memory type
+
+    L_Expr lhs;              ///< The left hand side
+    memory_type lhs_m;        ///< The left hand side memory
+    R_Expr rhs;              ///< The right hand side
+    const std::size_t _size;  ///< The size to assign
+
+    /*!
+     * \brief The RHS value type
+     */
+    using lhs_value_type = value_t<L_Expr>;
+
+    /*!
+     * \brief The RHS value type
+     */
+    using rhs_value_type = value_t<R_Expr>;
+
+    /*!
+     * \brief The intrinsic type for the value type
+     */
+    using IT = typename get_intrinsic_traits<V>::template type<rhs_value_type>;
+
+    /*!
+     * \brief The vector implementation to use
+     */
+    using vect_impl = typename get_vector_impl<V>::type;
+
+    /*!
+     * \brief Indicates if the memory is aligned and padded for the vectors
+     * of V. This is not the case when the functor is compiled for an
+     * instruction set wider than the one of the binary.
+     */
+    static constexpr bool aligned = IT::size <= intrinsic_traits<lhs_value_type>::size;
+
+    /*!
+     * \brief Constuct a new vectorized_base
+     * \param lhs The lhs expression
+     * \param rhs The rhs expression
+     */
+    vectorized_base(L_Expr lhs, R_Expr rhs) : lhs(lhs), lhs_m(lhs.memory_start()), rhs(rhs), _size(etl::size(lhs)) {
+        //Nothing else
+    }
+
+    /*!
+     * \brief Load a vector from lhs at position i
+     * \param i The index where to start loading from
+     * \return a vector from lhs starting at position i
+     */
+    inline auto lhs_load(std::size_t i) const {
+        return aligned ? lhs.template load<vect_impl>(i) : lhs.template loadu<vect_impl>(i);
+    }
+
+    /*!
+     * \brief Load a vector from rhs at position i
+     * \param i The index where to start loading from
+     * \return a vector from rhs starting at position i
+     */
+    inline auto rhs_load(std::size_t i) const {
+        return aligned ? rhs.template load<vect_impl>(i) : rhs.template loadu<vect_impl>(i);
+    }
+
+    /*!
+     * \brief Store a vector to lhs at position i
+     * \param in The vector to store
+     * \param i The index where to start storing to
+     */
+    template <typename In>
+    inline void lhs_store(const In& in, std::size_t i) {
+        if (aligned) {
+            lhs.template store<vect_impl>(in, i);
+        } else {
+            lhs.template storeu<vect_impl>(in, i);
+        }
+    }
+
+private:
+    /*!
+     * \brief Returns a reference to the derived object, i.e. the object using the CRTP injector.
+     * \return a reference to the derived object.
+     */
+    const derived_t& as_derived() const noexcept {
+        return *static_cast<const derived_t*>(this);
+    }
+};
+
+/*!
+ * \brief Functor for vectorized assign
+ *
+ * The result is computed in a vectorized fashion with several
+ * operations per cycle and written directly to the memory of lhs.
+ */
+template <vector_mode_t V, typename L_Expr, typename R_Expr>
+struct VectorizedAssign : vectorized_base<V, L_Expr, R_Expr, VectorizedAssign<V, L_Expr, R_Expr>> {
+    using base_t    = vectorized_base<V, L_Expr, R_Expr, VectorizedAssign<V, L_Expr, R_Expr>>; ///< The base type
+    using IT        = typename base_t::IT;                                                     ///< The intrisic type
+    using vect_impl = typename base_t::vect_impl;                                              ///< The vector implementation
+
+    using base_t::lhs_m;
+    using base_t::lhs;
+    using base_t::rhs;
+    using base_t::_size;
+    using base_t::rhs_load;
+    using base_t::lhs_store;
+
+    /*!
+     * \brief Constuct a new VectorizedAssign
+     * \param lhs The lhs expression
+     * \param rhs The rhs expression
+     */
+    VectorizedAssign(L_Expr lhs, R_Expr rhs) : base_t(lhs, rhs) {
+        //Nothing else
+    }
+
+    /*!
+     * \brief Compute the vectorized iterations of the loop using aligned store operations
+     */
+    void operator()(){
+        constexpr bool remainder = !padding || !all_padded<L_Expr, R_Expr>::value || !base_t::aligned;
+
+        const size_t last = remainder ? (_size & size_t(-IT::size)) : _size;
+
+        std::size_t i = 0;
+
+        if(streaming && base_t::aligned && _size > cache_size / (sizeof(typename base_t::lhs_value_type) * 3) && !rhs.alias(lhs)){
+            for (; i < last; i += IT::size) {
+                lhs.template stream<vect_impl>(rhs_load(i), i);
+            }
+
+            for (; remainder && i < _size; ++i) {
+                lhs_m[i] = rhs[i];
+            }
+        } else {
+            for (; i + (IT::size * 3) < last; i += 4 * IT::size) {
+                lhs_store(rhs_load(i + 0 * IT::size), i + 0 * IT::size);
+                lhs_store(rhs_load(i + 1 * IT::size), i + 1 * IT::size);
+                lhs_store(rhs_load(i + 2 * IT::size), i + 2 * IT::size);
+                lhs_store(rhs_load(i + 3 * IT::size), i + 3 * IT::size);
+            }
+
+            for (; i < last; i += IT::size) {
+                lhs_store(rhs_load(i), i);
+            }
+
+            for (; remainder && i < _size; ++i) {
+                lhs_m[i] = rhs[i];
+            }
+        }
+    }
+};
+
+/*!
+ * \brief Functor for vectorized compound assign add
+ */
+template <vector_mode_t V, typename L_Expr, typename R_Expr>
+struct VectorizedAssignAdd : vectorized_base<V, L_Expr, R_Expr, VectorizedAssignAdd<V, L_Expr, R_Expr>> {
+    using base_t    = vectorized_base<V, L_Expr, R_Expr, VectorizedAssignAdd<V, L_Expr, R_Expr>>; ///< The base type
+    using IT        = typename base_t::IT;                                                        ///< The intrisic type
+    using vect_impl = typename base_t::vect_impl;                                                 ///< The vector implementation
+
+    using base_t::lhs;
+    using base_t::lhs_m;
+    using base_t::rhs;
+    using base_t::_size;
+    using base_t::lhs_load;
+    using base_t::rhs_load;
+    using base_t::lhs_store;
+
+    /*!
+     * \brief Constuct a new VectorizedAssignAdd
+     * \param lhs The lhs expression
+     * \param rhs The rhs expression
+     */
+    VectorizedAssignAdd(L_Expr lhs, R_Expr rhs) : base_t(lhs, rhs) {
+        //Nothing else
+    }
+
+    /*!
+     * \brief Compute the vectorized iterations of the loop using aligned store operations
+     */
+    void operator()(){
+        constexpr bool remainder = !padding || !all_padded<L_Expr, R_Expr>::value || !base_t::aligned;
+
+        const size_t last = remainder ? (_size & size_t(-IT::size)) : _size;
+
+        std::size_t i = 0;
+
+        for (; i + (IT::size * 3) < last; i += 4 * IT::size) {
+            lhs_store(vect_impl::add(lhs_load(i + 0 * IT::size), rhs_load(i + 0 * IT::size)), i + 0 * IT::size);
+            lhs_store(vect_impl::add(lhs_load(i + 1 * IT::size), rhs_load(i + 1 * IT::size)), i + 1 * IT::size);
+            lhs_store(vect_impl::add(lhs_load(i + 2 * IT::size), rhs_load(i + 2 * IT::size)), i + 2 * IT::size);
+            lhs_store(vect_impl::add(lhs_load(i + 3 * IT::size), rhs_load(i + 3 * IT::size)), i + 3 * IT::size);
+        }
+
+        for (; i < last; i += IT::size) {
+            lhs_store(vect_impl::add(lhs_load(i), rhs_load(i)), i);
+        }
+
+        for (; remainder && i < _size; ++i) {
+            lhs_m[i] += rhs[i];
+        }
+    }
+};
+
+/*!
+ * \brief Functor for vectorized compound assign sub
+ */
+template <vector_mode_t V, typename L_Expr, typename R_Expr>
+struct VectorizedAssignSub : vectorized_base<V, L_Expr, R_Expr, VectorizedAssignSub<V, L_Expr, R_Expr>> {
+    using base_t    = vectorized_base<V, L_Expr, R_Expr, VectorizedAssignSub<V, L_Expr, R_Expr>>; ///< The base type
+    using IT        = typename base_t::IT;                                                        ///< The intrisic type
+    using vect_impl = typename base_t::vect_impl;                                                 ///< The vector implementation
+
+    using base_t::lhs;
+    using base_t::lhs_m;
+    using base_t::rhs;
+    using base_t::_size;
+    using base_t::lhs_load;
+    using base_t::rhs_load;
+    using base_t::lhs_store;
+
+    /*!
+     * \brief Constuct a new VectorizedAssignSub
+     * \param lhs The lhs expression
+     * \param rhs The rhs expression
+     */
+    VectorizedAssignSub(L_Expr lhs, R_Expr rhs) : base_t(lhs, rhs) {
+        //Nothing else
+    }
+
+    /*!
+     * \brief Compute the vectorized iterations of the loop using aligned store operations
+     */
+    void operator()() {
+        constexpr bool remainder = !padding || !all_padded<L_Expr, R_Expr>::value || !base_t::aligned;
+
+        const size_t last = remainder ? (_size & size_t(-IT::size)) : _size;
+
+        std::size_t i = 0;
+
+        for (; i + (IT::size * 3) < last; i += 4 * IT::size) {
+            lhs_store(vect_impl::sub(lhs_load(i + 0 * IT::size), rhs_load(i + 0 * IT::size)), i + 0 * IT::size);
+            lhs_store(vect_impl::sub(lhs_load(i + 1 * IT::size), rhs_load(i + 1 * IT::size)), i + 1 * IT::size);
+            lhs_store(vect_impl::sub(lhs_load(i + 2 * IT::size), rhs_load(i + 2 * IT::size)), i + 2 * IT::size);
+            lhs_store(vect_impl::sub(lhs_load(i + 3 * IT::size), rhs_load(i + 3 * IT::size)), i + 3 * IT::size);
+        }
+
+        for (; i < last; i += IT::size) {
+            lhs_store(vect_impl::sub(lhs_load(i), rhs_load(i)), i);
+        }
+
+        for (; remainder && i < _size; ++i) {
+            lhs_m[i] -= rhs[i];
+        }
+    }
+};
+
+/*!
+ * \brief Functor for vectorized compound assign mul
+ */
+template <vector_mode_t V, typename L_Expr, typename R_Expr>
+struct VectorizedAssignMul : vectorized_base<V, L_Expr, R_Expr, VectorizedAssignMul<V, L_Expr, R_Expr>> {
+    static constexpr bool Cx = is_complex_t<value_t<L_Expr>>::value; ///< Indicates it is a complex multiplication
+
+    using base_t    = vectorized_base<V, L_Expr, R_Expr, VectorizedAssignMul<V, L_Expr, R_Expr>>; ///< The base type
+    using IT        = typename base_t::IT;                                                        ///< The intrisic type
+    using vect_impl = typename base_t::vect_impl;                                                 ///< The vector implementation
+
+    using base_t::lhs;
+    using base_t::lhs_m;
+    using base_t::rhs;
+    using base_t::_size;
+    using base_t::lhs_load;
+    using base_t::rhs_load;
+    using base_t::lhs_store;
+
+    /*!
+     * \brief Constuct a new VectorizedAssignMul
+     * \param lhs The lhs expression
+     * \param rhs The rhs expression
+     */
+    VectorizedAssignMul(L_Expr lhs, R_Expr rhs) : base_t(lhs, rhs) {
+        //Nothing else
+    }
+
+    /*!
+     * \brief Compute the vectorized iterations of the loop using aligned store operations
+     */
+    void operator()(){
+        constexpr bool remainder = !padding || !all_padded<L_Expr, R_Expr>::value || !base_t::aligned;
+
+        const size_t last = remainder ? (_size & size_t(-IT::size)) : _size;
+
+        std::size_t i = 0;
+
+        for (; i + (IT::size * 3) < last; i += 4 * IT::size) {
+            lhs_store(vect_impl::template mul<Cx>(lhs_load(i + 0 * IT::size), rhs_load(i + 0 * IT::size)), i + 0 * IT::size);
+            lhs_store(vect_impl::template mul<Cx>(lhs_load(i + 1 * IT::size), rhs_load(i + 1 * IT::size)), i + 1 * IT::size);
+            lhs_store(vect_impl::template mul<Cx>(lhs_load(i + 2 * IT::size), rhs_load(i + 2 * IT::size)), i + 2 * IT::size);
+            lhs_store(vect_impl::template mul<Cx>(lhs_load(i + 3 * IT::size), rhs_load(i + 3 * IT::size)), i + 3 * IT::size);
+        }
+
+        for (; i < last; i += IT::size) {
+            lhs_store(vect_impl::template mul<Cx>(lhs_load(i), rhs_load(i)), i);
+        }
+
+        for (; remainder && i < _size; ++i) {
+            lhs_m[i] *= rhs[i];
+        }
+    }
+};
+
+/*!
+ * \brief Functor for vectorized compound assign div
+ */
+template <vector_mode_t V, typename L_Expr, typename R_Expr>
+struct VectorizedAssignDiv : vectorized_base<V, L_Expr, R_Expr, VectorizedAssignDiv<V, L_Expr, R_Expr>> {
+    static constexpr bool Cx = is_complex_t<value_t<L_Expr>>::value; ///< Indicates if it is a complex division
+
+    using base_t    = vectorized_base<V, L_Expr, R_Expr, VectorizedAssignDiv<V, L_Expr, R_Expr>>; ///< The base type
+    using IT        = typename base_t::IT;                                                        ///< The intrisic type
+    using vect_impl = typename base_t::vect_impl;                                                 ///< The vector implementation
+
+    using base_t::lhs;
+    using base_t::lhs_m;
+    using base_t::rhs;
+    using base_t::_size;
+    using base_t::lhs_load;
+    using base_t::rhs_load;
+    using base_t::lhs_store;
+
+    /*!
+     * \brief Constuct a new VectorizedAssignDiv
+     * \param lhs The lhs expression
+     * \param rhs The rhs expression
+     */
+    VectorizedAssignDiv(L_Expr lhs, R_Expr rhs) : base_t(lhs, rhs) {
+        //Nothing else
+    }
+
+    /*!
+     * \brief Compute the vectorized iterations of the loop using aligned store operations
+     */
+    void operator()(){
+        constexpr bool remainder = !padding || !all_padded<L_Expr, R_Expr>::value || !base_t::aligned;
+
+        const size_t last = remainder ? (_size & size_t(-IT::size)) : _size;
+
+        std::size_t i = 0;
+
+        for (; i + (IT::size * 3) < last; i += 4 * IT::size) {
+            lhs_store(vect_impl::template div<Cx>(lhs_load(i + 0 * IT::size), rhs_load(i + 0 * IT::size)), i + 0 * IT::size);
+            lhs_store(vect_impl::template div<Cx>(lhs_load(i + 1 * IT::size), rhs_load(i + 1 * IT::size)), i + 1 * IT::size);
+            lhs_store(vect_impl::template div<Cx>(lhs_load(i + 2 * IT::size), rhs_load(i + 2 * IT::size)), i + 2 * IT::size);
+            lhs_store(vect_impl::template div<Cx>(lhs_load(i + 3 * IT::size), rhs_load(i + 3 * IT::size)), i + 3 * IT::size);
+        }
+
+        for (; i < last; i += IT::size) {
+            lhs_store(vect_impl::template div<Cx>(lhs_load(i), rhs_load(i)), i);
+        }
+
+        for (; remainder && i < _size; ++i) {
+            lhs_m[i] /= rhs[i];
+        }
+    }
+};
+
+/*!
+ * \brief Evaluate expr into result with the vectorized functor Fun, in
+ * parallel if the expression is large enough
+ * \param expr The right hand side expression
+ * \param result The left hand side
+ */
+template <template <vector_mode_t, typename, typename> class Fun, typename E, typename R>
+void vectorized_evaluate(E&& expr, R&& result) {
+    constexpr auto V = select_vector_mode<E, R>();
+
+    if (all_thread_safe<E>::value && select_parallel(etl::size(result))) {
+        const auto n = etl::size(result);
+
+        using RS = decltype(memory_slice(result, 0, n));
+        using ES = decltype(memory_slice(expr, 0, n));
+
+        dispatch_1d(true, [&](std::size_t first, std::size_t last) {
+            Fun<V, RS, ES>(memory_slice(result, first, last), memory_slice(expr, first, last))();
+        }, 0, n);
+    } else {
+        Fun<V, R&, E&>(result, expr)();
+    }
+}
+
+// The functions are called with parentheses to disable ADL, which would
+// also find the functions compiled for the other instruction sets
+
+/*!
+ * \brief Assign expr to result with vectorized operations
+ * \param expr The right hand side expression
+ * \param result The left hand side
+ */
+template <typename E, typename R>
+void vectorized_assign_evaluate(E&& expr, R&& result) {
+    (vectorized_evaluate<VectorizedAssign>)(expr, result);
+}
+
+/*!
+ * \brief Add expr to result with vectorized operations
+ * \param expr The right hand side expression
+ * \param result The left hand side
+ */
+template <typename E, typename R>
+void vectorized_add_evaluate(E&& expr, R&& result) {
+    (vectorized_evaluate<VectorizedAssignAdd>)(expr, result);
+}
+
+/*!
+ * \brief Subtract expr from result with vectorized operations
+ * \param expr The right hand side expression
+ * \param result The left hand side
+ */
+template <typename E, typename R>
+void vectorized_sub_evaluate(E&& expr, R&& result) {
+    (vectorized_evaluate<VectorizedAssignSub>)(expr, result);
+}
+
+/*!
+ * \brief Multiply result by expr with vectorized operations
+ * \param expr The right hand side expression
+ * \param result The left hand side
+ */
+template <typename E, typename R>
+void vectorized_mul_evaluate(E&& expr, R&& result) {
+    (vectorized_evaluate<VectorizedAssignMul>)(expr, result);
+}
+
+/*!
+ * \brief Divide result by expr with vectorized operations
+ * \param expr The right hand side expression
+ * \param result The left hand side
+ */
+template <typename E, typename R>
+void vectorized_div_evaluate(E&& expr, R&& result) {
+    (vectorized_evaluate<VectorizedAssignDiv>)(expr, result);
+}
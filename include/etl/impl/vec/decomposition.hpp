@@ -0,0 +1,726 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Blocked and vectorized implementation of the decompositions
+ * (LU, Cholesky and QR) and of the triangular solves.
+ *
+ * The decompositions are right-looking: a panel of columns is factorized
+ * and the trailing matrix is updated with matrix-matrix multiplications.
+ * The LU solves are done by blocks of rows, the contribution of the
+ * previous blocks being subtracted with a matrix-matrix multiplication as
+ * well. The multiplications go through the selected GEMM implementation.
+ * All the row operations are vectorized.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+constexpr std::size_t lu_block_size = 64; ///< The size of the blocks of the LU decomposition and solves
+
+/*!
+ * \brief Compute y += alpha * x on n contiguous elements
+ * \param y The output elements
+ * \param alpha The scaling factor
+ * \param x The input elements
+ * \param n The number of elements
+ */
+template <typename V, typename T>
+void lu_axpy(T* y, T alpha, const T* x, std::size_t n) {
+    static constexpr std::size_t vec_size = V::template traits<T>::size;
+
+    const auto a = V::set(alpha);
+
+    std::size_t j = 0;
+
+    for (; j + 2 * vec_size <= n; j += 2 * vec_size) {
+        V::storeu(y + j + 0 * vec_size, V::fmadd(a, V::loadu(x + j + 0 * vec_size), V::loadu(y + j + 0 * vec_size)));
+        V::storeu(y + j + 1 * vec_size, V::fmadd(a, V::loadu(x + j + 1 * vec_size), V::loadu(y + j + 1 * vec_size)));
+    }
+
+    for (; j + vec_size <= n; j += vec_size) {
+        V::storeu(y + j, V::fmadd(a, V::loadu(x + j), V::loadu(y + j)));
+    }
+
+    for (; j < n; ++j) {
+        y[j] += alpha * x[j];
+    }
+}
+
+/*!
+ * \brief Compute y *= alpha on n contiguous elements
+ * \param y The elements
+ * \param alpha The scaling factor
+ * \param n The number of elements
+ */
+template <typename V, typename T>
+void lu_scale(T* y, T alpha, std::size_t n) {
+    static constexpr std::size_t vec_size = V::template traits<T>::size;
+
+    const auto a = V::set(alpha);
+
+    std::size_t j = 0;
+
+    for (; j + vec_size <= n; j += vec_size) {
+        V::storeu(y + j, V::mul(a, V::loadu(y + j)));
+    }
+
+    for (; j < n; ++j) {
+        y[j] *= alpha;
+    }
+}
+
+/*!
+ * \brief Compute the dot product of n contiguous elements
+ * \param x The first elements
+ * \param y The second elements
+ * \param n The number of elements
+ * \return the dot product of x and y
+ */
+template <typename V, typename T>
+T lu_dot(const T* x, const T* y, std::size_t n) {
+    static constexpr std::size_t vec_size = V::template traits<T>::size;
+
+    auto r1 = V::template zero<T>();
+    auto r2 = V::template zero<T>();
+
+    std::size_t j = 0;
+
+    for (; j + 2 * vec_size <= n; j += 2 * vec_size) {
+        r1 = V::fmadd(V::loadu(x + j + 0 * vec_size), V::loadu(y + j + 0 * vec_size), r1);
+        r2 = V::fmadd(V::loadu(x + j + 1 * vec_size), V::loadu(y + j + 1 * vec_size), r2);
+    }
+
+    for (; j + vec_size <= n; j += vec_size) {
+        r1 = V::fmadd(V::loadu(x + j), V::loadu(y + j), r1);
+    }
+
+    T product = V::hadd(V::add(r1, r2));
+
+    for (; j < n; ++j) {
+        product += x[j] * y[j];
+    }
+
+    return product;
+}
+
+/*!
+ * \brief Compute C = A * B on contiguous row major blocks, with the
+ * selected GEMM implementation.
+ * \param c The C block (m x n)
+ * \param a The A block (m x k)
+ * \param b The B block (k x n)
+ * \param m The number of rows of C
+ * \param n The number of columns of C
+ * \param k The number of columns of A
+ */
+template <typename T>
+void block_gemm(T* c, const T* a, const T* b, std::size_t m, std::size_t n, std::size_t k) {
+    // Note: a and b are only read, the const_cast is only here to allow the views
+    custom_dyn_matrix<T> a_view(const_cast<T*>(a), m, k);
+    custom_dyn_matrix<T> b_view(const_cast<T*>(b), k, n);
+    custom_dyn_matrix<T> c_view(c, m, n);
+
+    c_view = a_view * b_view;
+}
+
+/*!
+ * \brief Compute C -= A * B on blocks of row major matrices.
+ *
+ * The blocks of A and B are packed if they are not contiguous and the
+ * product is computed into a buffer before being subtracted from C.
+ *
+ * \param c The first element of the block of C (m x n)
+ * \param ldc The distance between two rows of C
+ * \param a The first element of the block of A (m x k)
+ * \param lda The distance between two rows of A
+ * \param b The first element of the block of B (k x n)
+ * \param ldb The distance between two rows of B
+ * \param m The number of rows of C
+ * \param n The number of columns of C
+ * \param k The number of columns of A
+ * \param a_buffer A buffer of at least m * k elements
+ * \param b_buffer A buffer of at least k * n elements
+ * \param c_buffer A buffer of at least m * n elements
+ */
+template <typename V, typename T>
+void lu_gemm_update(T* c, std::size_t ldc, const T* a, std::size_t lda, const T* b, std::size_t ldb, std::size_t m, std::size_t n, std::size_t k, T* a_buffer, T* b_buffer, T* c_buffer) {
+    if (lda != k) {
+        for (std::size_t i = 0; i < m; ++i) {
+            std::copy(a + i * lda, a + i * lda + k, a_buffer + i * k);
+        }
+
+        a = a_buffer;
+    }
+
+    if (ldb != n) {
+        for (std::size_t i = 0; i < k; ++i) {
+            std::copy(b + i * ldb, b + i * ldb + n, b_buffer + i * n);
+        }
+
+        b = b_buffer;
+    }
+
+    block_gemm(c_buffer, a, b, m, n, k);
+
+    for (std::size_t i = 0; i < m; ++i) {
+        lu_axpy<V>(c + i * ldc, T(-1), c_buffer + i * n, n);
+    }
+}
+
+/*!
+ * \brief Compute the LU decomposition of the given matrix in place, with
+ * partial pivoting.
+ * \param lu The matrix to decompose, replaced by its decomposition
+ * \param perm The permutation of the rows (output)
+ * \return false if the matrix is singular, true otherwise
+ */
+template <typename V, typename LU>
+bool selected_lu_factor(LU& lu, std::vector<std::size_t>& perm) {
+    using T = value_t<LU>;
+
+    static constexpr std::size_t nb = lu_block_size;
+
+    const std::size_t n = etl::dim<0>(lu);
+
+    perm.resize(n);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        perm[i] = i;
+    }
+
+    T* a = lu.memory_start();
+
+    // The buffers of the trailing updates
+    const std::size_t m_max = n > nb ? n - nb : 1;
+
+    auto a_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(m_max * nb)};
+    auto b_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(nb * m_max)};
+    auto c_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(m_max * m_max)};
+
+    bool regular = true;
+
+    for (std::size_t k = 0; k < n; k += nb) {
+        const std::size_t kl = std::min(n, k + nb);
+
+        // 1. Factorize the panel (the rows are swapped entirely)
+
+        for (std::size_t j = k; j < kl; ++j) {
+            auto p = j;
+
+            for (std::size_t i = j + 1; i < n; ++i) {
+                if (std::abs(a[i * n + j]) > std::abs(a[p * n + j])) {
+                    p = i;
+                }
+            }
+
+            if (p != j) {
+                std::swap_ranges(a + j * n, a + (j + 1) * n, a + p * n);
+                std::swap(perm[j], perm[p]);
+            }
+
+            const T pivot = a[j * n + j];
+
+            if (pivot == T(0)) {
+                regular = false;
+                continue;
+            }
+
+            for (std::size_t i = j + 1; i < n; ++i) {
+                a[i * n + j] /= pivot;
+
+                lu_axpy<V>(a + i * n + j + 1, -a[i * n + j], a + j * n + j + 1, kl - j - 1);
+            }
+        }
+
+        if (kl < n) {
+            const std::size_t m = n - kl;
+
+            // 2. Solve L11 U12 = A12
+
+            for (std::size_t i = k + 1; i < kl; ++i) {
+                for (std::size_t p = k; p < i; ++p) {
+                    lu_axpy<V>(a + i * n + kl, -a[i * n + p], a + p * n + kl, m);
+                }
+            }
+
+            // 3. A22 -= L21 U12
+
+            lu_gemm_update<V>(a + kl * n + kl, n, a + kl * n + k, n, a + k * n + kl, n, m, m, kl - k, a_buffer.get(), b_buffer.get(), c_buffer.get());
+        }
+    }
+
+    return regular;
+}
+
+/*!
+ * \brief Solve A X = B in place, given the LU decomposition of A.
+ * \param lu The LU decomposition of A, as computed by lu_factor
+ * \param perm The permutation of the rows of the decomposition
+ * \param x The matrix (n x r, row major) containing B, replaced by X
+ */
+template <typename V, typename LU, typename X>
+void selected_lu_solve(const LU& lu, const std::vector<std::size_t>& perm, X& x) {
+    using T = value_t<LU>;
+
+    static constexpr std::size_t nb = lu_block_size;
+
+    const std::size_t n = etl::dim<0>(lu);
+    const std::size_t r = etl::dim<1>(x);
+
+    const T* a = lu.memory_start();
+    T* b       = x.memory_start();
+
+    auto a_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(nb * n)};
+    auto c_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(nb * r)};
+
+    // Permute the rows of B
+
+    {
+        auto tmp = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(n * r)};
+
+        std::copy(b, b + n * r, tmp.get());
+
+        for (std::size_t i = 0; i < n; ++i) {
+            std::copy(tmp.get() + perm[i] * r, tmp.get() + (perm[i] + 1) * r, b + i * r);
+        }
+    }
+
+    const std::size_t blocks = (n + nb - 1) / nb;
+
+    // Forward substitution with L (unit diagonal)
+
+    for (std::size_t kk = 0; kk < blocks; ++kk) {
+        const std::size_t k  = kk * nb;
+        const std::size_t kl = std::min(n, k + nb);
+
+        if (k) {
+            lu_gemm_update<V>(b + k * r, r, a + k * n, n, b, r, kl - k, r, k, a_buffer.get(), b, c_buffer.get());
+        }
+
+        for (std::size_t i = k + 1; i < kl; ++i) {
+            for (std::size_t p = k; p < i; ++p) {
+                lu_axpy<V>(b + i * r, -a[i * n + p], b + p * r, r);
+            }
+        }
+    }
+
+    // Backward substitution with U
+
+    for (std::size_t kk = blocks; kk-- > 0;) {
+        const std::size_t k  = kk * nb;
+        const std::size_t kl = std::min(n, k + nb);
+
+        if (kl < n) {
+            lu_gemm_update<V>(b + k * r, r, a + k * n + kl, n, b + kl * r, r, kl - k, r, n - kl, a_buffer.get(), b, c_buffer.get());
+        }
+
+        for (std::size_t i = kl; i-- > k;) {
+            for (std::size_t p = i + 1; p < kl; ++p) {
+                lu_axpy<V>(b + i * r, -a[i * n + p], b + p * r, r);
+            }
+
+            lu_scale<V>(b + i * r, T(1) / a[i * n + i], r);
+        }
+    }
+}
+
+/*!
+ * \brief Compute the Cholesky decomposition of the given matrix in place.
+ *
+ * Only the lower part of the matrix is read. After the decomposition, the
+ * lower part contains L and the strict upper part is zero.
+ *
+ * \param l The matrix to decompose, replaced by its decomposition
+ * \return false if the matrix is not positive definite, true otherwise
+ */
+template <typename V, typename L>
+bool selected_cholesky(L& l) {
+    using T = value_t<L>;
+
+    static constexpr std::size_t nb = lu_block_size;
+
+    const std::size_t n = etl::dim<0>(l);
+
+    T* a = l.memory_start();
+
+    auto lt_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(nb * (n > nb ? n - nb : 1))};
+
+    for (std::size_t k = 0; k < n; k += nb) {
+        const std::size_t kl = std::min(n, k + nb);
+        const std::size_t b  = kl - k;
+
+        // 1. Factorize the diagonal block
+
+        for (std::size_t i = k; i < kl; ++i) {
+            for (std::size_t j = k; j < i; ++j) {
+                a[i * n + j] = (a[i * n + j] - lu_dot<V>(a + i * n + k, a + j * n + k, j - k)) / a[j * n + j];
+            }
+
+            const T d = a[i * n + i] - lu_dot<V>(a + i * n + k, a + i * n + k, i - k);
+
+            if (!(d > T(0))) {
+                return false;
+            }
+
+            a[i * n + i] = std::sqrt(d);
+        }
+
+        if (kl < n) {
+            const std::size_t m = n - kl;
+
+            // 2. Solve L21 L11^T = A21, each row independently
+
+            auto trsm_fun = [a, n, k, kl](std::size_t first, std::size_t last) {
+                for (std::size_t i = first; i < last; ++i) {
+                    for (std::size_t j = k; j < kl; ++j) {
+                        a[i * n + j] = (a[i * n + j] - lu_dot<V>(a + i * n + k, a + j * n + k, j - k)) / a[j * n + j];
+                    }
+                }
+            };
+
+            dispatch_1d(select_parallel(m * b * b / 2, parallel_threshold), trsm_fun, kl, n);
+
+            // 3. A22 -= L21 L21^T, only the blocks of the lower part
+
+            T* lt = lt_buffer.get();
+
+            for (std::size_t i = 0; i < m; ++i) {
+                for (std::size_t j = 0; j < b; ++j) {
+                    lt[j * m + i] = a[(kl + i) * n + k + j];
+                }
+            }
+
+            auto update_fun = [a, n, k, kl, b, m, lt](std::size_t first, std::size_t last) {
+                auto a_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(nb * b)};
+                auto b_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(b * m)};
+                auto c_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(nb * m)};
+
+                for (std::size_t bi = first; bi < last; ++bi) {
+                    const std::size_t r0 = bi * nb;
+                    const std::size_t r1 = std::min(m, r0 + nb);
+
+                    lu_gemm_update<V>(a + (kl + r0) * n + kl, n, a + (kl + r0) * n + k, n, lt, m, r1 - r0, r1, b, a_buffer.get(), b_buffer.get(), c_buffer.get());
+                }
+            };
+
+            dispatch_1d_threads(select_parallel(m * m * b / 2, gemm_parallel_threshold), update_fun, 0, (m + nb - 1) / nb);
+        }
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        std::fill(a + i * n + i + 1, a + (i + 1) * n, T(0));
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Build the compact WY representation H_k ... H_(k+b-1) = I - V T V^T
+ * of the Householder reflectors stored below the diagonal of a panel.
+ * \param a The factorized matrix (m x n)
+ * \param n The number of columns of a
+ * \param m The number of rows of a
+ * \param k The first column of the panel
+ * \param b The number of reflectors of the panel
+ * \param tau The scaling factors of the reflectors
+ * \param v The V matrix ((m - k) x b, output)
+ * \param vt The transpose of V (b x (m - k), output)
+ * \param t The T matrix (b x b, upper triangular, output)
+ */
+template <typename V, typename T>
+void qr_block_reflector(const T* a, std::size_t n, std::size_t m, std::size_t k, std::size_t b, const std::vector<T>& tau, T* v, T* vt, T* t) {
+    const std::size_t mk = m - k;
+
+    for (std::size_t i = 0; i < mk; ++i) {
+        for (std::size_t c = 0; c < b; ++c) {
+            v[i * b + c] = i == c ? T(1) : i > c ? a[(k + i) * n + k + c] : T(0);
+
+            vt[c * mk + i] = v[i * b + c];
+        }
+    }
+
+    std::fill(t, t + b * b, T(0));
+
+    std::vector<T> z(b);
+
+    for (std::size_t c = 0; c < b; ++c) {
+        // z = V(:, 0:c)^T v_c, v_c being zero above the row c
+        std::fill(z.begin(), z.end(), T(0));
+
+        for (std::size_t i = c; i < mk; ++i) {
+            lu_axpy<V>(z.data(), v[i * b + c], v + i * b, c);
+        }
+
+        for (std::size_t r = 0; r < c; ++r) {
+            T value = T(0);
+
+            for (std::size_t s = r; s < c; ++s) {
+                value += t[r * b + s] * z[s];
+            }
+
+            t[r * b + c] = -tau[k + c] * value;
+        }
+
+        t[c * b + c] = tau[k + c];
+    }
+}
+
+/*!
+ * \brief Compute C = (I - V T V^T) C, on blocks of columns of C
+ * \param c The C block (rows x cols)
+ * \param ldc The distance between two rows of C
+ * \param rows The number of rows of C
+ * \param cols The number of columns of C
+ * \param v The V matrix (rows x b)
+ * \param vt The transpose of V
+ * \param t The T matrix (b x b)
+ * \param b The number of reflectors
+ */
+template <typename V, typename T>
+void qr_apply_block(T* c, std::size_t ldc, std::size_t rows, std::size_t cols, const T* v, const T* vt, const T* t, std::size_t b) {
+    auto apply_fun = [=](std::size_t first, std::size_t last) {
+        const std::size_t w = last - first;
+
+        auto c_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(rows * w)};
+        auto w_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(b * w)};
+        auto x_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(b * w)};
+
+        for (std::size_t i = 0; i < rows; ++i) {
+            std::copy(c + i * ldc + first, c + i * ldc + last, c_buffer.get() + i * w);
+        }
+
+        // W = T V^T C
+
+        block_gemm(x_buffer.get(), vt, c_buffer.get(), b, w, rows);
+        block_gemm(w_buffer.get(), t, x_buffer.get(), b, w, b);
+
+        // C -= V W
+
+        block_gemm(c_buffer.get(), v, w_buffer.get(), rows, w, b);
+
+        for (std::size_t i = 0; i < rows; ++i) {
+            lu_axpy<V>(c + i * ldc + first, T(-1), c_buffer.get() + i * w, w);
+        }
+    };
+
+    dispatch_1d_threads(select_parallel(2 * rows * cols * b, gemm_parallel_threshold), apply_fun, 0, cols);
+}
+
+/*!
+ * \brief Compute the QR decomposition of the given matrix, with Householder
+ * reflectors.
+ * \param r The matrix to decompose (m x n), replaced by R
+ * \param q The Q matrix (m x m, output)
+ */
+template <typename V, typename R, typename Q>
+void selected_qr(R& r, Q& q) {
+    using T = value_t<R>;
+
+    static constexpr std::size_t nb = lu_block_size;
+
+    const std::size_t m = etl::dim<0>(r);
+    const std::size_t n = etl::dim<1>(r);
+    const std::size_t p = m ? std::min(m - 1, n) : 0;
+
+    T* a = r.memory_start();
+
+    std::vector<T> tau(p);
+
+    auto v_buffer  = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(m * nb)};
+    auto vt_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(nb * m)};
+    auto t_buffer  = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(nb * nb)};
+    auto w_buffer  = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(nb)};
+
+    T* w = w_buffer.get();
+    T* t = t_buffer.get();
+
+    for (std::size_t k = 0; k < p; k += nb) {
+        const std::size_t kl = std::min(p, k + nb);
+
+        // 1. Factorize the panel
+
+        for (std::size_t j = k; j < kl; ++j) {
+            T xnorm = T(0);
+
+            for (std::size_t i = j + 1; i < m; ++i) {
+                xnorm += a[i * n + j] * a[i * n + j];
+            }
+
+            tau[j] = T(0);
+
+            if (xnorm == T(0)) {
+                continue;
+            }
+
+            const T alpha = a[j * n + j];
+            const T beta  = -std::copysign(std::sqrt(alpha * alpha + xnorm), alpha);
+
+            tau[j] = (beta - alpha) / beta;
+
+            const T scale = T(1) / (alpha - beta);
+
+            for (std::size_t i = j + 1; i < m; ++i) {
+                a[i * n + j] *= scale;
+            }
+
+            a[j * n + j] = beta;
+
+            // Apply the reflector to the next columns of the panel
+
+            const std::size_t cols = kl - j - 1;
+
+            std::copy(a + j * n + j + 1, a + j * n + kl, w);
+
+            for (std::size_t i = j + 1; i < m; ++i) {
+                lu_axpy<V>(w, a[i * n + j], a + i * n + j + 1, cols);
+            }
+
+            lu_axpy<V>(a + j * n + j + 1, -tau[j], w, cols);
+
+            for (std::size_t i = j + 1; i < m; ++i) {
+                lu_axpy<V>(a + i * n + j + 1, -tau[j] * a[i * n + j], w, cols);
+            }
+        }
+
+        // 2. Apply H^T = I - V T^T V^T to the trailing columns
+
+        if (kl < n) {
+            const std::size_t b = kl - k;
+
+            qr_block_reflector<V>(a, n, m, k, b, tau, v_buffer.get(), vt_buffer.get(), t);
+
+            for (std::size_t i = 0; i < b; ++i) {
+                for (std::size_t j = i + 1; j < b; ++j) {
+                    std::swap(t[i * b + j], t[j * b + i]);
+                }
+            }
+
+            qr_apply_block<V>(a + k * n + kl, n, m - k, n - kl, v_buffer.get(), vt_buffer.get(), t, b);
+        }
+    }
+
+    // Accumulate Q = H_0 ... H_(p-1), starting from the last panel
+
+    T* qq = q.memory_start();
+
+    std::fill(qq, qq + m * m, T(0));
+
+    for (std::size_t i = 0; i < m; ++i) {
+        qq[i * m + i] = T(1);
+    }
+
+    for (std::size_t kk = (p + nb - 1) / nb; kk-- > 0;) {
+        const std::size_t k = kk * nb;
+        const std::size_t b = std::min(p, k + nb) - k;
+
+        qr_block_reflector<V>(a, n, m, k, b, tau, v_buffer.get(), vt_buffer.get(), t);
+
+        qr_apply_block<V>(qq + k * m + k, m, m - k, m - k, v_buffer.get(), vt_buffer.get(), t, b);
+    }
+
+    for (std::size_t i = 1; i < m; ++i) {
+        std::fill(a + i * n, a + i * n + std::min(i, n), T(0));
+    }
+}
+
+/*!
+ * \brief Indicates if the vectorized implementation of the decompositions
+ * can be used for the given expression
+ */
+template <typename E>
+using decomposition_vectorizable = cpp::bool_constant<vec_enabled && all_floating<E>::value>;
+
+/*!
+ * \copydoc selected_lu_factor
+ */
+template <typename LU, cpp_enable_if(decomposition_vectorizable<LU>::value)>
+bool lu_factor(LU& lu, std::vector<std::size_t>& perm) {
+    using vec_type = typename get_vector_impl<vector_mode>::type;
+
+    return selected_lu_factor<vec_type>(lu, perm);
+}
+
+/*!
+ * \copydoc selected_lu_factor
+ */
+template <typename LU, cpp_disable_if(decomposition_vectorizable<LU>::value)>
+bool lu_factor(LU& lu, std::vector<std::size_t>& perm) {
+    cpp_unused(lu);
+    cpp_unused(perm);
+    cpp_unreachable("vec::lu_factor called with invalid parameters");
+}
+
+/*!
+ * \copydoc selected_lu_solve
+ */
+template <typename LU, typename X, cpp_enable_if(decomposition_vectorizable<LU>::value)>
+void lu_solve(const LU& lu, const std::vector<std::size_t>& perm, X& x) {
+    using vec_type = typename get_vector_impl<vector_mode>::type;
+
+    selected_lu_solve<vec_type>(lu, perm, x);
+}
+
+/*!
+ * \copydoc selected_lu_solve
+ */
+template <typename LU, typename X, cpp_disable_if(decomposition_vectorizable<LU>::value)>
+void lu_solve(const LU& lu, const std::vector<std::size_t>& perm, X& x) {
+    cpp_unused(lu);
+    cpp_unused(perm);
+    cpp_unused(x);
+    cpp_unreachable("vec::lu_solve called with invalid parameters");
+}
+
+/*!
+ * \copydoc selected_cholesky
+ */
+template <typename L, cpp_enable_if(decomposition_vectorizable<L>::value)>
+bool cholesky(L& l) {
+    using vec_type = typename get_vector_impl<vector_mode>::type;
+
+    return selected_cholesky<vec_type>(l);
+}
+
+/*!
+ * \copydoc selected_cholesky
+ */
+template <typename L, cpp_disable_if(decomposition_vectorizable<L>::value)>
+bool cholesky(L& l) {
+    cpp_unused(l);
+    cpp_unreachable("vec::cholesky called with invalid parameters");
+}
+
+/*!
+ * \copydoc selected_qr
+ */
+template <typename R, typename Q, cpp_enable_if(decomposition_vectorizable<R>::value)>
+void qr(R& r, Q& q) {
+    using vec_type = typename get_vector_impl<vector_mode>::type;
+
+    selected_qr<vec_type>(r, q);
+}
+
+/*!
+ * \copydoc selected_qr
+ */
+template <typename R, typename Q, cpp_disable_if(decomposition_vectorizable<R>::value)>
+void qr(R& r, Q& q) {
+    cpp_unused(r);
+    cpp_unused(q);
+    cpp_unreachable("vec::qr called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
@@ -0,0 +1,120 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized kernels for the FFT of power of two sizes and for
+ * the FFT of sizes with large prime factors
+ *
+ * The transforms are computed with the Stockham autosort algorithm: each
+ * stage reads one buffer and writes the other one in an order such that
+ * the result of the last stage is in natural order, without any bit
+ * reversal. The stages are radix-4, with radix-8 stages to handle odd
+ * powers and small strides and a radix-2 stage for the transform of two
+ * elements.
+ *
+ * Each butterfly of a stage is applied to s consecutive elements at once,
+ * s being the stride of the stage, which is vectorized with the complex
+ * operations of the vectorization mode. The twiddle factors are stored
+ * already broadcast in vectors. When the stride is smaller than a vector,
+ * the elements of several butterflies are loaded at once and the twiddle
+ * factors of the stage are stored for each element.
+ *
+ * The transforms larger than the threshold are computed with the
+ * four-step algorithm: the signal is seen as a n1 x n2 matrix, the
+ * columns are transformed together (each stage streams over the whole
+ * matrix), then each row is multiplied by twiddle factors and transformed
+ * while it is in cache and the rows are written transposed.
+ *
+ * The sizes with a large prime factor are computed with the chirp-z
+ * algorithm of Bluestein: the transform is written as a convolution,
+ * which is computed with power of two transforms.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Scalar complex operations with the interface of the
+ * vectorization modes. This is used by the FFT kernels when the
+ * implementations are not vectorized and for the transforms too small to
+ * fill a vector.
+ */
+struct scalar_fft_vec {
+    /*!
+     * \brief The traits of the scalar mode, one element at a time
+     */
+    template <typename T>
+    struct traits {
+        static constexpr std::size_t size = 1; ///< Numbers of elements done at once
+    };
+
+    template <typename T>
+    using vec_type = T; ///< The "vector" type is the scalar type
+
+    /*!
+     * \brief Load a value from memory
+     */
+    template <typename T>
+    static T loadu(const T* memory) {
+        return *memory;
+    }
+
+    /*!
+     * \brief Store a value to memory
+     */
+    template <typename T>
+    static void storeu(T* memory, T value) {
+        *memory = value;
+    }
+
+    /*!
+     * \brief Returns the given value
+     */
+    template <typename T>
+    static T set(T value) {
+        return value;
+    }
+
+    /*!
+     * \brief Add the two given values
+     */
+    template <typename T>
+    static T add(T lhs, T rhs) {
+        return lhs + rhs;
+    }
+
+    /*!
+     * \brief Subtract rhs from lhs
+     */
+    template <typename T>
+    static T sub(T lhs, T rhs) {
+        return lhs - rhs;
+    }
+
+    /*!
+     * \brief Multiply the two given values
+     */
+    template <bool Complex = false, typename T>
+    static T mul(T lhs, T rhs) {
+        return lhs * rhs;
+    }
+};
+
+#include "etl/impl/vec/fft_kernels.hpp"
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
+
+#define ETL_ISA_KERNELS "etl/impl/vec/fft_kernels.hpp"
+#include "etl/impl/isa/instantiate.hpp"
@@ -0,0 +1,644 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Kernels of the vectorized FFT.
+ *
+ * This file has no include guard, it is included in etl::impl::vec by
+ * fft.hpp and included again for the other instruction sets by
+ * impl/isa/instantiate.hpp, with runtime dispatch.
+ */
+
+/*!
+ * \brief The constants of the butterflies, broadcast in vectors
+ * \tparam V The vectorization mode
+ * \tparam T The precision
+ */
+template <typename V, typename T>
+struct fft_constants {
+    using vec_type = typename V::template vec_type<etl::complex<T>>; ///< The vector type
+
+    vec_type j;  ///< The fourth root of unity of the direction (-i forward, i inverse)
+    vec_type w1; ///< The first eighth root of unity of the direction
+    vec_type w3; ///< The third eighth root of unity of the direction
+
+    /*!
+     * \brief Compute the constants
+     * \param sign The sign of the exponent of the transform (-1 forward, 1 inverse)
+     */
+    explicit fft_constants(T sign)
+            : j(V::set(etl::complex<T>(T(0), sign))),
+              w1(V::set(etl::complex<T>(T(M_SQRT1_2), sign * T(M_SQRT1_2)))),
+              w3(V::set(etl::complex<T>(T(-M_SQRT1_2), sign * T(M_SQRT1_2)))) {}
+};
+
+/*!
+ * \brief Inplace DFT of R vectors of elements
+ * \tparam R The radix of the butterfly
+ */
+template <std::size_t R>
+struct fft_butterfly;
+
+/*!
+ * \copydoc fft_butterfly
+ */
+template <>
+struct fft_butterfly<2> {
+    /*!
+     * \brief Apply the butterfly to x
+     * \param x The R vectors, transformed inplace
+     * \param c The constants of the transform
+     */
+    template <typename V, typename X, typename C>
+    static void apply(X* x, const C& c) {
+        cpp_unused(c);
+
+        auto a = x[0];
+
+        x[0] = V::add(a, x[1]);
+        x[1] = V::sub(a, x[1]);
+    }
+};
+
+/*!
+ * \copydoc fft_butterfly
+ */
+template <>
+struct fft_butterfly<4> {
+    /*!
+     * \brief Apply the butterfly to the given vectors, inplace
+     * \param x0 The first vector
+     * \param x1 The second vector
+     * \param x2 The third vector
+     * \param x3 The fourth vector
+     * \param c The constants of the transform
+     */
+    template <typename V, typename X, typename C>
+    static void apply(X& x0, X& x1, X& x2, X& x3, const C& c) {
+        auto apc  = V::add(x0, x2);
+        auto amc  = V::sub(x0, x2);
+        auto bpd  = V::add(x1, x3);
+        auto jbmd = V::template mul<true>(c.j, V::sub(x1, x3));
+
+        x0 = V::add(apc, bpd);
+        x1 = V::add(amc, jbmd);
+        x2 = V::sub(apc, bpd);
+        x3 = V::sub(amc, jbmd);
+    }
+
+    /*!
+     * \copydoc fft_butterfly<2>::apply
+     */
+    template <typename V, typename X, typename C>
+    static void apply(X* x, const C& c) {
+        apply<V>(x[0], x[1], x[2], x[3], c);
+    }
+};
+
+/*!
+ * \copydoc fft_butterfly
+ */
+template <>
+struct fft_butterfly<8> {
+    /*!
+     * \copydoc fft_butterfly<2>::apply
+     */
+    template <typename V, typename X, typename C>
+    static void apply(X* x, const C& c) {
+        // Transforms of the even and of the odd elements
+        fft_butterfly<4>::apply<V>(x[0], x[2], x[4], x[6], c);
+        fft_butterfly<4>::apply<V>(x[1], x[3], x[5], x[7], c);
+
+        auto o1 = V::template mul<true>(x[3], c.w1);
+        auto o2 = V::template mul<true>(x[5], c.j);
+        auto o3 = V::template mul<true>(x[7], c.w3);
+
+        auto e0 = x[0];
+        auto e1 = x[2];
+        auto e2 = x[4];
+        auto e3 = x[6];
+
+        x[0] = V::add(e0, x[1]);
+        x[4] = V::sub(e0, x[1]);
+        x[1] = V::add(e1, o1);
+        x[5] = V::sub(e1, o1);
+        x[2] = V::add(e2, o2);
+        x[6] = V::sub(e2, o2);
+        x[3] = V::add(e3, o3);
+        x[7] = V::sub(e3, o3);
+    }
+};
+
+/*!
+ * \brief Compute one stage of a Stockham FFT.
+ *
+ * The input is seen as R blocks of m * s elements. Element q of
+ * butterfly p takes its inputs at q + s * (p + k * m) and its outputs
+ * are written, multiplied by the twiddle factors, at q + s * (R * p + k).
+ *
+ * \param in The input of the stage
+ * \param out The output of the stage
+ * \param m The number of butterflies
+ * \param s The stride of the stage
+ * \param twiddles The twiddle factors of the stage
+ * \param expanded Indicates if the twiddle factors are stored for each element (s < vector size) or broadcast for each butterfly
+ * \param c The constants of the transform
+ * \tparam R The radix of the stage
+ * \tparam V The vectorization mode
+ */
+template <std::size_t R, typename V, typename T>
+void stockham_stage(const etl::complex<T>* in, etl::complex<T>* out, std::size_t m, std::size_t s, const etl::complex<T>* twiddles, bool expanded, const fft_constants<V, T>& c) {
+    using vec_type = typename V::template vec_type<etl::complex<T>>;
+
+    static constexpr std::size_t vec_size = V::template traits<etl::complex<T>>::size;
+
+    const std::size_t ms = m * s;
+
+    if (!expanded) {
+        // The stride is a multiple of the vector size
+        for (std::size_t p = 0; p < m; ++p) {
+            vec_type w[R];
+
+            for (std::size_t k = 1; k < R; ++k) {
+                w[k] = V::loadu(twiddles + ((k - 1) * m + p) * vec_size);
+            }
+
+            const auto* src = in + s * p;
+            auto* dst       = out + s * R * p;
+
+            for (std::size_t q = 0; q < s; q += vec_size) {
+                vec_type x[R];
+
+                for (std::size_t k = 0; k < R; ++k) {
+                    x[k] = V::loadu(src + q + k * ms);
+                }
+
+                fft_butterfly<R>::template apply<V>(x, c);
+
+                V::storeu(dst + q, x[0]);
+
+                for (std::size_t k = 1; k < R; ++k) {
+                    V::storeu(dst + q + k * s, V::template mul<true>(x[k], w[k]));
+                }
+            }
+        }
+    } else {
+        // Each vector holds the elements of vec_size / s butterflies, they
+        // are written back through a buffer
+        etl::complex<T> tmp[R * vec_size];
+
+        for (std::size_t i = 0; i < ms; i += vec_size) {
+            vec_type x[R];
+
+            for (std::size_t k = 0; k < R; ++k) {
+                x[k] = V::loadu(in + i + k * ms);
+            }
+
+            fft_butterfly<R>::template apply<V>(x, c);
+
+            V::storeu(tmp, x[0]);
+
+            for (std::size_t k = 1; k < R; ++k) {
+                V::storeu(tmp + k * vec_size, V::template mul<true>(x[k], V::loadu(twiddles + (k - 1) * ms + i)));
+            }
+
+            for (std::size_t b = 0; b < vec_size; b += s) {
+                const std::size_t p = (i + b) / s;
+
+                for (std::size_t k = 0; k < R; ++k) {
+                    for (std::size_t t = 0; t < s; ++t) {
+                        out[s * (R * p + k) + t] = tmp[k * vec_size + b + t];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * \brief A Stockham FFT of a power of two size.
+ *
+ * The transform can be applied to several interleaved signals at once:
+ * with a stride of s0, element j of signal q is at q + s0 * j. The
+ * stride must be a multiple of the vector size.
+ *
+ * \tparam V The vectorization mode
+ * \tparam T The precision
+ */
+template <typename V, typename T>
+struct stockham_fft {
+    using complex_type = etl::complex<T>; ///< The complex type
+
+    static constexpr std::size_t vec_size = V::template traits<complex_type>::size; ///< The number of complex numbers in a vector
+
+    /*!
+     * \brief Prepare the stages of the transform
+     * \param n The size of the transform
+     * \param sign The sign of the exponent of the transform (-1 forward, 1 inverse)
+     * \param s0 The number of interleaved signals
+     */
+    stockham_fft(std::size_t n, T sign, std::size_t s0 = 1) : n(n), s0(s0), sign(sign) {
+        // The transforms that cannot fill a vector in every stage are scalar
+        vectorized = n * s0 >= 8 * vec_size;
+
+        std::size_t remaining = 0;
+        while ((std::size_t(1) << remaining) < n) {
+            ++remaining;
+        }
+
+        std::size_t twiddles_size = 0;
+        std::size_t s             = s0;
+        std::size_t length        = n;
+
+        while (remaining > 0) {
+            std::size_t radix;
+            std::size_t bits;
+
+            // Radix-8 stages are used to make the number of remaining stages
+            // even and to grow the stride faster than a vector
+            if (remaining == 1) {
+                radix = 2;
+                bits  = 1;
+            } else if (remaining % 2 == 1 || (vectorized && s < vec_size && remaining >= 6)) {
+                radix = 8;
+                bits  = 3;
+            } else {
+                radix = 4;
+                bits  = 2;
+            }
+
+            stage st;
+            st.radix    = radix;
+            st.m        = length / radix;
+            st.s        = s;
+            st.expanded = vectorized && s < vec_size;
+            st.offset   = twiddles_size;
+            st.width    = st.expanded ? s : (vectorized ? vec_size : 1);
+
+            twiddles_size += (radix - 1) * st.m * st.width;
+
+            stages.push_back(st);
+
+            length /= radix;
+            s *= radix;
+            remaining -= bits;
+        }
+
+        twiddles = etl::allocate<complex_type>(std::max(twiddles_size, std::size_t(1)));
+
+        for (auto& st : stages) {
+            const double size = double(st.m * st.radix);
+
+            for (std::size_t k = 1; k < st.radix; ++k) {
+                for (std::size_t p = 0; p < st.m; ++p) {
+                    const double theta = double(sign) * 2.0 * M_PI * double(k * p) / size;
+                    const complex_type w(T(std::cos(theta)), T(std::sin(theta)));
+
+                    std::fill_n(twiddles.get() + st.offset + ((k - 1) * st.m + p) * st.width, st.width, w);
+                }
+            }
+        }
+    }
+
+    stockham_fft(const stockham_fft& rhs) = delete;
+    stockham_fft& operator=(const stockham_fft& rhs) = delete;
+
+    /*!
+     * \brief Transform the signals of in and store the result in out
+     * \param in The input signals
+     * \param out The output signals, may alias the input
+     * \param tmp A buffer of n * s0 complex numbers
+     */
+    void execute(const complex_type* in, complex_type* out, complex_type* tmp) const {
+        const std::size_t total = n * s0;
+
+        if (stages.empty()) {
+            if (in != out) {
+                std::copy_n(in, total, out);
+            }
+
+            return;
+        }
+
+        // The stages alternate between out and tmp, the last one writes out
+        const std::size_t S = stages.size();
+
+        if (S % 2 == 1 && in == out) {
+            std::copy_n(in, total, tmp);
+            in = tmp;
+        }
+
+        if (vectorized) {
+            run_stages<V>(in, out, tmp);
+        } else {
+            run_stages<scalar_fft_vec>(in, out, tmp);
+        }
+    }
+
+private:
+    /*!
+     * \brief Run all the stages with the given operations
+     */
+    template <typename VV>
+    void run_stages(const complex_type* in, complex_type* out, complex_type* tmp) const {
+        const fft_constants<VV, T> c(sign);
+
+        const std::size_t S = stages.size();
+
+        const complex_type* src = in;
+
+        for (std::size_t i = 0; i < S; ++i) {
+            auto& st = stages[i];
+
+            complex_type* dst = (S - 1 - i) % 2 == 0 ? out : tmp;
+
+            const complex_type* tw = twiddles.get() + st.offset;
+
+            if (st.radix == 4) {
+                stockham_stage<4, VV>(src, dst, st.m, st.s, tw, st.expanded, c);
+            } else if (st.radix == 8) {
+                stockham_stage<8, VV>(src, dst, st.m, st.s, tw, st.expanded, c);
+            } else {
+                stockham_stage<2, VV>(src, dst, st.m, st.s, tw, st.expanded, c);
+            }
+
+            src = dst;
+        }
+    }
+
+    /*!
+     * \brief A stage of the transform
+     */
+    struct stage {
+        std::size_t radix;  ///< The radix of the stage
+        std::size_t m;      ///< The number of butterflies
+        std::size_t s;      ///< The stride of the stage
+        bool expanded;      ///< Indicates if the twiddle factors are stored for each element
+        std::size_t width;  ///< The number of copies of each twiddle factor
+        std::size_t offset; ///< The offset of the twiddle factors of the stage
+    };
+
+    std::size_t n;                              ///< The size of the transform
+    std::size_t s0;                             ///< The number of interleaved signals
+    T sign;                                     ///< The sign of the exponent of the transform
+    bool vectorized;                            ///< Indicates if the stages are vectorized
+    std::vector<stage> stages;                  ///< The stages of the transform
+    std::unique_ptr<complex_type[]> twiddles;   ///< The twiddle factors of all the stages
+};
+
+/*!
+ * \brief A FFT of a power of two size.
+ *
+ * The transforms smaller than the threshold are computed with a single
+ * Stockham FFT. The larger ones are computed with the four-step algorithm
+ * so that the transforms of the rows fit in cache.
+ *
+ * \tparam V The vectorization mode
+ * \tparam T The precision
+ */
+template <typename V, typename T>
+struct pow2_fft {
+    using complex_type = etl::complex<T>; ///< The complex type
+
+    static constexpr std::size_t vec_size = V::template traits<complex_type>::size; ///< The number of complex numbers in a vector
+
+    /*!
+     * \brief Prepare the transform
+     * \param n The size of the transform
+     * \param sign The sign of the exponent of the transform (-1 forward, 1 inverse)
+     * \param threshold The minimum size for the four-step algorithm
+     */
+    pow2_fft(std::size_t n, T sign, std::size_t threshold = fft_four_step_threshold) : n(n) {
+        // The rows must hold at least one vector
+        if (n >= std::max(threshold, 4 * vec_size * vec_size)) {
+            std::size_t bits = 0;
+            while ((std::size_t(1) << bits) < n) {
+                ++bits;
+            }
+
+            n2 = std::size_t(1) << ((bits + 1) / 2);
+            n1 = n / n2;
+
+            rows = std::make_unique<stockham_fft<V, T>>(n2, sign);
+            cols = std::make_unique<stockham_fft<V, T>>(n1, sign, n2);
+
+            twiddles = etl::allocate<complex_type>(n);
+
+            for (std::size_t k1 = 0; k1 < n1; ++k1) {
+                for (std::size_t j2 = 0; j2 < n2; ++j2) {
+                    const double theta = double(sign) * 2.0 * M_PI * double(k1 * j2) / double(n);
+
+                    twiddles[k1 * n2 + j2] = complex_type(T(std::cos(theta)), T(std::sin(theta)));
+                }
+            }
+        } else {
+            n1   = 1;
+            n2   = n;
+            rows = std::make_unique<stockham_fft<V, T>>(n, sign);
+        }
+    }
+
+    /*!
+     * \brief Returns the number of complex numbers needed in the buffer of execute
+     */
+    std::size_t work_size() const noexcept {
+        return cols ? 2 * n + n2 : n;
+    }
+
+    /*!
+     * \brief Transform the n elements of in and store the result in out
+     * \param in The input signal
+     * \param out The output signal, may alias the input
+     * \param tmp A buffer of work_size() complex numbers
+     */
+    void execute(const complex_type* in, complex_type* out, complex_type* tmp) const {
+        if (cols) {
+            four_step(in, out, tmp);
+        } else {
+            rows->execute(in, out, tmp);
+        }
+    }
+
+private:
+    /*!
+     * \brief Compute the transform with the four-step algorithm. The
+     * input is seen as a n1 x n2 matrix and the output as a n2 x n1
+     * matrix.
+     */
+    void four_step(const complex_type* in, complex_type* out, complex_type* tmp) const {
+        static constexpr std::size_t rows_block = 16;
+
+        complex_type* matrix = tmp;
+        complex_type* buffer = tmp + n;
+        complex_type* row    = tmp + 2 * n;
+
+        // 1. Transform the columns, all the columns are interleaved in the
+        // stages of the transform
+
+        cols->execute(in, matrix, buffer);
+
+        // 2. Apply the twiddle factors, transform the rows and write them
+        // transposed, by blocks of rows to write contiguous elements
+
+        for (std::size_t r = 0; r < n1; r += rows_block) {
+            const std::size_t r_end = std::min(r + rows_block, n1);
+
+            for (std::size_t k1 = r; k1 < r_end; ++k1) {
+                complex_type* x        = matrix + k1 * n2;
+                const complex_type* tw = twiddles.get() + k1 * n2;
+
+                for (std::size_t j2 = 0; j2 < n2; j2 += vec_size) {
+                    V::storeu(x + j2, V::template mul<true>(V::loadu(x + j2), V::loadu(tw + j2)));
+                }
+
+                rows->execute(x, x, row);
+            }
+
+            for (std::size_t k2 = 0; k2 < n2; ++k2) {
+                for (std::size_t k1 = r; k1 < r_end; ++k1) {
+                    out[k2 * n1 + k1] = matrix[k1 * n2 + k2];
+                }
+            }
+        }
+    }
+
+    std::size_t n;                              ///< The size of the transform
+    std::size_t n1;                             ///< The number of rows of the four-step algorithm
+    std::size_t n2;                             ///< The number of columns of the four-step algorithm
+    std::unique_ptr<stockham_fft<V, T>> rows;   ///< The transform of the rows (or of the complete signal)
+    std::unique_ptr<stockham_fft<V, T>> cols;   ///< The transform of the blocks of columns
+    std::unique_ptr<complex_type[]> twiddles;   ///< The twiddle factors of the four-step algorithm
+};
+
+/*!
+ * \brief Multiply the n elements of a by the elements of b and store the result in c
+ * \param a The first input
+ * \param b The second input
+ * \param c The output, may alias a
+ * \param n The number of elements
+ */
+template <typename V, typename T>
+void fft_multiply(const etl::complex<T>* a, const etl::complex<T>* b, etl::complex<T>* c, std::size_t n) {
+    static constexpr std::size_t vec_size = V::template traits<etl::complex<T>>::size;
+
+    std::size_t i = 0;
+
+    for (; i + vec_size <= n; i += vec_size) {
+        V::storeu(c + i, V::template mul<true>(V::loadu(a + i), V::loadu(b + i)));
+    }
+
+    for (; i < n; ++i) {
+        c[i] = a[i] * b[i];
+    }
+}
+
+/*!
+ * \brief Multiply the n elements of a by the elements of b and store the
+ * result in c, with the default vectorization mode
+ * \param a The first input
+ * \param b The second input
+ * \param c The output, may alias a
+ * \param n The number of elements
+ */
+template <typename T>
+void fft_multiply_kernel(const etl::complex<T>* a, const etl::complex<T>* b, etl::complex<T>* c, std::size_t n) {
+    fft_multiply<default_vec>(a, b, c, n);
+}
+
+/*!
+ * \brief A FFT of any size, computed with the algorithm of Bluestein.
+ *
+ * With 2jk = j^2 + k^2 - (k - j)^2, the transform is the convolution of
+ * the signal multiplied by the chirp w_j = e^(sign * i * pi * j^2 / n)
+ * with the conjugate of the chirp, multiplied again by the chirp. The
+ * convolution is computed with power of two transforms of at least 2n - 1
+ * elements. The transform of the conjugate chirp is precomputed.
+ *
+ * \tparam V The vectorization mode
+ * \tparam T The precision
+ */
+template <typename V, typename T>
+struct bluestein_fft {
+    using complex_type = etl::complex<T>; ///< The complex type
+
+    /*!
+     * \brief Prepare the transform
+     * \param n The size of the transform
+     * \param sign The sign of the exponent of the transform (-1 forward, 1 inverse)
+     */
+    bluestein_fft(std::size_t n, T sign) : n(n) {
+        m = 1;
+        while (m < 2 * n - 1) {
+            m *= 2;
+        }
+
+        forward = std::make_unique<pow2_fft<V, T>>(m, T(-1));
+        inverse = std::make_unique<pow2_fft<V, T>>(m, T(1));
+
+        // j^2 is reduced modulo 2n to keep the angles precise
+        chirp = etl::allocate<complex_type>(n);
+
+        for (std::size_t j = 0; j < n; ++j) {
+            const double theta = double(sign) * M_PI * double((j * j) % (2 * n)) / double(n);
+
+            chirp[j] = complex_type(T(std::cos(theta)), T(std::sin(theta)));
+        }
+
+        // The transform of the conjugate chirp, wrapped around, and
+        // normalized for the inverse transform of the convolution
+        kernel = etl::allocate<complex_type>(m);
+
+        std::fill_n(kernel.get(), m, complex_type(T(0), T(0)));
+
+        for (std::size_t j = 0; j < n; ++j) {
+            kernel[j] = complex_type(chirp[j].real / T(m), -chirp[j].imag / T(m));
+
+            if (j > 0) {
+                kernel[m - j] = kernel[j];
+            }
+        }
+
+        auto tmp = etl::allocate<complex_type>(forward->work_size());
+        forward->execute(kernel.get(), kernel.get(), tmp.get());
+    }
+
+    /*!
+     * \brief Returns the number of complex numbers needed in the buffer of execute
+     */
+    std::size_t work_size() const noexcept {
+        return m + std::max(forward->work_size(), inverse->work_size());
+    }
+
+    /*!
+     * \brief Transform the n elements of in and store the result in out
+     * \param in The input signal
+     * \param out The output signal, may alias the input
+     * \param tmp A buffer of work_size() complex numbers
+     */
+    void execute(const complex_type* in, complex_type* out, complex_type* tmp) const {
+        complex_type* a    = tmp;
+        complex_type* work = tmp + m;
+
+        fft_multiply<V>(in, chirp.get(), a, n);
+        std::fill(a + n, a + m, complex_type(T(0), T(0)));
+
+        forward->execute(a, a, work);
+        fft_multiply<V>(a, kernel.get(), a, m);
+        inverse->execute(a, a, work);
+
+        fft_multiply<V>(a, chirp.get(), out, n);
+    }
+
+private:
+    std::size_t n;                              ///< The size of the transform
+    std::size_t m;                              ///< The size of the convolution
+    std::unique_ptr<pow2_fft<V, T>> forward;    ///< The forward transform of the convolution
+    std::unique_ptr<pow2_fft<V, T>> inverse;    ///< The inverse transform of the convolution
+    std::unique_ptr<complex_type[]> chirp;      ///< The chirp
+    std::unique_ptr<complex_type[]> kernel;     ///< The transform of the conjugate chirp
+};
@@ -8,6 +8,9 @@
 // The idea of the kernel is largely inspired by the kernels in Blaze
 // by Klaus Igleberg
 
+#include "etl/impl/common/gemm.hpp"
+#include "etl/impl/isa/view.hpp"
+
 namespace etl {
 
 namespace impl {
@@ -15,375 +18,35 @@ namespace impl {
 namespace vec {
 
 /*!
- * \brief Optimized version of small GEMV for row major version
- * \param a The lhs matrix
- * \param b The rhs vector
- * \param c The result vector
+ * \brief Traits indicating if the GEMV can be computed as a GEVM on the
+ * transpose of the column major matrix.
  */
-template <typename V, typename A, typename B, typename C, cpp_enable_if((all_row_major<A, B, C>::value))>
-void gemv_small_kernel(const A& a, const B& b, C& c) {
-    using vec_type = V;
-    using T        = value_t<A>;
-
-    static constexpr size_t vec_size = vec_type::template traits<T>::size;
-    static constexpr bool Cx         = is_complex_t<T>::value;
-
-    const auto m = rows(a);
-    const auto n = columns(a);
-
-    static constexpr bool remainder = !advanced_padding || !all_padded<A, B>::value;
-    const size_t last = remainder ? (n & size_t(-vec_size)) : n;
-
-    size_t i = 0;
-
-    // 8-Unrolled outer loop
-    for (; i + 7 < m; i += 8) {
-        auto r1 = vec_type::template zero<T>();
-        auto r2 = vec_type::template zero<T>();
-        auto r3 = vec_type::template zero<T>();
-        auto r4 = vec_type::template zero<T>();
-        auto r5 = vec_type::template zero<T>();
-        auto r6 = vec_type::template zero<T>();
-        auto r7 = vec_type::template zero<T>();
-        auto r8 = vec_type::template zero<T>();
-
-        size_t k = 0;
-
-        // Vectorized inner loop
-        for (; k < last; k += vec_size) {
-            auto b1 = b.template load<vec_type>(k);
-
-            auto a1 = a.template loadu<vec_type>((i + 0) * n + k);
-            auto a2 = a.template loadu<vec_type>((i + 1) * n + k);
-            auto a3 = a.template loadu<vec_type>((i + 2) * n + k);
-            auto a4 = a.template loadu<vec_type>((i + 3) * n + k);
-            auto a5 = a.template loadu<vec_type>((i + 4) * n + k);
-            auto a6 = a.template loadu<vec_type>((i + 5) * n + k);
-            auto a7 = a.template loadu<vec_type>((i + 6) * n + k);
-            auto a8 = a.template loadu<vec_type>((i + 7) * n + k);
-
-            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-            r2 = vec_type::template fmadd<Cx>(a2, b1, r2);
-            r3 = vec_type::template fmadd<Cx>(a3, b1, r3);
-            r4 = vec_type::template fmadd<Cx>(a4, b1, r4);
-            r5 = vec_type::template fmadd<Cx>(a5, b1, r5);
-            r6 = vec_type::template fmadd<Cx>(a6, b1, r6);
-            r7 = vec_type::template fmadd<Cx>(a7, b1, r7);
-            r8 = vec_type::template fmadd<Cx>(a8, b1, r8);
-        }
-
-        c[i + 0] = vec_type::template hadd<T>(r1);
-        c[i + 1] = vec_type::template hadd<T>(r2);
-        c[i + 2] = vec_type::template hadd<T>(r3);
-        c[i + 3] = vec_type::template hadd<T>(r4);
-        c[i + 4] = vec_type::template hadd<T>(r5);
-        c[i + 5] = vec_type::template hadd<T>(r6);
-        c[i + 6] = vec_type::template hadd<T>(r7);
-        c[i + 7] = vec_type::template hadd<T>(r8);
-
-        // Remainder inner loop
-        for (; remainder && k < n; ++k) {
-            c[i + 0] += a(i + 0, k) * b(k);
-            c[i + 1] += a(i + 1, k) * b(k);
-            c[i + 2] += a(i + 2, k) * b(k);
-            c[i + 3] += a(i + 3, k) * b(k);
-            c[i + 4] += a(i + 4, k) * b(k);
-            c[i + 5] += a(i + 5, k) * b(k);
-            c[i + 6] += a(i + 6, k) * b(k);
-            c[i + 7] += a(i + 7, k) * b(k);
-        }
-    }
-
-    // 2-Unrolled outer loop
-    for (; i + 1 < m; i += 2) {
-        auto r1 = vec_type::template zero<T>();
-        auto r2 = vec_type::template zero<T>();
-
-        size_t k = 0;
-
-        // Vectorized inner loop
-        for (; k < last; k += vec_size) {
-            auto b1 = b.template load<vec_type>(k);
-
-            auto a1 = a.template loadu<vec_type>((i + 0) * n + k);
-            auto a2 = a.template loadu<vec_type>((i + 1) * n + k);
-
-            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-            r2 = vec_type::template fmadd<Cx>(a2, b1, r2);
-        }
-
-        c[i + 0] = vec_type::template hadd<T>(r1);
-        c[i + 1] = vec_type::template hadd<T>(r2);
-
-        // Remainder inner loop
-        for (; remainder && k < n; ++k) {
-            c[i + 0] += a(i + 0, k) * b(k);
-            c[i + 1] += a(i + 1, k) * b(k);
-        }
-    }
-
-    // Remainder loop
-    if (i < m) {
-        auto r1 = vec_type::template zero<T>();
-
-        size_t k = 0;
-
-        // Vectorized inner loop
-        for (; k < last; k += vec_size) {
-            auto a1 = a.template loadu<vec_type>(i * n + k);
-            auto b1 = b.template load<vec_type>(k);
-            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-        }
-
-        auto result = vec_type::template hadd<T>(r1);
-
-        // Remainder inner loop
-        for (; remainder && k < n; ++k) {
-            result += a(i, k) * b(k);
-        }
-
-        c[i] = result;
-    }
-}
+template <typename A, typename B, typename C>
+using is_gemv_transpose = cpp::and_u<all_dma<A>::value, !all_row_major<A>::value, all_row_major<B, C>::value>;
 
 /*!
- * \brief Optimized version of large GEMV for row major version
- * \param a The lhs matrix
- * \param b The rhs vector
- * \param c The result vector
+ * \brief Traits indicating if the GEVM can be computed as a GEMV on the
+ * transpose of the column major matrix.
  */
-template <typename V, typename A, typename B, typename C, cpp_enable_if((all_row_major<A, B, C>::value))>
-void gemv_large_kernel(const A& a, const B& b, C& c) {
-    using vec_type = V;
-    using T        = value_t<A>;
-
-    static constexpr size_t vec_size = vec_type::template traits<T>::size;
-    static constexpr bool Cx         = is_complex_t<T>::value;
-
-    const auto m = rows(a);
-    const auto n = columns(a);
-
-    static constexpr bool remainder = !advanced_padding || !all_padded<A, B>::value;
-    const size_t last = remainder ? (n & size_t(-vec_size)) : n;
-
-    size_t i = 0;
-
-    // 8-Unrolled outer loop
-    for (; i + 7 < m; i += 8) {
-        auto r1 = vec_type::template zero<T>();
-        auto r2 = vec_type::template zero<T>();
-        auto r3 = vec_type::template zero<T>();
-        auto r4 = vec_type::template zero<T>();
-        auto r5 = vec_type::template zero<T>();
-        auto r6 = vec_type::template zero<T>();
-        auto r7 = vec_type::template zero<T>();
-        auto r8 = vec_type::template zero<T>();
-
-        size_t k = 0;
-
-        // 4-Unrolled Vectorized inner loop
-        for (; k + (vec_size * 3) < last; k += vec_size * 4) {
-            const auto k1 = k + 0 * vec_size;
-            const auto k2 = k + 1 * vec_size;
-            const auto k3 = k + 2 * vec_size;
-            const auto k4 = k + 3 * vec_size;
-
-            auto b1 = b.template load<vec_type>(k1);
-            auto b2 = b.template load<vec_type>(k2);
-            auto b3 = b.template load<vec_type>(k3);
-            auto b4 = b.template load<vec_type>(k4);
-
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k1), b1, r1);
-            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k1), b1, r2);
-            r3 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 2) * n + k1), b1, r3);
-            r4 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 3) * n + k1), b1, r4);
-            r5 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 4) * n + k1), b1, r5);
-            r6 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 5) * n + k1), b1, r6);
-            r7 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 6) * n + k1), b1, r7);
-            r8 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 7) * n + k1), b1, r8);
-
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k2), b2, r1);
-            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k2), b2, r2);
-            r3 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 2) * n + k2), b2, r3);
-            r4 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 3) * n + k2), b2, r4);
-            r5 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 4) * n + k2), b2, r5);
-            r6 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 5) * n + k2), b2, r6);
-            r7 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 6) * n + k2), b2, r7);
-            r8 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 7) * n + k2), b2, r8);
-
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k3), b3, r1);
-            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k3), b3, r2);
-            r3 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 2) * n + k3), b3, r3);
-            r4 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 3) * n + k3), b3, r4);
-            r5 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 4) * n + k3), b3, r5);
-            r6 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 5) * n + k3), b3, r6);
-            r7 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 6) * n + k3), b3, r7);
-            r8 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 7) * n + k3), b3, r8);
-
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k4), b4, r1);
-            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k4), b4, r2);
-            r3 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 2) * n + k4), b4, r3);
-            r4 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 3) * n + k4), b4, r4);
-            r5 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 4) * n + k4), b4, r5);
-            r6 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 5) * n + k4), b4, r6);
-            r7 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 6) * n + k4), b4, r7);
-            r8 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 7) * n + k4), b4, r8);
-        }
-
-        // 2-Unrolled Vectorized inner loop
-        for (; k + (vec_size) < last; k += vec_size * 2) {
-            const auto k1 = k + 0 * vec_size;
-            const auto k2 = k + 1 * vec_size;
-
-            auto b1 = b.template load<vec_type>(k1);
-            auto b2 = b.template load<vec_type>(k2);
-
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k1), b1, r1);
-            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k1), b1, r2);
-            r3 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 2) * n + k1), b1, r3);
-            r4 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 3) * n + k1), b1, r4);
-            r5 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 4) * n + k1), b1, r5);
-            r6 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 5) * n + k1), b1, r6);
-            r7 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 6) * n + k1), b1, r7);
-            r8 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 7) * n + k1), b1, r8);
-
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k2), b2, r1);
-            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k2), b2, r2);
-            r3 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 2) * n + k2), b2, r3);
-            r4 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 3) * n + k2), b2, r4);
-            r5 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 4) * n + k2), b2, r5);
-            r6 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 5) * n + k2), b2, r6);
-            r7 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 6) * n + k2), b2, r7);
-            r8 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 7) * n + k2), b2, r8);
-        }
-
-        // Vectorized inner loop
-        if (k < last) {
-            auto b1 = b.template load<vec_type>(k);
-
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k), b1, r1);
-            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k), b1, r2);
-            r3 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 2) * n + k), b1, r3);
-            r4 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 3) * n + k), b1, r4);
-            r5 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 4) * n + k), b1, r5);
-            r6 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 5) * n + k), b1, r6);
-            r7 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 6) * n + k), b1, r7);
-            r8 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 7) * n + k), b1, r8);
-
-            k += vec_size;
-        }
-
-        c[i + 0] = vec_type::template hadd<T>(r1);
-        c[i + 1] = vec_type::template hadd<T>(r2);
-        c[i + 2] = vec_type::template hadd<T>(r3);
-        c[i + 3] = vec_type::template hadd<T>(r4);
-        c[i + 4] = vec_type::template hadd<T>(r5);
-        c[i + 5] = vec_type::template hadd<T>(r6);
-        c[i + 6] = vec_type::template hadd<T>(r7);
-        c[i + 7] = vec_type::template hadd<T>(r8);
-
-        // Remainder inner loop
-        for (; remainder && k < n; ++k) {
-            c[i + 0] += a(i + 0, k) * b(k);
-            c[i + 1] += a(i + 1, k) * b(k);
-            c[i + 2] += a(i + 2, k) * b(k);
-            c[i + 3] += a(i + 3, k) * b(k);
-            c[i + 4] += a(i + 4, k) * b(k);
-            c[i + 5] += a(i + 5, k) * b(k);
-            c[i + 6] += a(i + 6, k) * b(k);
-            c[i + 7] += a(i + 7, k) * b(k);
-        }
-    }
-
-    // 2-Unrolled outer loop
-    for (; i + 1 < m; i += 2) {
-        auto r1 = vec_type::template zero<T>();
-        auto r2 = vec_type::template zero<T>();
-
-        size_t k = 0;
-
-        // 4-Unrolled Vectorized inner loop
-        for (; k + (vec_size * 3) < last; k += vec_size * 4) {
-            const auto k1 = k + 0 * vec_size;
-            const auto k2 = k + 1 * vec_size;
-            const auto k3 = k + 2 * vec_size;
-            const auto k4 = k + 3 * vec_size;
-
-            auto b1 = b.template load<vec_type>(k1);
-            auto b2 = b.template load<vec_type>(k2);
-            auto b3 = b.template load<vec_type>(k3);
-            auto b4 = b.template load<vec_type>(k4);
-
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k1), b1, r1);
-            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k1), b1, r2);
-
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k2), b2, r1);
-            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k2), b2, r2);
-
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k3), b3, r1);
-            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k3), b3, r2);
-
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k4), b4, r1);
-            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k4), b4, r2);
-        }
-
-        // 2-Unrolled Vectorized inner loop
-        for (; k + vec_size < last; k += vec_size * 2) {
-            const auto k1 = k + 0 * vec_size;
-            const auto k2 = k + 1 * vec_size;
-
-            auto b1 = b.template load<vec_type>(k1);
-            auto b2 = b.template load<vec_type>(k2);
-
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k1), b1, r1);
-            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k1), b1, r2);
-
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k2), b2, r1);
-            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k2), b2, r2);
-        }
+template <typename A, typename B, typename C>
+using is_gevm_transpose = cpp::and_u<all_dma<B>::value, !all_row_major<B>::value, all_row_major<A, C>::value>;
 
-        // Vectorized inner loop
-        if (k < last) {
-            auto b1 = b.template load<vec_type>(k);
+#include "etl/impl/vec/gemm_kernels.hpp"
 
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k), b1, r1);
-            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k), b1, r2);
-
-            k += vec_size;
-        }
-
-        c[i + 0] = vec_type::template hadd<T>(r1);
-        c[i + 1] = vec_type::template hadd<T>(r2);
-
-        // Remainder inner loop
-        for (; remainder && k < n; ++k) {
-            c[i + 0] += a(i + 0, k) * b(k);
-            c[i + 1] += a(i + 1, k) * b(k);
-        }
-    }
+} //end of namespace vec
 
-    // Remainder loop
-    if (i < m) {
-        auto r1 = vec_type::template zero<T>();
+} //end of namespace impl
 
-        size_t k = 0;
+} //end of namespace etl
 
-        // Vectorized inner loop
-        for (; k < last; k += vec_size) {
-            auto b1 = b.template load<vec_type>(k);
-            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k), b1, r1);
-        }
+#define ETL_ISA_KERNELS "etl/impl/vec/gemm_kernels.hpp"
+#include "etl/impl/isa/instantiate.hpp"
 
-        auto result = vec_type::template hadd<T>(r1);
+namespace etl {
 
-        // Remainder inner loop
-        for (; remainder && k < n; ++k) {
-            result += a(i, k) * b(k);
-        }
+namespace impl {
 
-        c[i] = result;
-    }
-}
+namespace vec {
 
 /*!
  * \brief Optimized version of GEMV for row major version
@@ -395,10 +58,8 @@ template <typename A, typename B, typename C, cpp_enable_if((all_row_major<A, B,
 void gemv(A&& a, B&& b, C&& c) {
     cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
-    if (etl::size(a) < gemv_small_threshold) {
-        gemv_small_kernel<default_vec>(a, b, c);
-    } else {
-        gemv_large_kernel<default_vec>(a, b, c);
+    if (!ETL_ISA_VEC_CALL(gemv_kernel(isa::view(a), isa::view(b), isa::view(c)))) {
+        gemv_kernel(a, b, c);
     }
 }
 
@@ -408,7 +69,7 @@ void gemv(A&& a, B&& b, C&& c) {
  * \param b The rhs vector
  * \param c The result vector
  */
-template <typename A, typename B, typename C, cpp_disable_if((all_row_major<A, B, C>::value))>
+template <typename A, typename B, typename C, cpp_enable_if(!all_row_major<A, B, C>::value, !is_gemv_transpose<A, B, C>::value)>
 void gemv(A&& a, B&& b, C&& c) {
     cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
@@ -425,838 +86,131 @@ void gemv(A&& a, B&& b, C&& c) {
 }
 
 /*!
- * \brief Optimized version of small GEVM for row major version
+ * \brief Optimized version of GEVM for row major version
  * \param a The lhs vector
  * \param b The rhs matrix
  * \param c The result vector
  */
-template <typename V, typename A, typename B, typename C, cpp_enable_if((all_row_major<A, B, C>::value))>
-void gevm_small_kernel(const A& a, const B& b, C& c) {
-    using vec_type = V;
-    using T        = value_t<A>;
-
-    static constexpr size_t vec_size = vec_type::template traits<T>::size;
-    static constexpr bool Cx         = is_complex_t<T>::value;
-
-    const auto m = rows(b);
-    const auto n = columns(b);
-
-    size_t j = 0;
-
-    for (; j + vec_size * 8 - 1 < n; j += vec_size * 8) {
-        auto r1 = vec_type::template zero<T>();
-        auto r2 = vec_type::template zero<T>();
-        auto r3 = vec_type::template zero<T>();
-        auto r4 = vec_type::template zero<T>();
-        auto r5 = vec_type::template zero<T>();
-        auto r6 = vec_type::template zero<T>();
-        auto r7 = vec_type::template zero<T>();
-        auto r8 = vec_type::template zero<T>();
-
-        for (size_t k = 0; k < m; k++) {
-            auto a1 = vec_type::set(a[k]);
-
-            auto b1 = b.template loadu<vec_type>(k * n + j + 0 * vec_size);
-            auto b2 = b.template loadu<vec_type>(k * n + j + 1 * vec_size);
-            auto b3 = b.template loadu<vec_type>(k * n + j + 2 * vec_size);
-            auto b4 = b.template loadu<vec_type>(k * n + j + 3 * vec_size);
-            auto b5 = b.template loadu<vec_type>(k * n + j + 4 * vec_size);
-            auto b6 = b.template loadu<vec_type>(k * n + j + 5 * vec_size);
-            auto b7 = b.template loadu<vec_type>(k * n + j + 6 * vec_size);
-            auto b8 = b.template loadu<vec_type>(k * n + j + 7 * vec_size);
-
-            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-            r2 = vec_type::template fmadd<Cx>(a1, b2, r2);
-            r3 = vec_type::template fmadd<Cx>(a1, b3, r3);
-            r4 = vec_type::template fmadd<Cx>(a1, b4, r4);
-            r5 = vec_type::template fmadd<Cx>(a1, b5, r5);
-            r6 = vec_type::template fmadd<Cx>(a1, b6, r6);
-            r7 = vec_type::template fmadd<Cx>(a1, b7, r7);
-            r8 = vec_type::template fmadd<Cx>(a1, b8, r8);
-        }
-
-        c.template storeu<vec_type>(r1, j + 0 * vec_size);
-        c.template storeu<vec_type>(r2, j + 1 * vec_size);
-        c.template storeu<vec_type>(r3, j + 2 * vec_size);
-        c.template storeu<vec_type>(r4, j + 3 * vec_size);
-        c.template storeu<vec_type>(r5, j + 4 * vec_size);
-        c.template storeu<vec_type>(r6, j + 5 * vec_size);
-        c.template storeu<vec_type>(r7, j + 6 * vec_size);
-        c.template storeu<vec_type>(r8, j + 7 * vec_size);
-    }
-
-    for (; j + vec_size * 4 - 1 < n; j += vec_size * 4) {
-        auto r1 = vec_type::template zero<T>();
-        auto r2 = vec_type::template zero<T>();
-        auto r3 = vec_type::template zero<T>();
-        auto r4 = vec_type::template zero<T>();
-
-        for (size_t k = 0; k < m; k++) {
-            auto a1 = vec_type::set(a[k]);
-
-            auto b1 = b.template loadu<vec_type>(k * n + j + 0 * vec_size);
-            auto b2 = b.template loadu<vec_type>(k * n + j + 1 * vec_size);
-            auto b3 = b.template loadu<vec_type>(k * n + j + 2 * vec_size);
-            auto b4 = b.template loadu<vec_type>(k * n + j + 3 * vec_size);
-
-            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-            r2 = vec_type::template fmadd<Cx>(a1, b2, r2);
-            r3 = vec_type::template fmadd<Cx>(a1, b3, r3);
-            r4 = vec_type::template fmadd<Cx>(a1, b4, r4);
-        }
-
-        c.template storeu<vec_type>(r1, j + 0 * vec_size);
-        c.template storeu<vec_type>(r2, j + 1 * vec_size);
-        c.template storeu<vec_type>(r3, j + 2 * vec_size);
-        c.template storeu<vec_type>(r4, j + 3 * vec_size);
-    }
-
-    for (; j + vec_size - 1 < n; j += vec_size) {
-        auto r1 = vec_type::template zero<T>();
-
-        for (size_t k = 0; k < m; k++) {
-            auto a1 = vec_type::set(a[k]);
-
-            auto b1 = b.template loadu<vec_type>(k * n + j);
-
-            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-        }
-
-        c.template storeu<vec_type>(r1, j);
-    }
-
-    for (; j < n; j++) {
-        auto value = T();
-
-        for (size_t k = 0; k < m; k++) {
-            value += a(k) * b(k, j);
-        }
+template <typename A, typename B, typename C, cpp_enable_if((all_row_major<A, B, C>::value))>
+void gevm(A&& a, B&& b, C&& c) {
+    cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
-        c[j] = value;
+    if (!ETL_ISA_VEC_CALL(gevm_kernel(isa::view(a), isa::view(b), isa::view(c)))) {
+        gevm_kernel(a, b, c);
     }
 }
 
 /*!
- * \brief Optimized version of large GEVM for row major version
+ * \brief Unoptimized version of GEVM for column major version
  * \param a The lhs vector
  * \param b The rhs matrix
  * \param c The result vector
  */
-template <typename V, typename A, typename B, typename C, cpp_enable_if((all_row_major<A, B, C>::value))>
-void gevm_large_kernel(const A& a, const B& b, C& c) {
-    using vec_type = V;
-    using T        = value_t<A>;
-
-    static constexpr size_t vec_size = vec_type::template traits<T>::size;
-    static constexpr bool Cx         = is_complex_t<T>::value;
-
-    const auto m = rows(b);
-    const auto n = columns(b);
-
-    const size_t n_block = (32 * 1024) / sizeof(T);
-    const size_t m_block = n < n_block ? 8 : 4;
+template <typename A, typename B, typename C, cpp_enable_if(!all_row_major<A, B, C>::value, !is_gevm_transpose<A, B, C>::value)>
+void gevm(A&& a, B&& b, C&& c) {
+    cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
     c = 0;
 
-    for (size_t block_j = 0; block_j < n; block_j += n_block) {
-        for (size_t block_k = 0; block_k < m; block_k += m_block) {
-            const size_t m_end = std::min(block_k + m_block, m);
-            const size_t n_end = std::min(block_j + n_block, n) & size_t(-vec_size);
-
-            size_t j = block_j;
-
-            // 8-Unrolled Vectorized loop
-            for (; j + vec_size * 8 - 1 < n_end; j += vec_size * 8) {
-                auto r1 = vec_type::template zero<T>();
-                auto r2 = vec_type::template zero<T>();
-                auto r3 = vec_type::template zero<T>();
-                auto r4 = vec_type::template zero<T>();
-                auto r5 = vec_type::template zero<T>();
-                auto r6 = vec_type::template zero<T>();
-                auto r7 = vec_type::template zero<T>();
-                auto r8 = vec_type::template zero<T>();
-
-                for (size_t k = block_k; k < m_end; ++k) {
-                    auto a1 = vec_type::set(a[k]);
-
-                    auto b1 = b.template loadu<vec_type>(k * n + j + 0 * vec_size);
-                    auto b2 = b.template loadu<vec_type>(k * n + j + 1 * vec_size);
-                    auto b3 = b.template loadu<vec_type>(k * n + j + 2 * vec_size);
-                    auto b4 = b.template loadu<vec_type>(k * n + j + 3 * vec_size);
-                    auto b5 = b.template loadu<vec_type>(k * n + j + 4 * vec_size);
-                    auto b6 = b.template loadu<vec_type>(k * n + j + 5 * vec_size);
-                    auto b7 = b.template loadu<vec_type>(k * n + j + 6 * vec_size);
-                    auto b8 = b.template loadu<vec_type>(k * n + j + 7 * vec_size);
-
-                    r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-                    r2 = vec_type::template fmadd<Cx>(a1, b2, r2);
-                    r3 = vec_type::template fmadd<Cx>(a1, b3, r3);
-                    r4 = vec_type::template fmadd<Cx>(a1, b4, r4);
-                    r5 = vec_type::template fmadd<Cx>(a1, b5, r5);
-                    r6 = vec_type::template fmadd<Cx>(a1, b6, r6);
-                    r7 = vec_type::template fmadd<Cx>(a1, b7, r7);
-                    r8 = vec_type::template fmadd<Cx>(a1, b8, r8);
-                }
-
-                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 0 * vec_size), r1), j + 0 * vec_size);
-                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 1 * vec_size), r2), j + 1 * vec_size);
-                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 2 * vec_size), r3), j + 2 * vec_size);
-                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 3 * vec_size), r4), j + 3 * vec_size);
-                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 4 * vec_size), r5), j + 4 * vec_size);
-                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 5 * vec_size), r6), j + 5 * vec_size);
-                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 6 * vec_size), r7), j + 6 * vec_size);
-                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 7 * vec_size), r8), j + 7 * vec_size);
-            }
-
-            // 4-Unrolled vectorized loop
-            for (; j + vec_size * 4 - 1 < n_end; j += vec_size * 4) {
-                auto r1 = vec_type::template zero<T>();
-                auto r2 = vec_type::template zero<T>();
-                auto r3 = vec_type::template zero<T>();
-                auto r4 = vec_type::template zero<T>();
-
-                for (size_t k = block_k; k < m_end; ++k) {
-                    auto a1 = vec_type::set(a[k]);
-
-                    auto b1 = b.template loadu<vec_type>(k * n + j + 0 * vec_size);
-                    auto b2 = b.template loadu<vec_type>(k * n + j + 1 * vec_size);
-                    auto b3 = b.template loadu<vec_type>(k * n + j + 2 * vec_size);
-                    auto b4 = b.template loadu<vec_type>(k * n + j + 3 * vec_size);
-
-                    r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-                    r2 = vec_type::template fmadd<Cx>(a1, b2, r2);
-                    r3 = vec_type::template fmadd<Cx>(a1, b3, r3);
-                    r4 = vec_type::template fmadd<Cx>(a1, b4, r4);
-                }
-
-                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 0 * vec_size), r1), j + 0 * vec_size);
-                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 1 * vec_size), r2), j + 1 * vec_size);
-                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 2 * vec_size), r3), j + 2 * vec_size);
-                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 3 * vec_size), r4), j + 3 * vec_size);
-            }
-
-            // Base vectorized loop
-            for (; j + vec_size - 1 < n_end; j += vec_size) {
-                auto r1 = vec_type::template zero<T>();
-
-                for (size_t k = block_k; k < m_end; ++k) {
-                    auto a1 = vec_type::set(a[k]);
-                    auto b1 = b.template loadu<vec_type>(k * n + j + 0 * vec_size);
-                    r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-                }
-
-                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 0 * vec_size), r1), j + 0 * vec_size);
-            }
-
-            // Remainder non-vectorized loop
-            for (; j < n_end; ++j) {
-                auto r1 = T();
-
-                for (size_t k = block_k; k < m_end; ++k) {
-                    r1 += a[k] * b(k, j);
-                }
-
-                c[j] += r1;
-            }
+    for (std::size_t k = 0; k < etl::dim<0>(a); k++) {
+        for (std::size_t j = 0; j < columns(b); j++) {
+            c(j) += a(k) * b(k, j);
         }
     }
 }
 
 /*!
- * \brief Optimized version of GEVM for row major version
- * \param a The lhs vector
- * \param b The rhs matrix
+ * \brief Optimized version of GEMV for column major matrix
+ *
+ * A * b is computed as b * A' on a row major view of the transpose.
+ *
+ * \param a The lhs matrix
+ * \param b The rhs vector
  * \param c The result vector
  */
-template <typename A, typename B, typename C, cpp_enable_if((all_row_major<A, B, C>::value))>
-void gevm(A&& a, B&& b, C&& c) {
-    cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
-
-    if(etl::size(b) < gevm_small_threshold){
-        gevm_small_kernel<default_vec>(a, b, c);
-    } else {
-        gevm_large_kernel<default_vec>(a, b, c);
-    }
+template <typename A, typename B, typename C, cpp_enable_if(is_gemv_transpose<A, B, C>::value)>
+void gemv(A&& a, B&& b, C&& c) {
+    gevm(b, etl::impl::common::transpose_view(a), c);
 }
 
 /*!
- * \brief Unoptimized version of GEVM for column major version
+ * \brief Optimized version of GEVM for column major matrix
+ *
+ * a * B is computed as B' * a on a row major view of the transpose.
+ *
  * \param a The lhs vector
  * \param b The rhs matrix
  * \param c The result vector
  */
-template <typename A, typename B, typename C, cpp_disable_if((all_row_major<A, B, C>::value))>
+template <typename A, typename B, typename C, cpp_enable_if(is_gevm_transpose<A, B, C>::value)>
 void gevm(A&& a, B&& b, C&& c) {
-    cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
-
-    c = 0;
-
-    for (std::size_t k = 0; k < etl::dim<0>(a); k++) {
-        for (std::size_t j = 0; j < columns(b); j++) {
-            c(j) += a(k) * b(k, j);
-        }
-    }
+    gemv(etl::impl::common::transpose_view(b), a, c);
 }
 
 /*!
- * \brief Optimized version of small GEMM for row major version
+ * \brief Optimized version of GEMM for row major result
+ *
+ * The operands can be in any storage order, a column major operand
+ * being handled when it is packed.
+ *
  * \param a The lhs matrix
  * \param b The rhs matrix
  * \param c The result matrix
  */
-template <typename V, typename A, typename B, typename C>
-void gemm_small_kernel(const A& a, const B& b, C& c) {
-    using vec_type = V;
-    using T        = value_t<A>;
-
-    static constexpr size_t vec_size = vec_type::template traits<T>::size;
-    static constexpr bool Cx         = is_complex_t<T>::value;
-
-    const size_t M = etl::rows(a);
-    const size_t N = etl::columns(b);
-    const size_t K = etl::columns(a);
-
-    size_t j = 0;
-
-    for (; j + vec_size * 8 - 1 < N; j += vec_size * 8) {
-        for (size_t i = 0; i < M; ++i) {
-            auto r1 = vec_type::template zero<T>();
-            auto r2 = vec_type::template zero<T>();
-            auto r3 = vec_type::template zero<T>();
-            auto r4 = vec_type::template zero<T>();
-            auto r5 = vec_type::template zero<T>();
-            auto r6 = vec_type::template zero<T>();
-            auto r7 = vec_type::template zero<T>();
-            auto r8 = vec_type::template zero<T>();
-
-            for (size_t k = 0; k < K; ++k) {
-                auto a1 = vec_type::set(a(i, k));
-
-                auto b1 = b.template loadu<vec_type>(k * N + j + vec_size * 0);
-                auto b2 = b.template loadu<vec_type>(k * N + j + vec_size * 1);
-                auto b3 = b.template loadu<vec_type>(k * N + j + vec_size * 2);
-                auto b4 = b.template loadu<vec_type>(k * N + j + vec_size * 3);
-                auto b5 = b.template loadu<vec_type>(k * N + j + vec_size * 4);
-                auto b6 = b.template loadu<vec_type>(k * N + j + vec_size * 5);
-                auto b7 = b.template loadu<vec_type>(k * N + j + vec_size * 6);
-                auto b8 = b.template loadu<vec_type>(k * N + j + vec_size * 7);
-
-                r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-                r2 = vec_type::template fmadd<Cx>(a1, b2, r2);
-                r3 = vec_type::template fmadd<Cx>(a1, b3, r3);
-                r4 = vec_type::template fmadd<Cx>(a1, b4, r4);
-                r5 = vec_type::template fmadd<Cx>(a1, b5, r5);
-                r6 = vec_type::template fmadd<Cx>(a1, b6, r6);
-                r7 = vec_type::template fmadd<Cx>(a1, b7, r7);
-                r8 = vec_type::template fmadd<Cx>(a1, b8, r8);
-            }
-
-            c.template storeu<vec_type>(r1, i * N + j + 0 * vec_size);
-            c.template storeu<vec_type>(r2, i * N + j + 1 * vec_size);
-            c.template storeu<vec_type>(r3, i * N + j + 2 * vec_size);
-            c.template storeu<vec_type>(r4, i * N + j + 3 * vec_size);
-            c.template storeu<vec_type>(r5, i * N + j + 4 * vec_size);
-            c.template storeu<vec_type>(r6, i * N + j + 5 * vec_size);
-            c.template storeu<vec_type>(r7, i * N + j + 6 * vec_size);
-            c.template storeu<vec_type>(r8, i * N + j + 7 * vec_size);
-        }
-    }
-
-    for (; j + (4 * vec_size) - 1 < N; j += 4 * vec_size) {
-        size_t i = 0;
-
-        for (; i + 1 < M; i += 2){
-            auto r11 = vec_type::template zero<T>();
-            auto r12 = vec_type::template zero<T>();
-
-            auto r21 = vec_type::template zero<T>();
-            auto r22 = vec_type::template zero<T>();
-
-            auto r31 = vec_type::template zero<T>();
-            auto r32 = vec_type::template zero<T>();
-
-            auto r41 = vec_type::template zero<T>();
-            auto r42 = vec_type::template zero<T>();
-
-            for (size_t k = 0; k < K; ++k) {
-                auto b1 = b.template loadu<vec_type>(k * N + j + 0 * vec_size);
-                auto b2 = b.template loadu<vec_type>(k * N + j + 1 * vec_size);
-                auto b3 = b.template loadu<vec_type>(k * N + j + 2 * vec_size);
-                auto b4 = b.template loadu<vec_type>(k * N + j + 3 * vec_size);
-
-                auto a1 = vec_type::set(a(i, k));
-                auto a2 = vec_type::set(a(i + 1, k));
-
-                r11 = vec_type::template fmadd<Cx>(a1, b1, r11);
-                r12 = vec_type::template fmadd<Cx>(a2, b1, r12);
-
-                r21 = vec_type::template fmadd<Cx>(a1, b2, r21);
-                r22 = vec_type::template fmadd<Cx>(a2, b2, r22);
-
-                r31 = vec_type::template fmadd<Cx>(a1, b3, r31);
-                r32 = vec_type::template fmadd<Cx>(a2, b3, r32);
-
-                r41 = vec_type::template fmadd<Cx>(a1, b4, r41);
-                r42 = vec_type::template fmadd<Cx>(a2, b4, r42);
-            }
-
-            c.template storeu<vec_type>(r11, (i+0) * N + j + 0 * vec_size);
-            c.template storeu<vec_type>(r12, (i+1) * N + j + 0 * vec_size);
-
-            c.template storeu<vec_type>(r21, (i+0) * N + j + 1 * vec_size);
-            c.template storeu<vec_type>(r22, (i+1) * N + j + 1 * vec_size);
-
-            c.template storeu<vec_type>(r31, (i+0) * N + j + 2 * vec_size);
-            c.template storeu<vec_type>(r32, (i+1) * N + j + 2 * vec_size);
-
-            c.template storeu<vec_type>(r41, (i+0) * N + j + 3 * vec_size);
-            c.template storeu<vec_type>(r42, (i+1) * N + j + 3 * vec_size);
-        }
-
-        if (i < M) {
-            auto r11 = vec_type::template zero<T>();
-            auto r21 = vec_type::template zero<T>();
-            auto r31 = vec_type::template zero<T>();
-            auto r41 = vec_type::template zero<T>();
-
-            for (size_t k = 0; k < K; ++k) {
-                auto b1 = b.template loadu<vec_type>(k * N + j + 0 * vec_size);
-                auto b2 = b.template loadu<vec_type>(k * N + j + 1 * vec_size);
-                auto b3 = b.template loadu<vec_type>(k * N + j + 2 * vec_size);
-                auto b4 = b.template loadu<vec_type>(k * N + j + 3 * vec_size);
-
-                auto a1 = vec_type::set(a(i, k));
-
-                r11 = vec_type::template fmadd<Cx>(a1, b1, r11);
-                r21 = vec_type::template fmadd<Cx>(a1, b2, r21);
-                r31 = vec_type::template fmadd<Cx>(a1, b3, r31);
-                r41 = vec_type::template fmadd<Cx>(a1, b4, r41);
-            }
-
-            c.template storeu<vec_type>(r11, i * N + j + 0 * vec_size);
-            c.template storeu<vec_type>(r21, i * N + j + 1 * vec_size);
-            c.template storeu<vec_type>(r31, i * N + j + 2 * vec_size);
-            c.template storeu<vec_type>(r41, i * N + j + 3 * vec_size);
-        }
-    }
-
-    for (; j + (2 * vec_size) - 1 < N; j += 2 * vec_size) {
-        size_t i = 0;
-
-        for (; i + 1 < M; i += 2) {
-            auto r11 = vec_type::template zero<T>();
-            auto r12 = vec_type::template zero<T>();
-
-            auto r21 = vec_type::template zero<T>();
-            auto r22 = vec_type::template zero<T>();
-
-            for (size_t k = 0; k < K; ++k) {
-                auto b1 = b.template loadu<vec_type>(k * N + j + 0 * vec_size);
-                auto b2 = b.template loadu<vec_type>(k * N + j + 1 * vec_size);
-
-                auto a1 = vec_type::set(a(i, k));
-                auto a2 = vec_type::set(a(i + 1, k));
-
-                r11 = vec_type::template fmadd<Cx>(a1, b1, r11);
-                r12 = vec_type::template fmadd<Cx>(a2, b1, r12);
-
-                r21 = vec_type::template fmadd<Cx>(a1, b2, r21);
-                r22 = vec_type::template fmadd<Cx>(a2, b2, r22);
-            }
-
-            c.template storeu<vec_type>(r11, (i+0) * N + j + 0 * vec_size);
-            c.template storeu<vec_type>(r12, (i+1) * N + j + 0 * vec_size);
-
-            c.template storeu<vec_type>(r21, (i+0) * N + j + 1 * vec_size);
-            c.template storeu<vec_type>(r22, (i+1) * N + j + 1 * vec_size);
-        }
-
-        if (i < M) {
-            auto r11 = vec_type::template zero<T>();
-            auto r21 = vec_type::template zero<T>();
-
-            for (size_t k = 0; k < K; ++k) {
-                auto b1 = b.template loadu<vec_type>(k * N + j + 0 * vec_size);
-                auto b2 = b.template loadu<vec_type>(k * N + j + 1 * vec_size);
-
-                auto a1 = vec_type::set(a(i, k));
-
-                r11 = vec_type::template fmadd<Cx>(a1, b1, r11);
-                r21 = vec_type::template fmadd<Cx>(a1, b2, r21);
-            }
-
-            c.template storeu<vec_type>(r11, i * N + j + 0 * vec_size);
-            c.template storeu<vec_type>(r21, i * N + j + 1 * vec_size);
-        }
-    }
-
-    for (; j + vec_size - 1 < N; j += vec_size) {
-        size_t i = 0;
-
-        for (; i + 1 < M; i += 2) {
-            auto r1 = vec_type::template zero<T>();
-            auto r2 = vec_type::template zero<T>();
-
-            for (size_t k = 0; k < K; ++k) {
-                auto b1 = b.template loadu<vec_type>(k * N + j);
-
-                auto a1 = vec_type::set(a(i, k));
-                auto a2 = vec_type::set(a(i + 1, k));
-
-                r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-                r2 = vec_type::template fmadd<Cx>(a2, b1, r2);
-            }
-
-            c.template storeu<vec_type>(r1, (i+0) * N + j);
-            c.template storeu<vec_type>(r2, (i+1) * N + j);
-        }
-
-        if (i < M) {
-            auto r1 = vec_type::template zero<T>();
-
-            for (size_t k = 0; k < K; ++k) {
-                auto b1 = b.template loadu<vec_type>(k * N + j);
-
-                auto a1 = vec_type::set(a(i, k));
-
-                r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-            }
-
-            c.template storeu<vec_type>(r1, i * N + j);
-        }
-    }
-
-    for (; j + 1 < N; j += 2) {
-        size_t j1 = j + 0;
-        size_t j2 = j + 1;
-
-        size_t i = 0;
-
-        for (; i + 1 < M; i += 2) {
-            auto r11 = T();
-            auto r12 = T();
-            auto r21 = T();
-            auto r22 = T();
-
-            for (size_t k = 0; k < K; ++k) {
-                r11 += a(i + 0, k) * b(k, j1);
-                r21 += a(i + 0, k) * b(k, j2);
-                r12 += a(i + 1, k) * b(k, j1);
-                r22 += a(i + 1, k) * b(k, j2);
-            }
-
-            c(i + 0, j1) = r11;
-            c(i + 0, j2) = r21;
-            c(i + 1, j1) = r12;
-            c(i + 1, j2) = r22;
-        }
-
-        if (i < M) {
-            auto r1 = T();
-            auto r2 = T();
-
-            for (size_t k = 0; k < K; ++k) {
-                r1 += a(i, k) * b(k, j1);
-                r2 += a(i, k) * b(k, j2);
-            }
-
-            c(i, j1) = r1;
-            c(i, j2) = r2;
-        }
-    }
-
-    if (j < N) {
-        size_t i = 0;
-
-        for (; i + 1 < M; i += 2) {
-            auto r1 = T();
-            auto r2 = T();
-
-            for (size_t k = 0; k < K; ++k) {
-                r1 += a(i, k) * b(k, j);
-                r2 += a(i + 1, k) * b(k, j);
-            }
-
-            c(i + 0, j) = r1;
-            c(i + 1, j) = r2;
-        }
-
-        if (i < M) {
-            auto r1 = T();
-
-            for (size_t k = 0; k < K; ++k) {
-                r1 += a(i, k) * b(k, j);
-            }
+template <typename A, typename B, typename C, cpp_enable_if(all_dma<A, B, C>::value, all_row_major<C>::value)>
+void gemm(A&& a, B&& b, C&& c) {
+    cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
-            c(i, j) = r1;
-        }
+    if (!ETL_ISA_VEC_CALL(gemm_kernel(isa::view(a), isa::view(b), isa::view(c)))) {
+        gemm_kernel(a, b, c);
     }
 }
 
 /*!
- * \brief Optimized version of large GEMM for row major version
+ * \brief Optimized version of GEMM for column major result
+ *
+ * C' = B' * A' is computed on row major views of the transposes.
+ *
  * \param a The lhs matrix
  * \param b The rhs matrix
  * \param c The result matrix
  */
-template <typename V, typename A, typename B, typename C>
-void gemm_large_kernel(const A& a, const B& b, C& c) {
-    using vec_type = V;
-    using T        = value_t<A>;
-
-    static constexpr size_t vec_size = vec_type::template traits<T>::size;
-    static constexpr bool Cx         = is_complex_t<T>::value;
-
-    const size_t M = etl::rows(a);
-    const size_t N = etl::columns(b);
-    const size_t K = etl::columns(a);
-
-    const size_t n_block_size = 128;
-    const size_t m_block_size = 64;
-    const size_t k_block_size = 128;
-
-    for (size_t block_j = 0; block_j < N; block_j += n_block_size) {
-        const size_t j_end = std::min(block_j + n_block_size, N);
-
-        for (size_t block_i = 0; block_i < M; block_i += m_block_size) {
-            const size_t i_end = std::min(block_i + m_block_size, M);
-
-            for (size_t i = block_i; i < i_end; ++i) {
-                for (size_t j = block_j; j < j_end; ++j) {
-                    c(i, j) = 0;
-                }
-            }
-
-            for (size_t block_k = 0; block_k < K; block_k += k_block_size) {
-                const size_t k_end = std::min(block_k + k_block_size, K);
-
-                size_t j = block_j;
-
-                for (; j + vec_size * 4 - 1 < j_end; j += vec_size * 4) {
-                    const size_t j1 = j + vec_size * 1;
-                    const size_t j2 = j + vec_size * 2;
-                    const size_t j3 = j + vec_size * 3;
-
-                    size_t i = block_i;
-
-                    for (; i + 1 < i_end; i += 2) {
-                        auto r11 = c.template loadu<vec_type>((i + 0) * N + j);
-                        auto r12 = c.template loadu<vec_type>((i + 0) * N + j1);
-                        auto r13 = c.template loadu<vec_type>((i + 0) * N + j2);
-                        auto r14 = c.template loadu<vec_type>((i + 0) * N + j3);
-
-                        auto r21 = c.template loadu<vec_type>((i + 1) * N + j);
-                        auto r22 = c.template loadu<vec_type>((i + 1) * N + j1);
-                        auto r23 = c.template loadu<vec_type>((i + 1) * N + j2);
-                        auto r24 = c.template loadu<vec_type>((i + 1) * N + j3);
-
-                        for (size_t k = block_k; k < k_end; ++k) {
-                            auto a1 = vec_type::set(a(i + 0, k));
-                            auto a2 = vec_type::set(a(i + 1, k));
-
-                            auto b1 = b.template loadu<vec_type>(k * N + j);
-                            auto b2 = b.template loadu<vec_type>(k * N + j1);
-                            auto b3 = b.template loadu<vec_type>(k * N + j2);
-                            auto b4 = b.template loadu<vec_type>(k * N + j3);
-
-                            r11 = vec_type::template fmadd<Cx>(a1, b1, r11);
-                            r12 = vec_type::template fmadd<Cx>(a1, b2, r12);
-                            r13 = vec_type::template fmadd<Cx>(a1, b3, r13);
-                            r14 = vec_type::template fmadd<Cx>(a1, b4, r14);
-
-                            r21 = vec_type::template fmadd<Cx>(a2, b1, r21);
-                            r22 = vec_type::template fmadd<Cx>(a2, b2, r22);
-                            r23 = vec_type::template fmadd<Cx>(a2, b3, r23);
-                            r24 = vec_type::template fmadd<Cx>(a2, b4, r24);
-                        }
-
-                        c.template storeu<vec_type>(r11, (i + 0) * N + j);
-                        c.template storeu<vec_type>(r12, (i + 0) * N + j1);
-                        c.template storeu<vec_type>(r13, (i + 0) * N + j2);
-                        c.template storeu<vec_type>(r14, (i + 0) * N + j3);
-                        c.template storeu<vec_type>(r21, (i + 1) * N + j);
-                        c.template storeu<vec_type>(r22, (i + 1) * N + j1);
-                        c.template storeu<vec_type>(r23, (i + 1) * N + j2);
-                        c.template storeu<vec_type>(r24, (i + 1) * N + j3);
-                    }
-
-                    if (i < i_end) {
-                        auto r1 = c.template loadu<vec_type>(i * N + j);
-                        auto r2 = c.template loadu<vec_type>(i * N + j1);
-                        auto r3 = c.template loadu<vec_type>(i * N + j2);
-                        auto r4 = c.template loadu<vec_type>(i * N + j3);
-
-                        for (size_t k = block_k; k < k_end; ++k) {
-                            auto a1 = vec_type::set(a(i, k));
-
-                            auto b1 = b.template loadu<vec_type>(k * N + j);
-                            auto b2 = b.template loadu<vec_type>(k * N + j1);
-                            auto b3 = b.template loadu<vec_type>(k * N + j2);
-                            auto b4 = b.template loadu<vec_type>(k * N + j3);
-
-                            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-                            r2 = vec_type::template fmadd<Cx>(a1, b2, r2);
-                            r3 = vec_type::template fmadd<Cx>(a1, b3, r3);
-                            r4 = vec_type::template fmadd<Cx>(a1, b4, r4);
-                        }
-
-                        c.template storeu<vec_type>(r1, i * N + j);
-                        c.template storeu<vec_type>(r2, i * N + j1);
-                        c.template storeu<vec_type>(r3, i * N + j2);
-                        c.template storeu<vec_type>(r4, i * N + j3);
-                    }
-                }
-
-                for (; j + vec_size * 2 - 1 < j_end; j += vec_size * 2) {
-                    const size_t j1(j + vec_size);
-
-                    size_t i = block_i;
-
-                    for (; i + 3 < i_end; i += 4) {
-                        auto r11 = c.template loadu<vec_type>((i + 0) * N + j);
-                        auto r12 = c.template loadu<vec_type>((i + 0) * N + j1);
-
-                        auto r21 = c.template loadu<vec_type>((i + 1) * N + j);
-                        auto r22 = c.template loadu<vec_type>((i + 1) * N + j1);
-
-                        auto r31 = c.template loadu<vec_type>((i + 2) * N + j);
-                        auto r32 = c.template loadu<vec_type>((i + 2) * N + j1);
-
-                        auto r41 = c.template loadu<vec_type>((i + 3) * N + j);
-                        auto r42 = c.template loadu<vec_type>((i + 3) * N + j1);
-
-                        for (size_t k = block_k; k < k_end; ++k) {
-                            auto a1 = vec_type::set(a(i + 0, k));
-                            auto a2 = vec_type::set(a(i + 1, k));
-                            auto a3 = vec_type::set(a(i + 2, k));
-                            auto a4 = vec_type::set(a(i + 3, k));
-
-                            auto b1 = b.template loadu<vec_type>(k * N + j);
-                            auto b2 = b.template loadu<vec_type>(k * N + j1);
-
-                            r11 = vec_type::template fmadd<Cx>(a1, b1, r11);
-                            r12 = vec_type::template fmadd<Cx>(a1, b2, r12);
-
-                            r21 = vec_type::template fmadd<Cx>(a2, b1, r21);
-                            r22 = vec_type::template fmadd<Cx>(a2, b2, r22);
-
-                            r31 = vec_type::template fmadd<Cx>(a3, b1, r31);
-                            r32 = vec_type::template fmadd<Cx>(a3, b2, r32);
-
-                            r41 = vec_type::template fmadd<Cx>(a4, b1, r41);
-                            r42 = vec_type::template fmadd<Cx>(a4, b2, r42);
-                        }
-
-                        c.template storeu<vec_type>(r11, (i + 0) * N + j);
-                        c.template storeu<vec_type>(r12, (i + 0) * N + j1);
-                        c.template storeu<vec_type>(r21, (i + 1) * N + j);
-                        c.template storeu<vec_type>(r22, (i + 1) * N + j1);
-                        c.template storeu<vec_type>(r31, (i + 2) * N + j);
-                        c.template storeu<vec_type>(r32, (i + 2) * N + j1);
-                        c.template storeu<vec_type>(r41, (i + 3) * N + j);
-                        c.template storeu<vec_type>(r42, (i + 3) * N + j1);
-                    }
-
-                    for (; i + 2 - 1 < i_end; i += 2) {
-                        auto r11 = c.template loadu<vec_type>((i + 0) * N + j);
-                        auto r12 = c.template loadu<vec_type>((i + 0) * N + j1);
-
-                        auto r21 = c.template loadu<vec_type>((i + 1) * N + j);
-                        auto r22 = c.template loadu<vec_type>((i + 1) * N + j1);
-
-                        for (size_t k = block_k; k < k_end; ++k) {
-                            auto a1 = vec_type::set(a(i + 0, k));
-                            auto a2 = vec_type::set(a(i + 1, k));
-
-                            auto b1 = b.template loadu<vec_type>(k * N + j);
-                            auto b2 = b.template loadu<vec_type>(k * N + j1);
-
-                            r11 = vec_type::template fmadd<Cx>(a1, b1, r11);
-                            r12 = vec_type::template fmadd<Cx>(a1, b2, r12);
-
-                            r21 = vec_type::template fmadd<Cx>(a2, b1, r21);
-                            r22 = vec_type::template fmadd<Cx>(a2, b2, r22);
-                        }
-
-                        c.template storeu<vec_type>(r11, (i + 0) * N + j);
-                        c.template storeu<vec_type>(r12, (i + 0) * N + j1);
-                        c.template storeu<vec_type>(r21, (i + 1) * N + j);
-                        c.template storeu<vec_type>(r22, (i + 1) * N + j1);
-                    }
-
-                    if (i < i_end) {
-                        auto r1 = c.template loadu<vec_type>(i * N + j);
-                        auto r2 = c.template loadu<vec_type>(i * N + j1);
-
-                        for (size_t k = block_k; k < k_end; ++k) {
-                            auto a1 = vec_type::set(a(i, k));
-
-                            auto b1 = b.template loadu<vec_type>(k * N + j);
-                            auto b2 = b.template loadu<vec_type>(k * N + j1);
-
-                            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-                            r2 = vec_type::template fmadd<Cx>(a1, b2, r2);
-                        }
-
-                        c.template storeu<vec_type>(r1, i * N + j);
-                        c.template storeu<vec_type>(r2, i * N + j1);
-                    }
-                }
-
-                for (; j + vec_size - 1 < j_end; j += vec_size) {
-                    for (size_t i = block_i; i < i_end; ++i) {
-                        auto r1 = c.template loadu<vec_type>(i * N + j);
-
-                        for (size_t k = block_k; k < k_end; ++k) {
-                            auto a1 = vec_type::set(a(i, k));
-                            auto b1 = b.template loadu<vec_type>(k * N + j);
-                            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
-                        }
-
-                        c.template storeu<vec_type>(r1, i * N + j);
-                    }
-                }
-
-                for (; j < j_end; ++j) {
-                    for (size_t i = block_i; i < i_end; ++i) {
-                        auto value = c(i, j);
-
-                        for (size_t k = block_k; k < k_end; ++k) {
-                            value += a(i, k) * b(k, j);
-                        }
+template <typename A, typename B, typename C, cpp_enable_if(all_dma<A, B, C>::value, !all_row_major<C>::value)>
+void gemm(A&& a, B&& b, C&& c) {
+    auto c_t = etl::impl::common::transpose_view(c);
 
-                        c(i, j) = value;
-                    }
-                }
-            }
-        }
-    }
+    gemm(etl::impl::common::transpose_view(b), etl::impl::common::transpose_view(a), c_t);
 }
 
 /*!
- * \brief Optimized version of GEMM for row major version
+ * \brief Optimized version of GEMM for row major version, calling the
+ * given epilogue on the parts of C as soon as they are computed.
+ *
+ * The epilogue is called with (first_row, last_row, first_column,
+ * last_column), on the MCxNC blocks for large matrices and on panels of
+ * rows otherwise, and may be called concurrently on different parts.
+ *
  * \param a The lhs matrix
  * \param b The rhs matrix
  * \param c The result matrix
+ * \param epilogue The functor to call on each complete part of C
  */
-template <typename A, typename B, typename C, cpp_enable_if((all_row_major<A, B, C>::value))>
-void gemm(A&& a, B&& b, C&& c) {
+template <typename A, typename B, typename C, typename Epilogue, cpp_enable_if((all_row_major<A, B, C>::value))>
+void gemm(A&& a, B&& b, C&& c, Epilogue&& epilogue) {
     cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
-    if(etl::size(b) < 10000){
-        gemm_small_kernel<default_vec>(a, b, c);
-    } else {
-        gemm_large_kernel<default_vec>(a, b, c);
+    if (!ETL_ISA_VEC_CALL(gemm_kernel(isa::view(a), isa::view(b), isa::view(c), epilogue))) {
+        gemm_kernel(a, b, c, epilogue);
     }
 }
 
 /*!
- * \brief Unoptimized version of GEMM for column major version
+ * \brief Unoptimized version of GEMM for matrices without direct memory access
  * \param a The lhs matrix
  * \param b The rhs matrix
  * \param c The result matrix
  */
-template <typename A, typename B, typename C, cpp_disable_if((all_row_major<A, B, C>::value))>
+template <typename A, typename B, typename C, cpp_disable_if(all_dma<A, B, C>::value)>
 void gemm(A&& a, B&& b, C&& c) {
     cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
@@ -0,0 +1,1349 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Kernels of the vectorized GEMV, GEVM and GEMM.
+ *
+ * This file has no include guard, it is included in etl::impl::vec by
+ * gemm.hpp and included again for the other instruction sets by
+ * impl/isa/instantiate.hpp, with runtime dispatch.
+ */
+
+/*!
+ * \brief Optimized version of small GEMV for row major version
+ * \param a The lhs matrix
+ * \param b The rhs vector
+ * \param c The result vector
+ */
+template <typename V, typename A, typename B, typename C, cpp_enable_if((all_row_major<A, B, C>::value))>
+void gemv_small_kernel(const A& a, const B& b, C& c) {
+    using vec_type = V;
+    using T        = value_t<A>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+    static constexpr bool Cx         = is_complex_t<T>::value;
+
+    const auto m = rows(a);
+    const auto n = columns(a);
+
+    static constexpr bool remainder = !advanced_padding || !all_padded<A, B>::value;
+    const size_t last = remainder ? (n & size_t(-vec_size)) : n;
+
+    size_t i = 0;
+
+    // 8-Unrolled outer loop
+    for (; i + 7 < m; i += 8) {
+        auto r1 = vec_type::template zero<T>();
+        auto r2 = vec_type::template zero<T>();
+        auto r3 = vec_type::template zero<T>();
+        auto r4 = vec_type::template zero<T>();
+        auto r5 = vec_type::template zero<T>();
+        auto r6 = vec_type::template zero<T>();
+        auto r7 = vec_type::template zero<T>();
+        auto r8 = vec_type::template zero<T>();
+
+        size_t k = 0;
+
+        // Vectorized inner loop
+        for (; k < last; k += vec_size) {
+            auto b1 = b.template load<vec_type>(k);
+
+            auto a1 = a.template loadu<vec_type>((i + 0) * n + k);
+            auto a2 = a.template loadu<vec_type>((i + 1) * n + k);
+            auto a3 = a.template loadu<vec_type>((i + 2) * n + k);
+            auto a4 = a.template loadu<vec_type>((i + 3) * n + k);
+            auto a5 = a.template loadu<vec_type>((i + 4) * n + k);
+            auto a6 = a.template loadu<vec_type>((i + 5) * n + k);
+            auto a7 = a.template loadu<vec_type>((i + 6) * n + k);
+            auto a8 = a.template loadu<vec_type>((i + 7) * n + k);
+
+            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
+            r2 = vec_type::template fmadd<Cx>(a2, b1, r2);
+            r3 = vec_type::template fmadd<Cx>(a3, b1, r3);
+            r4 = vec_type::template fmadd<Cx>(a4, b1, r4);
+            r5 = vec_type::template fmadd<Cx>(a5, b1, r5);
+            r6 = vec_type::template fmadd<Cx>(a6, b1, r6);
+            r7 = vec_type::template fmadd<Cx>(a7, b1, r7);
+            r8 = vec_type::template fmadd<Cx>(a8, b1, r8);
+        }
+
+        c[i + 0] = vec_type::template hadd<T>(r1);
+        c[i + 1] = vec_type::template hadd<T>(r2);
+        c[i + 2] = vec_type::template hadd<T>(r3);
+        c[i + 3] = vec_type::template hadd<T>(r4);
+        c[i + 4] = vec_type::template hadd<T>(r5);
+        c[i + 5] = vec_type::template hadd<T>(r6);
+        c[i + 6] = vec_type::template hadd<T>(r7);
+        c[i + 7] = vec_type::template hadd<T>(r8);
+
+        // Remainder inner loop
+        for (; remainder && k < n; ++k) {
+            c[i + 0] += a(i + 0, k) * b(k);
+            c[i + 1] += a(i + 1, k) * b(k);
+            c[i + 2] += a(i + 2, k) * b(k);
+            c[i + 3] += a(i + 3, k) * b(k);
+            c[i + 4] += a(i + 4, k) * b(k);
+            c[i + 5] += a(i + 5, k) * b(k);
+            c[i + 6] += a(i + 6, k) * b(k);
+            c[i + 7] += a(i + 7, k) * b(k);
+        }
+    }
+
+    // 2-Unrolled outer loop
+    for (; i + 1 < m; i += 2) {
+        auto r1 = vec_type::template zero<T>();
+        auto r2 = vec_type::template zero<T>();
+
+        size_t k = 0;
+
+        // Vectorized inner loop
+        for (; k < last; k += vec_size) {
+            auto b1 = b.template load<vec_type>(k);
+
+            auto a1 = a.template loadu<vec_type>((i + 0) * n + k);
+            auto a2 = a.template loadu<vec_type>((i + 1) * n + k);
+
+            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
+            r2 = vec_type::template fmadd<Cx>(a2, b1, r2);
+        }
+
+        c[i + 0] = vec_type::template hadd<T>(r1);
+        c[i + 1] = vec_type::template hadd<T>(r2);
+
+        // Remainder inner loop
+        for (; remainder && k < n; ++k) {
+            c[i + 0] += a(i + 0, k) * b(k);
+            c[i + 1] += a(i + 1, k) * b(k);
+        }
+    }
+
+    // Remainder loop
+    if (i < m) {
+        auto r1 = vec_type::template zero<T>();
+
+        size_t k = 0;
+
+        // Vectorized inner loop
+        for (; k < last; k += vec_size) {
+            auto a1 = a.template loadu<vec_type>(i * n + k);
+            auto b1 = b.template load<vec_type>(k);
+            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
+        }
+
+        auto result = vec_type::template hadd<T>(r1);
+
+        // Remainder inner loop
+        for (; remainder && k < n; ++k) {
+            result += a(i, k) * b(k);
+        }
+
+        c[i] = result;
+    }
+}
+
+/*!
+ * \brief Optimized version of large GEMV for row major version
+ * \param a The lhs matrix
+ * \param b The rhs vector
+ * \param c The result vector
+ */
+template <typename V, typename A, typename B, typename C, cpp_enable_if((all_row_major<A, B, C>::value))>
+void gemv_large_kernel(const A& a, const B& b, C& c) {
+    using vec_type = V;
+    using T        = value_t<A>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+    static constexpr bool Cx         = is_complex_t<T>::value;
+
+    const auto m = rows(a);
+    const auto n = columns(a);
+
+    static constexpr bool remainder = !advanced_padding || !all_padded<A, B>::value;
+    const size_t last = remainder ? (n & size_t(-vec_size)) : n;
+
+    size_t i = 0;
+
+    // 8-Unrolled outer loop
+    for (; i + 7 < m; i += 8) {
+        auto r1 = vec_type::template zero<T>();
+        auto r2 = vec_type::template zero<T>();
+        auto r3 = vec_type::template zero<T>();
+        auto r4 = vec_type::template zero<T>();
+        auto r5 = vec_type::template zero<T>();
+        auto r6 = vec_type::template zero<T>();
+        auto r7 = vec_type::template zero<T>();
+        auto r8 = vec_type::template zero<T>();
+
+        size_t k = 0;
+
+        // 4-Unrolled Vectorized inner loop
+        for (; k + (vec_size * 3) < last; k += vec_size * 4) {
+            const auto k1 = k + 0 * vec_size;
+            const auto k2 = k + 1 * vec_size;
+            const auto k3 = k + 2 * vec_size;
+            const auto k4 = k + 3 * vec_size;
+
+            auto b1 = b.template load<vec_type>(k1);
+            auto b2 = b.template load<vec_type>(k2);
+            auto b3 = b.template load<vec_type>(k3);
+            auto b4 = b.template load<vec_type>(k4);
+
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k1), b1, r1);
+            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k1), b1, r2);
+            r3 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 2) * n + k1), b1, r3);
+            r4 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 3) * n + k1), b1, r4);
+            r5 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 4) * n + k1), b1, r5);
+            r6 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 5) * n + k1), b1, r6);
+            r7 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 6) * n + k1), b1, r7);
+            r8 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 7) * n + k1), b1, r8);
+
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k2), b2, r1);
+            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k2), b2, r2);
+            r3 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 2) * n + k2), b2, r3);
+            r4 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 3) * n + k2), b2, r4);
+            r5 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 4) * n + k2), b2, r5);
+            r6 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 5) * n + k2), b2, r6);
+            r7 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 6) * n + k2), b2, r7);
+            r8 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 7) * n + k2), b2, r8);
+
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k3), b3, r1);
+            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k3), b3, r2);
+            r3 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 2) * n + k3), b3, r3);
+            r4 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 3) * n + k3), b3, r4);
+            r5 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 4) * n + k3), b3, r5);
+            r6 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 5) * n + k3), b3, r6);
+            r7 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 6) * n + k3), b3, r7);
+            r8 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 7) * n + k3), b3, r8);
+
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k4), b4, r1);
+            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k4), b4, r2);
+            r3 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 2) * n + k4), b4, r3);
+            r4 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 3) * n + k4), b4, r4);
+            r5 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 4) * n + k4), b4, r5);
+            r6 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 5) * n + k4), b4, r6);
+            r7 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 6) * n + k4), b4, r7);
+            r8 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 7) * n + k4), b4, r8);
+        }
+
+        // 2-Unrolled Vectorized inner loop
+        for (; k + (vec_size) < last; k += vec_size * 2) {
+            const auto k1 = k + 0 * vec_size;
+            const auto k2 = k + 1 * vec_size;
+
+            auto b1 = b.template load<vec_type>(k1);
+            auto b2 = b.template load<vec_type>(k2);
+
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k1), b1, r1);
+            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k1), b1, r2);
+            r3 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 2) * n + k1), b1, r3);
+            r4 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 3) * n + k1), b1, r4);
+            r5 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 4) * n + k1), b1, r5);
+            r6 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 5) * n + k1), b1, r6);
+            r7 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 6) * n + k1), b1, r7);
+            r8 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 7) * n + k1), b1, r8);
+
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k2), b2, r1);
+            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k2), b2, r2);
+            r3 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 2) * n + k2), b2, r3);
+            r4 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 3) * n + k2), b2, r4);
+            r5 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 4) * n + k2), b2, r5);
+            r6 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 5) * n + k2), b2, r6);
+            r7 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 6) * n + k2), b2, r7);
+            r8 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 7) * n + k2), b2, r8);
+        }
+
+        // Vectorized inner loop
+        if (k < last) {
+            auto b1 = b.template load<vec_type>(k);
+
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k), b1, r1);
+            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k), b1, r2);
+            r3 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 2) * n + k), b1, r3);
+            r4 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 3) * n + k), b1, r4);
+            r5 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 4) * n + k), b1, r5);
+            r6 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 5) * n + k), b1, r6);
+            r7 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 6) * n + k), b1, r7);
+            r8 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 7) * n + k), b1, r8);
+
+            k += vec_size;
+        }
+
+        c[i + 0] = vec_type::template hadd<T>(r1);
+        c[i + 1] = vec_type::template hadd<T>(r2);
+        c[i + 2] = vec_type::template hadd<T>(r3);
+        c[i + 3] = vec_type::template hadd<T>(r4);
+        c[i + 4] = vec_type::template hadd<T>(r5);
+        c[i + 5] = vec_type::template hadd<T>(r6);
+        c[i + 6] = vec_type::template hadd<T>(r7);
+        c[i + 7] = vec_type::template hadd<T>(r8);
+
+        // Remainder inner loop
+        for (; remainder && k < n; ++k) {
+            c[i + 0] += a(i + 0, k) * b(k);
+            c[i + 1] += a(i + 1, k) * b(k);
+            c[i + 2] += a(i + 2, k) * b(k);
+            c[i + 3] += a(i + 3, k) * b(k);
+            c[i + 4] += a(i + 4, k) * b(k);
+            c[i + 5] += a(i + 5, k) * b(k);
+            c[i + 6] += a(i + 6, k) * b(k);
+            c[i + 7] += a(i + 7, k) * b(k);
+        }
+    }
+
+    // 2-Unrolled outer loop
+    for (; i + 1 < m; i += 2) {
+        auto r1 = vec_type::template zero<T>();
+        auto r2 = vec_type::template zero<T>();
+
+        size_t k = 0;
+
+        // 4-Unrolled Vectorized inner loop
+        for (; k + (vec_size * 3) < last; k += vec_size * 4) {
+            const auto k1 = k + 0 * vec_size;
+            const auto k2 = k + 1 * vec_size;
+            const auto k3 = k + 2 * vec_size;
+            const auto k4 = k + 3 * vec_size;
+
+            auto b1 = b.template load<vec_type>(k1);
+            auto b2 = b.template load<vec_type>(k2);
+            auto b3 = b.template load<vec_type>(k3);
+            auto b4 = b.template load<vec_type>(k4);
+
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k1), b1, r1);
+            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k1), b1, r2);
+
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k2), b2, r1);
+            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k2), b2, r2);
+
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k3), b3, r1);
+            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k3), b3, r2);
+
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k4), b4, r1);
+            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k4), b4, r2);
+        }
+
+        // 2-Unrolled Vectorized inner loop
+        for (; k + vec_size < last; k += vec_size * 2) {
+            const auto k1 = k + 0 * vec_size;
+            const auto k2 = k + 1 * vec_size;
+
+            auto b1 = b.template load<vec_type>(k1);
+            auto b2 = b.template load<vec_type>(k2);
+
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k1), b1, r1);
+            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k1), b1, r2);
+
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k2), b2, r1);
+            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k2), b2, r2);
+        }
+
+        // Vectorized inner loop
+        if (k < last) {
+            auto b1 = b.template load<vec_type>(k);
+
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k), b1, r1);
+            r2 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 1) * n + k), b1, r2);
+
+            k += vec_size;
+        }
+
+        c[i + 0] = vec_type::template hadd<T>(r1);
+        c[i + 1] = vec_type::template hadd<T>(r2);
+
+        // Remainder inner loop
+        for (; remainder && k < n; ++k) {
+            c[i + 0] += a(i + 0, k) * b(k);
+            c[i + 1] += a(i + 1, k) * b(k);
+        }
+    }
+
+    // Remainder loop
+    if (i < m) {
+        auto r1 = vec_type::template zero<T>();
+
+        size_t k = 0;
+
+        // Vectorized inner loop
+        for (; k < last; k += vec_size) {
+            auto b1 = b.template load<vec_type>(k);
+            r1 = vec_type::template fmadd<Cx>(a.template loadu<vec_type>((i + 0) * n + k), b1, r1);
+        }
+
+        auto result = vec_type::template hadd<T>(r1);
+
+        // Remainder inner loop
+        for (; remainder && k < n; ++k) {
+            result += a(i, k) * b(k);
+        }
+
+        c[i] = result;
+    }
+}
+
+/*!
+ * \brief Optimized version of small GEVM for row major version
+ * \param a The lhs vector
+ * \param b The rhs matrix
+ * \param c The result vector
+ */
+template <typename V, typename A, typename B, typename C, cpp_enable_if((all_row_major<A, B, C>::value))>
+void gevm_small_kernel(const A& a, const B& b, C& c) {
+    using vec_type = V;
+    using T        = value_t<A>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+    static constexpr bool Cx         = is_complex_t<T>::value;
+
+    const auto m = rows(b);
+    const auto n = columns(b);
+
+    size_t j = 0;
+
+    for (; j + vec_size * 8 - 1 < n; j += vec_size * 8) {
+        auto r1 = vec_type::template zero<T>();
+        auto r2 = vec_type::template zero<T>();
+        auto r3 = vec_type::template zero<T>();
+        auto r4 = vec_type::template zero<T>();
+        auto r5 = vec_type::template zero<T>();
+        auto r6 = vec_type::template zero<T>();
+        auto r7 = vec_type::template zero<T>();
+        auto r8 = vec_type::template zero<T>();
+
+        for (size_t k = 0; k < m; k++) {
+            auto a1 = vec_type::set(a[k]);
+
+            auto b1 = b.template loadu<vec_type>(k * n + j + 0 * vec_size);
+            auto b2 = b.template loadu<vec_type>(k * n + j + 1 * vec_size);
+            auto b3 = b.template loadu<vec_type>(k * n + j + 2 * vec_size);
+            auto b4 = b.template loadu<vec_type>(k * n + j + 3 * vec_size);
+            auto b5 = b.template loadu<vec_type>(k * n + j + 4 * vec_size);
+            auto b6 = b.template loadu<vec_type>(k * n + j + 5 * vec_size);
+            auto b7 = b.template loadu<vec_type>(k * n + j + 6 * vec_size);
+            auto b8 = b.template loadu<vec_type>(k * n + j + 7 * vec_size);
+
+            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
+            r2 = vec_type::template fmadd<Cx>(a1, b2, r2);
+            r3 = vec_type::template fmadd<Cx>(a1, b3, r3);
+            r4 = vec_type::template fmadd<Cx>(a1, b4, r4);
+            r5 = vec_type::template fmadd<Cx>(a1, b5, r5);
+            r6 = vec_type::template fmadd<Cx>(a1, b6, r6);
+            r7 = vec_type::template fmadd<Cx>(a1, b7, r7);
+            r8 = vec_type::template fmadd<Cx>(a1, b8, r8);
+        }
+
+        c.template storeu<vec_type>(r1, j + 0 * vec_size);
+        c.template storeu<vec_type>(r2, j + 1 * vec_size);
+        c.template storeu<vec_type>(r3, j + 2 * vec_size);
+        c.template storeu<vec_type>(r4, j + 3 * vec_size);
+        c.template storeu<vec_type>(r5, j + 4 * vec_size);
+        c.template storeu<vec_type>(r6, j + 5 * vec_size);
+        c.template storeu<vec_type>(r7, j + 6 * vec_size);
+        c.template storeu<vec_type>(r8, j + 7 * vec_size);
+    }
+
+    for (; j + vec_size * 4 - 1 < n; j += vec_size * 4) {
+        auto r1 = vec_type::template zero<T>();
+        auto r2 = vec_type::template zero<T>();
+        auto r3 = vec_type::template zero<T>();
+        auto r4 = vec_type::template zero<T>();
+
+        for (size_t k = 0; k < m; k++) {
+            auto a1 = vec_type::set(a[k]);
+
+            auto b1 = b.template loadu<vec_type>(k * n + j + 0 * vec_size);
+            auto b2 = b.template loadu<vec_type>(k * n + j + 1 * vec_size);
+            auto b3 = b.template loadu<vec_type>(k * n + j + 2 * vec_size);
+            auto b4 = b.template loadu<vec_type>(k * n + j + 3 * vec_size);
+
+            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
+            r2 = vec_type::template fmadd<Cx>(a1, b2, r2);
+            r3 = vec_type::template fmadd<Cx>(a1, b3, r3);
+            r4 = vec_type::template fmadd<Cx>(a1, b4, r4);
+        }
+
+        c.template storeu<vec_type>(r1, j + 0 * vec_size);
+        c.template storeu<vec_type>(r2, j + 1 * vec_size);
+        c.template storeu<vec_type>(r3, j + 2 * vec_size);
+        c.template storeu<vec_type>(r4, j + 3 * vec_size);
+    }
+
+    for (; j + vec_size - 1 < n; j += vec_size) {
+        auto r1 = vec_type::template zero<T>();
+
+        for (size_t k = 0; k < m; k++) {
+            auto a1 = vec_type::set(a[k]);
+
+            auto b1 = b.template loadu<vec_type>(k * n + j);
+
+            r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
+        }
+
+        c.template storeu<vec_type>(r1, j);
+    }
+
+    for (; j < n; j++) {
+        auto value = T();
+
+        for (size_t k = 0; k < m; k++) {
+            value += a(k) * b(k, j);
+        }
+
+        c[j] = value;
+    }
+}
+
+/*!
+ * \brief Optimized version of large GEVM for row major version
+ * \param a The lhs vector
+ * \param b The rhs matrix
+ * \param c The result vector
+ */
+template <typename V, typename A, typename B, typename C, cpp_enable_if((all_row_major<A, B, C>::value))>
+void gevm_large_kernel(const A& a, const B& b, C& c) {
+    using vec_type = V;
+    using T        = value_t<A>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+    static constexpr bool Cx         = is_complex_t<T>::value;
+
+    const auto m = rows(b);
+    const auto n = columns(b);
+
+    const size_t n_block = (32 * 1024) / sizeof(T);
+    const size_t m_block = n < n_block ? 8 : 4;
+
+    c = 0;
+
+    for (size_t block_j = 0; block_j < n; block_j += n_block) {
+        for (size_t block_k = 0; block_k < m; block_k += m_block) {
+            const size_t m_end = std::min(block_k + m_block, m);
+            const size_t n_end = std::min(block_j + n_block, n);
+
+            size_t j = block_j;
+
+            // 8-Unrolled Vectorized loop
+            for (; j + vec_size * 8 - 1 < n_end; j += vec_size * 8) {
+                auto r1 = vec_type::template zero<T>();
+                auto r2 = vec_type::template zero<T>();
+                auto r3 = vec_type::template zero<T>();
+                auto r4 = vec_type::template zero<T>();
+                auto r5 = vec_type::template zero<T>();
+                auto r6 = vec_type::template zero<T>();
+                auto r7 = vec_type::template zero<T>();
+                auto r8 = vec_type::template zero<T>();
+
+                for (size_t k = block_k; k < m_end; ++k) {
+                    auto a1 = vec_type::set(a[k]);
+
+                    auto b1 = b.template loadu<vec_type>(k * n + j + 0 * vec_size);
+                    auto b2 = b.template loadu<vec_type>(k * n + j + 1 * vec_size);
+                    auto b3 = b.template loadu<vec_type>(k * n + j + 2 * vec_size);
+                    auto b4 = b.template loadu<vec_type>(k * n + j + 3 * vec_size);
+                    auto b5 = b.template loadu<vec_type>(k * n + j + 4 * vec_size);
+                    auto b6 = b.template loadu<vec_type>(k * n + j + 5 * vec_size);
+                    auto b7 = b.template loadu<vec_type>(k * n + j + 6 * vec_size);
+                    auto b8 = b.template loadu<vec_type>(k * n + j + 7 * vec_size);
+
+                    r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
+                    r2 = vec_type::template fmadd<Cx>(a1, b2, r2);
+                    r3 = vec_type::template fmadd<Cx>(a1, b3, r3);
+                    r4 = vec_type::template fmadd<Cx>(a1, b4, r4);
+                    r5 = vec_type::template fmadd<Cx>(a1, b5, r5);
+                    r6 = vec_type::template fmadd<Cx>(a1, b6, r6);
+                    r7 = vec_type::template fmadd<Cx>(a1, b7, r7);
+                    r8 = vec_type::template fmadd<Cx>(a1, b8, r8);
+                }
+
+                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 0 * vec_size), r1), j + 0 * vec_size);
+                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 1 * vec_size), r2), j + 1 * vec_size);
+                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 2 * vec_size), r3), j + 2 * vec_size);
+                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 3 * vec_size), r4), j + 3 * vec_size);
+                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 4 * vec_size), r5), j + 4 * vec_size);
+                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 5 * vec_size), r6), j + 5 * vec_size);
+                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 6 * vec_size), r7), j + 6 * vec_size);
+                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 7 * vec_size), r8), j + 7 * vec_size);
+            }
+
+            // 4-Unrolled vectorized loop
+            for (; j + vec_size * 4 - 1 < n_end; j += vec_size * 4) {
+                auto r1 = vec_type::template zero<T>();
+                auto r2 = vec_type::template zero<T>();
+                auto r3 = vec_type::template zero<T>();
+                auto r4 = vec_type::template zero<T>();
+
+                for (size_t k = block_k; k < m_end; ++k) {
+                    auto a1 = vec_type::set(a[k]);
+
+                    auto b1 = b.template loadu<vec_type>(k * n + j + 0 * vec_size);
+                    auto b2 = b.template loadu<vec_type>(k * n + j + 1 * vec_size);
+                    auto b3 = b.template loadu<vec_type>(k * n + j + 2 * vec_size);
+                    auto b4 = b.template loadu<vec_type>(k * n + j + 3 * vec_size);
+
+                    r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
+                    r2 = vec_type::template fmadd<Cx>(a1, b2, r2);
+                    r3 = vec_type::template fmadd<Cx>(a1, b3, r3);
+                    r4 = vec_type::template fmadd<Cx>(a1, b4, r4);
+                }
+
+                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 0 * vec_size), r1), j + 0 * vec_size);
+                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 1 * vec_size), r2), j + 1 * vec_size);
+                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 2 * vec_size), r3), j + 2 * vec_size);
+                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 3 * vec_size), r4), j + 3 * vec_size);
+            }
+
+            // Base vectorized loop
+            for (; j + vec_size - 1 < n_end; j += vec_size) {
+                auto r1 = vec_type::template zero<T>();
+
+                for (size_t k = block_k; k < m_end; ++k) {
+                    auto a1 = vec_type::set(a[k]);
+                    auto b1 = b.template loadu<vec_type>(k * n + j + 0 * vec_size);
+                    r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
+                }
+
+                c.template storeu<vec_type>(vec_type::add(c.template loadu<vec_type>(j + 0 * vec_size), r1), j + 0 * vec_size);
+            }
+
+            // Remainder non-vectorized loop
+            for (; j < n_end; ++j) {
+                auto r1 = T();
+
+                for (size_t k = block_k; k < m_end; ++k) {
+                    r1 += a[k] * b(k, j);
+                }
+
+                c[j] += r1;
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Optimized version of small GEMM for row major version
+ * \param a The lhs matrix
+ * \param b The rhs matrix
+ * \param c The result matrix
+ */
+template <typename V, typename A, typename B, typename C>
+void gemm_small_kernel(const A& a, const B& b, C& c) {
+    using vec_type = V;
+    using T        = value_t<A>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+    static constexpr bool Cx         = is_complex_t<T>::value;
+
+    const size_t M = etl::rows(a);
+    const size_t N = etl::columns(b);
+    const size_t K = etl::columns(a);
+
+    size_t j = 0;
+
+    for (; j + vec_size * 8 - 1 < N; j += vec_size * 8) {
+        for (size_t i = 0; i < M; ++i) {
+            auto r1 = vec_type::template zero<T>();
+            auto r2 = vec_type::template zero<T>();
+            auto r3 = vec_type::template zero<T>();
+            auto r4 = vec_type::template zero<T>();
+            auto r5 = vec_type::template zero<T>();
+            auto r6 = vec_type::template zero<T>();
+            auto r7 = vec_type::template zero<T>();
+            auto r8 = vec_type::template zero<T>();
+
+            for (size_t k = 0; k < K; ++k) {
+                auto a1 = vec_type::set(a(i, k));
+
+                auto b1 = b.template loadu<vec_type>(k * N + j + vec_size * 0);
+                auto b2 = b.template loadu<vec_type>(k * N + j + vec_size * 1);
+                auto b3 = b.template loadu<vec_type>(k * N + j + vec_size * 2);
+                auto b4 = b.template loadu<vec_type>(k * N + j + vec_size * 3);
+                auto b5 = b.template loadu<vec_type>(k * N + j + vec_size * 4);
+                auto b6 = b.template loadu<vec_type>(k * N + j + vec_size * 5);
+                auto b7 = b.template loadu<vec_type>(k * N + j + vec_size * 6);
+                auto b8 = b.template loadu<vec_type>(k * N + j + vec_size * 7);
+
+                r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
+                r2 = vec_type::template fmadd<Cx>(a1, b2, r2);
+                r3 = vec_type::template fmadd<Cx>(a1, b3, r3);
+                r4 = vec_type::template fmadd<Cx>(a1, b4, r4);
+                r5 = vec_type::template fmadd<Cx>(a1, b5, r5);
+                r6 = vec_type::template fmadd<Cx>(a1, b6, r6);
+                r7 = vec_type::template fmadd<Cx>(a1, b7, r7);
+                r8 = vec_type::template fmadd<Cx>(a1, b8, r8);
+            }
+
+            c.template storeu<vec_type>(r1, i * N + j + 0 * vec_size);
+            c.template storeu<vec_type>(r2, i * N + j + 1 * vec_size);
+            c.template storeu<vec_type>(r3, i * N + j + 2 * vec_size);
+            c.template storeu<vec_type>(r4, i * N + j + 3 * vec_size);
+            c.template storeu<vec_type>(r5, i * N + j + 4 * vec_size);
+            c.template storeu<vec_type>(r6, i * N + j + 5 * vec_size);
+            c.template storeu<vec_type>(r7, i * N + j + 6 * vec_size);
+            c.template storeu<vec_type>(r8, i * N + j + 7 * vec_size);
+        }
+    }
+
+    for (; j + (4 * vec_size) - 1 < N; j += 4 * vec_size) {
+        size_t i = 0;
+
+        for (; i + 1 < M; i += 2){
+            auto r11 = vec_type::template zero<T>();
+            auto r12 = vec_type::template zero<T>();
+
+            auto r21 = vec_type::template zero<T>();
+            auto r22 = vec_type::template zero<T>();
+
+            auto r31 = vec_type::template zero<T>();
+            auto r32 = vec_type::template zero<T>();
+
+            auto r41 = vec_type::template zero<T>();
+            auto r42 = vec_type::template zero<T>();
+
+            for (size_t k = 0; k < K; ++k) {
+                auto b1 = b.template loadu<vec_type>(k * N + j + 0 * vec_size);
+                auto b2 = b.template loadu<vec_type>(k * N + j + 1 * vec_size);
+                auto b3 = b.template loadu<vec_type>(k * N + j + 2 * vec_size);
+                auto b4 = b.template loadu<vec_type>(k * N + j + 3 * vec_size);
+
+                auto a1 = vec_type::set(a(i, k));
+                auto a2 = vec_type::set(a(i + 1, k));
+
+                r11 = vec_type::template fmadd<Cx>(a1, b1, r11);
+                r12 = vec_type::template fmadd<Cx>(a2, b1, r12);
+
+                r21 = vec_type::template fmadd<Cx>(a1, b2, r21);
+                r22 = vec_type::template fmadd<Cx>(a2, b2, r22);
+
+                r31 = vec_type::template fmadd<Cx>(a1, b3, r31);
+                r32 = vec_type::template fmadd<Cx>(a2, b3, r32);
+
+                r41 = vec_type::template fmadd<Cx>(a1, b4, r41);
+                r42 = vec_type::template fmadd<Cx>(a2, b4, r42);
+            }
+
+            c.template storeu<vec_type>(r11, (i+0) * N + j + 0 * vec_size);
+            c.template storeu<vec_type>(r12, (i+1) * N + j + 0 * vec_size);
+
+            c.template storeu<vec_type>(r21, (i+0) * N + j + 1 * vec_size);
+            c.template storeu<vec_type>(r22, (i+1) * N + j + 1 * vec_size);
+
+            c.template storeu<vec_type>(r31, (i+0) * N + j + 2 * vec_size);
+            c.template storeu<vec_type>(r32, (i+1) * N + j + 2 * vec_size);
+
+            c.template storeu<vec_type>(r41, (i+0) * N + j + 3 * vec_size);
+            c.template storeu<vec_type>(r42, (i+1) * N + j + 3 * vec_size);
+        }
+
+        if (i < M) {
+            auto r11 = vec_type::template zero<T>();
+            auto r21 = vec_type::template zero<T>();
+            auto r31 = vec_type::template zero<T>();
+            auto r41 = vec_type::template zero<T>();
+
+            for (size_t k = 0; k < K; ++k) {
+                auto b1 = b.template loadu<vec_type>(k * N + j + 0 * vec_size);
+                auto b2 = b.template loadu<vec_type>(k * N + j + 1 * vec_size);
+                auto b3 = b.template loadu<vec_type>(k * N + j + 2 * vec_size);
+                auto b4 = b.template loadu<vec_type>(k * N + j + 3 * vec_size);
+
+                auto a1 = vec_type::set(a(i, k));
+
+                r11 = vec_type::template fmadd<Cx>(a1, b1, r11);
+                r21 = vec_type::template fmadd<Cx>(a1, b2, r21);
+                r31 = vec_type::template fmadd<Cx>(a1, b3, r31);
+                r41 = vec_type::template fmadd<Cx>(a1, b4, r41);
+            }
+
+            c.template storeu<vec_type>(r11, i * N + j + 0 * vec_size);
+            c.template storeu<vec_type>(r21, i * N + j + 1 * vec_size);
+            c.template storeu<vec_type>(r31, i * N + j + 2 * vec_size);
+            c.template storeu<vec_type>(r41, i * N + j + 3 * vec_size);
+        }
+    }
+
+    for (; j + (2 * vec_size) - 1 < N; j += 2 * vec_size) {
+        size_t i = 0;
+
+        for (; i + 1 < M; i += 2) {
+            auto r11 = vec_type::template zero<T>();
+            auto r12 = vec_type::template zero<T>();
+
+            auto r21 = vec_type::template zero<T>();
+            auto r22 = vec_type::template zero<T>();
+
+            for (size_t k = 0; k < K; ++k) {
+                auto b1 = b.template loadu<vec_type>(k * N + j + 0 * vec_size);
+                auto b2 = b.template loadu<vec_type>(k * N + j + 1 * vec_size);
+
+                auto a1 = vec_type::set(a(i, k));
+                auto a2 = vec_type::set(a(i + 1, k));
+
+                r11 = vec_type::template fmadd<Cx>(a1, b1, r11);
+                r12 = vec_type::template fmadd<Cx>(a2, b1, r12);
+
+                r21 = vec_type::template fmadd<Cx>(a1, b2, r21);
+                r22 = vec_type::template fmadd<Cx>(a2, b2, r22);
+            }
+
+            c.template storeu<vec_type>(r11, (i+0) * N + j + 0 * vec_size);
+            c.template storeu<vec_type>(r12, (i+1) * N + j + 0 * vec_size);
+
+            c.template storeu<vec_type>(r21, (i+0) * N + j + 1 * vec_size);
+            c.template storeu<vec_type>(r22, (i+1) * N + j + 1 * vec_size);
+        }
+
+        if (i < M) {
+            auto r11 = vec_type::template zero<T>();
+            auto r21 = vec_type::template zero<T>();
+
+            for (size_t k = 0; k < K; ++k) {
+                auto b1 = b.template loadu<vec_type>(k * N + j + 0 * vec_size);
+                auto b2 = b.template loadu<vec_type>(k * N + j + 1 * vec_size);
+
+                auto a1 = vec_type::set(a(i, k));
+
+                r11 = vec_type::template fmadd<Cx>(a1, b1, r11);
+                r21 = vec_type::template fmadd<Cx>(a1, b2, r21);
+            }
+
+            c.template storeu<vec_type>(r11, i * N + j + 0 * vec_size);
+            c.template storeu<vec_type>(r21, i * N + j + 1 * vec_size);
+        }
+    }
+
+    for (; j + vec_size - 1 < N; j += vec_size) {
+        size_t i = 0;
+
+        for (; i + 1 < M; i += 2) {
+            auto r1 = vec_type::template zero<T>();
+            auto r2 = vec_type::template zero<T>();
+
+            for (size_t k = 0; k < K; ++k) {
+                auto b1 = b.template loadu<vec_type>(k * N + j);
+
+                auto a1 = vec_type::set(a(i, k));
+                auto a2 = vec_type::set(a(i + 1, k));
+
+                r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
+                r2 = vec_type::template fmadd<Cx>(a2, b1, r2);
+            }
+
+            c.template storeu<vec_type>(r1, (i+0) * N + j);
+            c.template storeu<vec_type>(r2, (i+1) * N + j);
+        }
+
+        if (i < M) {
+            auto r1 = vec_type::template zero<T>();
+
+            for (size_t k = 0; k < K; ++k) {
+                auto b1 = b.template loadu<vec_type>(k * N + j);
+
+                auto a1 = vec_type::set(a(i, k));
+
+                r1 = vec_type::template fmadd<Cx>(a1, b1, r1);
+            }
+
+            c.template storeu<vec_type>(r1, i * N + j);
+        }
+    }
+
+    for (; j + 1 < N; j += 2) {
+        size_t j1 = j + 0;
+        size_t j2 = j + 1;
+
+        size_t i = 0;
+
+        for (; i + 1 < M; i += 2) {
+            auto r11 = T();
+            auto r12 = T();
+            auto r21 = T();
+            auto r22 = T();
+
+            for (size_t k = 0; k < K; ++k) {
+                r11 += a(i + 0, k) * b(k, j1);
+                r21 += a(i + 0, k) * b(k, j2);
+                r12 += a(i + 1, k) * b(k, j1);
+                r22 += a(i + 1, k) * b(k, j2);
+            }
+
+            c(i + 0, j1) = r11;
+            c(i + 0, j2) = r21;
+            c(i + 1, j1) = r12;
+            c(i + 1, j2) = r22;
+        }
+
+        if (i < M) {
+            auto r1 = T();
+            auto r2 = T();
+
+            for (size_t k = 0; k < K; ++k) {
+                r1 += a(i, k) * b(k, j1);
+                r2 += a(i, k) * b(k, j2);
+            }
+
+            c(i, j1) = r1;
+            c(i, j2) = r2;
+        }
+    }
+
+    if (j < N) {
+        size_t i = 0;
+
+        for (; i + 1 < M; i += 2) {
+            auto r1 = T();
+            auto r2 = T();
+
+            for (size_t k = 0; k < K; ++k) {
+                r1 += a(i, k) * b(k, j);
+                r2 += a(i + 1, k) * b(k, j);
+            }
+
+            c(i + 0, j) = r1;
+            c(i + 1, j) = r2;
+        }
+
+        if (i < M) {
+            auto r1 = T();
+
+            for (size_t k = 0; k < K; ++k) {
+                r1 += a(i, k) * b(k, j);
+            }
+
+            c(i, j) = r1;
+        }
+    }
+}
+
+/*!
+ * \brief Blocking configuration of the packed GEMM kernels.
+ *
+ * The micro-kernels compute a MR x NR block of C in registers. The
+ * macro-kernel works on blocks of MC x KC of A (kept in L2) and
+ * panels of KC x NC of B (kept in L3).
+ *
+ * \tparam V The vectorization mode
+ * \tparam T The value type
+ */
+template <typename V, typename T>
+struct gemm_blocking {
+    static constexpr size_t vec_size = V::template traits<T>::size; ///< The number of elements in a vector
+
+    static constexpr size_t MR = 6;            ///< The number of rows of the micro-kernel
+    static constexpr size_t NR = 2 * vec_size; ///< The number of columns of the micro-kernel
+    static constexpr size_t KC = 256;          ///< The depth of the blocks
+
+    static constexpr size_t MC = MR * std::max<size_t>(1, (96 * 1024) / (KC * sizeof(T) * MR));                  ///< The number of rows of the blocks of A
+    static constexpr size_t NC = NR * std::max<size_t>(1, cache_size / (2 * KC * sizeof(T) * NR)); ///< The number of columns of the panels of B
+};
+
+/*!
+ * \brief Pack a block of A into contiguous micro-panels of MR rows.
+ *
+ * Each micro-panel is stored column by column so that the
+ * micro-kernel can read it sequentially. The last micro-panel is
+ * padded with zeroes.
+ *
+ * \param a The lhs matrix
+ * \param buffer The packing buffer
+ * \param K The number of columns of A
+ * \param i_first The first row of the block
+ * \param mc The number of rows of the block
+ * \param k_first The first column of the block
+ * \param kc The number of columns of the block
+ */
+template <size_t MR, typename A, typename T>
+void gemm_pack_a(const A& a, T* buffer, size_t K, size_t i_first, size_t mc, size_t k_first, size_t kc) {
+    static constexpr bool row_major = decay_traits<A>::storage_order == order::RowMajor;
+
+    const size_t M = etl::rows(a);
+
+    for (size_t ip = 0; ip < mc; ip += MR) {
+        const size_t mr = std::min(MR, mc - ip);
+
+        for (size_t k = 0; k < kc; ++k) {
+            if (row_major) {
+                for (size_t ii = 0; ii < mr; ++ii) {
+                    buffer[k * MR + ii] = a[(i_first + ip + ii) * K + k_first + k];
+                }
+            } else {
+                // The micro-panel is already contiguous in a column major matrix
+                for (size_t ii = 0; ii < mr; ++ii) {
+                    buffer[k * MR + ii] = a[(k_first + k) * M + i_first + ip + ii];
+                }
+            }
+
+            for (size_t ii = mr; ii < MR; ++ii) {
+                buffer[k * MR + ii] = T(0);
+            }
+        }
+
+        buffer += kc * MR;
+    }
+}
+
+/*!
+ * \brief Pack a panel of B into contiguous micro-panels of NR columns.
+ *
+ * Each micro-panel is stored row by row so that the micro-kernel can
+ * read it sequentially with aligned loads. The last micro-panel is
+ * padded with zeroes. A column major B, i.e. the transpose of a row
+ * major matrix, is read column by column.
+ *
+ * \param b The rhs matrix
+ * \param buffer The packing buffer
+ * \param N The number of columns of B
+ * \param k_first The first row of the panel
+ * \param kc The number of rows of the panel
+ * \param j_first The first column of the panel
+ * \param nc The number of columns of the panel
+ */
+template <typename V, size_t NR, typename B, typename T>
+void gemm_pack_b(const B& b, T* buffer, size_t N, size_t k_first, size_t kc, size_t j_first, size_t nc) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size  = vec_type::template traits<T>::size;
+    static constexpr bool row_major   = decay_traits<B>::storage_order == order::RowMajor;
+
+    const size_t K = etl::rows(b);
+
+    for (size_t jp = 0; jp < nc; jp += NR) {
+        const size_t nr = std::min(NR, nc - jp);
+
+        if (!row_major) {
+            for (size_t jj = 0; jj < nr; ++jj) {
+                const size_t offset = (j_first + jp + jj) * K + k_first;
+
+                for (size_t k = 0; k < kc; ++k) {
+                    buffer[k * NR + jj] = b[offset + k];
+                }
+            }
+
+            for (size_t k = 0; k < kc; ++k) {
+                for (size_t jj = nr; jj < NR; ++jj) {
+                    buffer[k * NR + jj] = T(0);
+                }
+            }
+        } else if (nr == NR) {
+            for (size_t k = 0; k < kc; ++k) {
+                const size_t offset = (k_first + k) * N + j_first + jp;
+
+                vec_type::store(buffer + k * NR + 0 * vec_size, b.template loadu<vec_type>(offset + 0 * vec_size));
+                vec_type::store(buffer + k * NR + 1 * vec_size, b.template loadu<vec_type>(offset + 1 * vec_size));
+            }
+        } else {
+            for (size_t k = 0; k < kc; ++k) {
+                const size_t offset = (k_first + k) * N + j_first + jp;
+
+                for (size_t jj = 0; jj < nr; ++jj) {
+                    buffer[k * NR + jj] = b[offset + jj];
+                }
+
+                for (size_t jj = nr; jj < NR; ++jj) {
+                    buffer[k * NR + jj] = T(0);
+                }
+            }
+        }
+
+        buffer += kc * NR;
+    }
+}
+
+/*!
+ * \brief Compute a MR x NR block of C from packed micro-panels of A and B.
+ *
+ * When the block is complete, the result is directly written into C,
+ * otherwise, it goes through a temporary tile and only the valid part
+ * is written.
+ *
+ * \param kc The depth of the micro-panels
+ * \param ap The packed micro-panel of A
+ * \param bp The packed micro-panel of B
+ * \param c The result matrix
+ * \param N The number of columns of C
+ * \param i The first row of the block in C
+ * \param j The first column of the block in C
+ * \param mr The number of valid rows of the block
+ * \param nr The number of valid columns of the block
+ * \param first Indicates if C must be overwritten (true) or accumulated into (false)
+ */
+template <typename V, typename T, typename C>
+void gemm_micro_kernel(size_t kc, const T* ap, const T* bp, C& c, size_t N, size_t i, size_t j, size_t mr, size_t nr, bool first) {
+    using vec_type = V;
+    using blocking = gemm_blocking<V, T>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+    static constexpr bool Cx         = is_complex_t<T>::value;
+    static constexpr size_t MR       = blocking::MR;
+    static constexpr size_t NR       = blocking::NR;
+
+    auto r11 = vec_type::template zero<T>();
+    auto r12 = vec_type::template zero<T>();
+    auto r21 = vec_type::template zero<T>();
+    auto r22 = vec_type::template zero<T>();
+    auto r31 = vec_type::template zero<T>();
+    auto r32 = vec_type::template zero<T>();
+    auto r41 = vec_type::template zero<T>();
+    auto r42 = vec_type::template zero<T>();
+    auto r51 = vec_type::template zero<T>();
+    auto r52 = vec_type::template zero<T>();
+    auto r61 = vec_type::template zero<T>();
+    auto r62 = vec_type::template zero<T>();
+
+    for (size_t k = 0; k < kc; ++k) {
+        auto b1 = vec_type::load(bp + k * NR + 0 * vec_size);
+        auto b2 = vec_type::load(bp + k * NR + 1 * vec_size);
+
+        auto a1 = vec_type::set(ap[k * MR + 0]);
+        r11     = vec_type::template fmadd<Cx>(a1, b1, r11);
+        r12     = vec_type::template fmadd<Cx>(a1, b2, r12);
+
+        auto a2 = vec_type::set(ap[k * MR + 1]);
+        r21     = vec_type::template fmadd<Cx>(a2, b1, r21);
+        r22     = vec_type::template fmadd<Cx>(a2, b2, r22);
+
+        auto a3 = vec_type::set(ap[k * MR + 2]);
+        r31     = vec_type::template fmadd<Cx>(a3, b1, r31);
+        r32     = vec_type::template fmadd<Cx>(a3, b2, r32);
+
+        auto a4 = vec_type::set(ap[k * MR + 3]);
+        r41     = vec_type::template fmadd<Cx>(a4, b1, r41);
+        r42     = vec_type::template fmadd<Cx>(a4, b2, r42);
+
+        auto a5 = vec_type::set(ap[k * MR + 4]);
+        r51     = vec_type::template fmadd<Cx>(a5, b1, r51);
+        r52     = vec_type::template fmadd<Cx>(a5, b2, r52);
+
+        auto a6 = vec_type::set(ap[k * MR + 5]);
+        r61     = vec_type::template fmadd<Cx>(a6, b1, r61);
+        r62     = vec_type::template fmadd<Cx>(a6, b2, r62);
+    }
+
+    if (mr == MR && nr == NR) {
+        if (!first) {
+            r11 = vec_type::add(r11, c.template loadu<vec_type>((i + 0) * N + j + 0 * vec_size));
+            r12 = vec_type::add(r12, c.template loadu<vec_type>((i + 0) * N + j + 1 * vec_size));
+            r21 = vec_type::add(r21, c.template loadu<vec_type>((i + 1) * N + j + 0 * vec_size));
+            r22 = vec_type::add(r22, c.template loadu<vec_type>((i + 1) * N + j + 1 * vec_size));
+            r31 = vec_type::add(r31, c.template loadu<vec_type>((i + 2) * N + j + 0 * vec_size));
+            r32 = vec_type::add(r32, c.template loadu<vec_type>((i + 2) * N + j + 1 * vec_size));
+            r41 = vec_type::add(r41, c.template loadu<vec_type>((i + 3) * N + j + 0 * vec_size));
+            r42 = vec_type::add(r42, c.template loadu<vec_type>((i + 3) * N + j + 1 * vec_size));
+            r51 = vec_type::add(r51, c.template loadu<vec_type>((i + 4) * N + j + 0 * vec_size));
+            r52 = vec_type::add(r52, c.template loadu<vec_type>((i + 4) * N + j + 1 * vec_size));
+            r61 = vec_type::add(r61, c.template loadu<vec_type>((i + 5) * N + j + 0 * vec_size));
+            r62 = vec_type::add(r62, c.template loadu<vec_type>((i + 5) * N + j + 1 * vec_size));
+        }
+
+        c.template storeu<vec_type>(r11, (i + 0) * N + j + 0 * vec_size);
+        c.template storeu<vec_type>(r12, (i + 0) * N + j + 1 * vec_size);
+        c.template storeu<vec_type>(r21, (i + 1) * N + j + 0 * vec_size);
+        c.template storeu<vec_type>(r22, (i + 1) * N + j + 1 * vec_size);
+        c.template storeu<vec_type>(r31, (i + 2) * N + j + 0 * vec_size);
+        c.template storeu<vec_type>(r32, (i + 2) * N + j + 1 * vec_size);
+        c.template storeu<vec_type>(r41, (i + 3) * N + j + 0 * vec_size);
+        c.template storeu<vec_type>(r42, (i + 3) * N + j + 1 * vec_size);
+        c.template storeu<vec_type>(r51, (i + 4) * N + j + 0 * vec_size);
+        c.template storeu<vec_type>(r52, (i + 4) * N + j + 1 * vec_size);
+        c.template storeu<vec_type>(r61, (i + 5) * N + j + 0 * vec_size);
+        c.template storeu<vec_type>(r62, (i + 5) * N + j + 1 * vec_size);
+    } else {
+        T tile[MR * NR];
+
+        vec_type::storeu(tile + 0 * NR + 0 * vec_size, r11);
+        vec_type::storeu(tile + 0 * NR + 1 * vec_size, r12);
+        vec_type::storeu(tile + 1 * NR + 0 * vec_size, r21);
+        vec_type::storeu(tile + 1 * NR + 1 * vec_size, r22);
+        vec_type::storeu(tile + 2 * NR + 0 * vec_size, r31);
+        vec_type::storeu(tile + 2 * NR + 1 * vec_size, r32);
+        vec_type::storeu(tile + 3 * NR + 0 * vec_size, r41);
+        vec_type::storeu(tile + 3 * NR + 1 * vec_size, r42);
+        vec_type::storeu(tile + 4 * NR + 0 * vec_size, r51);
+        vec_type::storeu(tile + 4 * NR + 1 * vec_size, r52);
+        vec_type::storeu(tile + 5 * NR + 0 * vec_size, r61);
+        vec_type::storeu(tile + 5 * NR + 1 * vec_size, r62);
+
+        for (size_t ii = 0; ii < mr; ++ii) {
+            for (size_t jj = 0; jj < nr; ++jj) {
+                if (first) {
+                    c[(i + ii) * N + j + jj] = tile[ii * NR + jj];
+                } else {
+                    c[(i + ii) * N + j + jj] += tile[ii * NR + jj];
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Optimized version of large GEMM for row major version
+ *
+ * The panels of B and the blocks of A are packed into aligned
+ * contiguous buffers and the result is computed by a register-blocked
+ * micro-kernel. The blocks of A are distributed over the threads.
+ *
+ * Once a MCxNC block of C is complete, i.e. after the micro-kernels of
+ * the last panel of B, the epilogue is called on it while it is still in
+ * the L2 cache. Calling it once per block rather than once per tile of
+ * the micro-kernel keeps its overhead negligible. The epilogue may be
+ * called concurrently on different blocks.
+ *
+ * \param a The lhs matrix
+ * \param b The rhs matrix
+ * \param c The result matrix
+ * \param epilogue The functor called with (first_row, last_row, first_column, last_column) of each complete block of C
+ */
+template <typename V, typename A, typename B, typename C, typename Epilogue>
+void gemm_large_kernel(const A& a, const B& b, C& c, Epilogue&& epilogue) {
+    using T        = value_t<A>;
+    using blocking = gemm_blocking<V, T>;
+
+    static constexpr size_t MR = blocking::MR;
+    static constexpr size_t NR = blocking::NR;
+    static constexpr size_t MC = blocking::MC;
+    static constexpr size_t KC = blocking::KC;
+    static constexpr size_t NC = blocking::NC;
+
+    const size_t M = etl::rows(a);
+    const size_t N = etl::columns(b);
+    const size_t K = etl::columns(a);
+
+    const size_t m_panels = (M + MR - 1) / MR;
+
+    const bool p = m_panels > 1 && select_parallel(M * N * K, gemm_parallel_threshold);
+
+    auto b_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(std::min(KC, K) * (std::min(NC, N) + NR))};
+
+    for (size_t jc = 0; jc < N; jc += NC) {
+        const size_t nc = std::min(NC, N - jc);
+
+        for (size_t pc = 0; pc < K; pc += KC) {
+            const size_t kc   = std::min(KC, K - pc);
+            const bool first = pc == 0;
+            const bool last  = pc + kc == K;
+
+            gemm_pack_b<V, NR>(b, b_buffer.get(), N, pc, kc, jc, nc);
+
+            const T* b_packed = b_buffer.get();
+
+            // Each thread packs its own blocks of A
+
+            auto batch_fun_i = [&](const size_t first_panel, const size_t last_panel) {
+                auto a_buffer = aligned_ptr<T>{aligned_allocator<64>::allocate<T>(kc * MC)};
+
+                for (size_t ic = first_panel * MR; ic < std::min(last_panel * MR, M); ic += MC) {
+                    const size_t mc = std::min({MC, M - ic, last_panel * MR - ic});
+
+                    gemm_pack_a<MR>(a, a_buffer.get(), K, ic, mc, pc, kc);
+
+                    for (size_t jr = 0; jr < nc; jr += NR) {
+                        const size_t nr = std::min(NR, nc - jr);
+
+                        for (size_t ir = 0; ir < mc; ir += MR) {
+                            const size_t mr = std::min(MR, mc - ir);
+
+                            gemm_micro_kernel<V>(kc, a_buffer.get() + ir * kc, b_packed + jr * kc, c, N, ic + ir, jc + jr, mr, nr, first);
+                        }
+                    }
+
+                    // The MCxNC block of C is complete and still in the L2 cache
+                    if (last) {
+                        epilogue(ic, ic + mc, jc, jc + nc);
+                    }
+                }
+            };
+
+            dispatch_1d_threads(p, batch_fun_i, 0, m_panels);
+        }
+    }
+}
+
+
+/*!
+ * \brief Compute the GEMV of row major operands with the vectorization
+ * mode of the namespace
+ * \param a The lhs matrix
+ * \param b The rhs vector
+ * \param c The result vector
+ */
+template <typename A, typename B, typename C>
+void gemv_kernel(A&& a, B&& b, C&& c) {
+    if (etl::size(a) < gemv_small_threshold) {
+        gemv_small_kernel<default_vec>(a, b, c);
+    } else {
+        gemv_large_kernel<default_vec>(a, b, c);
+    }
+}
+
+/*!
+ * \brief Compute the GEVM of row major operands with the vectorization
+ * mode of the namespace
+ * \param a The lhs vector
+ * \param b The rhs matrix
+ * \param c The result vector
+ */
+template <typename A, typename B, typename C>
+void gevm_kernel(A&& a, B&& b, C&& c) {
+    if (etl::size(b) < gevm_small_threshold) {
+        gevm_small_kernel<default_vec>(a, b, c);
+    } else {
+        gevm_large_kernel<default_vec>(a, b, c);
+    }
+}
+
+/*!
+ * \brief Compute the GEMM of a row major result with the vectorization
+ * mode of the namespace
+ * \param a The lhs matrix
+ * \param b The rhs matrix
+ * \param c The result matrix
+ */
+template <typename A, typename B, typename C>
+void gemm_kernel(A&& a, B&& b, C&& c) {
+    // The small kernel reads B directly, row by row
+    if (all_row_major<B>::value && etl::size(b) < 10000) {
+        gemm_small_kernel<default_vec>(a, b, c);
+    } else {
+        gemm_large_kernel<default_vec>(a, b, c, [](size_t, size_t, size_t, size_t) {});
+    }
+}
+
+/*!
+ * \brief Compute the GEMM of row major operands with the vectorization
+ * mode of the namespace, calling the given epilogue on the parts of C as
+ * soon as they are computed.
+ * \param a The lhs matrix
+ * \param b The rhs matrix
+ * \param c The result matrix
+ * \param epilogue The functor to call on each complete part of C
+ */
+template <typename A, typename B, typename C, typename Epilogue>
+void gemm_kernel(A&& a, B&& b, C&& c, Epilogue&& epilogue) {
+    using T = value_t<A>;
+
+    const size_t M = etl::rows(a);
+    const size_t N = etl::columns(b);
+    const size_t K = etl::columns(a);
+
+    if (etl::size(b) < 10000) {
+        // B is not packed, the multiplication can be done by panels of rows of A
+        const size_t rows = std::max(gemm_epilogue_panel / N, size_t(16));
+
+        for (size_t first = 0; first < M; first += rows) {
+            const size_t last = std::min(first + rows, M);
+
+            // Note: a_panel is only read, the const_cast is only here to allow the view
+            custom_dyn_matrix<T> a_panel(const_cast<T*>(a.memory_start()) + first * K, last - first, K);
+            custom_dyn_matrix<T> c_panel(c.memory_start() + first * N, last - first, N);
+
+            gemm_small_kernel<default_vec>(a_panel, b, c_panel);
+
+            epilogue(first, last, size_t(0), N);
+        }
+    } else {
+        gemm_large_kernel<default_vec>(a, b, c, epilogue);
+    }
+}
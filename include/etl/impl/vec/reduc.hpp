@@ -0,0 +1,111 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the column reductions
+ *
+ * The columns are split into panels small enough to keep their sums in
+ * the L1 cache. The rows are then streamed one after another, each one
+ * being read contiguously on the width of the panel and added to the sums.
+ * The elements of each column are added in the order of the rows, as in
+ * the standard implementation.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Compute the sums of the columns [first, last) of a
+ * \param a The input expression, seen as a matrix of rows
+ * \param c The output expression, with one element per column
+ * \param first The first column
+ * \param last The last column (exclusive)
+ */
+template <typename V, typename A, typename C>
+void selected_sum_l(const A& a, C&& c, std::size_t first, std::size_t last) {
+    using T = value_t<A>;
+
+    static constexpr std::size_t vec_size = V::template traits<T>::size;
+    static constexpr std::size_t panel    = 8192 / sizeof(T); // The sums of a panel use 8KB of L1
+
+    const std::size_t m = etl::dim<0>(a);
+    const std::size_t n = etl::size(a) / m;
+
+    auto out = c.memory_start();
+
+    for (std::size_t pf = first; pf < last; pf += panel) {
+        const std::size_t pl = std::min(last, pf + panel);
+
+        for (std::size_t j = pf; j < pl; ++j) {
+            out[j] = T(0);
+        }
+
+        for (std::size_t i = 0; i < m; ++i) {
+            const std::size_t row = i * n;
+
+            std::size_t j = pf;
+
+            for (; j + 4 * vec_size <= pl; j += 4 * vec_size) {
+                auto r1 = V::add(V::loadu(out + j + 0 * vec_size), a.template loadu<V>(row + j + 0 * vec_size));
+                auto r2 = V::add(V::loadu(out + j + 1 * vec_size), a.template loadu<V>(row + j + 1 * vec_size));
+                auto r3 = V::add(V::loadu(out + j + 2 * vec_size), a.template loadu<V>(row + j + 2 * vec_size));
+                auto r4 = V::add(V::loadu(out + j + 3 * vec_size), a.template loadu<V>(row + j + 3 * vec_size));
+
+                V::storeu(out + j + 0 * vec_size, r1);
+                V::storeu(out + j + 1 * vec_size, r2);
+                V::storeu(out + j + 2 * vec_size, r3);
+                V::storeu(out + j + 3 * vec_size, r4);
+            }
+
+            for (; j + vec_size <= pl; j += vec_size) {
+                V::storeu(out + j, V::add(V::loadu(out + j), a.template loadu<V>(row + j)));
+            }
+
+            for (; j < pl; ++j) {
+                out[j] += a.read_flat(row + j);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Compute the sums of the columns [first, last) of a
+ * \param a The input expression, seen as a matrix of rows
+ * \param c The output expression, with one element per column
+ * \param first The first column
+ * \param last The last column (exclusive)
+ */
+template <typename A, typename C, cpp_enable_if((vec_enabled && all_vectorizable<vector_mode, A>::value))>
+void sum_l(const A& a, C&& c, std::size_t first, std::size_t last) {
+    selected_sum_l<default_vec>(a, c, first, last);
+}
+
+/*!
+ * \brief Compute the sums of the columns [first, last) of a
+ * \param a The input expression, seen as a matrix of rows
+ * \param c The output expression, with one element per column
+ * \param first The first column
+ * \param last The last column (exclusive)
+ */
+template <typename A, typename C, cpp_disable_if((vec_enabled && all_vectorizable<vector_mode, A>::value))>
+void sum_l(const A& a, C&& c, std::size_t first, std::size_t last) {
+    cpp_unused(a);
+    cpp_unused(c);
+    cpp_unused(first);
+    cpp_unused(last);
+    cpp_unreachable("vec::sum_l called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
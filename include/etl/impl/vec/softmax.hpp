@@ -0,0 +1,444 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the softmax functions
+ *
+ * The maximum and the sum of the exponentials are computed in a single
+ * pass over the input: each lane keeps its own running maximum, updated
+ * once per block of vectors, its partial sum being rescaled at the same
+ * time. The second pass normalizes the result.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief The vector mode used by the softmax kernels for values of type T.
+ *
+ * The kernels need the exponential, which is not available in every
+ * vector mode.
+ */
+template <typename T>
+constexpr vector_mode_t softmax_vector_mode =
+      (avx512_enabled && exp_unary_op<T>::template vectorizable<vector_mode_t::AVX512>::value) ? vector_mode_t::AVX512
+    : (avx_enabled && exp_unary_op<T>::template vectorizable<vector_mode_t::AVX>::value) ? vector_mode_t::AVX
+    : (sse3_enabled && exp_unary_op<T>::template vectorizable<vector_mode_t::SSE3>::value) ? vector_mode_t::SSE3
+    : vector_mode_t::NONE;
+
+/*!
+ * \brief Traits indicating if the softmax of A can be computed into C
+ * with the vectorized kernels
+ */
+template <typename A, typename C>
+using softmax_vectorizable = cpp::bool_constant<
+    all_dma<A, C>::value && all_floating<A, C>::value && softmax_vector_mode<value_t<A>> != vector_mode_t::NONE>;
+
+/*!
+ * \brief Compute the exponential of the given vector.
+ *
+ * The arguments are clamped at common::softmax_exp_min, like in the
+ * standard implementation. NaN arguments are kept.
+ *
+ * \param x The vector of arguments
+ * \return The vector of exponentials
+ */
+template <typename V, typename T>
+inline typename V::template vec_type<T> softmax_exp(typename V::template vec_type<T> x) {
+    return V::exp(V::max(V::set(common::softmax_exp_min<T>), x));
+}
+
+/*!
+ * \brief Returns the number of values of the maximums saved by
+ * softmax_max_sum for n elements
+ * \param n The number of elements
+ * \return The number of values of the saved maximums
+ */
+template <typename V, typename T>
+std::size_t softmax_steps(std::size_t n) {
+    static constexpr std::size_t vec_size = V::template traits<T>::size;
+
+    return (n / (4 * vec_size) + (n % (4 * vec_size)) / vec_size) * vec_size;
+}
+
+/*!
+ * \brief Compute the maximum of the n elements of in and the sum of their
+ * exponentials relative to the maximum, in a single pass.
+ *
+ * If Store is true, the exponentials are stored in out, relative to the
+ * running maximums of their lanes, which are saved in steps after each
+ * block. softmax_rescale corrects them afterwards.
+ *
+ * \param in The input memory
+ * \param out The output memory
+ * \param steps The memory where the running maximums are saved
+ * \param n The number of elements
+ * \param max The computed maximum
+ * \param sum The computed sum of exp(in[i] - max)
+ */
+template <typename V, bool Store, typename T>
+void softmax_max_sum(const T* in, T* out, T* steps, std::size_t n, T& max, T& sum) {
+    static constexpr std::size_t vec_size = V::template traits<T>::size;
+
+    auto m = V::set(std::numeric_limits<T>::lowest());
+    auto s = V::template zero<T>();
+
+    std::size_t i = 0;
+
+    for (; i + 4 * vec_size <= n; i += 4 * vec_size) {
+        auto x1 = V::loadu(in + i + 0 * vec_size);
+        auto x2 = V::loadu(in + i + 1 * vec_size);
+        auto x3 = V::loadu(in + i + 2 * vec_size);
+        auto x4 = V::loadu(in + i + 3 * vec_size);
+
+        auto mm = V::max(m, V::max(V::max(x1, x2), V::max(x3, x4)));
+
+        auto e1 = softmax_exp<V, T>(V::sub(x1, mm));
+        auto e2 = softmax_exp<V, T>(V::sub(x2, mm));
+        auto e3 = softmax_exp<V, T>(V::sub(x3, mm));
+        auto e4 = softmax_exp<V, T>(V::sub(x4, mm));
+
+        s = V::add(V::mul(s, softmax_exp<V, T>(V::sub(m, mm))), V::add(V::add(e1, e2), V::add(e3, e4)));
+        m = mm;
+
+        if (Store) {
+            V::storeu(out + i + 0 * vec_size, e1);
+            V::storeu(out + i + 1 * vec_size, e2);
+            V::storeu(out + i + 2 * vec_size, e3);
+            V::storeu(out + i + 3 * vec_size, e4);
+
+            V::storeu(steps, m);
+            steps += vec_size;
+        }
+    }
+
+    for (; i + vec_size <= n; i += vec_size) {
+        auto x1 = V::loadu(in + i);
+
+        auto mm = V::max(m, x1);
+        auto e1 = softmax_exp<V, T>(V::sub(x1, mm));
+
+        s = V::add(V::mul(s, softmax_exp<V, T>(V::sub(m, mm))), e1);
+        m = mm;
+
+        if (Store) {
+            V::storeu(out + i, e1);
+
+            V::storeu(steps, m);
+            steps += vec_size;
+        }
+    }
+
+    // Merge the lanes and the remaining elements
+
+    T lanes_m[vec_size];
+    T lanes_s[vec_size];
+
+    V::storeu(lanes_m, m);
+    V::storeu(lanes_s, s);
+
+    max = lanes_m[0];
+
+    for (std::size_t l = 1; l < vec_size; ++l) {
+        max = std::max(max, lanes_m[l]);
+    }
+
+    for (std::size_t j = i; j < n; ++j) {
+        max = std::max(max, in[j]);
+    }
+
+    sum = T(0);
+
+    for (std::size_t l = 0; l < vec_size; ++l) {
+        sum += lanes_s[l] * common::softmax_exp(lanes_m[l] - max);
+    }
+
+    for (std::size_t j = i; j < n; ++j) {
+        const T e = common::softmax_exp(in[j] - max);
+
+        if (Store) {
+            out[j] = e;
+        }
+
+        sum += e;
+    }
+}
+
+/*!
+ * \brief Normalize the exponentials stored by softmax_max_sum
+ *
+ * If Diag is true, the diagonal of the Jacobian, s * (1 - s) for each
+ * softmax value s, is stored instead.
+ *
+ * \param out The memory of the exponentials
+ * \param steps The running maximums saved by softmax_max_sum
+ * \param n The number of elements
+ * \param max The maximum of the elements
+ * \param scale The inverse of the sum of the exponentials
+ */
+template <typename V, bool Diag, typename T>
+void softmax_rescale(T* out, const T* steps, std::size_t n, T max, T scale) {
+    static constexpr std::size_t vec_size = V::template traits<T>::size;
+
+    const auto vmax   = V::set(max);
+    const auto vscale = V::set(scale);
+    const auto vone   = V::set(T(1));
+
+    auto finish = [&vone](typename V::template vec_type<T> s) {
+        return Diag ? V::mul(s, V::sub(vone, s)) : s;
+    };
+
+    std::size_t i = 0;
+
+    for (; i + 4 * vec_size <= n; i += 4 * vec_size) {
+        auto f = V::mul(softmax_exp<V, T>(V::sub(V::loadu(steps), vmax)), vscale);
+        steps += vec_size;
+
+        V::storeu(out + i + 0 * vec_size, finish(V::mul(V::loadu(out + i + 0 * vec_size), f)));
+        V::storeu(out + i + 1 * vec_size, finish(V::mul(V::loadu(out + i + 1 * vec_size), f)));
+        V::storeu(out + i + 2 * vec_size, finish(V::mul(V::loadu(out + i + 2 * vec_size), f)));
+        V::storeu(out + i + 3 * vec_size, finish(V::mul(V::loadu(out + i + 3 * vec_size), f)));
+    }
+
+    for (; i + vec_size <= n; i += vec_size) {
+        auto f = V::mul(softmax_exp<V, T>(V::sub(V::loadu(steps), vmax)), vscale);
+        steps += vec_size;
+
+        V::storeu(out + i, finish(V::mul(V::loadu(out + i), f)));
+    }
+
+    for (; i < n; ++i) {
+        const T s = out[i] * scale;
+        out[i]    = Diag ? s * (T(1) - s) : s;
+    }
+}
+
+/*!
+ * \brief Compute the softmax of the elements [first, last) of a
+ * \param a The input expression
+ * \param c The output expression
+ * \param first The first element
+ * \param last The last element (exclusive)
+ */
+template <typename A, typename C, cpp_enable_if((softmax_vectorizable<A, C>::value))>
+void softmax(const A& a, C&& c, std::size_t first, std::size_t last) {
+    using V = typename get_vector_impl<softmax_vector_mode<value_t<A>>>::type;
+    using T = value_t<A>;
+
+    static constexpr std::size_t vec_size = V::template traits<T>::size;
+
+    const std::size_t n = last - first;
+
+    const T* in = a.memory_start() + first;
+    T* out      = c.memory_start() + first;
+
+    auto s1 = V::template zero<T>();
+    auto s2 = V::template zero<T>();
+
+    std::size_t i = 0;
+
+    for (; i + 2 * vec_size <= n; i += 2 * vec_size) {
+        auto e1 = softmax_exp<V, T>(V::loadu(in + i + 0 * vec_size));
+        auto e2 = softmax_exp<V, T>(V::loadu(in + i + 1 * vec_size));
+
+        V::storeu(out + i + 0 * vec_size, e1);
+        V::storeu(out + i + 1 * vec_size, e2);
+
+        s1 = V::add(s1, e1);
+        s2 = V::add(s2, e2);
+    }
+
+    for (; i + vec_size <= n; i += vec_size) {
+        auto e1 = softmax_exp<V, T>(V::loadu(in + i));
+
+        V::storeu(out + i, e1);
+
+        s1 = V::add(s1, e1);
+    }
+
+    T sum = V::hadd(V::add(s1, s2));
+
+    for (; i < n; ++i) {
+        out[i] = common::softmax_exp(in[i]);
+        sum += out[i];
+    }
+
+    const T scale = T(1) / sum;
+    const auto vscale = V::set(scale);
+
+    i = 0;
+
+    for (; i + vec_size <= n; i += vec_size) {
+        V::storeu(out + i, V::mul(V::loadu(out + i), vscale));
+    }
+
+    for (; i < n; ++i) {
+        out[i] *= scale;
+    }
+}
+
+/*!
+ * \brief Compute the stable softmax of the elements [first, last) of a
+ *
+ * The running maximums are saved in a per-thread buffer, which is only
+ * grown, so that computing the softmax of many rows does not allocate.
+ * If Diag is true, the diagonal of the Jacobian, s * (1 - s) for each
+ * softmax value s, is stored instead.
+ *
+ * \param a The input expression
+ * \param c The output expression
+ * \param first The first element
+ * \param last The last element (exclusive)
+ */
+template <bool Diag = false, typename A, typename C, cpp_enable_if((softmax_vectorizable<A, C>::value))>
+void stable_softmax(const A& a, C&& c, std::size_t first, std::size_t last) {
+    using V = typename get_vector_impl<softmax_vector_mode<value_t<A>>>::type;
+    using T = value_t<A>;
+
+    const std::size_t n = last - first;
+
+    const T* in = a.memory_start() + first;
+    T* out      = c.memory_start() + first;
+
+    static thread_local std::vector<T> steps;
+
+    if (steps.size() < softmax_steps<V, T>(n)) {
+        steps.resize(softmax_steps<V, T>(n));
+    }
+
+    T max;
+    T sum;
+
+    softmax_max_sum<V, true>(in, out, steps.data(), n, max, sum);
+    softmax_rescale<V, Diag>(out, steps.data(), n, max, T(1) / sum);
+}
+
+/*!
+ * \brief Compute the diagonal of the Jacobian of the stable softmax of
+ * the elements [first, last) of a
+ * \param a The input expression
+ * \param c The output expression
+ * \param first The first element
+ * \param last The last element (exclusive)
+ */
+template <typename A, typename C, cpp_enable_if((softmax_vectorizable<A, C>::value))>
+void softmax_jacobian_diag(const A& a, C&& c, std::size_t first, std::size_t last) {
+    stable_softmax<true>(a, c, first, last);
+}
+
+/*!
+ * \brief Compute the logarithm of the softmax of the elements [first, last) of a
+ * \param a The input expression
+ * \param c The output expression
+ * \param first The first element
+ * \param last The last element (exclusive)
+ */
+template <typename A, typename C, cpp_enable_if((softmax_vectorizable<A, C>::value))>
+void log_softmax(const A& a, C&& c, std::size_t first, std::size_t last) {
+    using V = typename get_vector_impl<softmax_vector_mode<value_t<A>>>::type;
+    using T = value_t<A>;
+
+    static constexpr std::size_t vec_size = V::template traits<T>::size;
+
+    const std::size_t n = last - first;
+
+    const T* in = a.memory_start() + first;
+    T* out      = c.memory_start() + first;
+
+    T max;
+    T sum;
+
+    softmax_max_sum<V, false, T>(in, out, nullptr, n, max, sum);
+
+    const T shift = max + std::log(sum);
+    const auto vshift = V::set(shift);
+
+    std::size_t i = 0;
+
+    for (; i + vec_size <= n; i += vec_size) {
+        V::storeu(out + i, V::sub(V::loadu(in + i), vshift));
+    }
+
+    for (; i < n; ++i) {
+        out[i] = in[i] - shift;
+    }
+}
+
+/*!
+ * \brief Compute the softmax of the elements [first, last) of a
+ * \param a The input expression
+ * \param c The output expression
+ * \param first The first element
+ * \param last The last element (exclusive)
+ */
+template <typename A, typename C, cpp_disable_if((softmax_vectorizable<A, C>::value))>
+void softmax(const A& a, C&& c, std::size_t first, std::size_t last) {
+    cpp_unused(a);
+    cpp_unused(c);
+    cpp_unused(first);
+    cpp_unused(last);
+    cpp_unreachable("vec::softmax called with invalid parameters");
+}
+
+/*!
+ * \brief Compute the stable softmax of the elements [first, last) of a
+ * \param a The input expression
+ * \param c The output expression
+ * \param first The first element
+ * \param last The last element (exclusive)
+ */
+template <bool Diag = false, typename A, typename C, cpp_disable_if((softmax_vectorizable<A, C>::value))>
+void stable_softmax(const A& a, C&& c, std::size_t first, std::size_t last) {
+    cpp_unused(a);
+    cpp_unused(c);
+    cpp_unused(first);
+    cpp_unused(last);
+    cpp_unreachable("vec::stable_softmax called with invalid parameters");
+}
+
+/*!
+ * \brief Compute the diagonal of the Jacobian of the stable softmax of
+ * the elements [first, last) of a
+ * \param a The input expression
+ * \param c The output expression
+ * \param first The first element
+ * \param last The last element (exclusive)
+ */
+template <typename A, typename C, cpp_disable_if((softmax_vectorizable<A, C>::value))>
+void softmax_jacobian_diag(const A& a, C&& c, std::size_t first, std::size_t last) {
+    cpp_unused(a);
+    cpp_unused(c);
+    cpp_unused(first);
+    cpp_unused(last);
+    cpp_unreachable("vec::softmax_jacobian_diag called with invalid parameters");
+}
+
+/*!
+ * \brief Compute the logarithm of the softmax of the elements [first, last) of a
+ * \param a The input expression
+ * \param c The output expression
+ * \param first The first element
+ * \param last The last element (exclusive)
+ */
+template <typename A, typename C, cpp_disable_if((softmax_vectorizable<A, C>::value))>
+void log_softmax(const A& a, C&& c, std::size_t first, std::size_t last) {
+    cpp_unused(a);
+    cpp_unused(c);
+    cpp_unused(first);
+    cpp_unused(last);
+    cpp_unreachable("vec::log_softmax called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
@@ -0,0 +1,240 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the "stats" reduction
+ *
+ * Each lane of the accumulators runs its own Welford recurrence. Since all
+ * the lanes see the same number of values, the reciprocal of the count is
+ * shared. The lanes are merged at the end of the range.
+ *
+ * The minimum and the maximum are tracked by block of values. Only the
+ * block containing the first extremum is read again at the end, with the
+ * same vectorized loads, to find its index.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Find the index of the first value equal to v in [first, last) of e
+ *
+ * The values are read with the same vectorized loads as the reduction
+ * so that they are exactly the values that have been compared.
+ *
+ * \param e The expression to search
+ * \param v The value to search for
+ * \param first The beginning of the range
+ * \param last The end of the range, first + a multiple of the vector size
+ * \tparam V The vectorization mode
+ * \return the index of the first value equal to v, or first if there are none
+ */
+template <typename V, typename E>
+std::size_t find_first(const E& e, value_t<E> v, std::size_t first, std::size_t last) {
+    using T = value_t<E>;
+
+    static constexpr std::size_t vec_size = V::template traits<T>::size;
+
+    T tmp[vec_size];
+
+    for (std::size_t i = first; i < last; i += vec_size) {
+        V::storeu(tmp, e.template loadu<V>(i));
+
+        for (std::size_t l = 0; l < vec_size; ++l) {
+            if (tmp[l] == v) {
+                return i + l;
+            }
+        }
+    }
+
+    return first;
+}
+
+/*!
+ * \brief Compute the statistics of the input in the given range
+ * \param e The input expression
+ * \param first The beginning of the range
+ * \param last The end of the range
+ * \tparam V The vectorization mode
+ * \return the statistics of the range
+ */
+template <typename V, typename E>
+statistics<value_t<E>> selected_stats(const E& e, std::size_t first, std::size_t last) {
+    using T = value_t<E>;
+
+    static constexpr std::size_t vec_size = V::template traits<T>::size;
+    static constexpr std::size_t lanes    = 4 * vec_size;
+    static constexpr std::size_t block    = 32 * lanes;
+
+    statistics<T> result;
+
+    std::size_t i = first;
+
+    if (last - first >= lanes) {
+        auto m1 = V::template zero<T>();
+        auto m2 = V::template zero<T>();
+        auto m3 = V::template zero<T>();
+        auto m4 = V::template zero<T>();
+
+        auto s1 = V::template zero<T>();
+        auto s2 = V::template zero<T>();
+        auto s3 = V::template zero<T>();
+        auto s4 = V::template zero<T>();
+
+        T min_value        = T(0);
+        T max_value        = T(0);
+        std::size_t min_bf = first;
+        std::size_t min_bl = first;
+        std::size_t max_bf = first;
+        std::size_t max_bl = first;
+
+        std::size_t k = 0;
+
+        T tmp[vec_size];
+
+        while (i + lanes <= last) {
+            const std::size_t end = i + std::min(block, (last - i) / lanes * lanes);
+
+            auto bmin = e.template loadu<V>(i);
+            auto bmax = bmin;
+
+            for (std::size_t j = i; j < end; j += lanes) {
+                const auto inv = V::set(T(1) / T(++k));
+
+                auto x1 = e.template loadu<V>(j + 0 * vec_size);
+                auto x2 = e.template loadu<V>(j + 1 * vec_size);
+                auto x3 = e.template loadu<V>(j + 2 * vec_size);
+                auto x4 = e.template loadu<V>(j + 3 * vec_size);
+
+                auto d1 = V::sub(x1, m1);
+                auto d2 = V::sub(x2, m2);
+                auto d3 = V::sub(x3, m3);
+                auto d4 = V::sub(x4, m4);
+
+                m1 = V::fmadd(d1, inv, m1);
+                m2 = V::fmadd(d2, inv, m2);
+                m3 = V::fmadd(d3, inv, m3);
+                m4 = V::fmadd(d4, inv, m4);
+
+                s1 = V::fmadd(d1, V::sub(x1, m1), s1);
+                s2 = V::fmadd(d2, V::sub(x2, m2), s2);
+                s3 = V::fmadd(d3, V::sub(x3, m3), s3);
+                s4 = V::fmadd(d4, V::sub(x4, m4), s4);
+
+                bmin = V::min(bmin, V::min(V::min(x1, x2), V::min(x3, x4)));
+                bmax = V::max(bmax, V::max(V::max(x1, x2), V::max(x3, x4)));
+            }
+
+            V::storeu(tmp, bmin);
+            const T block_min = *std::min_element(tmp, tmp + vec_size);
+
+            V::storeu(tmp, bmax);
+            const T block_max = *std::max_element(tmp, tmp + vec_size);
+
+            // On ties, the first block wins
+            if (i == first || block_min < min_value) {
+                min_value = block_min;
+                min_bf    = i;
+                min_bl    = end;
+            }
+
+            if (i == first || block_max > max_value) {
+                max_value = block_max;
+                max_bf    = i;
+                max_bl    = end;
+            }
+
+            i = end;
+        }
+
+        // Merge the lanes, they all have k values
+
+        T means[lanes];
+        T sums[lanes];
+
+        V::storeu(means + 0 * vec_size, m1);
+        V::storeu(means + 1 * vec_size, m2);
+        V::storeu(means + 2 * vec_size, m3);
+        V::storeu(means + 3 * vec_size, m4);
+
+        V::storeu(sums + 0 * vec_size, s1);
+        V::storeu(sums + 1 * vec_size, s2);
+        V::storeu(sums + 2 * vec_size, s3);
+        V::storeu(sums + 3 * vec_size, s4);
+
+        T mean = T(0);
+
+        for (std::size_t l = 0; l < lanes; ++l) {
+            mean += means[l];
+        }
+
+        mean /= T(lanes);
+
+        T m2_sum = T(0);
+
+        for (std::size_t l = 0; l < lanes; ++l) {
+            m2_sum += sums[l] + T(k) * (means[l] - mean) * (means[l] - mean);
+        }
+
+        result.count  = k * lanes;
+        result.mean   = mean;
+        result.m2     = m2_sum;
+        result.min    = min_value;
+        result.max    = max_value;
+        result.argmin = find_first<V>(e, min_value, min_bf, min_bl);
+        result.argmax = find_first<V>(e, max_value, max_bf, max_bl);
+    }
+
+    statistics<T> rest;
+
+    for (; i < last; ++i) {
+        rest.push(i, e[i]);
+    }
+
+    result.merge(rest);
+
+    return result;
+}
+
+/*!
+ * \brief Compute the statistics of the input in the given range
+ * \param e The input expression
+ * \param first The beginning of the range
+ * \param last The end of the range
+ * \return the statistics of the range
+ */
+template <typename E, cpp_enable_if((vec_enabled && all_vectorizable<vector_mode, E>::value && std::is_floating_point<value_t<E>>::value))>
+statistics<value_t<E>> stats(const E& e, std::size_t first, std::size_t last) {
+    using vec_type = typename get_vector_impl<vector_mode>::type;
+
+    return selected_stats<vec_type>(e, first, last);
+}
+
+/*!
+ * \brief Compute the statistics of the input in the given range
+ * \param e The input expression
+ * \param first The beginning of the range
+ * \param last The end of the range
+ * \return the statistics of the range
+ */
+template <typename E, cpp_disable_if((vec_enabled && all_vectorizable<vector_mode, E>::value && std::is_floating_point<value_t<E>>::value))>
+statistics<value_t<E>> stats(const E& e, std::size_t first, std::size_t last) {
+    cpp_unused(e);
+    cpp_unused(first);
+    cpp_unused(last);
+    cpp_unreachable("vec::stats called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
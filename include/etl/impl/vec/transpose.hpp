@@ -0,0 +1,433 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the "transpose" algorithm
+ *
+ * The matrices are transposed by tiles small enough to stay in cache, each
+ * tile being transposed by square blocks held in vector registers. The
+ * tiles are distributed to the threads of the pool.
+ *
+ * The inplace rectangular transposition is done without any full-size
+ * buffer, with the decomposition of Catanzaro, Keller and Garland ("A
+ * decomposition for in-place matrix transposition", PPoPP 2014): a
+ * rotation of the columns, a shuffle of the rows and a shuffle of the
+ * columns, each needing only a buffer of the size of a few rows.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief The number of rows and columns of the tiles of the transpose
+ */
+template <typename T>
+constexpr std::size_t transpose_tile = 64 * sizeof(float) / sizeof(T);
+
+/*!
+ * \brief The number of columns shuffled at once by the inplace rectangular
+ * transposition
+ */
+template <typename T>
+constexpr std::size_t transpose_columns = 64 / sizeof(T);
+
+/*!
+ * \brief Transpose the rows [first, last) of a matrix stored in memory
+ * \param in The memory of the matrix
+ * \param out The memory of the transposed matrix
+ * \param rows The number of rows of the matrix
+ * \param columns The number of columns of the matrix
+ * \param first The first row to transpose
+ * \param last The last row to transpose (exclusive)
+ */
+template <typename V, typename T>
+void transpose_kernel(const T* in, T* out, std::size_t rows, std::size_t columns, std::size_t first, std::size_t last) {
+    static constexpr std::size_t vec_size = V::template traits<T>::size;
+    static constexpr std::size_t tile     = transpose_tile<T>;
+
+    for (std::size_t ii = first; ii < last; ii += tile) {
+        const std::size_t i_end = std::min(ii + tile, last);
+
+        for (std::size_t jj = 0; jj < columns; jj += tile) {
+            const std::size_t j_end = std::min(jj + tile, columns);
+
+            std::size_t i = ii;
+
+            for (; i + vec_size <= i_end; i += vec_size) {
+                std::size_t j = jj;
+
+                for (; j + vec_size <= j_end; j += vec_size) {
+                    V::transpose_block(in + i * columns + j, columns, out + j * rows + i, rows);
+                }
+
+                for (; j < j_end; ++j) {
+                    for (std::size_t k = i; k < i + vec_size; ++k) {
+                        out[j * rows + k] = in[k * columns + j];
+                    }
+                }
+            }
+
+            for (; i < i_end; ++i) {
+                for (std::size_t j = jj; j < j_end; ++j) {
+                    out[j * rows + i] = in[i * columns + j];
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Transpose inplace the blocks of the rows [first, last) of a square
+ * matrix that are on the right of the diagonal
+ *
+ * Only the full blocks are transposed, the last n % vec_size rows and
+ * columns are left to the caller.
+ *
+ * \param mem The memory of the matrix
+ * \param n The number of rows and columns of the matrix
+ * \param first The first row to transpose
+ * \param last The last row to transpose (exclusive)
+ */
+template <typename V, typename T>
+void inplace_square_transpose_kernel(T* mem, std::size_t n, std::size_t first, std::size_t last) {
+    static constexpr std::size_t vec_size = V::template traits<T>::size;
+    static constexpr std::size_t tile     = transpose_tile<T>;
+
+    const std::size_t full = n - n % vec_size;
+
+    T tmp[vec_size * vec_size];
+
+    for (std::size_t ii = first; ii < last; ii += tile) {
+        const std::size_t i_end = std::min(ii + tile, last);
+
+        for (std::size_t jj = ii; jj < full; jj += tile) {
+            const std::size_t j_end = std::min(jj + tile, full);
+
+            for (std::size_t i = ii; i < i_end; i += vec_size) {
+                for (std::size_t j = std::max(jj, i); j < j_end; j += vec_size) {
+                    if (i == j) {
+                        // The block is completely loaded before being stored
+                        V::transpose_block(mem + i * n + j, n, mem + i * n + j, n);
+                    } else {
+                        for (std::size_t k = 0; k < vec_size; ++k) {
+                            std::copy_n(mem + (j + k) * n + i, vec_size, tmp + k * vec_size);
+                        }
+
+                        V::transpose_block(mem + i * n + j, n, mem + j * n + i, n);
+                        V::transpose_block(tmp, vec_size, mem + i * n + j, n);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Rotate the columns [first, last) of a matrix stored in memory.
+ *
+ * The column j is rotated upward by j / b rows.
+ *
+ * \param mem The memory of the matrix
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ * \param b The number of columns of the matrix divided by gcd(m, n)
+ * \param first The first column to rotate
+ * \param last The last column to rotate (exclusive)
+ */
+template <typename T>
+void inplace_rotate_columns(T* mem, std::size_t m, std::size_t n, std::size_t b, std::size_t first, std::size_t last) {
+    static constexpr std::size_t W = transpose_columns<T>;
+
+    std::vector<T> tmp(m * W);
+
+    std::size_t k[W];
+
+    for (std::size_t jj = first; jj < last; jj += W) {
+        const std::size_t w = std::min(jj + W, last) - jj;
+
+        for (std::size_t s = 0; s < w; ++s) {
+            k[s] = (jj + s) / b;
+        }
+
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t s = 0; s < w; ++s) {
+                const std::size_t ii = i + k[s] < m ? i + k[s] : i + k[s] - m;
+
+                tmp[i * W + s] = mem[ii * n + jj + s];
+            }
+        }
+
+        for (std::size_t i = 0; i < m; ++i) {
+            std::copy_n(tmp.data() + i * W, w, mem + i * n + jj);
+        }
+    }
+}
+
+/*!
+ * \brief Shuffle the rows [first, last) of a matrix stored in memory.
+ *
+ * Once the columns are rotated, the element of each row that is originally
+ * at (i, j) is moved to the column (j * m + i) % n.
+ *
+ * \param mem The memory of the matrix
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ * \param b The number of columns of the matrix divided by gcd(m, n)
+ * \param first The first row to shuffle
+ * \param last The last row to shuffle (exclusive)
+ */
+template <typename T>
+void inplace_shuffle_rows(T* mem, std::size_t m, std::size_t n, std::size_t b, std::size_t first, std::size_t last) {
+    std::vector<T> tmp(n);
+
+    const std::size_t m_n = m % n;
+
+    for (std::size_t r = first; r < last; ++r) {
+        T* row = mem + r * n;
+
+        std::size_t jb = 0;     // j % b
+        std::size_t jm = 0;     // (j * m) % n
+        std::size_t i  = r;     // The original row of the element
+        std::size_t in = r % n; // i % n
+
+        for (std::size_t j = 0; j < n; ++j) {
+            const std::size_t s = jm + in;
+
+            tmp[s < n ? s : s - n] = row[j];
+
+            jm += m_n;
+            jm = jm < n ? jm : jm - n;
+
+            if (++jb == b) {
+                jb = 0;
+                i  = i + 1 < m ? i + 1 : 0;
+                in = i % n;
+            }
+        }
+
+        std::copy_n(tmp.data(), n, row);
+    }
+}
+
+/*!
+ * \brief Shuffle the columns [first, last) of a matrix stored in memory.
+ *
+ * Once the rows are shuffled, the element that must be at the position p is
+ * gathered from the row of its original position.
+ *
+ * \param mem The memory of the matrix
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ * \param b The number of columns of the matrix divided by gcd(m, n)
+ * \param first The first column to shuffle
+ * \param last The last column to shuffle (exclusive)
+ */
+template <typename T>
+void inplace_shuffle_columns(T* mem, std::size_t m, std::size_t n, std::size_t b, std::size_t first, std::size_t last) {
+    static constexpr std::size_t W = transpose_columns<T>;
+
+    std::vector<T> tmp(m * W);
+
+    for (std::size_t jj = first; jj < last; jj += W) {
+        const std::size_t w = std::min(jj + W, last) - jj;
+
+        for (std::size_t r = 0; r < m; ++r) {
+            // The original position of the element at (r, jj)
+            const std::size_t p = r * n + jj;
+            std::size_t j       = p / m;
+            std::size_t i       = p - j * m;
+
+            std::size_t k       = j / b;
+
+            for (std::size_t s = 0; s < w; ++s) {
+                const std::size_t ii = i >= k ? i - k : i + m - k;
+
+                tmp[r * W + s] = mem[ii * n + jj + s];
+
+                if (++i == m) {
+                    i = 0;
+                    k = ++j / b;
+                }
+            }
+        }
+
+        for (std::size_t r = 0; r < m; ++r) {
+            std::copy_n(tmp.data() + r * W, w, mem + r * n + jj);
+        }
+    }
+}
+
+/*!
+ * \brief Transpose inplace a rectangular matrix stored in memory
+ * \param mem The memory of the matrix
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ */
+template <typename T>
+void inplace_rectangular_transpose_kernel(T* mem, std::size_t m, std::size_t n) {
+    // The transposition of a vector does not move anything
+    if (m == 1 || n == 1) {
+        return;
+    }
+
+    std::size_t c = m;
+    std::size_t d = n;
+
+    while (d) {
+        std::size_t t = c % d;
+        c             = d;
+        d             = t;
+    }
+
+    const std::size_t b = n / c;
+
+    const bool p = select_parallel(m * n);
+
+    if (c > 1) {
+        dispatch_1d_threads(p && n >= 2 * transpose_columns<T>, [&](std::size_t first, std::size_t last) {
+            inplace_rotate_columns(mem, m, n, b, first, last);
+        }, 0, n);
+    }
+
+    dispatch_1d_threads(p, [&](std::size_t first, std::size_t last) {
+        inplace_shuffle_rows(mem, m, n, b, first, last);
+    }, 0, m);
+
+    dispatch_1d_threads(p && n >= 2 * transpose_columns<T>, [&](std::size_t first, std::size_t last) {
+        inplace_shuffle_columns(mem, m, n, b, first, last);
+    }, 0, n);
+}
+
+/*!
+ * \brief Inplace transposition of the square matrix c
+ * \param c The matrix to transpose
+ */
+template <typename C, cpp_enable_if((vec_enabled && all_dma<C>::value && all_floating<C>::value))>
+void inplace_square_transpose(C&& c) {
+    using vec_type = typename get_vector_impl<vector_mode>::type;
+    using T        = value_t<C>;
+
+    static constexpr std::size_t vec_size = vec_type::template traits<T>::size;
+    static constexpr std::size_t tile     = transpose_tile<T>;
+
+    const std::size_t n    = etl::dim<0>(c);
+    const std::size_t full = n - n % vec_size;
+
+    auto mem = c.memory_start();
+
+    auto batch_fun = [&](std::size_t first, std::size_t last) {
+        inplace_square_transpose_kernel<vec_type>(mem, n, first * tile, std::min(last * tile, full));
+    };
+
+    dispatch_1d_any(select_parallel(n * n), batch_fun, 0, (full + tile - 1) / tile);
+
+    // The last rows and columns
+
+    using std::swap;
+
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = std::max(i + 1, full); j < n; ++j) {
+            swap(mem[i * n + j], mem[j * n + i]);
+        }
+    }
+}
+
+/*!
+ * \brief Inplace transposition of the rectangular matrix c
+ *
+ * The matrix is transposed without any full-size temporary.
+ *
+ * \param c The matrix to transpose
+ */
+template <typename C, cpp_enable_if((vec_enabled && all_dma<C>::value && all_floating<C>::value))>
+void inplace_rectangular_transpose(C&& c) {
+    if (decay_traits<C>::storage_order == order::RowMajor) {
+        inplace_rectangular_transpose_kernel(c.memory_start(), etl::dim<0>(c), etl::dim<1>(c));
+    } else {
+        inplace_rectangular_transpose_kernel(c.memory_start(), etl::dim<1>(c), etl::dim<0>(c));
+    }
+}
+
+/*!
+ * \brief Transpose the matrix a and the store the result in c
+ * \param a The matrix to transpose
+ * \param c The target matrix
+ */
+template <typename A, typename C, cpp_enable_if((vec_enabled && all_dma<A, C>::value && all_floating<A, C>::value))>
+void transpose(A&& a, C&& c) {
+    using vec_type = typename get_vector_impl<vector_mode>::type;
+    using T        = value_t<A>;
+
+    static constexpr std::size_t tile = transpose_tile<T>;
+
+    auto mem_c = c.memory_start();
+    auto mem_a = a.memory_start();
+
+    // Delegate aliasing transpose to inplace algorithm
+    if (mem_c == mem_a) {
+        if (etl::dim<0>(a) == etl::dim<1>(a)) {
+            inplace_square_transpose(c);
+        } else {
+            inplace_rectangular_transpose(c);
+        }
+
+        return;
+    }
+
+    // The memory of a column major matrix is the memory of its transpose in row major
+    const bool row_major       = decay_traits<A>::storage_order == order::RowMajor;
+    const std::size_t rows    = row_major ? etl::dim<0>(a) : etl::dim<1>(a);
+    const std::size_t columns = row_major ? etl::dim<1>(a) : etl::dim<0>(a);
+
+    auto batch_fun = [&](std::size_t first, std::size_t last) {
+        transpose_kernel<vec_type>(mem_a, mem_c, rows, columns, first * tile, std::min(last * tile, rows));
+    };
+
+    dispatch_1d_any(select_parallel(rows * columns), batch_fun, 0, (rows + tile - 1) / tile);
+}
+
+/*!
+ * \brief Inplace transposition of the square matrix c
+ * \param c The matrix to transpose
+ */
+template <typename C, cpp_disable_if((vec_enabled && all_dma<C>::value && all_floating<C>::value))>
+void inplace_square_transpose(C&& c) {
+    cpp_unused(c);
+    cpp_unreachable("vec::inplace_square_transpose called with invalid parameters");
+}
+
+/*!
+ * \brief Inplace transposition of the rectangular matrix c
+ * \param c The matrix to transpose
+ */
+template <typename C, cpp_disable_if((vec_enabled && all_dma<C>::value && all_floating<C>::value))>
+void inplace_rectangular_transpose(C&& c) {
+    cpp_unused(c);
+    cpp_unreachable("vec::inplace_rectangular_transpose called with invalid parameters");
+}
+
+/*!
+ * \brief Transpose the matrix a and the store the result in c
+ * \param a The matrix to transpose
+ * \param c The target matrix
+ */
+template <typename A, typename C, cpp_disable_if((vec_enabled && all_dma<A, C>::value && all_floating<A, C>::value))>
+void transpose(A&& a, C&& c) {
+    cpp_unused(a);
+    cpp_unused(c);
+    cpp_unreachable("vec::transpose called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
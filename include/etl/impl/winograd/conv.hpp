@@ -0,0 +1,664 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Winograd minimal filtering implementation of the 'valid'
+ * convolutions with 3x3 kernels and unit strides.
+ *
+ * The output is computed by tiles of MxM elements, F(2x2,3x3) or
+ * F(4x4,3x3). Each input tile and each kernel are transformed into a
+ * (M+2)x(M+2) tile in which the convolution is reduced to an element-wise
+ * product, accumulated over the channels. This reduces the number of
+ * multiplications by 2.25 (F(2x2,3x3)) or by 4 (F(4x4,3x3)).
+ *
+ * The tiles are processed by blocks. For each of the (M+2)x(M+2) elements
+ * of the transformed tiles, the products of the K kernels and the C channels
+ * of the tiles of a block are a matrix-matrix multiplication (KxC by
+ * CxTiles), computed by the selected GEMM implementation.
+ *
+ * The transformed kernels are kept in a small per-thread cache, indexed by
+ * the memory of the kernels and validated against their values, so that the
+ * kernels of a layer are only transformed again once they have changed.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace winograd {
+
+/*!
+ * \brief The maximum number of transformed kernels kept in the cache of
+ * each thread, for each tile size and type.
+ */
+constexpr std::size_t filter_cache_size = 8;
+
+/*!
+ * \brief The number of tiles transformed together, the number of columns
+ * of the multiplications in the transformed domain.
+ */
+constexpr std::size_t tile_block = 64;
+
+/*!
+ * \brief The transformation matrices of F(MxM,3x3).
+ *
+ * Each function applies a 1D transformation on strided memory, the 2D
+ * transformations are applied on the columns and then on the rows.
+ *
+ * \tparam M The size of the output tiles
+ */
+template <std::size_t M>
+struct transform;
+
+/*!
+ * \brief The transformation matrices of F(2x2,3x3)
+ */
+template <>
+struct transform<2> {
+    static constexpr std::size_t alpha = 4; ///< The size of the transformed tiles
+
+    /*!
+     * \brief Compute out = B^T in
+     */
+    template <typename T>
+    static void input(const T* in, std::size_t is, T* out, std::size_t os) {
+        const T d0 = in[0 * is];
+        const T d1 = in[1 * is];
+        const T d2 = in[2 * is];
+        const T d3 = in[3 * is];
+
+        out[0 * os] = d0 - d2;
+        out[1 * os] = d1 + d2;
+        out[2 * os] = d2 - d1;
+        out[3 * os] = d1 - d3;
+    }
+
+    /*!
+     * \brief Compute out = G in
+     */
+    template <typename T>
+    static void filter(const T* in, std::size_t is, T* out, std::size_t os) {
+        const T g0 = in[0 * is];
+        const T g1 = in[1 * is];
+        const T g2 = in[2 * is];
+
+        out[0 * os] = g0;
+        out[1 * os] = T(0.5) * (g0 + g1 + g2);
+        out[2 * os] = T(0.5) * (g0 - g1 + g2);
+        out[3 * os] = g2;
+    }
+
+    /*!
+     * \brief Compute out = A^T in
+     */
+    template <typename T>
+    static void output(const T* in, std::size_t is, T* out, std::size_t os) {
+        const T m0 = in[0 * is];
+        const T m1 = in[1 * is];
+        const T m2 = in[2 * is];
+        const T m3 = in[3 * is];
+
+        out[0 * os] = m0 + m1 + m2;
+        out[1 * os] = m1 - m2 - m3;
+    }
+};
+
+/*!
+ * \brief The transformation matrices of F(4x4,3x3)
+ */
+template <>
+struct transform<4> {
+    static constexpr std::size_t alpha = 6; ///< The size of the transformed tiles
+
+    /*!
+     * \brief Compute out = B^T in
+     */
+    template <typename T>
+    static void input(const T* in, std::size_t is, T* out, std::size_t os) {
+        const T d0 = in[0 * is];
+        const T d1 = in[1 * is];
+        const T d2 = in[2 * is];
+        const T d3 = in[3 * is];
+        const T d4 = in[4 * is];
+        const T d5 = in[5 * is];
+
+        out[0 * os] = T(4) * d0 - T(5) * d2 + d4;
+        out[1 * os] = d3 + d4 - T(4) * (d1 + d2);
+        out[2 * os] = T(4) * (d1 - d2) + d4 - d3;
+        out[3 * os] = T(2) * (d3 - d1) + d4 - d2;
+        out[4 * os] = T(2) * (d1 - d3) + d4 - d2;
+        out[5 * os] = T(4) * d1 - T(5) * d3 + d5;
+    }
+
+    /*!
+     * \brief Compute out = G in
+     */
+    template <typename T>
+    static void filter(const T* in, std::size_t is, T* out, std::size_t os) {
+        const T g0 = in[0 * is];
+        const T g1 = in[1 * is];
+        const T g2 = in[2 * is];
+
+        out[0 * os] = g0 / T(4);
+        out[1 * os] = -(g0 + g1 + g2) / T(6);
+        out[2 * os] = -(g0 - g1 + g2) / T(6);
+        out[3 * os] = g0 / T(24) + g1 / T(12) + g2 / T(6);
+        out[4 * os] = g0 / T(24) - g1 / T(12) + g2 / T(6);
+        out[5 * os] = g2;
+    }
+
+    /*!
+     * \brief Compute out = A^T in
+     */
+    template <typename T>
+    static void output(const T* in, std::size_t is, T* out, std::size_t os) {
+        const T m0 = in[0 * is];
+        const T m1 = in[1 * is];
+        const T m2 = in[2 * is];
+        const T m3 = in[3 * is];
+        const T m4 = in[4 * is];
+        const T m5 = in[5 * is];
+
+        out[0 * os] = m0 + m1 + m2 + m3 + m4;
+        out[1 * os] = m1 - m2 + T(2) * (m3 - m4);
+        out[2 * os] = m1 + m2 + T(4) * (m3 + m4);
+        out[3 * os] = m1 - m2 + T(8) * (m3 - m4) + m5;
+    }
+};
+
+/*!
+ * \brief Transform a kernel: u = G g G^T
+ * \param g The 3x3 kernel
+ * \param u The transformed (M+2)x(M+2) kernel
+ */
+template <std::size_t M, typename T>
+void filter_transform(const T* g, T* u) {
+    static constexpr std::size_t A = transform<M>::alpha;
+
+    T tmp[A * 3];
+
+    for (std::size_t j = 0; j < 3; ++j) {
+        transform<M>::filter(g + j, 3, tmp + j, 3);
+    }
+
+    for (std::size_t i = 0; i < A; ++i) {
+        transform<M>::filter(tmp + i * 3, 1, u + i * A, 1);
+    }
+}
+
+/*!
+ * \brief Transform n input tiles in place: d = B^T d B
+ *
+ * The tiles are interleaved, so that each 1D transformation is applied on
+ * n consecutive elements at once.
+ *
+ * \param d The (M+2)x(M+2) tiles, the element x of the tile t is at x * n + t
+ * \param tmp The scratch memory, (M+2)x(M+2)xn elements
+ * \param n The number of tiles
+ */
+template <std::size_t M, typename T>
+void input_transform(T* d, T* tmp, std::size_t n) {
+    static constexpr std::size_t A = transform<M>::alpha;
+
+    for (std::size_t j = 0; j < A; ++j) {
+        for (std::size_t t = 0; t < n; ++t) {
+            transform<M>::input(d + j * n + t, A * n, tmp + j * n + t, A * n);
+        }
+    }
+
+    for (std::size_t i = 0; i < A; ++i) {
+        for (std::size_t t = 0; t < n; ++t) {
+            transform<M>::input(tmp + i * A * n + t, n, d + i * A * n + t, n);
+        }
+    }
+}
+
+/*!
+ * \brief Transform n output tiles back: y = A^T m A
+ *
+ * \param m The (M+2)x(M+2) transformed output tiles, the element x of the tile t is at x * ms + t
+ * \param ms The distance between two elements of a transformed tile
+ * \param tmp The scratch memory, Mx(M+2)xn elements
+ * \param y The MxM output tiles, the element x of the tile t is at x * n + t
+ * \param n The number of tiles
+ */
+template <std::size_t M, typename T>
+void output_transform(const T* m, std::size_t ms, T* tmp, T* y, std::size_t n) {
+    static constexpr std::size_t A = transform<M>::alpha;
+
+    for (std::size_t j = 0; j < A; ++j) {
+        for (std::size_t t = 0; t < n; ++t) {
+            transform<M>::output(m + j * ms + t, A * ms, tmp + j * n + t, A * n);
+        }
+    }
+
+    for (std::size_t i = 0; i < M; ++i) {
+        for (std::size_t t = 0; t < n; ++t) {
+            transform<M>::output(tmp + i * A * n + t, n, y + i * M * n + t, n);
+        }
+    }
+}
+
+/*!
+ * \brief A set of transformed kernels kept in the cache
+ */
+template <typename T>
+struct filter_cache_entry {
+    const T* memory;        ///< The memory of the kernels
+    std::size_t K;          ///< The number of kernels
+    std::size_t C;          ///< The number of channels
+    bool flip;              ///< Indicates if the kernels were flipped
+    std::vector<T> values;  ///< The values of the kernels
+    std::vector<T> filters; ///< The transformed kernels
+};
+
+/*!
+ * \brief Returns the transformed kernels, from the cache if they have
+ * already been transformed.
+ *
+ * The kernels are stored as [K][C][3][3] and the transformed kernels as
+ * [(M+2)x(M+2)][K][C], one KxC matrix for each element of the transformed
+ * tiles.
+ *
+ * \param kernel The memory of the kernels
+ * \param K The number of kernels
+ * \param C The number of channels
+ * \param flip Indicates if the kernels must be flipped (convolution) or not (cross-correlation)
+ * \return a pointer to the transformed kernels
+ */
+template <std::size_t M, typename T>
+const T* transformed_filters(const T* kernel, std::size_t K, std::size_t C, bool flip) {
+    static constexpr std::size_t A2 = transform<M>::alpha * transform<M>::alpha;
+
+    static thread_local std::vector<filter_cache_entry<T>> cache;
+
+    const std::size_t n = K * C * 9;
+
+    for (auto it = cache.begin(); it != cache.end(); ++it) {
+        if (it->memory == kernel && it->K == K && it->C == C && it->flip == flip && std::equal(it->values.begin(), it->values.end(), kernel)) {
+            // Keep the most recently used kernels at the front
+            std::rotate(cache.begin(), it, it + 1);
+            return cache.front().filters.data();
+        }
+    }
+
+    if (cache.size() == filter_cache_size) {
+        cache.pop_back();
+    }
+
+    filter_cache_entry<T> entry{kernel, K, C, flip, std::vector<T>(kernel, kernel + n), std::vector<T>(K * C * A2)};
+
+    T u[A2];
+
+    for (std::size_t kc = 0; kc < K * C; ++kc) {
+        const T* g = kernel + kc * 9;
+
+        if (flip) {
+            T flipped[9];
+
+            for (std::size_t i = 0; i < 9; ++i) {
+                flipped[i] = g[8 - i];
+            }
+
+            filter_transform<M>(flipped, u);
+        } else {
+            filter_transform<M>(g, u);
+        }
+
+        for (std::size_t x = 0; x < A2; ++x) {
+            entry.filters[x * K * C + kc] = u[x];
+        }
+    }
+
+    cache.insert(cache.begin(), std::move(entry));
+
+    return cache.front().filters.data();
+}
+
+/*!
+ * \brief Move to the next tile of a batch of valid convolutions
+ * \param i The input of the tile
+ * \param tr The row of the tile
+ * \param tc The column of the tile
+ * \param t1 The number of rows of tiles
+ * \param t2 The number of columns of tiles
+ */
+inline void next_tile(std::size_t& i, std::size_t& tr, std::size_t& tc, std::size_t t1, std::size_t t2) {
+    if (++tc == t2) {
+        tc = 0;
+
+        if (++tr == t1) {
+            tr = 0;
+            ++i;
+        }
+    }
+}
+
+/*!
+ * \brief Transform the input tiles [first, first + count) of a batch of
+ * valid convolutions.
+ *
+ * The tiles are numbered by input, then by row and then by column. The
+ * tiles after count, up to n, are zeroes.
+ *
+ * \param input The inputs, N x C x n1 x n2
+ * \param v The transformed tiles, (M+2)x(M+2) matrices of Cxn elements, vs elements apart
+ * \param vs The distance between two matrices of v
+ * \param d The scratch memory, 2 x (M+2)x(M+2)xn elements
+ */
+template <std::size_t M, typename T>
+void input_tiles(const T* input, std::size_t C, std::size_t n1, std::size_t n2, std::size_t t1, std::size_t t2,
+                 std::size_t p1, std::size_t p2, std::size_t first, std::size_t count, std::size_t n, T* v, std::size_t vs, T* d) {
+    static constexpr std::size_t A  = transform<M>::alpha;
+    static constexpr std::size_t A2 = A * A;
+
+    for (std::size_t c = 0; c < C; ++c) {
+        std::size_t i  = first / (t1 * t2);
+        std::size_t tr = (first / t2) % t1;
+        std::size_t tc = first % t2;
+
+        for (std::size_t t = 0; t < count; ++t, next_tile(i, tr, tc, t1, t2)) {
+            const std::size_t i0 = tr * M;
+            const std::size_t j0 = tc * M;
+
+            const T* in_c = input + (i * C + c) * n1 * n2;
+
+            if (i0 >= p1 && j0 >= p2 && i0 + A <= n1 + p1 && j0 + A <= n2 + p2) {
+                for (std::size_t a = 0; a < A; ++a) {
+                    for (std::size_t b = 0; b < A; ++b) {
+                        d[(a * A + b) * n + t] = in_c[(i0 + a - p1) * n2 + (j0 + b - p2)];
+                    }
+                }
+            } else {
+                // Border tile: read the padding and what is after the input as zeroes
+                for (std::size_t a = 0; a < A; ++a) {
+                    for (std::size_t b = 0; b < A; ++b) {
+                        const std::size_t ii = i0 + a;
+                        const std::size_t jj = j0 + b;
+
+                        if (ii >= p1 && ii < n1 + p1 && jj >= p2 && jj < n2 + p2) {
+                            d[(a * A + b) * n + t] = in_c[(ii - p1) * n2 + (jj - p2)];
+                        } else {
+                            d[(a * A + b) * n + t] = T(0);
+                        }
+                    }
+                }
+            }
+        }
+
+        for (std::size_t x = 0; x < A2; ++x) {
+            std::fill(d + x * n + count, d + (x + 1) * n, T(0));
+        }
+
+        input_transform<M>(d, d + A2 * n, n);
+
+        for (std::size_t x = 0; x < A2; ++x) {
+            std::copy(d + x * n, d + (x + 1) * n, v + x * vs + c * n);
+        }
+    }
+}
+
+/*!
+ * \brief Transform back the output tiles [first, first + count) of a batch
+ * of valid convolutions.
+ *
+ * \param m The transformed output tiles, (M+2)x(M+2) matrices of Kxn elements, ms elements apart
+ * \param ms The distance between two matrices of m
+ * \param conv The output, the output of the input i and kernel k is at i * conv_n_inc + k * conv_k_inc
+ * \param y The scratch memory, 2 x (M+2)x(M+2)xn elements
+ */
+template <std::size_t M, typename T>
+void output_tiles(const T* m, std::size_t ms, std::size_t K, std::size_t t1, std::size_t t2, T* conv, std::size_t c1, std::size_t c2,
+                  std::size_t conv_n_inc, std::size_t conv_k_inc, std::size_t first, std::size_t count, std::size_t n, T* y) {
+    static constexpr std::size_t A  = transform<M>::alpha;
+    static constexpr std::size_t A2 = A * A;
+
+    for (std::size_t k = 0; k < K; ++k) {
+        output_transform<M>(m + k * n, ms, y + A2 * n, y, n);
+
+        std::size_t i  = first / (t1 * t2);
+        std::size_t tr = (first / t2) % t1;
+        std::size_t tc = first % t2;
+
+        for (std::size_t t = 0; t < count; ++t, next_tile(i, tr, tc, t1, t2)) {
+            const std::size_t i0 = tr * M;
+            const std::size_t j0 = tc * M;
+
+            const std::size_t r1 = std::min(M, c1 - i0);
+            const std::size_t r2 = std::min(M, c2 - j0);
+
+            T* out = conv + i * conv_n_inc + k * conv_k_inc;
+
+            for (std::size_t a = 0; a < r1; ++a) {
+                for (std::size_t b = 0; b < r2; ++b) {
+                    out[(i0 + a) * c2 + (j0 + b)] = y[(a * M + b) * n + t];
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Compute the valid convolutions of N inputs of C channels with K
+ * kernels of C channels.
+ *
+ * \param input The inputs, N x C x n1 x n2
+ * \param kernel The kernels, K x C x 3 x 3
+ * \param conv The output, the output of the input i and kernel k is at i * conv_n_inc + k * conv_k_inc
+ * \param flip Indicates if the kernels must be flipped (convolution) or not (cross-correlation)
+ */
+template <std::size_t M, typename T>
+void conv2_valid_batch(const T* input, std::size_t N, std::size_t C, std::size_t n1, std::size_t n2, const T* kernel, std::size_t K,
+                       T* conv, std::size_t c1, std::size_t c2, std::size_t conv_n_inc, std::size_t conv_k_inc, std::size_t p1, std::size_t p2, bool flip) {
+    static constexpr std::size_t A2 = transform<M>::alpha * transform<M>::alpha;
+
+    const T* filters = transformed_filters<M>(kernel, K, C, flip);
+
+    const std::size_t t1 = (c1 + M - 1) / M;
+    const std::size_t t2 = (c2 + M - 1) / M;
+
+    // The tiles are split evenly between the blocks, padded to full vectors
+    const std::size_t tiles  = N * t1 * t2;
+    const std::size_t blocks = (tiles + tile_block - 1) / tile_block;
+    const std::size_t block  = (((tiles + blocks - 1) / blocks + 15) / 16) * 16;
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        if (last - first) {
+            // The scratch memory of the tiles of this thread. The matrices
+            // are padded to not be a power of two apart, which would make
+            // the transformations conflict in the cache
+            const std::size_t vs = C * block + 16;
+            const std::size_t ms = K * block + 16;
+
+            std::vector<T> v(A2 * vs);
+            std::vector<T> m(A2 * ms);
+            std::vector<T> d(2 * A2 * block);
+
+            for (std::size_t b = first; b < last; ++b) {
+                const std::size_t t0    = b * block;
+                const std::size_t count = std::min(block, tiles - t0);
+
+                input_tiles<M>(input, C, n1, n2, t1, t2, p1, p2, t0, count, block, v.data(), vs, d.data());
+
+                for (std::size_t x = 0; x < A2; ++x) {
+                    // Note: the kernels are only read, the const_cast is only here to allow the view
+                    custom_dyn_matrix<T> u_x(const_cast<T*>(filters) + x * K * C, K, C);
+                    custom_dyn_matrix<T> v_x(v.data() + x * vs, C, block);
+                    custom_dyn_matrix<T> m_x(m.data() + x * ms, K, block);
+
+                    m_x = u_x * v_x;
+                }
+
+                output_tiles<M>(m.data(), ms, K, t1, t2, conv, c1, c2, conv_n_inc, conv_k_inc, t0, count, block, d.data());
+            }
+        }
+    };
+
+    // When the blocks are split between the threads, the multiplications are not parallelized themselves
+    if (select_parallel(blocks, 2)) {
+        dispatch_1d_threads(true, [&](const size_t first, const size_t last) {
+            SERIAL_SECTION {
+                batch_fun(first, last);
+            }
+        }, 0, blocks);
+    } else {
+        batch_fun(0, blocks);
+    }
+}
+
+/*!
+ * \brief Compute the valid convolutions of N inputs of C channels with K
+ * kernels of C channels, selecting the size of the output tiles.
+ *
+ * F(4x4,3x3) is used as soon as the outputs are large enough to contain
+ * several tiles of 4x4, F(2x2,3x3) wastes less computation on the border
+ * tiles of small outputs.
+ */
+template <typename T>
+void conv2_valid_batch(const T* input, std::size_t N, std::size_t C, std::size_t n1, std::size_t n2, const T* kernel, std::size_t K,
+                       T* conv, std::size_t c1, std::size_t c2, std::size_t conv_n_inc, std::size_t conv_k_inc, std::size_t p1, std::size_t p2, bool flip) {
+    if (c1 >= 8 && c2 >= 8) {
+        conv2_valid_batch<4>(input, N, C, n1, n2, kernel, K, conv, c1, c2, conv_n_inc, conv_k_inc, p1, p2, flip);
+    } else {
+        conv2_valid_batch<2>(input, N, C, n1, n2, kernel, K, conv, c1, c2, conv_n_inc, conv_k_inc, p1, p2, flip);
+    }
+}
+
+/*!
+ * \brief Winograd implementation of a 4D 'valid' convolution C = I * K
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding (left and right)
+ * \param p2 The second dimension padding (top and bottom)
+ */
+template <typename T>
+void conv4_valid(const opaque_memory<T, 4>& input, const opaque_memory<T, 4>& kernel, const opaque_memory<T, 4>& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_assert(s1 == 1 && s2 == 1, "Winograd convolution is only possible with unit strides");
+    cpp_assert(kernel.dim(2) == 3 && kernel.dim(3) == 3, "Winograd convolution is only possible with 3x3 kernels");
+    cpp_unused(s1);
+    cpp_unused(s2);
+
+    conv2_valid_batch(input.memory_start(), input.dim(0), input.dim(1), input.dim(2), input.dim(3), kernel.memory_start(), kernel.dim(0),
+                      conv.memory_start(), conv.dim(2), conv.dim(3), conv.dim(1) * conv.dim(2) * conv.dim(3), conv.dim(2) * conv.dim(3), p1, p2, true);
+}
+
+/*!
+ * \brief Winograd implementation of a 4D 'valid' convolution C = I * K, with flipped weights
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding (left and right)
+ * \param p2 The second dimension padding (top and bottom)
+ */
+template <typename T>
+void conv4_valid_flipped(const opaque_memory<T, 4>& input, const opaque_memory<T, 4>& kernel, const opaque_memory<T, 4>& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_assert(s1 == 1 && s2 == 1, "Winograd convolution is only possible with unit strides");
+    cpp_assert(kernel.dim(2) == 3 && kernel.dim(3) == 3, "Winograd convolution is only possible with 3x3 kernels");
+    cpp_unused(s1);
+    cpp_unused(s2);
+
+    conv2_valid_batch(input.memory_start(), input.dim(0), input.dim(1), input.dim(2), input.dim(3), kernel.memory_start(), kernel.dim(0),
+                      conv.memory_start(), conv.dim(2), conv.dim(3), conv.dim(1) * conv.dim(2) * conv.dim(3), conv.dim(2) * conv.dim(3), p1, p2, false);
+}
+
+/*!
+ * \brief Winograd implementation of a 2D 'valid' convolution C = I * K, with multiple kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding (left and right)
+ * \param p2 The second dimension padding (top and bottom)
+ */
+template <typename T>
+void conv2_valid_multi(const opaque_memory<T, 2>& input, const opaque_memory<T, 3>& kernel, const opaque_memory<T, 3>& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_assert(s1 == 1 && s2 == 1, "Winograd convolution is only possible with unit strides");
+    cpp_assert(kernel.dim(1) == 3 && kernel.dim(2) == 3, "Winograd convolution is only possible with 3x3 kernels");
+    cpp_unused(s1);
+    cpp_unused(s2);
+
+    conv2_valid_batch(input.memory_start(), 1, 1, input.dim(0), input.dim(1), kernel.memory_start(), kernel.dim(0),
+                      conv.memory_start(), conv.dim(1), conv.dim(2), 0, conv.dim(1) * conv.dim(2), p1, p2, true);
+}
+
+/*!
+ * \brief Winograd implementation of a 2D 'valid' convolution C = I * K, with multiple flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding (left and right)
+ * \param p2 The second dimension padding (top and bottom)
+ */
+template <typename T>
+void conv2_valid_multi_flipped(const opaque_memory<T, 2>& input, const opaque_memory<T, 3>& kernel, const opaque_memory<T, 3>& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_assert(s1 == 1 && s2 == 1, "Winograd convolution is only possible with unit strides");
+    cpp_assert(kernel.dim(1) == 3 && kernel.dim(2) == 3, "Winograd convolution is only possible with 3x3 kernels");
+    cpp_unused(s1);
+    cpp_unused(s2);
+
+    conv2_valid_batch(input.memory_start(), 1, 1, input.dim(0), input.dim(1), kernel.memory_start(), kernel.dim(0),
+                      conv.memory_start(), conv.dim(1), conv.dim(2), 0, conv.dim(1) * conv.dim(2), p1, p2, false);
+}
+
+/*!
+ * \brief Winograd implementation of a 2D 'valid' convolution C = I * K, with multiple images and multiple kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding (left and right)
+ * \param p2 The second dimension padding (top and bottom)
+ */
+template <typename T>
+void conv2_valid_multi_multi(const opaque_memory<T, 3>& input, const opaque_memory<T, 3>& kernel, const opaque_memory<T, 4>& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_assert(s1 == 1 && s2 == 1, "Winograd convolution is only possible with unit strides");
+    cpp_assert(kernel.dim(1) == 3 && kernel.dim(2) == 3, "Winograd convolution is only possible with 3x3 kernels");
+    cpp_unused(s1);
+    cpp_unused(s2);
+
+    conv2_valid_batch(input.memory_start(), input.dim(0), 1, input.dim(1), input.dim(2), kernel.memory_start(), kernel.dim(0),
+                      conv.memory_start(), conv.dim(2), conv.dim(3), conv.dim(2) * conv.dim(3), conv.dim(1) * conv.dim(2) * conv.dim(3), p1, p2, true);
+}
+
+/*!
+ * \brief Winograd implementation of a 2D 'valid' convolution C = I * K, with multiple images and multiple flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding (left and right)
+ * \param p2 The second dimension padding (top and bottom)
+ */
+template <typename T>
+void conv2_valid_multi_multi_flipped(const opaque_memory<T, 3>& input, const opaque_memory<T, 3>& kernel, const opaque_memory<T, 4>& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_assert(s1 == 1 && s2 == 1, "Winograd convolution is only possible with unit strides");
+    cpp_assert(kernel.dim(1) == 3 && kernel.dim(2) == 3, "Winograd convolution is only possible with 3x3 kernels");
+    cpp_unused(s1);
+    cpp_unused(s2);
+
+    conv2_valid_batch(input.memory_start(), input.dim(0), 1, input.dim(1), input.dim(2), kernel.memory_start(), kernel.dim(0),
+                      conv.memory_start(), conv.dim(2), conv.dim(3), conv.dim(2) * conv.dim(3), conv.dim(1) * conv.dim(2) * conv.dim(3), p1, p2, false);
+}
+
+} //end of namespace winograd
+
+} //end of namespace impl
+
+} //end of namespace etl
@@ -20,3 +20,4 @@
 #include "gemm_impl.hpp"
 #include "outer_impl.hpp"
 #include "fft_impl.hpp"
+#include "softmax_impl.hpp"
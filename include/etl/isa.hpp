@@ -0,0 +1,154 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file isa.hpp
+ * \brief Runtime detection of the instruction sets of the host and
+ * multi-versioning of kernels.
+ *
+ * By default, the vector mode is pinned at compile-time by the -m flags
+ * given to the compiler. When ETL_RUNTIME_DISPATCH is defined, the kernels
+ * are also compiled for the instruction sets wider than the one of the
+ * binary and the best version is selected based on cpuid, detected once:
+ *
+ * - The raw memory kernels of etl::impl::isa (sum, dot and element-wise
+ *   +, -, *, /) are compiled with target_clones for AVX-512, AVX2 and the
+ *   baseline of the binary.
+ * - The vector implementations (avx512_vec, avx_vec and sse_vec) that are
+ *   not available in the baseline are compiled in #pragma GCC target
+ *   regions (see isa_vectorization.hpp). The impl::vec GEMM, convolution
+ *   and FFT kernels and the VectorizedAssign functors are instantiated
+ *   again for AVX-512 and AVX in the etl::impl::vec::avx512 and
+ *   etl::impl::vec::avx namespaces, inside the same regions (see
+ *   impl/isa/instantiate.hpp).
+ *
+ * A binary compiled for AVX2 therefore runs these kernels with AVX-512 on
+ * an AVX-512 host. On such a host, the multi-kernel and 4D convolutions
+ * are computed by the BLAS implementation in order to use the dispatched
+ * GEMM. The vectorized kernels are only dispatched when they are enabled
+ * in the baseline of the binary, which must therefore support at least
+ * SSE3, and the assignment of expressions only when the expression is
+ * vectorizable in the baseline. The other kernels (softmax,
+ * decompositions, ...) always run with the pinned vector mode.
+ *
+ * Since the copies compiled for wider instruction sets share the memory
+ * layout of the baseline, they do not assume the alignment or the padding
+ * of their vector size.
+ */
+
+#pragma once
+
+#if defined(ETL_RUNTIME_DISPATCH) && (defined(__x86_64__) || defined(__i386__)) && defined(__has_attribute) && !defined(__clang__) && !defined(__INTEL_COMPILER)
+#if __has_attribute(target_clones)
+#define ETL_ISA_DISPATCH
+#endif
+#endif
+
+#ifdef ETL_ISA_DISPATCH
+#define ETL_ISA_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define ETL_ISA_CLONES
+#endif
+
+// The kernels are instantiated for the instruction sets wider than the baseline
+#if defined(ETL_ISA_DISPATCH) && !defined(__AVX512F__)
+#define ETL_ISA_AVX512
+#endif
+
+#if defined(ETL_ISA_DISPATCH) && !defined(__AVX__)
+#define ETL_ISA_AVX
+#endif
+
+namespace etl {
+
+#ifdef ETL_ISA_DISPATCH
+constexpr bool runtime_dispatch = true;
+#else
+constexpr bool runtime_dispatch = false; ///< Indicates if the kernels are dispatched at runtime between instruction sets
+#endif
+
+/*!
+ * \brief Detect the best vector mode supported by the host
+ * \return the best vector mode supported by the host
+ */
+inline vector_mode_t detect_cpu_vector_mode() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f")) {
+        return vector_mode_t::AVX512;
+    } else if (__builtin_cpu_supports("avx")) {
+        return vector_mode_t::AVX;
+    } else if (__builtin_cpu_supports("sse3")) {
+        return vector_mode_t::SSE3;
+    }
+
+    return vector_mode_t::NONE;
+#else
+    return vector_mode;
+#endif
+}
+
+/*!
+ * \brief Returns the best vector mode supported by the host.
+ *
+ * The detection is only done once, the first time this function is called.
+ *
+ * \return the best vector mode supported by the host
+ */
+inline vector_mode_t cpu_vector_mode() {
+    static const vector_mode_t mode = detect_cpu_vector_mode();
+    return mode;
+}
+
+/*!
+ * \brief Indicates if the runtime dispatched kernels must be used instead of
+ * the kernels compiled for the pinned vector mode.
+ *
+ * This is only the case when the host supports a wider instruction set
+ * than the one the program has been compiled for.
+ *
+ * \return true if the runtime dispatched kernels must be used, false otherwise
+ */
+inline bool isa_dispatch() {
+    return runtime_dispatch && cpu_vector_mode() > vector_mode;
+}
+
+/*!
+ * \brief Indicates if the kernels instantiated for AVX-512 must be used
+ * instead of the kernels compiled for the pinned vector mode.
+ * \return true if the AVX-512 kernels must be used, false otherwise
+ */
+inline bool isa_avx512() {
+    return runtime_dispatch && vector_mode < vector_mode_t::AVX512 && cpu_vector_mode() == vector_mode_t::AVX512;
+}
+
+/*!
+ * \brief Indicates if the kernels instantiated for AVX must be used
+ * instead of the kernels compiled for the pinned vector mode.
+ * \return true if the AVX kernels must be used, false otherwise
+ */
+inline bool isa_avx() {
+    return runtime_dispatch && vector_mode < vector_mode_t::AVX && cpu_vector_mode() == vector_mode_t::AVX;
+}
+
+} //end of namespace etl
+
+/*!
+ * \brief Call the given function of etl::impl::vec compiled for the best
+ * instruction set of the host, if it is wider than the vector mode of the
+ * binary.
+ *
+ * The expression is true if the function has been called, false otherwise.
+ */
+#if defined(ETL_ISA_AVX512) && defined(ETL_ISA_AVX)
+#define ETL_ISA_VEC_CALL(...) (etl::isa_avx512() ? (etl::impl::vec::avx512::__VA_ARGS__, true) : etl::isa_avx() ? (etl::impl::vec::avx::__VA_ARGS__, true) : false)
+#elif defined(ETL_ISA_AVX512)
+#define ETL_ISA_VEC_CALL(...) (etl::isa_avx512() ? (etl::impl::vec::avx512::__VA_ARGS__, true) : false)
+#else
+#define ETL_ISA_VEC_CALL(...) false
+#endif
@@ -0,0 +1,141 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file isa_vectorization.hpp
+ * \brief Compiles the vector implementations wider than the baseline of the
+ * binary for their own instruction set, for runtime dispatch.
+ *
+ * The implementations are included in #pragma GCC target regions. Since
+ * the C++ front-end of GCC does not define the macros of the instruction
+ * set (__AVX512F__, ...) inside the regions, ETL_TARGET_AVX512,
+ * ETL_TARGET_AVX and ETL_TARGET_SSE3 are defined instead while their code
+ * is included. Their functions are not forced inline: an always_inline
+ * function cannot be inlined in a function compiled for another
+ * instruction set. They are inlined in the kernels compiled inside the
+ * regions.
+ *
+ * This also declares the etl::impl::vec::avx512 and etl::impl::vec::avx
+ * namespaces, in which the kernels are instantiated again, with the
+ * configuration of their instruction set.
+ */
+
+#pragma once
+
+#include "etl/isa.hpp"
+
+#if defined(ETL_ISA_AVX512) || defined(ETL_ISA_AVX)
+
+// The vectors of the wider instruction sets are only passed by value
+// between functions compiled for these instruction sets, the warnings about
+// the changes of ABI without these instruction sets do not apply
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+#pragma push_macro("ETL_INLINE")
+#pragma push_macro("ETL_STATIC_INLINE")
+#pragma push_macro("ETL_TMP_INLINE")
+#pragma push_macro("ETL_OUT_INLINE")
+#pragma push_macro("ETL_INLINE_ATTR_VEC")
+
+#undef ETL_INLINE
+#undef ETL_STATIC_INLINE
+#undef ETL_TMP_INLINE
+#undef ETL_OUT_INLINE
+#undef ETL_INLINE_ATTR_VEC
+
+#define ETL_INLINE(RRRR) inline RRRR
+#define ETL_STATIC_INLINE(RRRR) static inline RRRR
+#define ETL_TMP_INLINE(RRRR) static inline RRRR
+#define ETL_OUT_INLINE(RRRR) inline RRRR
+#define ETL_INLINE_ATTR_VEC
+
+#ifndef __SSE3__
+#pragma GCC push_options
+#pragma GCC target("sse3")
+#define ETL_TARGET_SSE3
+#include "etl/sse_vectorization.hpp"
+#undef ETL_TARGET_SSE3
+#pragma GCC pop_options
+#endif
+
+#ifdef ETL_ISA_AVX
+#pragma GCC push_options
+#pragma GCC target("avx")
+#define ETL_TARGET_AVX
+#include "etl/avx_vectorization.hpp"
+#undef ETL_TARGET_AVX
+#pragma GCC pop_options
+#endif
+
+#ifdef ETL_ISA_AVX512
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx2,fma")
+#define ETL_TARGET_AVX512
+#include "etl/avx512_vectorization.hpp"
+#undef ETL_TARGET_AVX512
+#pragma GCC pop_options
+#endif
+
+#pragma pop_macro("ETL_INLINE")
+#pragma pop_macro("ETL_STATIC_INLINE")
+#pragma pop_macro("ETL_TMP_INLINE")
+#pragma pop_macro("ETL_OUT_INLINE")
+#pragma pop_macro("ETL_INLINE_ATTR_VEC")
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+#ifdef ETL_ISA_AVX512
+
+/*!
+ * \brief The kernels compiled for AVX-512
+ */
+namespace avx512 {
+
+using default_vec = avx512_vec; ///< The vectorization mode of the kernels
+
+constexpr vector_mode_t vector_mode = vector_mode_t::AVX512; ///< The vector mode of the kernels
+
+constexpr bool avx512_enabled = true; ///< Indicates if AVX512F is available
+constexpr bool avx_enabled    = true; ///< Indicates if AVX is available
+constexpr bool sse3_enabled   = true; ///< Indicates if sse3 is available
+constexpr bool vec_enabled    = true; ///< Indicates if any vectorization is available
+
+} //end of namespace avx512
+
+#endif
+
+#ifdef ETL_ISA_AVX
+
+/*!
+ * \brief The kernels compiled for AVX
+ */
+namespace avx {
+
+using default_vec = avx_vec; ///< The vectorization mode of the kernels
+
+constexpr vector_mode_t vector_mode = vector_mode_t::AVX; ///< The vector mode of the kernels
+
+constexpr bool avx512_enabled = false; ///< Indicates if AVX512F is available
+constexpr bool avx_enabled    = true;  ///< Indicates if AVX is available
+constexpr bool sse3_enabled   = true;  ///< Indicates if sse3 is available
+constexpr bool vec_enabled    = true;  ///< Indicates if any vectorization is available
+
+} //end of namespace avx
+
+#endif
+
+} //end of namespace vec
+
+} //end of namespace impl
+
+} //end of namespace etl
+
+#endif
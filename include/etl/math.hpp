@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cmath>
+#include <algorithm>
 
 namespace etl {
 
@@ -37,7 +38,7 @@ inline double logistic_sigmoid(double x) {
  * \return The softplus of x
  */
 inline float softplus(float x) {
-    return std::log1p(std::exp(x));
+    return std::max(x, 0.0f) + std::log1p(std::exp(-std::abs(x)));
 }
 
 /*!
@@ -46,7 +47,7 @@ inline float softplus(float x) {
  * \return The softplus of x
  */
 inline double softplus(double x) {
-    return std::log1p(std::exp(x));
+    return std::max(x, 0.0) + std::log1p(std::exp(-std::abs(x)));
 }
 
 /*!
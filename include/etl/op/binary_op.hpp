@@ -114,7 +114,7 @@ struct minus_binary_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    static cpp14_constexpr vec_type<V> load(const vec_type<V>& lhs, const vec_type<V>& rhs) noexcept {
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& lhs, const vec_type<V>& rhs) noexcept {
         return V::sub(lhs, rhs);
     }
 
@@ -144,7 +144,7 @@ struct mul_binary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = cpp::bool_constant<V == vector_mode_t::AVX512 ? !is_complex_t<T>::value : true>;
+    using vectorizable = std::true_type;
 
     static constexpr bool linear    = true;  ///< Indicates if the operator is linear or not
     static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
@@ -168,7 +168,7 @@ struct mul_binary_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    static cpp14_constexpr vec_type<V> load(const vec_type<V>& lhs, const vec_type<V>& rhs) noexcept {
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& lhs, const vec_type<V>& rhs) noexcept {
         return V::template mul<is_complex_t<T>::value>(lhs, rhs);
     }
 
@@ -198,7 +198,7 @@ struct div_binary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = cpp::bool_constant<V == vector_mode_t::AVX512 ? !is_complex_t<T>::value : true>;
+    using vectorizable = std::true_type;
 
     static constexpr bool linear    = true;  ///< Indicates if the operator is linear or not
     static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
@@ -222,7 +222,7 @@ struct div_binary_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    static cpp14_constexpr vec_type<V> load(const vec_type<V>& lhs, const vec_type<V>& rhs) noexcept {
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& lhs, const vec_type<V>& rhs) noexcept {
         return V::template div<is_complex_t<T>::value>(lhs, rhs);
     }
 
@@ -360,7 +360,7 @@ struct max_binary_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    static cpp14_constexpr vec_type<V> load(const vec_type<V>& lhs, const vec_type<V>& rhs) noexcept {
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& lhs, const vec_type<V>& rhs) noexcept {
         return V::max(lhs, rhs);
     }
 #endif
@@ -416,7 +416,7 @@ struct min_binary_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    static cpp14_constexpr vec_type<V> load(const vec_type<V>& lhs, const vec_type<V>& rhs) noexcept {
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& lhs, const vec_type<V>& rhs) noexcept {
         return V::min(lhs, rhs);
     }
 #endif
@@ -12,19 +12,43 @@
 
 #pragma once
 
-#include <chrono> //for std::time
-
 namespace etl {
 
 /*!
  * \brief Generator from a normal distribution
+ *
+ * The values are generated from a counter-based random stream, indexed by
+ * the position of the element.
  */
 template <typename T = double>
 struct normal_generator_op {
     using value_type = T; ///< The value type
 
-    random_engine rand_engine;                         ///< The random engine
-    std::normal_distribution<value_type> distribution; ///< The used distribution
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type = typename V::template vec_type<T>;
+
+    static constexpr bool thread_safe = true; ///< Indicates if the generator is thread safe
+
+    /*!
+     * \brief Indicates if the generator is vectorizable using the
+     * given vector mode.
+     *
+     * The normal values are only computed with the vector mode of the
+     * binary, used by the scalar version, since the results of the
+     * Box-Muller transform depend on the vector implementation.
+     *
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && V == vector_mode && is_floating_t<T>::value>;
+
+    random_stream stream;    ///< The random stream
+    const value_type mean;   ///< The mean
+    const value_type stddev; ///< The standard deviation
+    std::size_t current = 0; ///< The index of the next sequential value
 
     /*!
      * \brief Construct a new generator with the given mean and standard deviation
@@ -32,14 +56,34 @@ struct normal_generator_op {
      * \param stddev The standard deviation
      */
     normal_generator_op(T mean, T stddev)
-            : rand_engine(std::time(nullptr)), distribution(mean, stddev) {}
+            : mean(mean), stddev(stddev) {}
 
     /*!
      * \brief Generate a new value
      * \return the newly generated value
      */
     value_type operator()() {
-        return distribution(rand_engine);
+        return (*this)(current++);
+    }
+
+    /*!
+     * \brief Generate the value of the element i
+     * \param i The index of the element
+     * \return the generated value
+     */
+    value_type operator()(std::size_t i) const {
+        return mean + stddev * stream.template normal<random_real_t<T>>(i);
+    }
+
+    /*!
+     * \brief Generate the values of several elements at once
+     * \param i The index of the first element
+     * \tparam V The vectorization mode
+     * \return a vector containing the generated values
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(std::size_t i) const {
+        return V::fmadd(stream.template normal_load<V, T>(i), V::set(stddev), V::set(mean));
     }
 };
 
@@ -55,13 +99,35 @@ using uniform_distribution = std::conditional_t<
 
 /*!
  * \brief Generator from an uniform distribution
+ *
+ * The values are generated from a counter-based random stream, indexed by
+ * the position of the element. For integral types, the values are in
+ * [start, end], otherwise, they are in [start, end).
  */
 template <typename T = double>
 struct uniform_generator_op {
     using value_type = T; ///< The value type
 
-    random_engine rand_engine;                     ///< The random engine
-    uniform_distribution<value_type> distribution; ///< The used distribution
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type = typename V::template vec_type<T>;
+
+    static constexpr bool thread_safe = true; ///< Indicates if the generator is thread safe
+
+    /*!
+     * \brief Indicates if the generator is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
+
+    random_stream stream;    ///< The random stream
+    const value_type start;  ///< The beginning of the range
+    const value_type end;    ///< The end of the range
+    std::size_t current = 0; ///< The index of the next sequential value
 
     /*!
      * \brief Construct a new generator with the given start and end of the range
@@ -69,14 +135,44 @@ struct uniform_generator_op {
      * \param end The end of the range
      */
     uniform_generator_op(T start, T end)
-            : rand_engine(std::time(nullptr)), distribution(start, end) {}
+            : start(start), end(end) {}
 
     /*!
      * \brief Generate a new value
      * \return the newly generated value
      */
     value_type operator()() {
-        return distribution(rand_engine);
+        return (*this)(current++);
+    }
+
+    /*!
+     * \brief Generate the value of the element i
+     * \param i The index of the element
+     * \return the generated value
+     */
+    template <typename TT = T, cpp_enable_if(std::is_floating_point<TT>::value)>
+    value_type operator()(std::size_t i) const {
+        return start + (end - start) * stream.template uniform<random_real_t<T>>(i);
+    }
+
+    /*!
+     * \copydoc operator()(std::size_t)
+     */
+    template <typename TT = T, cpp_disable_if(std::is_floating_point<TT>::value)>
+    value_type operator()(std::size_t i) const {
+        const double range = double(end) - double(start) + 1.0;
+        return std::min(end, value_type(start + value_type(range * stream.template uniform<double>(i))));
+    }
+
+    /*!
+     * \brief Generate the values of several elements at once
+     * \param i The index of the first element
+     * \tparam V The vectorization mode
+     * \return a vector containing the generated values
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(std::size_t i) const {
+        return V::fmadd(stream.template uniform_load<V, T>(i), V::set(T(end - start)), V::set(start));
     }
 };
 
@@ -87,6 +183,16 @@ template <typename T = double>
 struct sequence_generator_op {
     using value_type = T; ///< The value type
 
+    static constexpr bool thread_safe = false; ///< Indicates if the generator is thread safe
+
+    /*!
+     * \brief Indicates if the generator is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    using vectorizable = std::false_type;
+
     const value_type start; ///< The beginning of the sequence
     value_type current;     ///< The current sequence element
 
@@ -104,6 +210,20 @@ struct sequence_generator_op {
     value_type operator()() {
         return current++;
     }
+
+    /*!
+     * \brief Generate a new value.
+     *
+     * The values are generated in the order of the calls, the index is
+     * not taken into account.
+     *
+     * \param i The index of the element
+     * \return the newly generated value
+     */
+    value_type operator()(std::size_t i) {
+        cpp_unused(i);
+        return current++;
+    }
 };
 
 /*!
@@ -9,14 +9,28 @@
 
 namespace etl {
 
+namespace detail {
+
+/*!
+ * \brief Compute the sum of the flat elements [first, last) of e, serially,
+ * with the selected sum implementation.
+ *
+ * This is defined with the implementations of the reductions.
+ */
+template <typename E>
+value_t<E> range_sum(const E& e, std::size_t first, std::size_t last);
+
+} //end of namespace detail
+
 /*!
  * \brief Transform (dynamic) that sums the expression from the right, effectively removing the right dimension.
  * \tparam T The type on which the transformer is applied
  */
 template <typename T>
 struct sum_r_transformer {
-    using sub_type   = T;          ///< The type on which the expression works
-    using value_type = value_t<T>; ///< The type of valuie
+    using sub_type   = T;                  ///< The type on which the expression works
+    using value_type = value_t<T>;         ///< The type of valuie
+    using impl_type  = detail::sum_r_impl; ///< The implementation of the whole reduction
 
     sub_type sub; ///< The subexpression
 
@@ -33,7 +47,7 @@ struct sum_r_transformer {
      * \return the value at the given index.
      */
     value_type operator[](std::size_t i) const {
-        return sum(sub(i));
+        return row_sum(i);
     }
 
     /*!
@@ -43,7 +57,7 @@ struct sum_r_transformer {
      * \return the value at the given index.
      */
     value_type read_flat(std::size_t i) const {
-        return sum(sub(i));
+        return row_sum(i);
     }
 
     /*!
@@ -51,7 +65,7 @@ struct sum_r_transformer {
      */
     template <typename... Sizes>
     value_type operator()(std::size_t i, Sizes... /*sizes*/) const {
-        return sum(sub(i));
+        return row_sum(i);
     }
 
     /*!
@@ -71,6 +85,28 @@ struct sum_r_transformer {
     bool alias(const E& rhs) const noexcept {
         return sub.alias(rhs);
     }
+
+private:
+    /*!
+     * \brief Compute the sum of the ith row, directly on its flat elements
+     * \param i The index of the row
+     * \return the sum of the ith row
+     */
+    template <typename S = sub_type, cpp_enable_if(decay_traits<S>::storage_order == order::RowMajor)>
+    value_type row_sum(std::size_t i) const {
+        const std::size_t n = etl::size(sub) / etl::dim<0>(sub);
+        return detail::range_sum(sub, i * n, (i + 1) * n);
+    }
+
+    /*!
+     * \brief Compute the sum of the ith row
+     * \param i The index of the row
+     * \return the sum of the ith row
+     */
+    template <typename S = sub_type, cpp_disable_if(decay_traits<S>::storage_order == order::RowMajor)>
+    value_type row_sum(std::size_t i) const {
+        return sum(sub(i));
+    }
 };
 
 /*!
@@ -79,8 +115,9 @@ struct sum_r_transformer {
  */
 template <typename T>
 struct mean_r_transformer {
-    using sub_type   = T;          ///< The type on which the expression works
-    using value_type = value_t<T>; ///< The type of valuie
+    using sub_type   = T;                   ///< The type on which the expression works
+    using value_type = value_t<T>;          ///< The type of valuie
+    using impl_type  = detail::mean_r_impl; ///< The implementation of the whole reduction
 
     sub_type sub; ///< The subexpression
 
@@ -97,7 +134,7 @@ struct mean_r_transformer {
      * \return the value at the given index.
      */
     value_type operator[](std::size_t i) const {
-        return mean(sub(i));
+        return row_mean(i);
     }
 
     /*!
@@ -107,7 +144,7 @@ struct mean_r_transformer {
      * \return the value at the given index.
      */
     value_type read_flat(std::size_t i) const {
-        return mean(sub(i));
+        return row_mean(i);
     }
 
     /*!
@@ -115,7 +152,7 @@ struct mean_r_transformer {
      */
     template <typename... Sizes>
     value_type operator()(std::size_t i, Sizes... /*sizes*/) const {
-        return mean(sub(i));
+        return row_mean(i);
     }
 
     /*!
@@ -135,16 +172,48 @@ struct mean_r_transformer {
     bool alias(const E& rhs) const noexcept {
         return sub.alias(rhs);
     }
+
+private:
+    /*!
+     * \brief Compute the mean of the ith row, directly on its flat elements
+     * \param i The index of the row
+     * \return the mean of the ith row
+     */
+    template <typename S = sub_type, cpp_enable_if(decay_traits<S>::storage_order == order::RowMajor)>
+    value_type row_mean(std::size_t i) const {
+        const std::size_t n = etl::size(sub) / etl::dim<0>(sub);
+        return detail::range_sum(sub, i * n, (i + 1) * n) / n;
+    }
+
+    /*!
+     * \brief Compute the mean of the ith row
+     * \param i The index of the row
+     * \return the mean of the ith row
+     */
+    template <typename S = sub_type, cpp_disable_if(decay_traits<S>::storage_order == order::RowMajor)>
+    value_type row_mean(std::size_t i) const {
+        return mean(sub(i));
+    }
 };
 
 /*!
  * \brief Transform (dynamic) that sums the expression from the left, effectively removing the left dimension.
+ *
+ * The transformer is vectorized by streaming the rows of the sub expression.
+ *
  * \tparam T The type on which the transformer is applied
  */
 template <typename T>
 struct sum_l_transformer {
-    using sub_type   = T;          ///< The type on which the expression works
-    using value_type = value_t<T>; ///< The type of valuie
+    using sub_type   = T;                  ///< The type on which the expression works
+    using value_type = value_t<T>;         ///< The type of valuie
+    using impl_type  = detail::sum_l_impl; ///< The implementation of the whole reduction
+
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type = typename V::template vec_type<value_type>;
 
     sub_type sub; ///< The subexpression
 
@@ -161,10 +230,12 @@ struct sum_l_transformer {
      * \return the value at the given index.
      */
     value_type operator[](std::size_t j) const {
+        const std::size_t n = etl::size(sub) / etl::dim<0>(sub);
+
         value_type m = 0.0;
 
         for (std::size_t i = 0; i < dim<0>(sub); ++i) {
-            m += sub[j + i * (size(sub) / dim<0>(sub))];
+            m += sub[j + i * n];
         }
 
         return m;
@@ -177,10 +248,42 @@ struct sum_l_transformer {
      * \return the value at the given index.
      */
     value_type read_flat(std::size_t j) const noexcept {
+        const std::size_t n = etl::size(sub) / etl::dim<0>(sub);
+
         value_type m = 0.0;
 
         for (std::size_t i = 0; i < dim<0>(sub); ++i) {
-            m += sub.read_flat(j + i * (size(sub) / dim<0>(sub)));
+            m += sub.read_flat(j + i * n);
+        }
+
+        return m;
+    }
+
+    /*!
+     * \brief Returns the values at the given index, several at once
+     * \param j The index
+     * \tparam V The vectorization mode to use
+     * \return a vector containing the values at the given index.
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(std::size_t j) const {
+        return loadu<V>(j);
+    }
+
+    /*!
+     * \brief Returns the values at the given index, several at once
+     * \param j The index
+     * \tparam V The vectorization mode to use
+     * \return a vector containing the values at the given index.
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) loadu(std::size_t j) const {
+        const std::size_t n = etl::size(sub) / etl::dim<0>(sub);
+
+        auto m = V::template zero<value_type>();
+
+        for (std::size_t i = 0; i < dim<0>(sub); ++i) {
+            m = V::add(m, sub.template loadu<V>(j + i * n));
         }
 
         return m;
@@ -224,12 +327,22 @@ struct sum_l_transformer {
 
 /*!
  * \brief Transform (dynamic) that averages the expression from the left, effectively removing the left dimension.
+ *
+ * The transformer is vectorized by streaming the rows of the sub expression.
+ *
  * \tparam T The type on which the transformer is applied
  */
 template <typename T>
 struct mean_l_transformer {
-    using sub_type   = T;          ///< The type on which the expression works
-    using value_type = value_t<T>; ///< The type of valuie
+    using sub_type   = T;                   ///< The type on which the expression works
+    using value_type = value_t<T>;          ///< The type of valuie
+    using impl_type  = detail::mean_l_impl; ///< The implementation of the whole reduction
+
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type = typename V::template vec_type<value_type>;
 
     sub_type sub; ///< The subexpression
 
@@ -246,10 +359,12 @@ struct mean_l_transformer {
      * \return the value at the given index.
      */
     value_type operator[](std::size_t j) const {
+        const std::size_t n = etl::size(sub) / etl::dim<0>(sub);
+
         value_type m = 0.0;
 
         for (std::size_t i = 0; i < dim<0>(sub); ++i) {
-            m += sub[j + i * (size(sub) / dim<0>(sub))];
+            m += sub[j + i * n];
         }
 
         return m / dim<0>(sub);
@@ -262,15 +377,47 @@ struct mean_l_transformer {
      * \return the value at the given index.
      */
     value_type read_flat(std::size_t j) const noexcept {
+        const std::size_t n = etl::size(sub) / etl::dim<0>(sub);
+
         value_type m = 0.0;
 
         for (std::size_t i = 0; i < dim<0>(sub); ++i) {
-            m += sub.read_flat(j + i * (size(sub) / dim<0>(sub)));
+            m += sub.read_flat(j + i * n);
         }
 
         return m / dim<0>(sub);
     }
 
+    /*!
+     * \brief Returns the values at the given index, several at once
+     * \param j The index
+     * \tparam V The vectorization mode to use
+     * \return a vector containing the values at the given index.
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(std::size_t j) const {
+        return loadu<V>(j);
+    }
+
+    /*!
+     * \brief Returns the values at the given index, several at once
+     * \param j The index
+     * \tparam V The vectorization mode to use
+     * \return a vector containing the values at the given index.
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) loadu(std::size_t j) const {
+        const std::size_t n = etl::size(sub) / etl::dim<0>(sub);
+
+        auto m = V::template zero<value_type>();
+
+        for (std::size_t i = 0; i < dim<0>(sub); ++i) {
+            m = V::add(m, sub.template loadu<V>(j + i * n));
+        }
+
+        return V::div(m, V::set(value_type(dim<0>(sub))));
+    }
+
     /*!
      * \brief Access to the value at the given (j, sizes...) position
      * \param j The first index
@@ -307,6 +454,18 @@ struct mean_l_transformer {
     }
 };
 
+/*!
+ * \brief Traits indicating if the given transformer reduces the rows
+ * (sum_r, mean_r) or the columns (sum_l, mean_l) of its sub expression
+ * \tparam T The transformer type
+ */
+template <typename T>
+using is_reduc_transformer = cpp::or_c<
+    cpp::is_specialization_of<etl::sum_r_transformer, std::decay_t<T>>,
+    cpp::is_specialization_of<etl::mean_r_transformer, std::decay_t<T>>,
+    cpp::is_specialization_of<etl::sum_l_transformer, std::decay_t<T>>,
+    cpp::is_specialization_of<etl::mean_l_transformer, std::decay_t<T>>>;
+
 /*!
  * \brief Specialization for (sum-mean)_r_transformer
  */
@@ -420,7 +579,7 @@ struct etl_traits<T, std::enable_if_t<cpp::or_c<
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = typename etl_traits<sub_expr_t>::template vectorizable<V>;
 
     /*!
      * \brief Returns the size of the given expression
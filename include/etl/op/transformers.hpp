@@ -149,9 +149,10 @@ struct mm_mul_transformer {
      * \return the value at the given index.
      */
     value_type operator[](std::size_t i) const {
-        std::size_t i_i, i_j;
-        std::tie(i_i, i_j) = index_to_2d(left, i);
-        return operator()(i_i, i_j);
+        // The result has the rows of left and the columns of right
+        return decay_traits<mm_mul_transformer>::storage_order == order::RowMajor
+                   ? operator()(i / columns(right), i % columns(right))
+                   : operator()(i % rows(left), i / rows(left));
     }
 
     /*!
@@ -161,9 +162,10 @@ struct mm_mul_transformer {
      * \return the value at the given index.
      */
     value_type read_flat(std::size_t i) const {
-        std::size_t i_i, i_j;
-        std::tie(i_i, i_j) = index_to_2d(left, i);
-        return operator()(i_i, i_j);
+        // The result has the rows of left and the columns of right
+        return decay_traits<mm_mul_transformer>::storage_order == order::RowMajor
+                   ? operator()(i / columns(right), i % columns(right))
+                   : operator()(i % rows(left), i / rows(left));
     }
 
     /*!
@@ -24,12 +24,46 @@
 
 namespace etl {
 
+namespace detail {
+
+/*!
+ * \brief Compute sinh(x) with its Taylor series, accurate up to double
+ * precision for |x| <= 1
+ * \param x The vector on which to operate
+ * \tparam V The vectorization mode
+ * \tparam T The value type
+ * \return a vector containing sinh(x)
+ */
+template <typename V, typename T>
+ETL_STRONG_INLINE(typename V::template vec_type<T>) sinh_series(const typename V::template vec_type<T>& x) {
+    auto z = V::mul(x, x);
+
+    auto y = V::set(T(1.0 / 355687428096000.0));
+    y      = V::fmadd(y, z, V::set(T(1.0 / 1307674368000.0)));
+    y      = V::fmadd(y, z, V::set(T(1.0 / 6227020800.0)));
+    y      = V::fmadd(y, z, V::set(T(1.0 / 39916800.0)));
+    y      = V::fmadd(y, z, V::set(T(1.0 / 362880.0)));
+    y      = V::fmadd(y, z, V::set(T(1.0 / 5040.0)));
+    y      = V::fmadd(y, z, V::set(T(1.0 / 120.0)));
+    y      = V::fmadd(y, z, V::set(T(1.0 / 6.0)));
+
+    return V::fmadd(V::mul(y, z), x, x);
+}
+
+} //end of namespace detail
+
 /*!
  * \brief Unary operation taking the absolute value
  * \tparam T The type of value
  */
 template <typename T>
 struct abs_unary_op {
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     static constexpr bool linear = true; ///< Indicates if the operator is linear
     static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
 
@@ -39,7 +73,7 @@ struct abs_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
 
     /*!
      * \brief Apply the unary operator on x
@@ -50,6 +84,17 @@ struct abs_unary_op {
         return std::abs(x);
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
+        return V::abs(x);
+    }
+
     /*!
      * \brief Returns a textual representation of the operator
      * \return a string representing the operator
@@ -74,10 +119,7 @@ struct log_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = cpp::bool_constant<
-            (V == vector_mode_t::SSE3 && is_single_precision_t<T>::value)
-        ||  (V == vector_mode_t::AVX && is_single_precision_t<T>::value)
-        ||  (intel_compiler && !is_complex_t<T>::value)>;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
 
     /*!
      * The vectorization type for V
@@ -101,7 +143,7 @@ struct log_unary_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    static cpp14_constexpr vec_type<V> load(const vec_type<V>& x) noexcept {
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
         return V::log(x);
     }
 
@@ -153,7 +195,7 @@ struct sqrt_unary_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    static cpp14_constexpr vec_type<V> load(const vec_type<V>& x) noexcept {
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
         return V::sqrt(x);
     }
 
@@ -187,10 +229,7 @@ struct exp_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = cpp::bool_constant<
-            (V == vector_mode_t::SSE3 && !is_complex_t<T>::value)
-        ||  (V == vector_mode_t::AVX && !is_complex_t<T>::value)
-        ||  (intel_compiler && !is_complex_t<T>::value)>;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
 
     /*!
      * \brief Apply the unary operator on x
@@ -208,7 +247,7 @@ struct exp_unary_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    static cpp14_constexpr vec_type<V> load(const vec_type<V>& x) noexcept {
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
         return V::exp(x);
     }
 
@@ -227,6 +266,12 @@ struct exp_unary_op {
  */
 template <typename T>
 struct sign_unary_op {
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     static constexpr bool linear = true; ///< Indicates if the operator is linear
     static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
 
@@ -236,7 +281,7 @@ struct sign_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
 
     /*!
      * \brief Apply the unary operator on x
@@ -247,6 +292,19 @@ struct sign_unary_op {
         return math::sign(x);
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
+        auto zero = V::set(T(0));
+        auto one  = V::set(T(1));
+        return V::select(V::lt(zero, x), one, V::select(V::lt(x, zero), V::minus(one), zero));
+    }
+
     /*!
      * \brief Returns a textual representation of the operator
      * \return a string representing the operator
@@ -262,6 +320,12 @@ struct sign_unary_op {
  */
 template <typename T>
 struct sigmoid_unary_op {
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     static constexpr bool linear = true; ///< Indicates if the operator is linear
     static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
 
@@ -271,7 +335,7 @@ struct sigmoid_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
 
     /*!
      * \brief Apply the unary operator on x
@@ -282,6 +346,21 @@ struct sigmoid_unary_op {
         return math::logistic_sigmoid(x);
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     *
+     * The maximum error is about 3 ulp, except for very negative inputs
+     * where the result becomes denormal.
+     */
+    template <typename V = default_vec>
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
+        auto one = V::set(T(1));
+        return V::div(one, V::add(one, V::exp(V::minus(x))));
+    }
+
     /*!
      * \brief Returns a textual representation of the operator
      * \return a string representing the operator
@@ -297,6 +376,12 @@ struct sigmoid_unary_op {
  */
 template <typename T>
 struct softplus_unary_op {
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     static constexpr bool linear = true; ///< Indicates if the operator is linear
     static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
 
@@ -306,7 +391,7 @@ struct softplus_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
 
     /*!
      * \brief Apply the unary operator on x
@@ -317,6 +402,30 @@ struct softplus_unary_op {
         return math::softplus(x);
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     *
+     * The maximum error is about 3 ulp.
+     */
+    template <typename V = default_vec>
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
+        auto zero = V::set(T(0));
+        auto one  = V::set(T(1));
+
+        // softplus(x) = max(x, 0) + log1p(exp(-|x|)) does not overflow
+        auto t = V::exp(V::minus(V::abs(x)));
+        auto u = V::add(one, t);
+        auto d = V::sub(u, one);
+
+        // log1p(t) = log(u) * t / (u - 1), which is t when u rounds to 1
+        auto l = V::select(V::lt(zero, d), V::mul(V::log(u), V::div(t, d)), t);
+
+        return V::add(V::max(x, zero), l);
+    }
+
     /*!
      * \brief Returns a textual representation of the operator
      * \return a string representing the operator
@@ -365,7 +474,7 @@ struct minus_unary_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    static cpp14_constexpr vec_type<V> load(const vec_type<V>& x) noexcept {
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
         return V::minus(x);
     }
 
@@ -417,7 +526,7 @@ struct plus_unary_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    static cpp14_constexpr vec_type<V> load(const vec_type<V>& x) noexcept {
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
         return x;
     }
 
@@ -436,6 +545,12 @@ struct plus_unary_op {
  */
 template <typename T>
 struct fast_sigmoid_unary_op {
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     static constexpr bool linear = true; ///< Indicates if the operator is linear
     static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
 
@@ -445,7 +560,7 @@ struct fast_sigmoid_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
 
     /*!
      * \brief Apply the unary operator on x
@@ -479,6 +594,30 @@ struct fast_sigmoid_unary_op {
         return 0.5 * (z + 1.0);
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
+        auto zero = V::set(T(0));
+        auto one  = V::set(T(1));
+        auto half = V::set(T(0.5));
+
+        auto ax = V::abs(V::mul(half, x));
+
+        auto z1 = V::div(V::mul(V::set(T(1.5)), ax), V::add(one, ax));
+        auto z2 = V::fmadd(V::set(T(0.0458812946797165)), V::sub(ax, V::set(T(1.7))), V::set(T(0.935409070603099)));
+        z2      = V::min(z2, V::set(T(0.99505475368673)));
+
+        auto z = V::select(V::lt(ax, V::set(T(1.7))), z1, z2);
+        z      = V::select(V::lt(x, zero), V::minus(z), z);
+
+        return V::mul(half, V::add(z, one));
+    }
+
     /*!
      * \brief Returns a textual representation of the operator
      * \return a string representing the operator
@@ -494,6 +633,12 @@ struct fast_sigmoid_unary_op {
  */
 template <typename T>
 struct tan_unary_op {
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     static constexpr bool linear = true; ///< Indicates if the operator is linear
     static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
 
@@ -503,7 +648,7 @@ struct tan_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
 
     /*!
      * \brief Apply the unary operator on x
@@ -514,6 +659,19 @@ struct tan_unary_op {
         return std::tan(x);
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     *
+     * The maximum error is about 4 ulp, except near the poles.
+     */
+    template <typename V = default_vec>
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
+        return V::div(V::sin(x), V::cos(x));
+    }
+
     /*!
      * \brief Returns a textual representation of the operator
      * \return a string representing the operator
@@ -544,7 +702,7 @@ struct cos_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = cpp::bool_constant<(V == vector_mode_t::SSE3 || V == vector_mode_t::AVX)&& is_single_precision_t<T>::value>;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
 
     /*!
      * \brief Apply the unary operator on x
@@ -562,7 +720,7 @@ struct cos_unary_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    static cpp14_constexpr vec_type<V> load(const vec_type<V>& x) noexcept {
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
         return V::cos(x);
     }
 
@@ -596,7 +754,7 @@ struct sin_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = cpp::bool_constant<(V == vector_mode_t::SSE3 || V == vector_mode_t::AVX)&& is_single_precision_t<T>::value>;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
 
     /*!
      * \brief Apply the unary operator on x
@@ -614,7 +772,7 @@ struct sin_unary_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    static cpp14_constexpr vec_type<V> load(const vec_type<V>& x) noexcept {
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
         return V::sin(x);
     }
 
@@ -633,6 +791,12 @@ struct sin_unary_op {
  */
 template <typename T>
 struct tanh_unary_op {
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     static constexpr bool linear = true; ///< Indicates if the operator is linear
     static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
 
@@ -642,7 +806,7 @@ struct tanh_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
 
     /*!
      * \brief Apply the unary operator on x
@@ -653,6 +817,31 @@ struct tanh_unary_op {
         return std::tanh(x);
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     *
+     * The maximum error is about 3 ulp.
+     */
+    template <typename V = default_vec>
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
+        auto one = V::set(T(1));
+        auto ax  = V::abs(x);
+
+        // |x| < 1: tanh(x) = sinh(x) / sqrt(1 + sinh(x)^2)
+        auto s     = detail::sinh_series<V, T>(x);
+        auto small = V::div(s, V::sqrt(V::fmadd(s, s, one)));
+
+        // |x| >= 1: tanh(|x|) = (1 - e^(-2|x|)) / (1 + e^(-2|x|))
+        auto e     = V::exp(V::mul(V::set(T(-2)), ax));
+        auto large = V::div(V::sub(one, e), V::add(one, e));
+        large      = V::select(V::lt(x, V::set(T(0))), V::minus(large), large);
+
+        return V::select(V::lt(ax, one), small, large);
+    }
+
     /*!
      * \brief Returns a textual representation of the operator
      * \return a string representing the operator
@@ -668,6 +857,12 @@ struct tanh_unary_op {
  */
 template <typename T>
 struct cosh_unary_op {
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     static constexpr bool linear = true; ///< Indicates if the operator is linear
     static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
 
@@ -677,7 +872,7 @@ struct cosh_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
 
     /*!
      * \brief Apply the unary operator on x
@@ -688,6 +883,21 @@ struct cosh_unary_op {
         return std::cosh(x);
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     *
+     * The maximum error is about 2 ulp, as long as e^|x| does not overflow.
+     */
+    template <typename V = default_vec>
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
+        auto half = V::set(T(0.5));
+        auto e    = V::exp(V::abs(x));
+        return V::add(V::mul(half, e), V::div(half, e));
+    }
+
     /*!
      * \brief Returns a textual representation of the operator
      * \return a string representing the operator
@@ -703,6 +913,12 @@ struct cosh_unary_op {
  */
 template <typename T>
 struct sinh_unary_op {
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     static constexpr bool linear = true; ///< Indicates if the operator is linear
     static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
 
@@ -712,7 +928,7 @@ struct sinh_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
 
     /*!
      * \brief Apply the unary operator on x
@@ -723,6 +939,28 @@ struct sinh_unary_op {
         return std::sinh(x);
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     *
+     * The maximum error is about 2 ulp, as long as e^|x| does not overflow.
+     */
+    template <typename V = default_vec>
+    static cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
+        auto one  = V::set(T(1));
+        auto half = V::set(T(0.5));
+        auto ax   = V::abs(x);
+
+        // |x| >= 1: sinh(|x|) = (e^|x| - e^-|x|) / 2
+        auto e     = V::exp(ax);
+        auto large = V::sub(V::mul(half, e), V::div(half, e));
+        large      = V::select(V::lt(x, V::set(T(0))), V::minus(large), large);
+
+        return V::select(V::lt(ax, one), detail::sinh_series<V, T>(x), large);
+    }
+
     /*!
      * \brief Returns a textual representation of the operator
      * \return a string representing the operator
@@ -874,12 +1112,23 @@ struct relu_derivative_op {
 
 /*!
  * \brief Unary operation sampling with a Bernoulli distribution
+ *
+ * The values are generated from a counter-based random stream, indexed by
+ * the position of the element.
+ *
  * \tparam T The type of value
  */
 template <typename T>
 struct bernoulli_unary_op {
-    static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
+    static constexpr bool linear      = true; ///< Indicates if the operator is linear
+    static constexpr bool thread_safe = true; ///< Indicates if the operator is thread safe or not
+    static constexpr bool indexed     = true; ///< Indicates if the operator needs the index of the elements
 
     /*!
      * \brief Indicates if the expression is vectorizable using the
@@ -887,18 +1136,30 @@ struct bernoulli_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
+
+    random_stream stream; ///< The random stream
 
     /*!
      * \brief Apply the unary operator on x
      * \param x The value on which to apply the operator
+     * \param i The index of the element
      * \return The result of applying the unary operator on x
      */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-        static std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    T apply(const T& x, std::size_t i) const {
+        return x > stream.template uniform<random_real_t<T>>(i) ? 1.0 : 0.0;
+    }
 
-        return x > distribution(rand_engine) ? 1.0 : 0.0;
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \param i The index of the first element
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x, std::size_t i) const {
+        return V::select(V::lt(stream.template uniform_load<V, T>(i), x), V::set(T(1)), V::set(T(0)));
     }
 
     /*!
@@ -912,12 +1173,23 @@ struct bernoulli_unary_op {
 
 /*!
  * \brief Unary operation sampling with a reverse Bernoulli distribution
+ *
+ * The values are generated from a counter-based random stream, indexed by
+ * the position of the element.
+ *
  * \tparam T The type of value
  */
 template <typename T>
 struct reverse_bernoulli_unary_op {
-    static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
+    static constexpr bool linear      = true; ///< Indicates if the operator is linear
+    static constexpr bool thread_safe = true; ///< Indicates if the operator is thread safe or not
+    static constexpr bool indexed     = true; ///< Indicates if the operator needs the index of the elements
 
     /*!
      * \brief Indicates if the expression is vectorizable using the
@@ -925,18 +1197,30 @@ struct reverse_bernoulli_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
+
+    random_stream stream; ///< The random stream
 
     /*!
      * \brief Apply the unary operator on x
      * \param x The value on which to apply the operator
+     * \param i The index of the element
      * \return The result of applying the unary operator on x
      */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-        static std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    T apply(const T& x, std::size_t i) const {
+        return x > stream.template uniform<random_real_t<T>>(i) ? 0.0 : 1.0;
+    }
 
-        return x > distribution(rand_engine) ? 0.0 : 1.0;
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \param i The index of the first element
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x, std::size_t i) const {
+        return V::select(V::lt(stream.template uniform_load<V, T>(i), x), V::set(T(0)), V::set(T(1)));
     }
 
     /*!
@@ -949,13 +1233,24 @@ struct reverse_bernoulli_unary_op {
 };
 
 /*!
- * \brief Unary operation applying an uniform noise (0.0, 1.0(
+ * \brief Unary operation applying an uniform noise (0.0, 1.0)
+ *
+ * The values are generated from a counter-based random stream, indexed by
+ * the position of the element.
+ *
  * \tparam T The type of value
  */
 template <typename T>
 struct uniform_noise_unary_op {
-    static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
+    static constexpr bool linear      = true; ///< Indicates if the operator is linear
+    static constexpr bool thread_safe = true; ///< Indicates if the operator is thread safe or not
+    static constexpr bool indexed     = true; ///< Indicates if the operator needs the index of the elements
 
     /*!
      * \brief Indicates if the expression is vectorizable using the
@@ -963,18 +1258,30 @@ struct uniform_noise_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && is_floating_t<T>::value>;
+
+    random_stream stream; ///< The random stream
 
     /*!
      * \brief Apply the unary operator on x
      * \param x The value on which to apply the operator
+     * \param i The index of the element
      * \return The result of applying the unary operator on x
      */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-        static std::uniform_real_distribution<double> real_distribution(0.0, 1.0);
+    T apply(const T& x, std::size_t i) const {
+        return x + stream.template uniform<random_real_t<T>>(i);
+    }
 
-        return x + real_distribution(rand_engine);
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \param i The index of the first element
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x, std::size_t i) const {
+        return V::add(x, stream.template uniform_load<V, T>(i));
     }
 
     /*!
@@ -988,31 +1295,55 @@ struct uniform_noise_unary_op {
 
 /*!
  * \brief Unary operation applying a normal noise
+ *
+ * The values are generated from a counter-based random stream, indexed by
+ * the position of the element.
+ *
  * \tparam T The type of value
  */
 template <typename T>
 struct normal_noise_unary_op {
-    static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
+    static constexpr bool linear      = true; ///< Indicates if the operator is linear
+    static constexpr bool thread_safe = true; ///< Indicates if the operator is thread safe or not
+    static constexpr bool indexed     = true; ///< Indicates if the operator needs the index of the elements
 
     /*!
      * \brief Indicates if the expression is vectorizable using the
-     * given vector mode
+     * given vector mode, only the one of the binary (see
+     * normal_generator_op)
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && V == vector_mode && is_floating_t<T>::value>;
+
+    random_stream stream; ///< The random stream
 
     /*!
      * \brief Apply the unary operator on x
      * \param x The value on which to apply the operator
+     * \param i The index of the element
      * \return The result of applying the unary operator on x
      */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-        static std::normal_distribution<double> normal_distribution(0.0, 1.0);
+    T apply(const T& x, std::size_t i) const {
+        return x + stream.template normal<random_real_t<T>>(i);
+    }
 
-        return x + normal_distribution(rand_engine);
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \param i The index of the first element
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x, std::size_t i) const {
+        return V::add(x, stream.template normal_load<V, T>(i));
     }
 
     /*!
@@ -1026,32 +1357,57 @@ struct normal_noise_unary_op {
 
 /*!
  * \brief Unary operation applying a logistic noise
+ *
+ * The noise follows N(0, sigmoid(x)).
+ *
+ * The values are generated from a counter-based random stream, indexed by
+ * the position of the element.
+ *
  * \tparam T The type of value
  */
 template <typename T>
 struct logistic_noise_unary_op {
-    static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
+    static constexpr bool linear      = true; ///< Indicates if the operator is linear
+    static constexpr bool thread_safe = true; ///< Indicates if the operator is thread safe or not
+    static constexpr bool indexed     = true; ///< Indicates if the operator needs the index of the elements
 
     /*!
      * \brief Indicates if the expression is vectorizable using the
-     * given vector mode
+     * given vector mode, only the one of the binary (see
+     * normal_generator_op)
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<V != vector_mode_t::NONE && V == vector_mode && is_floating_t<T>::value>;
+
+    random_stream stream; ///< The random stream
 
     /*!
      * \brief Apply the unary operator on x
      * \param x The value on which to apply the operator
+     * \param i The index of the element
      * \return The result of applying the unary operator on x
      */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-
-        std::normal_distribution<double> noise_distribution(0.0, math::logistic_sigmoid(x));
+    T apply(const T& x, std::size_t i) const {
+        return x + math::logistic_sigmoid(x) * stream.template normal<random_real_t<T>>(i);
+    }
 
-        return x + noise_distribution(rand_engine);
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \param i The index of the first element
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x, std::size_t i) const {
+        return V::fmadd(sigmoid_unary_op<T>::template load<V>(x), stream.template normal_load<V, T>(i), x);
     }
 
     /*!
@@ -1113,7 +1469,7 @@ struct min_scalar_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    cpp14_constexpr vec_type<V> load(const vec_type<V>& lhs) const noexcept {
+    cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& lhs) const noexcept {
         return V::min(lhs, V::set(s));
     }
 #endif
@@ -1177,7 +1533,7 @@ struct max_scalar_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    cpp14_constexpr vec_type<V> load(const vec_type<V>& lhs) const noexcept {
+    cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& lhs) const noexcept {
         return V::max(lhs, V::set(s));
     }
 #endif
@@ -1243,7 +1599,7 @@ struct clip_scalar_op {
      * \return a vector containing several results of the operator
      */
     template <typename V = default_vec>
-    cpp14_constexpr vec_type<V> load(const vec_type<V>& lhs) const noexcept {
+    cpp14_constexpr ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& lhs) const noexcept {
         return V::min(V::max(lhs, V::set(min)), V::set(max));
     }
 #endif
@@ -301,7 +301,7 @@ struct sub_view {
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void store(vec_type<V> in, std::size_t x) noexcept {
+    ETL_STRONG_INLINE(void) store(vec_type<V> in, std::size_t x) noexcept {
         return value().template storeu<V>(in, x + i * subsize(sub));
     }
 
@@ -312,7 +312,7 @@ struct sub_view {
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void storeu(vec_type<V> in, std::size_t x) noexcept {
+    ETL_STRONG_INLINE(void) storeu(vec_type<V> in, std::size_t x) noexcept {
         return value().template storeu<V>(in, x + i * subsize(sub));
     }
 
@@ -323,7 +323,7 @@ struct sub_view {
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void stream(vec_type<V> in, std::size_t x) noexcept {
+    ETL_STRONG_INLINE(void) stream(vec_type<V> in, std::size_t x) noexcept {
         return value().template storeu<V>(in, x + i * subsize(sub));
     }
 
@@ -334,7 +334,7 @@ struct sub_view {
      * \return a vector containing several elements of the expression
      */
     template <typename V = default_vec>
-    auto load(std::size_t x) const noexcept {
+    ETL_STRONG_INLINE(auto) load(std::size_t x) const noexcept {
         return sub.template loadu<V>(x + i * subsize(sub));
     }
 
@@ -345,7 +345,7 @@ struct sub_view {
      * \return a vector containing several elements of the expression
      */
     template <typename V = default_vec>
-    auto loadu(std::size_t x) const noexcept {
+    ETL_STRONG_INLINE(auto) loadu(std::size_t x) const noexcept {
         return sub.template loadu<V>(x + i * subsize(sub));
     }
 
@@ -522,7 +522,7 @@ struct slice_view {
      * \return a vector containing several elements of the expression
      */
     template <typename V = default_vec>
-    auto load(std::size_t x) const noexcept {
+    ETL_STRONG_INLINE(auto) load(std::size_t x) const noexcept {
         return sub.template loadu<V>(x + first * (etl::size(sub) / etl::dim<0>(sub)));
     }
 
@@ -533,7 +533,7 @@ struct slice_view {
      * \return a vector containing several elements of the expression
      */
     template <typename V = default_vec>
-    auto loadu(std::size_t x) const noexcept {
+    ETL_STRONG_INLINE(auto) loadu(std::size_t x) const noexcept {
         return sub.template loadu<V>(x + first * (etl::size(sub) / etl::dim<0>(sub)));
     }
 
@@ -667,7 +667,7 @@ struct memory_slice_view {
      * \return a vector containing several elements of the expression
      */
     template <typename V = default_vec>
-    auto load(std::size_t x) const noexcept {
+    ETL_STRONG_INLINE(auto) load(std::size_t x) const noexcept {
         return sub.template loadu<V>(x + first );
     }
 
@@ -678,7 +678,7 @@ struct memory_slice_view {
      * \return a vector containing several elements of the expression
      */
     template <typename V = default_vec>
-    auto loadu(std::size_t x) const noexcept {
+    ETL_STRONG_INLINE(auto) loadu(std::size_t x) const noexcept {
         return sub.template loadu<V>(x + first );
     }
 
@@ -689,7 +689,7 @@ struct memory_slice_view {
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void store(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) store(vec_type<V> in, std::size_t i) noexcept {
         sub.template storeu<V>(in, first + i);
     }
 
@@ -700,7 +700,7 @@ struct memory_slice_view {
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void storeu(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) storeu(vec_type<V> in, std::size_t i) noexcept {
         sub.template storeu<V>(in, first + i);
     }
 
@@ -711,7 +711,7 @@ struct memory_slice_view {
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void stream(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) stream(vec_type<V> in, std::size_t i) noexcept {
         sub.template storeu<V>(in, first + i);
     }
 
@@ -921,7 +921,7 @@ struct fast_matrix_view {
      * \return a vector containing several elements of the expression
      */
     template <typename V = default_vec>
-    auto load(std::size_t x) const noexcept {
+    ETL_STRONG_INLINE(auto) load(std::size_t x) const noexcept {
         return sub.template load<V>(x);
     }
 
@@ -932,7 +932,7 @@ struct fast_matrix_view {
      * \return a vector containing several elements of the expression
      */
     template <typename V = default_vec>
-    auto loadu(std::size_t x) const noexcept {
+    ETL_STRONG_INLINE(auto) loadu(std::size_t x) const noexcept {
         return sub.template loadu<V>(x);
     }
 
@@ -943,7 +943,7 @@ struct fast_matrix_view {
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void store(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) store(vec_type<V> in, std::size_t i) noexcept {
         sub.template store<V>(in, i);
     }
 
@@ -954,7 +954,7 @@ struct fast_matrix_view {
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void storeu(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) storeu(vec_type<V> in, std::size_t i) noexcept {
         sub.template storeu<V>(in, i);
     }
 
@@ -965,7 +965,7 @@ struct fast_matrix_view {
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void stream(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) stream(vec_type<V> in, std::size_t i) noexcept {
         sub.template stream<V>(in, i);
     }
 
@@ -1140,7 +1140,7 @@ struct dyn_matrix_view {
      * \return a vector containing several elements of the expression
      */
     template <typename V = default_vec>
-    auto load(std::size_t x) const noexcept {
+    ETL_STRONG_INLINE(auto) load(std::size_t x) const noexcept {
         return sub.template load<V>(x);
     }
 
@@ -1151,7 +1151,7 @@ struct dyn_matrix_view {
      * \return a vector containing several elements of the expression
      */
     template <typename V = default_vec>
-    auto loadu(std::size_t x) const noexcept {
+    ETL_STRONG_INLINE(auto) loadu(std::size_t x) const noexcept {
         return sub.template loadu<V>(x);
     }
 
@@ -1162,7 +1162,7 @@ struct dyn_matrix_view {
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void stream(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) stream(vec_type<V> in, std::size_t i) noexcept {
         sub.template stream<V>(in, i);
     }
 
@@ -1173,7 +1173,7 @@ struct dyn_matrix_view {
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void store(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) store(vec_type<V> in, std::size_t i) noexcept {
         sub.template store<V>(in, i);
     }
 
@@ -1184,7 +1184,7 @@ struct dyn_matrix_view {
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void storeu(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) storeu(vec_type<V> in, std::size_t i) noexcept {
         sub.template storeu<V>(in, i);
     }
 
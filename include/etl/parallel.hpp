@@ -9,6 +9,26 @@
 
 namespace etl {
 
+/*!
+ * \brief Returns the number of threads used for parallel evaluation
+ * \return the number of threads used for parallel evaluation
+ */
+inline std::size_t parallel_threads() noexcept {
+    return thread_pool::instance().threads();
+}
+
+/*!
+ * \brief Sets the number of threads used for parallel evaluation.
+ *
+ * By default, this is the threads configuration constant. This must not
+ * be called during a parallel evaluation.
+ *
+ * \param n The number of threads, including the calling thread
+ */
+inline void set_parallel_threads(std::size_t n) {
+    thread_pool::instance().set_threads(n);
+}
+
 /*!
  * \brief Indicates if an 1D evaluation should run in paralle
  * \param n The size of the evaluation
@@ -16,7 +36,7 @@ namespace etl {
  * \return true if the evaluation should be done in paralle, false otherwise
  */
 inline bool select_parallel(std::size_t n, std::size_t threshold = parallel_threshold) {
-    return threads > 1 && (local_context().parallel || (is_parallel && n >= threshold && !local_context().serial));
+    return parallel_threads() > 1 && (local_context().parallel || (is_parallel && n >= threshold && !local_context().serial));
 }
 
 /*!
@@ -28,48 +48,34 @@ inline bool select_parallel(std::size_t n, std::size_t threshold = parallel_thre
  * \return true if the evaluation should be done in paralle, false otherwise
  */
 inline bool select_parallel_2d(std::size_t n1, std::size_t t1, std::size_t n2, std::size_t t2) {
-    return threads > 1 && (local_context().parallel || (is_parallel && n1 >= t1 && n2 >= t2 && !local_context().serial));
+    return parallel_threads() > 1 && (local_context().parallel || (is_parallel && n1 >= t1 && n2 >= t2 && !local_context().serial));
 }
 
 /*!
- * \brief Dispatch the elements of a range to a functor in a parallel manner
- * \param pool The pool to use
- * \param p Boolean tag to indicate if parallel dispatching must be done
- * \param functor The functor to execute
- * \param T The number of threads to use
- * \param first The beginning of the range
- * \param last The end of the range
+ * \brief Returns the size of the chunks to split a range of the given size
+ * into for parallel evaluation
+ * \param n The size of the range
+ * \return The size of the chunks
  */
-template <typename Functor>
-inline void dispatch_1d(cpp::default_thread_pool<>& pool, bool p, Functor&& functor, size_t T, std::size_t first, std::size_t last) {
-    if (p) {
-        const auto n     = last - first;
-        const auto batch = n / T;
-
-        for (std::size_t t = 0; t < T - 1; ++t) {
-            pool.do_task(functor, first + t * batch, first + (t + 1) * batch);
-        }
-
-        functor(first + (T - 1) * batch, last);
-
-        pool.wait();
-    } else {
-        functor(first, last);
-    }
+inline std::size_t parallel_grain(std::size_t n) noexcept {
+    return std::max((n + parallel_chunks * parallel_threads() - 1) / (parallel_chunks * parallel_threads()), std::size_t(1));
 }
 
 /*!
  * \brief Dispatch the elements of a range to a functor in a parallel manner
- * \param pool The pool to use
+ *
+ * The range is split into chunks that are distributed dynamically to
+ * the threads of the global thread pool.
+ *
  * \param p Boolean tag to indicate if parallel dispatching must be done
  * \param functor The functor to execute
  * \param first The beginning of the range
  * \param last The end of the range
  */
 template <typename Functor>
-inline void dispatch_1d(cpp::default_thread_pool<>& pool, bool p, Functor&& functor, std::size_t first, std::size_t last) {
+inline void dispatch_1d(bool p, Functor&& functor, std::size_t first, std::size_t last) {
     if (p) {
-        dispatch_1d(pool, p, std::forward<Functor>(functor), pool.size(), first, last);
+        thread_pool::instance().parallel_for(first, last, parallel_grain(last - first), functor);
     } else {
         functor(first, last);
     }
@@ -83,29 +89,37 @@ inline void dispatch_1d(cpp::default_thread_pool<>& pool, bool p, Functor&& func
  * \param last The end of the range
  */
 template <typename Functor>
-inline void dispatch_1d(bool p, Functor&& functor, std::size_t first, std::size_t last) {
-    if (p) {
-        thread_local cpp::default_thread_pool<> pool(threads - 1);
-        dispatch_1d(pool, p, std::forward<Functor>(functor), first, last);
-    } else {
-        functor(first, last);
-    }
+inline void dispatch_1d_any(bool p, Functor&& functor, std::size_t first, std::size_t last) {
+    dispatch_1d(p, std::forward<Functor>(functor), first, last);
 }
 
 /*!
- * \brief Dispatch the elements of a range to a functor in a parallel manner
+ * \brief Returns the size of the chunks to split a range of the given size
+ * into so that each thread receives at most one chunk
+ * \param n The size of the range
+ * \return The size of the chunks
+ */
+inline std::size_t parallel_thread_grain(std::size_t n) noexcept {
+    return std::max((n + parallel_threads() - 1) / parallel_threads(), std::size_t(1));
+}
+
+/*!
+ * \brief Dispatch the elements of a range to a functor in a parallel manner,
+ * with at most one chunk per thread.
+ *
+ * This must be used instead of dispatch_1d_any for functors that allocate
+ * scratch memory on each call, so that the allocations are done once per
+ * thread and not once per chunk.
+ *
  * \param p Boolean tag to indicate if parallel dispatching must be done
  * \param functor The functor to execute
  * \param first The beginning of the range
  * \param last The end of the range
  */
 template <typename Functor>
-inline void dispatch_1d_any(bool p, Functor&& functor, std::size_t first, std::size_t last) {
+inline void dispatch_1d_threads(bool p, Functor&& functor, std::size_t first, std::size_t last) {
     if (p) {
-        auto n = last - first;
-        size_t T = std::min(n, threads);
-        thread_local cpp::default_thread_pool<> pool(threads);
-        dispatch_1d(pool, p, std::forward<Functor>(functor), T, first, last);
+        thread_pool::instance().parallel_for(first, last, parallel_thread_grain(last - first), functor);
     } else {
         functor(first, last);
     }
@@ -113,6 +127,10 @@ inline void dispatch_1d_any(bool p, Functor&& functor, std::size_t first, std::s
 
 /*!
  * \brief Dispatch the elements of a range to a functor in a parallel manner and use an accumulator functor to accumulate the results
+ *
+ * The accumulator functor is only called from the calling thread, once
+ * per chunk, in the order of the chunks.
+ *
  * \param p Boolean tag to indicate if parallel dispatching must be done
  * \param functor The functor to execute
  * \param acc_functor The functor to accumulate results
@@ -122,26 +140,22 @@ inline void dispatch_1d_any(bool p, Functor&& functor, std::size_t first, std::s
 template <typename T, typename Functor, typename AccFunctor>
 inline void dispatch_1d_acc(bool p, Functor&& functor, AccFunctor&& acc_functor, std::size_t first, std::size_t last) {
     if (p) {
-        std::vector<T> futures(threads - 1);
-        thread_local cpp::default_thread_pool<> pool(threads - 1);
-
-        auto n     = last - first;
-        auto batch = n / threads;
+        const auto grain = parallel_grain(last - first);
 
-        auto sub_functor = [&futures, &functor](std::size_t t, std::size_t first, std::size_t last) {
-            futures[t]   = functor(first, last);
-        };
-
-        for (std::size_t t = 0; t < threads - 1; ++t) {
-            pool.do_task(sub_functor, t, first + t * batch, first + (t + 1) * batch);
-        }
+        const auto chunks = (last - first + grain - 1) / grain;
 
-        acc_functor(functor(first + (threads - 1) * batch, last));
+        std::vector<T> results(chunks);
+        std::vector<char> done(chunks, 0);
 
-        pool.wait();
+        thread_pool::instance().parallel_for(first, last, grain, [&](std::size_t b, std::size_t e) {
+            results[(b - first) / grain] = functor(b, e);
+            done[(b - first) / grain]    = 1;
+        });
 
-        for (auto fut : futures) {
-            acc_functor(fut);
+        for (std::size_t c = 0; c < chunks; ++c) {
+            if (done[c]) {
+                acc_functor(results[c]);
+            }
         }
     } else {
         acc_functor(functor(first, last));
@@ -8,11 +8,20 @@
 /*!
  * \file
  * \brief Contains utilities for random generation
+ *
+ * The random expressions of the library are based on a counter-based
+ * generator (Philox4x32-10). Each expression draws a key when it is
+ * constructed and the value of each element only depends on this key and on
+ * the index of the element. This makes the random expressions thread safe
+ * and vectorizable and their results independent of the number of threads.
  */
 
 #pragma once
 
 #include <random>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 
 namespace etl {
 
@@ -21,4 +30,401 @@ namespace etl {
  */
 using random_engine = std::mt19937_64;
 
+/*!
+ * \brief The floating point type used to generate random values for
+ * elements of type T
+ */
+template <typename T>
+using random_real_t = std::conditional_t<std::is_same<T, float>::value, float, double>;
+
+namespace detail {
+
+/*!
+ * \brief Mix the bits of the given value (splitmix64 finalizer)
+ * \param x The value to mix
+ * \return the mixed value
+ */
+inline std::uint64_t splitmix64(std::uint64_t x) noexcept {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/*!
+ * \brief Returns the global counter from which the keys of the random
+ * expressions are derived.
+ */
+inline std::atomic<std::uint64_t>& random_key_counter() {
+    static std::atomic<std::uint64_t> counter(splitmix64(std::chrono::high_resolution_clock::now().time_since_epoch().count()));
+    return counter;
+}
+
+/*!
+ * \brief Returns a new key for a random expression
+ */
+inline std::uint64_t next_random_key() {
+    return splitmix64(random_key_counter().fetch_add(1));
+}
+
+constexpr std::uint32_t philox_m0 = 0xD2511F53; ///< The first multiplier of Philox
+constexpr std::uint32_t philox_m1 = 0xCD9E8D57; ///< The second multiplier of Philox
+constexpr std::uint32_t philox_w0 = 0x9E3779B9; ///< The first Weyl constant of Philox
+constexpr std::uint32_t philox_w1 = 0xBB67AE85; ///< The second Weyl constant of Philox
+
+/*!
+ * \brief Compute one block of the Philox4x32-10 generator.
+ *
+ * The counter is made of the block index and of the stream index.
+ *
+ * \param block The index of the block
+ * \param key The key
+ * \param stream The index of the stream
+ * \param out The output, four words
+ */
+inline void philox4x32(std::uint64_t block, std::uint64_t key, std::uint32_t stream, std::uint32_t* out) noexcept {
+    std::uint32_t c0 = std::uint32_t(block);
+    std::uint32_t c1 = std::uint32_t(block >> 32);
+    std::uint32_t c2 = stream;
+    std::uint32_t c3 = 0;
+
+    std::uint32_t k0 = std::uint32_t(key);
+    std::uint32_t k1 = std::uint32_t(key >> 32);
+
+    for (std::size_t r = 0; r < 10; ++r) {
+        const std::uint64_t p0 = std::uint64_t(philox_m0) * c0;
+        const std::uint64_t p1 = std::uint64_t(philox_m1) * c2;
+
+        c0 = std::uint32_t(p1 >> 32) ^ c1 ^ k0;
+        c1 = std::uint32_t(p1);
+        c2 = std::uint32_t(p0 >> 32) ^ c3 ^ k1;
+        c3 = std::uint32_t(p0);
+
+        k0 += philox_w0;
+        k1 += philox_w1;
+    }
+
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+#ifdef __SSE2__
+
+/*!
+ * \brief Compute the high and low words of the products of the 32 bits
+ * lanes of c with m
+ * \param m The multiplier, in each lane
+ * \param c The values to multiply
+ * \param lo The low words of the products
+ * \param hi The high words of the products
+ */
+inline void philox_mulhilo(__m128i m, __m128i c, __m128i& lo, __m128i& hi) noexcept {
+    const __m128i low_mask = _mm_set_epi32(0, -1, 0, -1);
+
+    const __m128i even = _mm_mul_epu32(c, m);
+    const __m128i odd  = _mm_mul_epu32(_mm_srli_epi64(c, 32), m);
+
+    lo = _mm_or_si128(_mm_and_si128(even, low_mask), _mm_slli_epi64(odd, 32));
+    hi = _mm_or_si128(_mm_srli_epi64(even, 32), _mm_andnot_si128(low_mask, odd));
+}
+
+#endif
+
+/*!
+ * \brief Compute four consecutive blocks of the Philox4x32-10 generator.
+ *
+ * With SSE2, the four blocks are computed at once, one per lane.
+ *
+ * \param block The index of the first block
+ * \param key The key
+ * \param stream The index of the stream
+ * \param out The output, sixteen words
+ */
+inline void philox4x32_4(std::uint64_t block, std::uint64_t key, std::uint32_t stream, std::uint32_t* out) noexcept {
+#ifdef __SSE2__
+    __m128i c0 = _mm_set_epi32(int(block + 3), int(block + 2), int(block + 1), int(block));
+    __m128i c1 = _mm_set_epi32(int((block + 3) >> 32), int((block + 2) >> 32), int((block + 1) >> 32), int(block >> 32));
+    __m128i c2 = _mm_set1_epi32(int(stream));
+    __m128i c3 = _mm_setzero_si128();
+
+    __m128i k0 = _mm_set1_epi32(int(key));
+    __m128i k1 = _mm_set1_epi32(int(key >> 32));
+
+    const __m128i m0 = _mm_set1_epi32(int(philox_m0));
+    const __m128i m1 = _mm_set1_epi32(int(philox_m1));
+    const __m128i w0 = _mm_set1_epi32(int(philox_w0));
+    const __m128i w1 = _mm_set1_epi32(int(philox_w1));
+
+    for (std::size_t r = 0; r < 10; ++r) {
+        __m128i lo0, hi0, lo1, hi1;
+
+        philox_mulhilo(m0, c0, lo0, hi0);
+        philox_mulhilo(m1, c2, lo1, hi1);
+
+        c0 = _mm_xor_si128(_mm_xor_si128(hi1, c1), k0);
+        c1 = lo1;
+        c2 = _mm_xor_si128(_mm_xor_si128(hi0, c3), k1);
+        c3 = lo0;
+
+        k0 = _mm_add_epi32(k0, w0);
+        k1 = _mm_add_epi32(k1, w1);
+    }
+
+    // Transpose to get the four words of each block together
+
+    __m128 r0 = _mm_castsi128_ps(c0);
+    __m128 r1 = _mm_castsi128_ps(c1);
+    __m128 r2 = _mm_castsi128_ps(c2);
+    __m128 r3 = _mm_castsi128_ps(c3);
+
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 0), _mm_castps_si128(r0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4), _mm_castps_si128(r1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_castps_si128(r2));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12), _mm_castps_si128(r3));
+#else
+    for (std::size_t b = 0; b < 4; ++b) {
+        philox4x32(block + b, key, stream, out + 4 * b);
+    }
+#endif
+}
+
+/*!
+ * \brief Conversion of random words to uniform values of type T
+ */
+template <typename T>
+struct random_words;
+
+/*!
+ * \brief Conversion of one random word to an uniform float in (0,1)
+ */
+template <>
+struct random_words<float> {
+    static constexpr std::size_t words = 1; ///< The number of words per value
+
+    /*!
+     * \brief Returns the uniform value for the given words
+     */
+    static float uniform(const std::uint32_t* w) noexcept {
+        return (float(w[0] >> 8) + 0.5f) * (1.0f / 16777216.0f);
+    }
+};
+
+/*!
+ * \brief Conversion of two random words to an uniform double in (0,1)
+ */
+template <>
+struct random_words<double> {
+    static constexpr std::size_t words = 2; ///< The number of words per value
+
+    /*!
+     * \brief Returns the uniform value for the given words
+     */
+    static double uniform(const std::uint32_t* w) noexcept {
+        return (double((static_cast<std::uint64_t>(w[0]) << 21) | (w[1] >> 11)) + 0.5) * (1.0 / 9007199254740992.0);
+    }
+};
+
+/*!
+ * \brief Compute the uniform values in (0,1) of the elements [first, first + n)
+ * of a stream
+ * \param key The key
+ * \param stream The index of the stream
+ * \param first The index of the first element
+ * \param n The number of elements
+ * \param out The output
+ */
+template <typename T>
+void random_uniform_fill(std::uint64_t key, std::uint32_t stream, std::size_t first, std::size_t n, T* out) noexcept {
+    constexpr std::size_t W = random_words<T>::words;
+    constexpr std::size_t E = 4 / W; // Elements per block
+
+    std::uint32_t words[16];
+
+    std::size_t e = first;
+    std::size_t k = 0;
+
+    while (k < n) {
+        const std::uint64_t block = e / E;
+
+        philox4x32_4(block, key, stream, words);
+
+        for (std::size_t j = e - block * E; j < 4 * E && k < n; ++j, ++k, ++e) {
+            out[k] = random_words<T>::uniform(words + j * W);
+        }
+    }
+}
+
+/*!
+ * \brief Compute normal values from uniform values with the Box-Muller
+ * transform, with the given vector implementation.
+ *
+ * The phase is shifted by pi/2 for the second element of each pair.
+ */
+template <typename V>
+struct box_muller {
+    /*!
+     * \brief Compute the normal values for vectors of uniform values and phases
+     */
+    template <typename T>
+    static ETL_STRONG_INLINE(typename V::template vec_type<T>) load(typename V::template vec_type<T> u, typename V::template vec_type<T> phase) {
+        return V::mul(V::sqrt(V::mul(V::set(T(-2.0)), V::log(u))), V::cos(phase));
+    }
+
+    /*!
+     * \brief Compute the normal value for a uniform value and a phase
+     *
+     * This uses the vector implementation so that the result is exactly the
+     * same as the one of the vectorized version.
+     */
+    template <typename T>
+    static T apply(T u, T phase) {
+        alignas(V::template traits<T>::alignment) T tmp[V::template traits<T>::size];
+        V::store(tmp, load<T>(V::set(u), V::set(phase)));
+        return tmp[0];
+    }
+};
+
+/*!
+ * \brief Scalar Box-Muller transform, when there is no vectorization
+ */
+template <>
+struct box_muller<no_vec> {
+    /*!
+     * \brief Compute the normal value for a uniform value and a phase
+     */
+    template <typename T>
+    static T apply(T u, T phase) {
+        return std::sqrt(T(-2.0) * std::log(u)) * std::cos(phase);
+    }
+};
+
+} //end of namespace detail
+
+/*!
+ * \brief Seed the random expressions.
+ *
+ * After this call, the random expressions are constructed with keys
+ * derived from the seed, in the order of their construction. This makes
+ * a program generating its random expressions in the same order
+ * reproducible.
+ *
+ * \param seed The seed
+ */
+inline void random_seed(std::uint64_t seed) {
+    detail::random_key_counter() = seed;
+}
+
+/*!
+ * \brief A counter-based random stream.
+ *
+ * The value of the element i only depends on the key of the stream and on
+ * i. Several sub-streams are available for a key.
+ *
+ * The normal values are generated with Box-Muller, the elements 2k and 2k+1
+ * share the two uniform values of the sub-stream 1.
+ */
+struct random_stream {
+    std::uint64_t key; ///< The key of the stream
+
+    /*!
+     * \brief Construct a new random stream with a new key
+     */
+    random_stream() : key(detail::next_random_key()) {}
+
+    /*!
+     * \brief Construct a new random stream with the given key
+     * \param key The key
+     */
+    explicit random_stream(std::uint64_t key) : key(key) {}
+
+    /*!
+     * \brief Returns the uniform value in (0,1) of the element i
+     * \param i The index of the element
+     * \param stream The sub-stream
+     */
+    template <typename T>
+    T uniform(std::size_t i, std::uint32_t stream = 0) const noexcept {
+        constexpr std::size_t W = detail::random_words<T>::words;
+        constexpr std::size_t E = 4 / W;
+
+        std::uint32_t words[4];
+        detail::philox4x32(i / E, key, stream, words);
+
+        return detail::random_words<T>::uniform(words + (i % E) * W);
+    }
+
+    /*!
+     * \brief Returns the normal value N(0,1) of the element i
+     * \param i The index of the element
+     */
+    template <typename T>
+    T normal(std::size_t i) const {
+        T u[2];
+        detail::random_uniform_fill(key, 1, i & ~std::size_t(1), 2, u);
+
+        return detail::box_muller<default_vec>::apply(u[0], phase(u[1], i));
+    }
+
+    /*!
+     * \brief Returns a vector of the uniform values in (0,1) of the
+     * elements starting at i
+     * \param i The index of the first element
+     * \tparam V The vector implementation
+     */
+    template <typename V, typename T>
+    ETL_STRONG_INLINE(typename V::template vec_type<T>) uniform_load(std::size_t i) const noexcept {
+        constexpr std::size_t S = V::template traits<T>::size;
+
+        alignas(V::template traits<T>::alignment) T u[S];
+        detail::random_uniform_fill(key, 0, i, S, u);
+
+        return V::load(u);
+    }
+
+    /*!
+     * \brief Returns a vector of the normal values N(0,1) of the elements
+     * starting at i
+     * \param i The index of the first element
+     * \tparam V The vector implementation
+     */
+    template <typename V, typename T>
+    ETL_STRONG_INLINE(typename V::template vec_type<T>) normal_load(std::size_t i) const {
+        constexpr std::size_t S = V::template traits<T>::size;
+
+        const std::size_t base = i & ~std::size_t(1);
+
+        T pairs[S + 2];
+        detail::random_uniform_fill(key, 1, base, ((i + S + 1) & ~std::size_t(1)) - base, pairs);
+
+        alignas(V::template traits<T>::alignment) T u[S];
+        alignas(V::template traits<T>::alignment) T p[S];
+
+        for (std::size_t j = 0; j < S; ++j) {
+            const std::size_t e = (i + j) & ~std::size_t(1);
+
+            u[j] = pairs[e - base];
+            p[j] = phase(pairs[e - base + 1], i + j);
+        }
+
+        return detail::box_muller<V>::template load<T>(V::load(u), V::load(p));
+    }
+
+private:
+    /*!
+     * \brief Returns the Box-Muller phase of the element i
+     */
+    template <typename T>
+    static T phase(T u, std::size_t i) noexcept {
+        constexpr T two_pi = T(6.283185307179586476925286766559);
+
+        // No multiply-add here, it could be contracted differently in the
+        // scalar and vector paths
+        return two_pi * (i & 1 ? u - T(0.25) : u);
+    }
+};
+
 } //end of namespace etl
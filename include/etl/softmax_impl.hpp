@@ -0,0 +1,25 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Enumeration of the softmax implementations
+ */
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief Enumeration describing the different implementations of softmax
+ */
+enum class softmax_impl {
+    STD, ///< Standard implementation
+    VEC, ///< Vectorized implementation
+};
+
+} //end of namespace etl
@@ -197,13 +197,680 @@ bool is_non_zero(T value) {
 } //end of namespace sparse_detail
 
 /*!
- * \brief Sparse matrix implementation
+ * \brief Sparse matrix implementation with compressed storage.
+ *
+ * With CSR storage, the non-zeros are stored row by row and sorted by
+ * column inside each row. With CSC storage, they are stored column by
+ * column and sorted by row inside each column. The position of an
+ * element is found with a binary search inside its row (column).
+ *
  * \tparam T The type of value
- * \tparam SS The storage type
+ * \tparam SS The storage type (CSR or CSC)
  * \tparam D The number of dimensions
  */
 template <typename T, sparse_storage SS, std::size_t D>
-struct sparse_matrix_impl;
+struct sparse_matrix_impl final : dyn_base<T, D> {
+    static_assert(SS == sparse_storage::CSR || SS == sparse_storage::CSC, "Invalid compressed sparse storage");
+
+    static constexpr std::size_t n_dimensions      = D;                              ///< The number of dimensions
+    static constexpr sparse_storage storage_format = SS;                             ///< The sparse storage scheme
+    static constexpr order storage_order           = order::RowMajor;                ///< The storage order
+    static constexpr std::size_t alignment         = intrinsic_traits<T>::alignment; ///< The alignment
+
+    using base_type              = dyn_base<T, D>;                                   ///< The base type
+    using this_type              = sparse_matrix_impl<T, SS, D>;                     ///< this type
+    using reference_type         = sparse_detail::sparse_reference<this_type>;       ///< The type of reference returned by the functions
+    using const_reference_type   = sparse_detail::sparse_reference<const this_type>; ///< The type of const reference returned by the functions
+    using value_type             = T;                                                ///< The type of value returned by the function
+    using dimension_storage_impl = std::array<std::size_t, n_dimensions>;            ///< The type used to store the dimensions
+    using memory_type            = value_type*;                                      ///< The memory type
+    using const_memory_type      = const value_type*;                                ///< The const memory type
+    using index_type             = std::size_t;                                      ///< The type used to store the indices
+    using index_memory_type      = index_type*;                                      ///< The memory type to the indices
+
+    friend struct sparse_detail::sparse_reference<this_type>;
+    friend struct sparse_detail::sparse_reference<const this_type>;
+
+    static_assert(n_dimensions == 2, "Only 2D sparse matrix are supported");
+
+private:
+    static constexpr bool row_compressed = SS == sparse_storage::CSR; ///< Indicates if the rows are compressed (CSR)
+
+    using base_type::_size;
+    using base_type::_dimensions;
+    memory_type _memory;            ///< The non-zero values
+    index_memory_type _inner_index; ///< The column (CSR) or row (CSC) of each non-zero
+    index_memory_type _outer_index; ///< The position of the first non-zero of each row (CSR) or column (CSC)
+    std::size_t nnz;                ///< The number of nonzeros in the matrix
+    std::size_t capacity;           ///< The number of non-zeros that fit in the allocated memory
+
+    using base_type::release;
+    using base_type::allocate;
+    using base_type::check_invariants;
+
+    template <typename TT, sparse_storage SSS>
+    friend struct sparse_builder;
+
+    /*!
+     * \brief Returns the number of compressed rows (CSR) or columns (CSC)
+     */
+    std::size_t outer_size() const noexcept {
+        return row_compressed ? _dimensions[0] : _dimensions[1];
+    }
+
+    /*!
+     * \brief Returns the compressed index of the element (i,j)
+     */
+    static std::size_t outer(std::size_t i, std::size_t j) noexcept {
+        return row_compressed ? i : j;
+    }
+
+    /*!
+     * \brief Returns the index of the element (i,j) inside its compressed row (column)
+     */
+    static std::size_t inner(std::size_t i, std::size_t j) noexcept {
+        return row_compressed ? j : i;
+    }
+
+    /*!
+     * \brief Allocate the outer index for the current dimensions, with no non-zeros
+     */
+    void init_outer_index() {
+        _outer_index = base_type::template allocate<index_type>(outer_size() + 1);
+        std::fill_n(_outer_index, outer_size() + 1, index_type(0));
+    }
+
+    /*!
+     * \brief Release all the memory of the matrix
+     */
+    void release_all() noexcept {
+        if (_memory) {
+            release(_memory, capacity);
+            release(_inner_index, capacity);
+        }
+
+        if (_outer_index) {
+            release(_outer_index, outer_size() + 1);
+        }
+    }
+
+    /*!
+     * \brief Build the content of the sparse matrix from an
+     * iterable collection
+     */
+    template <typename It>
+    void build_from_iterable(const It& iterable) {
+        init_outer_index();
+
+        nnz = 0;
+        capacity = 0;
+        _memory = nullptr;
+        _inner_index = nullptr;
+
+        //1. Count the non-zeros of each row (column)
+
+        auto it = iterable.begin();
+
+        for (std::size_t i = 0; i < rows(); ++i) {
+            for (std::size_t j = 0; j < columns(); ++j) {
+                if (sparse_detail::is_non_zero(*it)) {
+                    ++_outer_index[outer(i, j) + 1];
+                    ++nnz;
+                }
+
+                ++it;
+            }
+        }
+
+        if (nnz > 0) {
+            std::partial_sum(_outer_index, _outer_index + outer_size() + 1, _outer_index);
+
+            capacity     = nnz;
+            _memory      = allocate(capacity);
+            _inner_index = base_type::template allocate<index_type>(capacity);
+
+            //2. Fill the values, in order inside each row (column)
+
+            auto cursor = std::make_unique<index_type[]>(outer_size());
+            std::copy_n(_outer_index, outer_size(), cursor.get());
+
+            it = iterable.begin();
+
+            for (std::size_t i = 0; i < rows(); ++i) {
+                for (std::size_t j = 0; j < columns(); ++j) {
+                    if (sparse_detail::is_non_zero(*it)) {
+                        auto n = cursor[outer(i, j)]++;
+
+                        _memory[n]      = *it;
+                        _inner_index[n] = inner(i, j);
+                    }
+
+                    ++it;
+                }
+            }
+        }
+    }
+
+    /*!
+     * \brief Move the non-zeros to newly allocated arrays of the given
+     * capacity.
+     */
+    void grow(std::size_t new_capacity) {
+        auto new_memory      = allocate(new_capacity);
+        auto new_inner_index = base_type::template allocate<index_type>(new_capacity);
+
+        if (_memory) {
+            std::copy_n(_memory, nnz, new_memory);
+            std::copy_n(_inner_index, nnz, new_inner_index);
+
+            release(_memory, capacity);
+            release(_inner_index, capacity);
+        }
+
+        _memory      = new_memory;
+        _inner_index = new_inner_index;
+        capacity     = new_capacity;
+    }
+
+    /*!
+     * \brief Replace the content of the matrix by sorted and unique
+     * non-zeros given in compressed form.
+     * \param outer_index The position of the first non-zero of each row (column)
+     * \param it Iterator to the (inner index, value) pair of each non-zero
+     */
+    template <typename It>
+    void build_from_compressed(const index_type* outer_index, It it) {
+        const std::size_t new_nnz = outer_index[outer_size()];
+
+        nnz = 0;
+
+        if (new_nnz > capacity) {
+            grow(new_nnz);
+        }
+
+        std::copy_n(outer_index, outer_size() + 1, _outer_index);
+
+        for (std::size_t n = 0; n < new_nnz; ++n, ++it) {
+            _inner_index[n] = it->first;
+            _memory[n]      = it->second;
+        }
+
+        nnz = new_nnz;
+    }
+
+    /*!
+     * \brief Make room for a new element at position n of the outer
+     * row (column) o.
+     */
+    void reserve_hint(std::size_t o, std::size_t n) {
+        cpp_assert(n < nnz + 1, "Invalid hint for reserve_hint");
+
+        if (nnz == capacity) {
+            grow(std::max(2 * capacity, std::size_t(4)));
+        }
+
+        //Move the elements after the hint
+        std::copy_backward(_memory + n, _memory + nnz, _memory + nnz + 1);
+        std::copy_backward(_inner_index + n, _inner_index + nnz, _inner_index + nnz + 1);
+
+        for (std::size_t oo = o + 1; oo <= outer_size(); ++oo) {
+            ++_outer_index[oo];
+        }
+
+        ++nnz;
+    }
+
+    /*!
+     * \brief Erase the value in position n of the outer row (column) o
+     */
+    void erase_hint(std::size_t o, std::size_t n) {
+        cpp_assert(nnz > 0, "Invalid erase_hint call (no non-zero elements");
+
+        std::copy(_memory + n + 1, _memory + nnz, _memory + n);
+        std::copy(_inner_index + n + 1, _inner_index + nnz, _inner_index + n);
+
+        for (std::size_t oo = o + 1; oo <= outer_size(); ++oo) {
+            --_outer_index[oo];
+        }
+
+        --nnz;
+    }
+
+    /*!
+     * \brief Find the position of the value at (i,j). If the value
+     * is not present, returns its insertion point.
+     */
+    std::size_t find_n(std::size_t i, std::size_t j) const noexcept {
+        const auto o     = outer(i, j);
+        const auto first = _outer_index[o];
+        const auto last  = _outer_index[o + 1];
+
+        if (first == last) {
+            return first;
+        }
+
+        return std::lower_bound(_inner_index + first, _inner_index + last, inner(i, j)) - _inner_index;
+    }
+
+    /*!
+     * \brief Indicates if the position n is the position of the value at (i,j)
+     */
+    bool is_hint(std::size_t i, std::size_t j, std::size_t n) const noexcept {
+        return n < _outer_index[outer(i, j) + 1] && _inner_index[n] == inner(i, j);
+    }
+
+    /*!
+     * \brief Set the value at index (i,j) and position n
+     * \param value The new value to set
+     */
+    void unsafe_set_hint(std::size_t i, std::size_t j, std::size_t n, value_type value) {
+        //The value exists, modify it
+        if (is_hint(i, j, n)) {
+            _memory[n] = value;
+            return;
+        }
+
+        reserve_hint(outer(i, j), n);
+
+        _memory[n]      = value;
+        _inner_index[n] = inner(i, j);
+    }
+
+    /*!
+     * \brief Get the value at index (i,j) and position n
+     */
+    value_type get_hint(std::size_t i, std::size_t j, std::size_t n) const noexcept {
+        if (is_hint(i, j, n)) {
+            return _memory[n];
+        }
+
+        return 0.0;
+    }
+
+    /*!
+     * \brief Set the value at index (i,j) and position n.
+     */
+    void set_hint(std::size_t i, std::size_t j, std::size_t n, value_type value) {
+        if (is_hint(i, j, n)) {
+            //At this point, there is already a value for (i,j)
+            //If zero, we remove it, otherwise edit it
+            if (sparse_detail::is_non_zero(value)) {
+                _memory[n] = value;
+            } else {
+                erase_hint(outer(i, j), n);
+            }
+        } else if (sparse_detail::is_non_zero(value)) {
+            //At this point, the value does not exist
+            //We insert it if not zero
+            unsafe_set_hint(i, j, n, value);
+        }
+    }
+
+    /*!
+     * \brief Get a direct reference to the element at position n
+     */
+    value_type& unsafe_ref_hint(std::size_t n) {
+        return _memory[n];
+    }
+
+    /*!
+     * \brief Get a direct const reference to the element at position n
+     */
+    const value_type& unsafe_ref_hint(std::size_t n) const {
+        return _memory[n];
+    }
+
+public:
+    using base_type::dim;
+    using base_type::rows;
+    using base_type::columns;
+    using base_type::size;
+
+    // Construction
+
+    /*!
+     * \brief Constructs a new empty sparse matrix
+     */
+    sparse_matrix_impl() : base_type(), _memory(nullptr), _inner_index(nullptr), _outer_index(nullptr), nnz(0), capacity(0) {
+        init_outer_index();
+    }
+
+    /*!
+     * \brief Construct a new sparse matrix of the given dimensions,
+     * filled with zeroes
+     */
+    template <typename... S, cpp_enable_if(
+                                 (sizeof...(S) == D),
+                                 cpp::all_convertible_to<std::size_t, S...>::value,
+                                 cpp::is_homogeneous<typename cpp::first_type<S...>::type, S...>::value)>
+    explicit sparse_matrix_impl(S... sizes) : base_type(dyn_detail::size(sizes...), {{static_cast<std::size_t>(sizes)...}}),
+                                              _memory(nullptr),
+                                              _inner_index(nullptr),
+                                              _outer_index(nullptr),
+                                              nnz(0),
+                                              capacity(0) {
+        init_outer_index();
+    }
+
+    /*!
+     * \brief Construct a new sparse matrix of the given dimensions
+     * and use the initializer list to fill the matrix
+     */
+    template <typename... S, cpp_enable_if(dyn_detail::is_initializer_list_constructor<S...>::value)>
+    explicit sparse_matrix_impl(S... sizes) : base_type(dyn_detail::size(std::make_index_sequence<(sizeof...(S)-1)>(), sizes...),
+                                                        dyn_detail::sizes(std::make_index_sequence<(sizeof...(S)-1)>(), sizes...)) {
+        static_assert(sizeof...(S) == D + 1, "Invalid number of dimensions");
+
+        auto list = cpp::last_value(sizes...);
+        build_from_iterable(list);
+    }
+
+    /*!
+     * \brief Construct a new sparse matrix of the given dimensions
+     * and use the list of values list to fill the matrix
+     */
+    template <typename S1, typename... S, cpp_enable_if(
+                                              (sizeof...(S) == D),
+                                              cpp::is_specialization_of<values_t, typename cpp::last_type<S1, S...>::type>::value)>
+    explicit sparse_matrix_impl(S1 s1, S... sizes) : base_type(dyn_detail::size(std::make_index_sequence<(sizeof...(S))>(), s1, sizes...),
+                                                               dyn_detail::sizes(std::make_index_sequence<(sizeof...(S))>(), s1, sizes...)) {
+        auto list = cpp::last_value(sizes...).template list<value_type>();
+        build_from_iterable(list);
+    }
+
+    /*!
+     * \brief Copy construct a sparse matrix
+     * \param rhs The matrix to copy
+     */
+    sparse_matrix_impl(const sparse_matrix_impl& rhs) : base_type(rhs), _memory(nullptr), _inner_index(nullptr), _outer_index(nullptr), nnz(rhs.nnz), capacity(rhs.nnz) {
+        init_outer_index();
+        std::copy_n(rhs._outer_index, outer_size() + 1, _outer_index);
+
+        if (nnz) {
+            _memory      = allocate(capacity);
+            _inner_index = base_type::template allocate<index_type>(capacity);
+
+            std::copy_n(rhs._memory, nnz, _memory);
+            std::copy_n(rhs._inner_index, nnz, _inner_index);
+        }
+    }
+
+    /*!
+     * \brief Move construct a sparse matrix
+     * \param rhs The matrix to move
+     */
+    sparse_matrix_impl(sparse_matrix_impl&& rhs) noexcept : base_type(std::move(rhs)), _memory(rhs._memory), _inner_index(rhs._inner_index), _outer_index(rhs._outer_index), nnz(rhs.nnz), capacity(rhs.capacity) {
+        rhs._memory      = nullptr;
+        rhs._inner_index = nullptr;
+        rhs._outer_index = nullptr;
+        rhs.nnz          = 0;
+        rhs.capacity     = 0;
+    }
+
+    /*!
+     * \brief Copy assign a sparse matrix
+     * \param rhs The matrix to copy
+     * \return a reference to the assigned matrix
+     */
+    sparse_matrix_impl& operator=(const sparse_matrix_impl& rhs) {
+        if (this != &rhs) {
+            sparse_matrix_impl tmp(rhs);
+            *this = std::move(tmp);
+        }
+
+        return *this;
+    }
+
+    /*!
+     * \brief Move assign a sparse matrix
+     * \param rhs The matrix to move
+     * \return a reference to the assigned matrix
+     */
+    sparse_matrix_impl& operator=(sparse_matrix_impl&& rhs) noexcept {
+        if (this != &rhs) {
+            release_all();
+
+            _size        = rhs._size;
+            _dimensions  = rhs._dimensions;
+            _memory      = rhs._memory;
+            _inner_index = rhs._inner_index;
+            _outer_index = rhs._outer_index;
+            nnz          = rhs.nnz;
+            capacity     = rhs.capacity;
+
+            rhs._memory      = nullptr;
+            rhs._inner_index = nullptr;
+            rhs._outer_index = nullptr;
+            rhs.nnz          = 0;
+            rhs.capacity     = 0;
+        }
+
+        return *this;
+    }
+
+    /*!
+     * \brief Assign an ETL expression to the sparse matrix
+     */
+    template <typename E, cpp_enable_if(!std::is_same<std::decay_t<E>, sparse_matrix_impl<T, storage_format, D>>::value, std::is_convertible<value_t<E>, value_type>::value, is_etl_expr<E>::value)>
+    sparse_matrix_impl& operator=(E&& e) noexcept {
+        validate_assign(*this, e);
+
+        assign_evaluate(e, *this);
+
+        check_invariants();
+
+        return *this;
+    }
+
+    /*!
+     * \brief Returns the value at the given (i,j) position in the matrix.
+     *
+     * This function will never insert a new element in the matrix. It is
+     * suited when only reading the matrix and not neeeding references.
+     *
+     * \param i The row
+     * \param j The column
+     *
+     * \return The value at the (i,j) position.
+     */
+    value_type get(std::size_t i, std::size_t j) const noexcept(assert_nothrow) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+        return get_hint(i, j, n);
+    }
+
+    /*!
+     * \brief Returns a reference to the element at the position (i,j)
+     * \param i The first index
+     * \param j The second index
+     * \return a sparse reference (proxy reference) to the element at position (i,j)
+     */
+    reference_type operator()(std::size_t i, std::size_t j) noexcept(assert_nothrow) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        return {*this, i, j};
+    }
+
+    /*!
+     * \brief Returns a reference to the element at the position (i,j)
+     * \param i The first index
+     * \param j The second index
+     * \return a sparse reference (proxy reference) to the element at position (i,j)
+     */
+    const_reference_type operator()(std::size_t i, std::size_t j) const noexcept(assert_nothrow) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        return {*this, i, j};
+    }
+
+    /*!
+     * \brief Returns the element at the given index
+     * This function may result in insertion of deletion of elements
+     * in the matrix and therefore invalidation of some references.
+     * \param n The index
+     * \return a reference to the element at the given index.
+     */
+    reference_type operator[](std::size_t n) noexcept(assert_nothrow) {
+        cpp_assert(n < size(), "Out of bounds");
+
+        return {*this, n / columns(), n % columns()};
+    }
+
+    /*!
+     * \brief Returns the element at the given index
+     * This function may result in insertion of deletion of elements
+     * in the matrix and therefore invalidation of some references.
+     * \param n The index
+     * \return a reference to the element at the given index.
+     */
+    const_reference_type operator[](std::size_t n) const noexcept(assert_nothrow) {
+        cpp_assert(n < size(), "Out of bounds");
+
+        return {*this, n / columns(), n % columns()};
+    }
+
+    /*!
+     * \brief Returns the value at the given index
+     * This function never alters the state of the container.
+     * \param n The index
+     * \return the value at the given index.
+     */
+    value_type read_flat(std::size_t n) const noexcept {
+        return get(n / columns(), n % columns());
+    }
+
+    /*!
+     * \brief Returns Returns the number of non zeros entries in the sparse matrix.
+     *
+     * This is a constant time O(1) operation.
+     *
+     * \return The number of non zeros entries in the sparse matrix.
+     */
+    std::size_t non_zeros() const noexcept {
+        return nnz;
+    }
+
+    /*!
+     * \brief Reserve memory for at least the given number of non-zeros.
+     *
+     * Inserting up to this number of non-zeros will not reallocate the
+     * memory of the matrix.
+     *
+     * \param n The number of non-zeros to reserve memory for
+     */
+    void reserve(std::size_t n) {
+        if (n > capacity) {
+            grow(n);
+        }
+    }
+
+    /*!
+     * \brief Returns a pointer to the non-zero values, stored row by
+     * row (CSR) or column by column (CSC)
+     */
+    const_memory_type values() const noexcept {
+        return _memory;
+    }
+
+    /*!
+     * \brief Returns a pointer to the column (CSR) or row (CSC) index
+     * of each non-zero value
+     */
+    const index_type* inner_index() const noexcept {
+        return _inner_index;
+    }
+
+    /*!
+     * \brief Returns a pointer to the positions of the first non-zero
+     * of each row (CSR) or column (CSC). The array has one more
+     * element than the number of rows (columns), containing the number
+     * of non-zeros.
+     */
+    const index_type* outer_index() const noexcept {
+        return _outer_index;
+    }
+
+    /*!
+     * \brief Sets the element at the given position (i, j) to the given value
+     * \param i The first index
+     * \param j The second index
+     * \param value The new value
+     */
+    void set(std::size_t i, std::size_t j, value_type value) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+        set_hint(i, j, n, value);
+    }
+
+    /*!
+     * \brief Sets the element at the given position (i, j) to the given value
+     *
+     * This function will always set the element to the given value, even if it
+     * is zero (the normal behaviour would have been to erase it). This must be
+     * used when we need a pointer to the element in memory.
+     *
+     * \param i The first index
+     * \param j The second index
+     * \param value The new value
+     */
+    void unsafe_set(std::size_t i, std::size_t j, value_type value) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+
+        unsafe_set_hint(i, j, n, value);
+    }
+
+    /*!
+     * \brief Erases (sets to zero) the element at the given position (i, j)
+     * \param i The first index
+     * \param j The second index
+     */
+    void erase(std::size_t i, std::size_t j) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+
+        if (is_hint(i, j, n)) {
+            erase_hint(outer(i, j), n);
+        }
+    }
+
+    /*!
+     * \brief Test if this expression aliases with the given expression
+     * \param rhs The other expression to test
+     * \return true if the two expressions aliases, false otherwise
+     */
+    template <typename E, cpp_enable_if(is_sparse_matrix<E>::value)>
+    bool alias(const E& rhs) const noexcept {
+        return reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&rhs);
+    }
+
+    /*!
+     * \brief Test if this expression aliases with the given expression
+     * \param rhs The other expression to test
+     * \return true if the two expressions aliases, false otherwise
+     */
+    template <typename E, cpp_disable_if(is_sparse_matrix<E>::value)>
+    bool alias(const E& rhs) const noexcept {
+        return rhs.alias(*this);
+    }
+
+    /*!
+     * \brief Destructs the matrix and releases all its memory
+     */
+    ~sparse_matrix_impl() noexcept {
+        release_all();
+    }
+};
 
 /*!
  * \brief Sparse matrix implementation with COO storage type
@@ -240,18 +907,61 @@ private:
     index_memory_type _row_index; ///< The row index
     index_memory_type _col_index; ///< The column index
     std::size_t nnz;              ///< The number of nonzeros in the matrix
+    std::size_t capacity;         ///< The number of non-zeros that fit in the allocated memory
 
     using base_type::release;
     using base_type::allocate;
     using base_type::check_invariants;
 
+    template <typename TT, sparse_storage SSS>
+    friend struct sparse_builder;
+
+    /*!
+     * \brief Release all the memory of the matrix
+     */
+    void release_all() noexcept {
+        if (_memory) {
+            release(_memory, capacity);
+            release(_row_index, capacity);
+            release(_col_index, capacity);
+        }
+    }
+
+    /*!
+     * \brief Move the non-zeros to newly allocated arrays of the given
+     * capacity.
+     */
+    void grow(std::size_t new_capacity) {
+        auto new_memory    = allocate(new_capacity);
+        auto new_row_index = base_type::template allocate<index_type>(new_capacity);
+        auto new_col_index = base_type::template allocate<index_type>(new_capacity);
+
+        if (_memory) {
+            std::copy_n(_memory, nnz, new_memory);
+            std::copy_n(_row_index, nnz, new_row_index);
+            std::copy_n(_col_index, nnz, new_col_index);
+
+            release_all();
+        }
+
+        _memory    = new_memory;
+        _row_index = new_row_index;
+        _col_index = new_col_index;
+        capacity   = new_capacity;
+    }
+
     /*!
      * \brief Build the content of the sparse matrix from an
      * iterable collection
      */
     template <typename It>
     void build_from_iterable(const It& iterable) {
-        nnz = 0;
+        _memory    = nullptr;
+        _row_index = nullptr;
+        _col_index = nullptr;
+        nnz        = 0;
+        capacity   = 0;
+
         for (auto v : iterable) {
             if (sparse_detail::is_non_zero(v)) {
                 ++nnz;
@@ -260,9 +970,10 @@ private:
 
         if (nnz > 0) {
             //Allocate space for the three arrays
-            _memory    = allocate(nnz);
-            _row_index = base_type::template allocate<index_type>(nnz);
-            _col_index = base_type::template allocate<index_type>(nnz);
+            capacity   = nnz;
+            _memory    = allocate(capacity);
+            _row_index = base_type::template allocate<index_type>(capacity);
+            _col_index = base_type::template allocate<index_type>(capacity);
 
             auto it       = iterable.begin();
             std::size_t n = 0;
@@ -283,92 +994,63 @@ private:
     }
 
     /*!
-     * \brief Reserve enough space to put a value in position hint
+     * \brief Replace the content of the matrix by sorted and unique
+     * non-zeros given in compressed rows form.
+     * \param outer_index The position of the first non-zero of each row
+     * \param it Iterator to the (column, value) pair of each non-zero
      */
-    void reserve_hint(std::size_t hint) {
-        cpp_assert(hint < nnz + 1, "Invalid hint for reserve_hint");
+    template <typename It>
+    void build_from_compressed(const index_type* outer_index, It it) {
+        const std::size_t new_nnz = outer_index[rows()];
 
-        if (_memory) {
-            auto new_memory    = allocate(nnz + 1);
-            auto new_row_index = base_type::template allocate<index_type>(nnz + 1);
-            auto new_col_index = base_type::template allocate<index_type>(nnz + 1);
-
-            if (hint == nnz) {
-                //Copy the elements
-                std::copy_n(_memory, nnz, new_memory);
-                std::copy_n(_row_index, nnz, new_row_index);
-                std::copy_n(_col_index, nnz, new_col_index);
-            } else {
-                //Copy the elements before hint
-                std::copy(_memory, _memory + hint, new_memory);
-                std::copy(_row_index, _row_index + hint, new_row_index);
-                std::copy(_col_index, _col_index + hint, new_col_index);
-
-                //Copy the elements after hint
-                std::copy(_memory + hint, _memory + nnz, new_memory + hint + 1);
-                std::copy(_row_index + hint, _row_index + nnz, new_row_index + hint + 1);
-                std::copy(_col_index + hint, _col_index + nnz, new_col_index + hint + 1);
-            }
+        nnz = 0;
 
-            release(_memory, nnz);
-            release(_row_index, nnz);
-            release(_col_index, nnz);
+        if (new_nnz > capacity) {
+            grow(new_nnz);
+        }
 
-            _memory    = new_memory;
-            _col_index = new_col_index;
-            _row_index = new_row_index;
-        } else {
-            cpp_assert(hint == 0, "Invalid hint for reserve_hint");
+        for (std::size_t i = 0; i < rows(); ++i) {
+            std::fill(_row_index + outer_index[i], _row_index + outer_index[i + 1], i);
+        }
 
-            _memory    = allocate(nnz + 1);
-            _row_index = base_type::template allocate<index_type>(nnz + 1);
-            _col_index = base_type::template allocate<index_type>(nnz + 1);
+        for (std::size_t n = 0; n < new_nnz; ++n, ++it) {
+            _col_index[n] = it->first;
+            _memory[n]    = it->second;
         }
 
-        ++nnz;
+        nnz = new_nnz;
     }
 
     /*!
-     * \brief Erase the value in position n
+     * \brief Make room for a new element at position hint. The
+     * capacity grows geometrically, so that inserting the elements one
+     * by one is amortized.
      */
-    void erase_hint(std::size_t n) {
-        cpp_assert(nnz > 0, "Invalid erase_hint call (no non-zero elements");
+    void reserve_hint(std::size_t hint) {
+        cpp_assert(hint < nnz + 1, "Invalid hint for reserve_hint");
 
-        if (nnz == 1) {
-            release(_memory, nnz);
-            release(_row_index, nnz);
-            release(_col_index, nnz);
+        if (nnz == capacity) {
+            grow(std::max(2 * capacity, std::size_t(4)));
+        }
 
-            _memory    = nullptr;
-            _row_index = nullptr;
-            _col_index = nullptr;
-        } else {
-            auto new_memory    = allocate(nnz - 1);
-            auto new_row_index = base_type::template allocate<index_type>(nnz - 1);
-            auto new_col_index = base_type::template allocate<index_type>(nnz - 1);
-
-            if (n == nnz - 1) {
-                std::copy_n(_memory, nnz - 1, new_memory);
-                std::copy_n(_row_index, nnz - 1, new_row_index);
-                std::copy_n(_col_index, nnz - 1, new_col_index);
-            } else {
-                std::copy(_memory, _memory + n, new_memory);
-                std::copy(_row_index, _row_index + n, new_row_index);
-                std::copy(_col_index, _col_index + n, new_col_index);
+        //Move the elements after hint
+        std::copy_backward(_memory + hint, _memory + nnz, _memory + nnz + 1);
+        std::copy_backward(_row_index + hint, _row_index + nnz, _row_index + nnz + 1);
+        std::copy_backward(_col_index + hint, _col_index + nnz, _col_index + nnz + 1);
 
-                std::copy(_memory + n + 1, _memory + nnz, new_memory + n);
-                std::copy(_row_index + n + 1, _row_index + nnz, new_row_index + n);
-                std::copy(_col_index + n + 1, _col_index + nnz, new_col_index + n);
-            }
+        ++nnz;
+    }
 
-            release(_memory, nnz);
-            release(_row_index, nnz);
-            release(_col_index, nnz);
+    /*!
+     * \brief Erase the value in position n. The memory is kept for
+     * further insertions.
+     */
+    void erase_hint(std::size_t n) {
+        cpp_assert(nnz > 0, "Invalid erase_hint call (no non-zero elements");
 
-            _memory    = new_memory;
-            _row_index = new_row_index;
-            _col_index = new_col_index;
-        }
+        std::copy(_memory + n + 1, _memory + nnz, _memory + n);
+        std::copy(_row_index + n + 1, _row_index + nnz, _row_index + n);
+        std::copy(_col_index + n + 1, _col_index + nnz, _col_index + n);
 
         --nnz;
     }
@@ -379,19 +1061,28 @@ private:
      * already taken if its place of insertion is already taken.
      */
     std::size_t find_n(std::size_t i, std::size_t j) const noexcept {
-        for (std::size_t n = 0; n < nnz; ++n) {
-            //The value exists, modify it
-            if (_row_index[n] == i && _col_index[n] == j) {
-                return n;
-            }
+        //Fast path for insertion in order
+        if (!nnz || _row_index[nnz - 1] < i || (_row_index[nnz - 1] == i && _col_index[nnz - 1] < j)) {
+            return nnz;
+        }
+
+        //The elements are sorted by row and then by column
+        std::size_t first = 0;
+        std::size_t count = nnz;
 
-            //The insertion point has been found
-            if ((_row_index[n] == i && _col_index[n] > j) || _row_index[n] > i) {
-                return n;
+        while (count > 0) {
+            const std::size_t step = count / 2;
+            const std::size_t n    = first + step;
+
+            if (_row_index[n] < i || (_row_index[n] == i && _col_index[n] < j)) {
+                first = n + 1;
+                count -= step + 1;
+            } else {
+                count = step;
             }
         }
 
-        return nnz;
+        return first;
     }
 
     /*!
@@ -478,7 +1169,7 @@ public:
     /*!
      * \brief Constructs a new empty sparse matrix
      */
-    sparse_matrix_impl() noexcept : base_type(), _memory(nullptr), _row_index(nullptr), _col_index(nullptr), nnz(0) {
+    sparse_matrix_impl() noexcept : base_type(), _memory(nullptr), _row_index(nullptr), _col_index(nullptr), nnz(0), capacity(0) {
         //Nothing else to init
     }
 
@@ -494,7 +1185,8 @@ public:
                                                        _memory(nullptr),
                                                        _row_index(nullptr),
                                                        _col_index(nullptr),
-                                                       nnz(0) {
+                                                       nnz(0),
+                                                       capacity(0) {
         //Nothing else to init
     }
 
@@ -524,6 +1216,75 @@ public:
         build_from_iterable(list);
     }
 
+    /*!
+     * \brief Copy construct a sparse matrix
+     * \param rhs The matrix to copy
+     */
+    sparse_matrix_impl(const sparse_matrix_impl& rhs) : base_type(rhs), _memory(nullptr), _row_index(nullptr), _col_index(nullptr), nnz(rhs.nnz), capacity(rhs.nnz) {
+        if (nnz) {
+            _memory    = allocate(capacity);
+            _row_index = base_type::template allocate<index_type>(capacity);
+            _col_index = base_type::template allocate<index_type>(capacity);
+
+            std::copy_n(rhs._memory, nnz, _memory);
+            std::copy_n(rhs._row_index, nnz, _row_index);
+            std::copy_n(rhs._col_index, nnz, _col_index);
+        }
+    }
+
+    /*!
+     * \brief Move construct a sparse matrix
+     * \param rhs The matrix to move
+     */
+    sparse_matrix_impl(sparse_matrix_impl&& rhs) noexcept : base_type(std::move(rhs)), _memory(rhs._memory), _row_index(rhs._row_index), _col_index(rhs._col_index), nnz(rhs.nnz), capacity(rhs.capacity) {
+        rhs._memory    = nullptr;
+        rhs._row_index = nullptr;
+        rhs._col_index = nullptr;
+        rhs.nnz        = 0;
+        rhs.capacity   = 0;
+    }
+
+    /*!
+     * \brief Copy assign a sparse matrix
+     * \param rhs The matrix to copy
+     * \return a reference to the assigned matrix
+     */
+    sparse_matrix_impl& operator=(const sparse_matrix_impl& rhs) {
+        if (this != &rhs) {
+            sparse_matrix_impl tmp(rhs);
+            *this = std::move(tmp);
+        }
+
+        return *this;
+    }
+
+    /*!
+     * \brief Move assign a sparse matrix
+     * \param rhs The matrix to move
+     * \return a reference to the assigned matrix
+     */
+    sparse_matrix_impl& operator=(sparse_matrix_impl&& rhs) noexcept {
+        if (this != &rhs) {
+            release_all();
+
+            _size       = rhs._size;
+            _dimensions = rhs._dimensions;
+            _memory     = rhs._memory;
+            _row_index  = rhs._row_index;
+            _col_index  = rhs._col_index;
+            nnz         = rhs.nnz;
+            capacity    = rhs.capacity;
+
+            rhs._memory    = nullptr;
+            rhs._row_index = nullptr;
+            rhs._col_index = nullptr;
+            rhs.nnz        = 0;
+            rhs.capacity   = 0;
+        }
+
+        return *this;
+    }
+
     /*!
      * \brief Assign an ETL expression to the sparse matrix
      */
@@ -631,6 +1392,20 @@ public:
         return nnz;
     }
 
+    /*!
+     * \brief Reserve memory for at least the given number of non-zeros.
+     *
+     * Inserting up to this number of non-zeros will not reallocate the
+     * memory of the matrix.
+     *
+     * \param n The number of non-zeros to reserve memory for
+     */
+    void reserve(std::size_t n) {
+        if (n > capacity) {
+            grow(n);
+        }
+    }
+
     /*!
      * \brief Sets the element at the given position (i, j) to the given value
      * \param i The first index
@@ -705,11 +1480,172 @@ public:
      * \brief Destructs the matrix and releases all its memory
      */
     ~sparse_matrix_impl() noexcept {
-        if (_memory) {
-            release(_memory, nnz);
-            release(_row_index, nnz);
-            release(_col_index, nnz);
+        release_all();
+    }
+};
+
+/*!
+ * \brief Builder to fill a sparse matrix with many elements at once.
+ *
+ * The elements are given as (i, j, value) triplets, in any order. When
+ * the matrix is built, the triplets are bucketed by row (column for CSC),
+ * sorted inside each bucket, duplicates are summed and zeros are dropped.
+ * This is linear in the number of triplets (except for the sort inside
+ * each row), compared to the element-by-element insertion that has to
+ * keep the storage sorted at each step.
+ *
+ * \tparam T The type of value
+ * \tparam SS The storage type of the built matrix
+ */
+template <typename T, sparse_storage SS>
+struct sparse_builder {
+    using value_type  = T;                                ///< The type of value
+    using matrix_type = sparse_matrix_impl<T, SS, 2>;     ///< The type of the built matrix
+    using index_type  = typename matrix_type::index_type; ///< The type used to store the indices
+
+private:
+    static constexpr bool column_compressed = SS == sparse_storage::CSC; ///< Indicates if the elements are bucketed by column
+
+    std::size_t _rows;               ///< The number of rows of the matrix
+    std::size_t _columns;            ///< The number of columns of the matrix
+    std::vector<index_type> _i;      ///< The row of each triplet
+    std::vector<index_type> _j;      ///< The column of each triplet
+    std::vector<value_type> _values; ///< The value of each triplet
+
+public:
+    /*!
+     * \brief Construct a new builder for a matrix of the given dimensions
+     * \param rows The number of rows of the matrix
+     * \param columns The number of columns of the matrix
+     */
+    sparse_builder(std::size_t rows, std::size_t columns) : _rows(rows), _columns(columns) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Reserve memory for the given number of triplets
+     * \param n The number of triplets to reserve memory for
+     */
+    void reserve(std::size_t n) {
+        _i.reserve(n);
+        _j.reserve(n);
+        _values.reserve(n);
+    }
+
+    /*!
+     * \brief Add a new element to the builder. If several elements are
+     * added at the same position, their values are summed.
+     * \param i The row of the element
+     * \param j The column of the element
+     * \param value The value of the element
+     */
+    void add(std::size_t i, std::size_t j, value_type value) {
+        cpp_assert(i < _rows, "Out of bounds");
+        cpp_assert(j < _columns, "Out of bounds");
+
+        _i.push_back(i);
+        _j.push_back(j);
+        _values.push_back(value);
+    }
+
+    /*!
+     * \brief Returns the number of triplets added to the builder
+     */
+    std::size_t size() const noexcept {
+        return _values.size();
+    }
+
+    /*!
+     * \brief Remove all the triplets from the builder
+     */
+    void clear() noexcept {
+        _i.clear();
+        _j.clear();
+        _values.clear();
+    }
+
+    /*!
+     * \brief Replace the content of the given matrix by the triplets of
+     * the builder. The dimensions of the matrix must match the
+     * dimensions of the builder.
+     * \param matrix The matrix to fill
+     */
+    void build(matrix_type& matrix) const {
+        cpp_assert(matrix.rows() == _rows && matrix.columns() == _columns, "Invalid dimensions for sparse_builder::build");
+
+        const std::size_t outer_size = column_compressed ? _columns : _rows;
+        const std::size_t n          = size();
+
+        const auto& outer = column_compressed ? _j : _i;
+        const auto& inner = column_compressed ? _i : _j;
+
+        //1. Bucket the triplets by outer index
+
+        std::vector<index_type> outer_index(outer_size + 1, 0);
+
+        for (std::size_t k = 0; k < n; ++k) {
+            ++outer_index[outer[k] + 1];
+        }
+
+        std::partial_sum(outer_index.begin(), outer_index.end(), outer_index.begin());
+
+        std::vector<std::pair<index_type, value_type>> entries(n);
+
+        {
+            std::vector<index_type> cursor(outer_index.begin(), outer_index.end() - 1);
+
+            for (std::size_t k = 0; k < n; ++k) {
+                entries[cursor[outer[k]]++] = std::make_pair(inner[k], _values[k]);
+            }
+        }
+
+        //2. Sort each bucket, merge the duplicates and drop the zeros
+
+        auto by_inner = [](const std::pair<index_type, value_type>& lhs, const std::pair<index_type, value_type>& rhs) {
+            return lhs.first < rhs.first;
+        };
+
+        std::size_t nnz = 0;
+
+        for (std::size_t o = 0; o < outer_size; ++o) {
+            auto first = entries.begin() + outer_index[o];
+            auto last  = entries.begin() + outer_index[o + 1];
+
+            if (!std::is_sorted(first, last, by_inner)) {
+                std::sort(first, last, by_inner);
+            }
+
+            outer_index[o] = nnz;
+
+            //The entries are compacted in place, nnz never goes past first
+
+            while (first != last) {
+                auto index = first->first;
+                auto value = first->second;
+
+                while (++first != last && first->first == index) {
+                    value += first->second;
+                }
+
+                if (sparse_detail::is_non_zero(value)) {
+                    entries[nnz++] = std::make_pair(index, value);
+                }
+            }
         }
+
+        outer_index[outer_size] = nnz;
+
+        matrix.build_from_compressed(outer_index.data(), entries.begin());
+    }
+
+    /*!
+     * \brief Build a new matrix from the triplets of the builder
+     * \return the built sparse matrix
+     */
+    matrix_type build() const {
+        matrix_type matrix(_rows, _columns);
+        build(matrix);
+        return matrix;
     }
 };
 
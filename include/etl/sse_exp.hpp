@@ -36,12 +36,14 @@
 
 #pragma once
 
-#ifdef __SSE3__
+#if defined(__SSE3__) || defined(ETL_TARGET_SSE3)
 
 #include <immintrin.h>
 #include <xmmintrin.h>
 #include <emmintrin.h>
 
+#include <limits>
+
 #define ETL_INLINE_VEC_128 ETL_STATIC_INLINE(__m128)
 #define ETL_INLINE_VEC_128D ETL_STATIC_INLINE(__m128d)
 
@@ -58,6 +60,49 @@ namespace etl {
 #define PS_CONST_TYPE(Name, Type, Val) \
     static const ALIGN16_BEG Type _ps_##Name[4] ALIGN16_END = {Val, Val, Val, Val}
 
+/*!
+ * \brief Compute a * b + c, fused if possible
+ */
+ETL_INLINE_VEC_128D madd_pd(__m128d a, __m128d b, __m128d c) {
+#ifdef __FMA__
+    return _mm_fmadd_pd(a, b, c);
+#else
+    return _mm_add_pd(_mm_mul_pd(a, b), c);
+#endif
+}
+
+/*!
+ * \brief Select the elements of a where the mask is set and the
+ * elements of b elsewhere
+ */
+ETL_INLINE_VEC_128D blend_pd(__m128d mask, __m128d a, __m128d b) {
+    return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+}
+
+/*!
+ * \brief Select the elements of a where the mask is set and the
+ * elements of b elsewhere
+ */
+ETL_INLINE_VEC_128 blend_ps(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/*!
+ * \brief Compute 2^n for integral values of n in [-1023, 1024]
+ */
+ETL_INLINE_VEC_128D pow2n_pd(__m128d n) {
+    auto a = _mm_add_pd(n, _mm_set1_pd(1023.0 + 4503599627370496.0));
+    return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(a), 52));
+}
+
+/*!
+ * \brief Round each element to the nearest integer (|x| < 2^51)
+ */
+ETL_INLINE_VEC_128D round_pd(__m128d x) {
+    auto magic = _mm_set1_pd(6755399441055744.0);
+    return _mm_sub_pd(_mm_add_pd(x, magic), magic);
+}
+
 PS_CONST(1, 1.0f);
 PS_CONST(0p5, 0.5f);
 
@@ -88,13 +133,21 @@ PS_CONST(cephes_log_p8, +3.3333331174E-1);
 PS_CONST(cephes_log_q1, -2.12194440e-4);
 PS_CONST(cephes_log_q2, 0.693359375);
 
+/*!
+ * \brief Compute the natural logarithm of each element
+ *
+ * This is the log function of Cephes. Denormals are supported, log(0) is
+ * -inf, log(inf) is inf and negative or NaN arguments give NaN.
+ */
 ETL_INLINE_VEC_128 log_ps(__m128 x) {
     __m128i emm0;
-    __m128 one = *(__m128*)_ps_1;
-
-    __m128 invalid_mask = _mm_cmple_ps(x, _mm_setzero_ps());
+    __m128 one  = *(__m128*)_ps_1;
+    __m128 zero = _mm_setzero_ps();
+    __m128 x0   = x;
 
-    x = _mm_max_ps(x, *(__m128*)_ps_min_norm_pos); /* cut off denormalized stuff */
+    /* scale the denormals into the normal range */
+    __m128 denormal = _mm_cmplt_ps(x, *(__m128*)_ps_min_norm_pos);
+    x               = blend_ps(denormal, _mm_mul_ps(x, _mm_set1_ps(33554432.0f)), x);
 
     emm0 = _mm_srli_epi32(_mm_castps_si128(x), 23);
 
@@ -106,6 +159,7 @@ ETL_INLINE_VEC_128 log_ps(__m128 x) {
     __m128 e = _mm_cvtepi32_ps(emm0);
 
     e = _mm_add_ps(e, one);
+    e = _mm_sub_ps(e, _mm_and_ps(denormal, _mm_set1_ps(25.0f)));
 
     __m128 mask = _mm_cmplt_ps(x, *(__m128*)_ps_cephes_SQRTHF);
     __m128 tmp  = _mm_and_ps(x, mask);
@@ -145,12 +199,74 @@ ETL_INLINE_VEC_128 log_ps(__m128 x) {
     tmp = _mm_mul_ps(e, *(__m128*)_ps_cephes_log_q2);
     x   = _mm_add_ps(x, y);
     x   = _mm_add_ps(x, tmp);
-    x   = _mm_or_ps(x, invalid_mask); // negative arg will be NAN
-    return x;
+
+    /* special values */
+    __m128 inf = _mm_set1_ps(std::numeric_limits<float>::infinity());
+    x          = blend_ps(_mm_cmpeq_ps(x0, zero), _mm_sub_ps(zero, inf), x);
+    x          = blend_ps(_mm_cmpeq_ps(x0, inf), inf, x);
+    return _mm_or_ps(x, _mm_cmpnge_ps(x0, zero)); // negative or NaN arg will be NaN
+}
+
+/*!
+ * \brief Compute the natural logarithm of each element
+ *
+ * The argument is decomposed into m * 2^e with m in [sqrt(0.5), sqrt(2))
+ * and log(m) is computed with the rational approximation of Cephes. The
+ * maximum error is about 1 ulp. Denormals are supported, log(0) is -inf
+ * and negative arguments give NaN.
+ */
+ETL_INLINE_VEC_128D log_pd(__m128d x) {
+    auto one   = _mm_set1_pd(1.0);
+    auto zero  = _mm_setzero_pd();
+    auto magic = _mm_set1_pd(4503599627370496.0);
+
+    /* scale the denormals into the normal range */
+    auto denormal = _mm_cmplt_pd(x, _mm_set1_pd(2.2250738585072014e-308));
+    auto v        = blend_pd(denormal, _mm_mul_pd(x, _mm_set1_pd(18014398509481984.0)), x);
+    auto bias     = blend_pd(denormal, _mm_set1_pd(1022.0 + 54.0), _mm_set1_pd(1022.0));
+
+    /* extract the exponent and the mantissa in [0.5, 1) */
+    auto e_bits = _mm_srli_epi64(_mm_castpd_si128(v), 52);
+    auto e      = _mm_sub_pd(_mm_sub_pd(_mm_or_pd(_mm_castsi128_pd(e_bits), magic), magic), bias);
+
+    auto m = _mm_and_pd(v, _mm_castsi128_pd(_mm_set1_epi64x(0x000FFFFFFFFFFFFFLL)));
+    m      = _mm_or_pd(m, _mm_set1_pd(0.5));
+
+    /* m in [sqrt(0.5), sqrt(2)) */
+    auto small = _mm_cmplt_pd(m, _mm_set1_pd(0.70710678118654752440));
+    e          = _mm_sub_pd(e, _mm_and_pd(small, one));
+    m          = _mm_sub_pd(_mm_add_pd(m, _mm_and_pd(small, m)), one);
+
+    auto z = _mm_mul_pd(m, m);
+
+    auto p = _mm_set1_pd(1.01875663804580931796E-4);
+    p      = madd_pd(p, m, _mm_set1_pd(4.97494994976747001425E-1));
+    p      = madd_pd(p, m, _mm_set1_pd(4.70579119878881725854E0));
+    p      = madd_pd(p, m, _mm_set1_pd(1.44989225341610930846E1));
+    p      = madd_pd(p, m, _mm_set1_pd(1.79368678507819816313E1));
+    p      = madd_pd(p, m, _mm_set1_pd(7.70838733755885391666E0));
+
+    auto q = _mm_add_pd(m, _mm_set1_pd(1.12873587189167450590E1));
+    q      = madd_pd(q, m, _mm_set1_pd(4.52279145837532221105E1));
+    q      = madd_pd(q, m, _mm_set1_pd(8.29875266912776603211E1));
+    q      = madd_pd(q, m, _mm_set1_pd(7.11544750618563894466E1));
+    q      = madd_pd(q, m, _mm_set1_pd(2.31251620126765340583E1));
+
+    auto y = _mm_mul_pd(m, _mm_div_pd(_mm_mul_pd(z, p), q));
+    y      = madd_pd(e, _mm_set1_pd(-2.121944400546905827679e-4), y);
+    y      = madd_pd(z, _mm_set1_pd(-0.5), y);
+    y      = _mm_add_pd(m, y);
+    y      = madd_pd(e, _mm_set1_pd(0.693359375), y);
+
+    /* special values */
+    auto inf = _mm_set1_pd(std::numeric_limits<double>::infinity());
+    y        = blend_pd(_mm_cmpeq_pd(x, zero), _mm_sub_pd(zero, inf), y);
+    y        = blend_pd(_mm_cmpeq_pd(x, inf), inf, y);
+    return _mm_or_pd(y, _mm_cmpnge_pd(x, zero)); // negative or NaN arg will be NaN
 }
 
-PS_CONST(exp_hi, 88.3762626647949f);
-PS_CONST(exp_lo, -88.3762626647949f);
+PS_CONST(exp_hi, 89.0f);
+PS_CONST(exp_lo, -104.0f);
 
 PS_CONST(cephes_LOG2EF, 1.44269504088896341);
 PS_CONST(cephes_exp_C1, 0.693359375);
@@ -163,103 +279,65 @@ PS_CONST(cephes_exp_p3, 4.1665795894E-2);
 PS_CONST(cephes_exp_p4, 1.6666665459E-1);
 PS_CONST(cephes_exp_p5, 5.0000001201E-1);
 
+/*!
+ * \brief Compute the exponential of each element
+ *
+ * The argument is reduced to r in [-ln(2)/2, ln(2)/2] and e^r is computed
+ * with its Taylor series. The maximum error is about 1.5 ulp. Overflow
+ * gives +inf and the denormal results are correctly computed.
+ */
 ETL_INLINE_VEC_128D exp_pd(__m128d x) {
-    const __m128i offset = _mm_setr_epi32(1023, 1023, 0, 0);
-
-    __m128i k1;
-    __m128d p1;
-    __m128d a1;
-    __m128d x1;
+    // The NaN inputs are propagated by min/max when passed last
+    x = _mm_min_pd(_mm_set1_pd(710.0), x);
+    x = _mm_max_pd(_mm_set1_pd(-746.0), x);
 
-    auto xmm0 = _mm_set1_pd(7.09782712893383996843e2);
-    auto xmm1 = _mm_set1_pd(-7.08396418532264106224e2);
-
-    x1 = _mm_min_pd(x, xmm0);
-    x1 = _mm_max_pd(x1, xmm1);
-
-    /* a = x / log2; */
-    xmm0 = _mm_set1_pd(1.4426950408889634073599);
-    xmm1 = _mm_setzero_pd();
-    a1 = _mm_mul_pd(x1, xmm0);
-
-    /* k = (int)floor(a); p = (float)k; */
-    p1 = _mm_cmplt_pd(a1, xmm1);
-    xmm0 = _mm_set1_pd(1.0);
-    p1 = _mm_and_pd(p1, xmm0);
-    a1 = _mm_sub_pd(a1, p1);
-    k1 = _mm_cvttpd_epi32(a1);
-    p1 = _mm_cvtepi32_pd(k1);
-
-    /* x -= p * log2; */
-    xmm0 = _mm_set1_pd(6.93145751953125E-1);
-    xmm1 = _mm_set1_pd(1.42860682030941723212E-6);
+    /* express exp(x) as exp(r + k * log(2)) */
+    auto k = round_pd(_mm_mul_pd(x, _mm_set1_pd(1.44269504088896340736)));
 
 #ifdef __FMA__
-    x1 = _mm_fnmadd_pd(p1, xmm0, x1);
-    x1 = _mm_fnmadd_pd(p1, xmm1, x1);
+    auto r = _mm_fnmadd_pd(k, _mm_set1_pd(6.93145751953125E-1), x);
+    r      = _mm_fnmadd_pd(k, _mm_set1_pd(1.42860682030941723212E-6), r);
 #else
-    a1 = _mm_mul_pd(p1, xmm0);
-    x1 = _mm_sub_pd(x1, a1);
-    a1 = _mm_mul_pd(p1, xmm1);
-    x1 = _mm_sub_pd(x1, a1);
+    auto r = _mm_sub_pd(x, _mm_mul_pd(k, _mm_set1_pd(6.93145751953125E-1)));
+    r      = _mm_sub_pd(r, _mm_mul_pd(k, _mm_set1_pd(1.42860682030941723212E-6)));
 #endif
 
-    /* Compute e^x using a polynomial approximation. */
-    xmm0 = _mm_set1_pd(1.185268231308989403584147407056378360798378534739e-2);
-    xmm1 = _mm_set1_pd(3.87412011356070379615759057344100690905653320886699e-2);
-
-#ifdef __FMA__
-    a1 = _mm_fmadd_pd(x1, xmm0, xmm1);
-#else
-    a1 = _mm_mul_pd(x1, xmm0);
-    a1 = _mm_add_pd(a1, xmm1);
-#endif
-
-    xmm0 = _mm_set1_pd(0.16775408658617866431779970932853611481292418818223);
-    xmm1 = _mm_set1_pd(0.49981934577169208735732248650232562589934399402426);
-
-#ifdef __FMA__
-    a1 = _mm_fmadd_pd(a1, x1, xmm0);
-    a1 = _mm_fmadd_pd(a1, x1, xmm1);
-#else
-    a1 = _mm_mul_pd(a1, x1);
-    a1 = _mm_add_pd(a1, xmm0);
-    a1 = _mm_mul_pd(a1, x1);
-    a1 = _mm_add_pd(a1, xmm1);
-#endif
-
-    xmm0 = _mm_set1_pd(1.00001092396453942157124178508842412412025643386873);
-    xmm1 = _mm_set1_pd(0.99999989311082729779536722205742989232069120354073);
-
-#ifdef __FMA__
-    a1 = _mm_fmadd_pd(a1, x1, xmm0);
-    a1 = _mm_fmadd_pd(a1, x1, xmm1);
-#else
-    a1 = _mm_mul_pd(a1, x1);
-    a1 = _mm_add_pd(a1, xmm0);
-    a1 = _mm_mul_pd(a1, x1);
-    a1 = _mm_add_pd(a1, xmm1);
-#endif
-
-    /* p = 2^k; */
-    k1 = _mm_add_epi32(k1, offset);
-    k1 = _mm_slli_epi32(k1, 20);
-    k1 = _mm_shuffle_epi32(k1, _MM_SHUFFLE(1,3,0,2));
-    p1 = _mm_castsi128_pd(k1);
-
-    /* a *= 2^k. */
-    a1 = _mm_mul_pd(a1, p1);
-
-    return a1;
+    auto y = _mm_set1_pd(1.0 / 6227020800.0);
+    y      = madd_pd(y, r, _mm_set1_pd(1.0 / 479001600.0));
+    y      = madd_pd(y, r, _mm_set1_pd(1.0 / 39916800.0));
+    y      = madd_pd(y, r, _mm_set1_pd(1.0 / 3628800.0));
+    y      = madd_pd(y, r, _mm_set1_pd(1.0 / 362880.0));
+    y      = madd_pd(y, r, _mm_set1_pd(1.0 / 40320.0));
+    y      = madd_pd(y, r, _mm_set1_pd(1.0 / 5040.0));
+    y      = madd_pd(y, r, _mm_set1_pd(1.0 / 720.0));
+    y      = madd_pd(y, r, _mm_set1_pd(1.0 / 120.0));
+    y      = madd_pd(y, r, _mm_set1_pd(1.0 / 24.0));
+    y      = madd_pd(y, r, _mm_set1_pd(1.0 / 6.0));
+    y      = madd_pd(y, r, _mm_set1_pd(0.5));
+    y      = madd_pd(y, r, _mm_set1_pd(1.0));
+    y      = madd_pd(y, r, _mm_set1_pd(1.0));
+
+    /* 2^k is applied in two steps to support overflow and denormals */
+    auto k1 = round_pd(_mm_mul_pd(k, _mm_set1_pd(0.5)));
+    auto k2 = _mm_sub_pd(k, k1);
+
+    return _mm_mul_pd(_mm_mul_pd(y, pow2n_pd(k1)), pow2n_pd(k2));
 }
 
+/*!
+ * \brief Compute the exponential of each element
+ *
+ * This is the exp function of Cephes. Overflow gives +inf, the denormal
+ * results are correctly computed and NaN arguments give NaN.
+ */
 ETL_INLINE_VEC_128 exp_ps(__m128 x) {
     __m128 tmp, fx;
     __m128i emm0;
     __m128 one = *(__m128*)_ps_1;
 
-    x = _mm_min_ps(x, *(__m128*)_ps_exp_hi);
-    x = _mm_max_ps(x, *(__m128*)_ps_exp_lo);
+    // The NaN inputs are propagated by min/max when passed last
+    x = _mm_min_ps(*(__m128*)_ps_exp_hi, x);
+    x = _mm_max_ps(*(__m128*)_ps_exp_lo, x);
 
     /* express exp(x) as exp(g + n*log(2)) */
     fx = _mm_mul_ps(x, *(__m128*)_ps_cephes_LOG2EF);
@@ -295,13 +373,13 @@ ETL_INLINE_VEC_128 exp_ps(__m128 x) {
     y        = _mm_add_ps(y, x);
     y        = _mm_add_ps(y, one);
 
-    /* build 2^n */
-    emm0         = _mm_cvttps_epi32(fx);
-    emm0         = _mm_add_epi32(emm0, *(__m128i*)_pi32_0x7f);
-    emm0         = _mm_slli_epi32(emm0, 23);
-    __m128 pow2n = _mm_castsi128_ps(emm0);
-    y            = _mm_mul_ps(y, pow2n);
-    return y;
+    /* build 2^n, applied in two steps to support overflow and denormals */
+    emm0          = _mm_cvttps_epi32(fx);
+    __m128i emm1  = _mm_srai_epi32(emm0, 1);
+    emm0          = _mm_sub_epi32(emm0, emm1);
+    __m128 pow2n1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(emm1, *(__m128i*)_pi32_0x7f), 23));
+    __m128 pow2n2 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(emm0, *(__m128i*)_pi32_0x7f), 23));
+    return _mm_mul_ps(_mm_mul_ps(y, pow2n1), pow2n2);
 }
 
 PS_CONST(minus_cephes_DP1, -0.78515625);
@@ -467,6 +545,96 @@ ETL_INLINE_VEC_128 cos_ps(__m128 x) { // any x
     return y;
 }
 
+/*!
+ * \brief Compute the sine or the cosine of the argument reduced in
+ * [-Pi/4, Pi/4] from |x| and its octant y
+ * \param x The absolute value of the argument
+ * \param y The (even) octant of the argument
+ * \param cos_mask The mask of the elements using the cosine polynom
+ */
+ETL_INLINE_VEC_128D sincos_reduced_pd(__m128d x, __m128d y, __m128d cos_mask) {
+    /* Extended precision modular arithmetic */
+    x = madd_pd(y, _mm_set1_pd(-7.85398125648498535156E-1), x);
+    x = madd_pd(y, _mm_set1_pd(-3.77489470793079817668E-8), x);
+    x = madd_pd(y, _mm_set1_pd(-2.69515142907905952645E-15), x);
+
+    auto z = _mm_mul_pd(x, x);
+
+    /* cos(x) = 1 - x^2 / 2 + x^4 C(x^2) */
+    auto c = _mm_set1_pd(-1.13585365213876817300E-11);
+    c      = madd_pd(c, z, _mm_set1_pd(2.08757008419747316778E-9));
+    c      = madd_pd(c, z, _mm_set1_pd(-2.75573141792967388112E-7));
+    c      = madd_pd(c, z, _mm_set1_pd(2.48015872888517045348E-5));
+    c      = madd_pd(c, z, _mm_set1_pd(-1.38888888888730564116E-3));
+    c      = madd_pd(c, z, _mm_set1_pd(4.16666666666665929218E-2));
+    c      = _mm_mul_pd(_mm_mul_pd(c, z), z);
+    c      = _mm_add_pd(madd_pd(z, _mm_set1_pd(-0.5), _mm_set1_pd(1.0)), c);
+
+    /* sin(x) = x + x^3 S(x^2) */
+    auto s = _mm_set1_pd(1.58962301576546568060E-10);
+    s      = madd_pd(s, z, _mm_set1_pd(-2.50507477628578072866E-8));
+    s      = madd_pd(s, z, _mm_set1_pd(2.75573136213857245213E-6));
+    s      = madd_pd(s, z, _mm_set1_pd(-1.98412698295895385996E-4));
+    s      = madd_pd(s, z, _mm_set1_pd(8.33333333332211858878E-3));
+    s      = madd_pd(s, z, _mm_set1_pd(-1.66666666666666307295E-1));
+    s      = madd_pd(_mm_mul_pd(s, z), x, x);
+
+    return blend_pd(cos_mask, c, s);
+}
+
+/*!
+ * \brief Compute the sine of each element
+ *
+ * The maximum error is about 1 ulp for |x| < 1e8, the precision of the
+ * argument reduction is lost for larger arguments. Infinite and NaN
+ * arguments give NaN.
+ */
+ETL_INLINE_VEC_128D sin_pd(__m128d x) {
+    auto sign_mask = _mm_set1_pd(-0.0);
+    auto zero      = _mm_setzero_pd();
+
+    auto sign_bit = _mm_and_pd(x, sign_mask);
+    x             = _mm_andnot_pd(sign_mask, x);
+
+    /* j = (int) (x * 4 / Pi) rounded to the even octant above */
+    auto j = _mm_cvttpd_epi32(_mm_mul_pd(x, _mm_set1_pd(1.27323954473516268615)));
+    j      = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+
+    auto swap_mask = _mm_cmpneq_pd(_mm_cvtepi32_pd(_mm_and_si128(j, _mm_set1_epi32(4))), zero);
+    auto cos_mask  = _mm_cmpneq_pd(_mm_cvtepi32_pd(_mm_and_si128(j, _mm_set1_epi32(2))), zero);
+
+    sign_bit = _mm_xor_pd(sign_bit, _mm_and_pd(swap_mask, sign_mask));
+
+    auto y = _mm_xor_pd(sincos_reduced_pd(x, _mm_cvtepi32_pd(j), cos_mask), sign_bit);
+    return _mm_or_pd(y, _mm_cmpeq_pd(x, _mm_set1_pd(std::numeric_limits<double>::infinity()))); // infinite arg will be NaN
+}
+
+/*!
+ * \brief Compute the cosine of each element
+ *
+ * The maximum error is about 1 ulp for |x| < 1e8, the precision of the
+ * argument reduction is lost for larger arguments. Infinite and NaN
+ * arguments give NaN.
+ */
+ETL_INLINE_VEC_128D cos_pd(__m128d x) {
+    auto sign_mask = _mm_set1_pd(-0.0);
+    auto zero      = _mm_setzero_pd();
+
+    x = _mm_andnot_pd(sign_mask, x);
+
+    /* j = (int) (x * 4 / Pi) rounded to the even octant above */
+    auto j = _mm_cvttpd_epi32(_mm_mul_pd(x, _mm_set1_pd(1.27323954473516268615)));
+    j      = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+    auto y = _mm_cvtepi32_pd(j);
+    j      = _mm_sub_epi32(j, _mm_set1_epi32(2));
+
+    auto swap_mask = _mm_cmpeq_pd(_mm_cvtepi32_pd(_mm_and_si128(j, _mm_set1_epi32(4))), zero);
+    auto cos_mask  = _mm_cmpneq_pd(_mm_cvtepi32_pd(_mm_and_si128(j, _mm_set1_epi32(2))), zero);
+
+    auto r = _mm_xor_pd(sincos_reduced_pd(x, y, cos_mask), _mm_and_pd(swap_mask, sign_mask));
+    return _mm_or_pd(r, _mm_cmpeq_pd(x, _mm_set1_pd(std::numeric_limits<double>::infinity()))); // infinite arg will be NaN
+}
+
 } //end of namespace etl
 
 #endif //__SSE3__
@@ -12,7 +12,7 @@
 
 #pragma once
 
-#ifdef __SSE3__
+#if defined(__SSE3__) || defined(ETL_TARGET_SSE3)
 
 #include <immintrin.h>
 #include <emmintrin.h>
@@ -536,6 +536,14 @@ struct sse_vec {
         return etl::sin_ps(x);
     }
 
+    ETL_INLINE_VEC_128D cos(__m128d x) {
+        return etl::cos_pd(x);
+    }
+
+    ETL_INLINE_VEC_128D sin(__m128d x) {
+        return etl::sin_pd(x);
+    }
+
 //The Intel C++ Compiler (icc) has more intrinsics.
 //ETL uses them when compiled with icc
 
@@ -549,6 +557,10 @@ struct sse_vec {
         return etl::exp_pd(x);
     }
 
+    ETL_INLINE_VEC_128D log(__m128d x) {
+        return etl::log_pd(x);
+    }
+
     ETL_INLINE_VEC_128 log(__m128 x) {
         return etl::log_ps(x);
     }
@@ -575,6 +587,8 @@ struct sse_vec {
         return _mm_log_ps(x);
     }
 
+#endif //__INTEL_COMPILER
+
     //Min
 
     ETL_INLINE_VEC_128D min(__m128d lhs, __m128d rhs) {
@@ -595,7 +609,47 @@ struct sse_vec {
         return _mm_max_ps(lhs, rhs);
     }
 
-#endif //__INTEL_COMPILER
+    //Absolute value
+
+    ETL_INLINE_VEC_128D abs(__m128d x) {
+        return _mm_andnot_pd(_mm_set1_pd(-0.0), x);
+    }
+
+    ETL_INLINE_VEC_128 abs(__m128 x) {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+    }
+
+    //Comparison
+
+    /*!
+     * \brief Compare the two given values
+     * \return a mask set for the elements where lhs < rhs
+     */
+    ETL_STATIC_INLINE(__m128d) lt(__m128d lhs, __m128d rhs) {
+        return _mm_cmplt_pd(lhs, rhs);
+    }
+
+    /*!
+     * \brief Compare the two given values
+     * \return a mask set for the elements where lhs < rhs
+     */
+    ETL_STATIC_INLINE(__m128) lt(__m128 lhs, __m128 rhs) {
+        return _mm_cmplt_ps(lhs, rhs);
+    }
+
+    /*!
+     * \brief Select the elements of lhs where the mask is set and the elements of rhs elsewhere
+     */
+    ETL_INLINE_VEC_128D select(__m128d mask, __m128d lhs, __m128d rhs) {
+        return _mm_or_pd(_mm_and_pd(mask, lhs), _mm_andnot_pd(mask, rhs));
+    }
+
+    /*!
+     * \brief Select the elements of lhs where the mask is set and the elements of rhs elsewhere
+     */
+    ETL_INLINE_VEC_128 select(__m128 mask, __m128 lhs, __m128 rhs) {
+        return _mm_or_ps(_mm_and_ps(mask, lhs), _mm_andnot_ps(mask, rhs));
+    }
 
     /*!
      * \brief Perform an horizontal sum of the given vector.
@@ -623,6 +677,42 @@ struct sse_vec {
         __m128d shuf = _mm_castps_pd(shuftmp);
         return _mm_cvtsd_f64(_mm_add_sd(in, shuf));
     }
+
+    /*!
+     * \brief Transpose a 4x4 block of single precision values
+     * \param in The first element of the block
+     * \param in_stride The distance between two rows of the block
+     * \param out The first element of the transposed block
+     * \param out_stride The distance between two rows of the transposed block
+     */
+    ETL_INLINE_VEC_VOID transpose_block(const float* in, std::size_t in_stride, float* out, std::size_t out_stride) {
+        __m128 r0 = _mm_loadu_ps(in + 0 * in_stride);
+        __m128 r1 = _mm_loadu_ps(in + 1 * in_stride);
+        __m128 r2 = _mm_loadu_ps(in + 2 * in_stride);
+        __m128 r3 = _mm_loadu_ps(in + 3 * in_stride);
+
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+        _mm_storeu_ps(out + 0 * out_stride, r0);
+        _mm_storeu_ps(out + 1 * out_stride, r1);
+        _mm_storeu_ps(out + 2 * out_stride, r2);
+        _mm_storeu_ps(out + 3 * out_stride, r3);
+    }
+
+    /*!
+     * \brief Transpose a 2x2 block of double precision values
+     * \param in The first element of the block
+     * \param in_stride The distance between two rows of the block
+     * \param out The first element of the transposed block
+     * \param out_stride The distance between two rows of the transposed block
+     */
+    ETL_INLINE_VEC_VOID transpose_block(const double* in, std::size_t in_stride, double* out, std::size_t out_stride) {
+        __m128d r0 = _mm_loadu_pd(in + 0 * in_stride);
+        __m128d r1 = _mm_loadu_pd(in + 1 * in_stride);
+
+        _mm_storeu_pd(out + 0 * out_stride, _mm_unpacklo_pd(r0, r1));
+        _mm_storeu_pd(out + 1 * out_stride, _mm_unpackhi_pd(r0, r1));
+    }
 };
 
 //TODO Vectorize the two following functions
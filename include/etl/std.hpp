@@ -22,7 +22,6 @@
 #include "cpp_utils/tmp.hpp"
 #include "cpp_utils/likely.hpp"
 #include "cpp_utils/assert.hpp"
-#include "cpp_utils/parallel.hpp"
 
 // Macro to handle noexcept and cpp_assert
 
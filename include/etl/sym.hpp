@@ -571,7 +571,7 @@ public:
      * \return a vector containing several elements of the matrix
      */
     template<typename V = default_vec>
-    vec_type<V> load(std::size_t i) const noexcept {
+    ETL_STRONG_INLINE(vec_type<V>) load(std::size_t i) const noexcept {
         return matrix.template load<V>(i);
     }
 
@@ -582,7 +582,7 @@ public:
      * \return a vector containing several elements of the matrix
      */
     template<typename V = default_vec>
-    vec_type<V> loadu(std::size_t i) const noexcept {
+    ETL_STRONG_INLINE(vec_type<V>) loadu(std::size_t i) const noexcept {
         return matrix.template loadu<V>(i);
     }
 
@@ -593,7 +593,7 @@ public:
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void stream(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) stream(vec_type<V> in, std::size_t i) noexcept {
         matrix.template stream<V>(in, i);
     }
 
@@ -604,7 +604,7 @@ public:
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void store(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) store(vec_type<V> in, std::size_t i) noexcept {
         matrix.template store<V>(in, i);
     }
 
@@ -615,7 +615,7 @@ public:
      * \tparam V The vectorization mode to use
      */
     template <typename V = default_vec>
-    void storeu(vec_type<V> in, std::size_t i) noexcept {
+    ETL_STRONG_INLINE(void) storeu(vec_type<V> in, std::size_t i) noexcept {
         matrix.template storeu<V>(in, i);
     }
 
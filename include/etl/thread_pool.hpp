@@ -0,0 +1,298 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Process-wide thread pool used by all the parallel implementations
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "etl/config.hpp"
+#include "etl/arena.hpp"
+
+namespace etl {
+
+/*!
+ * \brief Process-wide pool of worker threads shared by all the parallel
+ * implementations of ETL.
+ *
+ * A parallel loop is split into chunks that are claimed dynamically, by
+ * the calling thread and by any idle worker. The calling thread always
+ * takes part in its own loop, so a parallel loop started from inside
+ * another one (nested parallelism) is always able to finish, even when
+ * all the workers are busy. Loops started concurrently from several
+ * application threads share the same workers instead of each having
+ * their own.
+ *
+ * When the calling thread has an active arena_scope, the workers open
+ * their own scope while they run the chunks of its loop, so that the
+ * scratch memory allocated by the chunks is recycled by their arenas.
+ */
+struct thread_pool {
+    /*!
+     * \brief Returns the unique instance of the pool
+     */
+    static thread_pool& instance() {
+        static thread_pool pool;
+        return pool;
+    }
+
+    thread_pool(const thread_pool& rhs) = delete;
+    thread_pool& operator=(const thread_pool& rhs) = delete;
+
+    /*!
+     * \brief Returns the number of threads taking part in a parallel
+     * loop, including the calling thread.
+     */
+    std::size_t threads() const noexcept {
+        return _threads.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Change the number of threads taking part in a parallel loop,
+     * including the calling thread.
+     *
+     * This must not be called while a parallel loop is running.
+     *
+     * \param n The new number of threads
+     */
+    void set_threads(std::size_t n) {
+        n = std::max(n, std::size_t(1));
+
+        std::unique_lock<std::mutex> lock(mutex);
+
+        stop_workers(lock);
+
+        _threads.store(n, std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Execute the functor on all the chunks of [first, last)
+     *
+     * The functor is called with sub ranges [b, e) of at most grain
+     * elements, from the calling thread and from the workers of the
+     * pool. The function returns once all the chunks have been processed.
+     * If the functor throws, the remaining chunks are not processed and
+     * the first exception is rethrown in the calling thread.
+     *
+     * \param first The beginning of the range
+     * \param last The end of the range
+     * \param grain The maximum number of elements of a chunk
+     * \param functor The functor to execute
+     */
+    template <typename Functor>
+    void parallel_for(std::size_t first, std::size_t last, std::size_t grain, Functor&& functor) {
+        grain = std::max(grain, std::size_t(1));
+
+        if (threads() < 2 || last - first <= grain) {
+            functor(first, last);
+            return;
+        }
+
+        using functor_t = std::remove_reference_t<Functor>;
+
+        job j(first, last, grain, const_cast<void*>(static_cast<const void*>(&functor)), [](void* f, std::size_t b, std::size_t e) {
+            (*static_cast<functor_t*>(f))(b, e);
+        }, arena_active());
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            start_workers();
+
+            jobs.push_back(&j);
+        }
+
+        work_cv.notify_all();
+
+        run_chunks(j);
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            jobs.erase(std::find(jobs.begin(), jobs.end(), &j));
+
+            done_cv.wait(lock, [&j] { return j.users == 0; });
+        }
+
+        if (j.error) {
+            std::rethrow_exception(j.error);
+        }
+    }
+
+    /*!
+     * \brief Stop and join all the workers
+     */
+    ~thread_pool() {
+        std::unique_lock<std::mutex> lock(mutex);
+        stop_workers(lock);
+    }
+
+private:
+    /*!
+     * \brief A parallel loop being executed
+     */
+    struct job {
+        using run_t = void (*)(void*, std::size_t, std::size_t); ///< The type of the type-erased functor call
+
+        const std::size_t last;        ///< The end of the range
+        const std::size_t grain;       ///< The size of a chunk
+        std::atomic<std::size_t> next; ///< The beginning of the next chunk to claim
+        void* const functor;           ///< The functor to call
+        const run_t run;               ///< The type-erased call of the functor
+        const bool arena;              ///< Indicates if the workers must use their arena
+        std::size_t users = 0;         ///< The number of workers currently on this job (protected by the pool mutex)
+        std::exception_ptr error;      ///< The first exception thrown by the functor (protected by the pool mutex)
+
+        job(std::size_t first, std::size_t last, std::size_t grain, void* functor, run_t run, bool arena)
+                : last(last), grain(grain), next(first), functor(functor), run(run), arena(arena) {}
+
+        /*!
+         * \brief Indicates if some chunks have not been claimed yet
+         */
+        bool available() const noexcept {
+            return next.load(std::memory_order_relaxed) < last;
+        }
+    };
+
+    std::atomic<std::size_t> _threads; ///< The number of threads of a parallel loop
+    std::vector<std::thread> workers;  ///< The worker threads
+    std::vector<job*> jobs;            ///< The jobs currently running
+    std::mutex mutex;                  ///< The mutex protecting the jobs and the workers
+    std::condition_variable work_cv;   ///< Condition variable to wake up the workers
+    std::condition_variable done_cv;   ///< Condition variable to signal the end of a job
+    bool stop = false;                 ///< Indicates that the workers must stop
+
+    thread_pool() : _threads(std::max(etl::threads, std::size_t(1))) {
+        //The workers are only started with the first parallel loop
+    }
+
+    /*!
+     * \brief Claim and execute chunks of the given job until there are
+     * none left.
+     */
+    void run_chunks(job& j) {
+        while (true) {
+            const std::size_t b = j.next.fetch_add(j.grain, std::memory_order_relaxed);
+
+            if (b >= j.last) {
+                return;
+            }
+
+            try {
+                j.run(j.functor, b, std::min(b + j.grain, j.last));
+            } catch (...) {
+                std::unique_lock<std::mutex> lock(mutex);
+
+                if (!j.error) {
+                    j.error = std::current_exception();
+                }
+
+                j.next.store(j.last, std::memory_order_relaxed);
+
+                return;
+            }
+        }
+    }
+
+    /*!
+     * \brief Find a job with chunks left, the most recent first, since it
+     * is the one blocking the others in case of nested loops. Must be
+     * called with the mutex locked.
+     */
+    job* find_job() const noexcept {
+        for (auto it = jobs.rbegin(); it != jobs.rend(); ++it) {
+            if ((*it)->available()) {
+                return *it;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /*!
+     * \brief The main loop of a worker
+     */
+    void worker_main() {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (true) {
+            job* j = nullptr;
+
+            work_cv.wait(lock, [this, &j] { return stop || (j = find_job()); });
+
+            if (stop) {
+                return;
+            }
+
+            ++j->users;
+
+            lock.unlock();
+
+            if (j->arena) {
+                arena_scope scope;
+                run_chunks(*j);
+            } else {
+                run_chunks(*j);
+            }
+
+            lock.lock();
+
+            if (--j->users == 0) {
+                done_cv.notify_all();
+            }
+        }
+    }
+
+    /*!
+     * \brief Start the workers if they are not running. Must be called
+     * with the mutex locked.
+     */
+    void start_workers() {
+        if (workers.empty()) {
+            const std::size_t n = threads();
+
+            for (std::size_t t = 0; t + 1 < n; ++t) {
+                workers.emplace_back([this] { worker_main(); });
+            }
+        }
+    }
+
+    /*!
+     * \brief Stop and join all the workers.
+     * \param lock The lock on the mutex, released while joining
+     */
+    void stop_workers(std::unique_lock<std::mutex>& lock) {
+        stop = true;
+
+        lock.unlock();
+
+        work_cv.notify_all();
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        lock.lock();
+
+        workers.clear();
+        stop = false;
+    }
+};
+
+} //end of namespace etl
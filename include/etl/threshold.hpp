@@ -18,6 +18,13 @@ namespace etl {
 constexpr std::size_t gemm_std_max    = 75 * 75;   ///< The maximum number of elements to be handled by std algorithm
 constexpr std::size_t gemm_cublas_min = 180 * 180; ///< The minimum number or elements before considering cublas
 
+constexpr std::size_t gemm_parallel_threshold = 128 * 128 * 128; ///< The minimum number of operations (M * N * K) before considering parallel GEMM
+
+constexpr std::size_t gemm_epilogue_threshold = 64 * 1024; ///< The minimum number of elements of the result before fusing elementwise operations into matrix multiplication
+constexpr std::size_t gemm_epilogue_panel     = 16 * 1024; ///< The number of elements of the result computed at once when elementwise operations are fused into matrix multiplication
+
+constexpr std::size_t sparse_mul_parallel_threshold = 32 * 1024; ///< The minimum number of operations (non-zeros * columns) before considering parallel sparse multiplication
+
 constexpr std::size_t gevm_small_threshold = 62000;   ///< The number of elements of b after which we use BLAS-like kernel
 constexpr std::size_t gemv_small_threshold = 4500000; ///< The number of elements of A after which we use BLAS-like kernel
 
@@ -25,6 +32,10 @@ constexpr std::size_t parallel_threshold = 128 * 1024; ///< The minimum number o
 
 constexpr std::size_t sum_parallel_threshold = 1024 * 32; ///< The minimum number of elements before considering parallel acc implementation
 
+constexpr std::size_t sum_l_parallel_threshold = 128; ///< The minimum number of columns before considering parallel column reductions
+
+constexpr std::size_t pooling_parallel_threshold = 1024 * 32; ///< The minimum number of input elements before considering parallel pooling and upsampling
+
 constexpr std::size_t conv1_parallel_threshold_conv   = 100; ///< The mimum output size before considering parallel convolution
 constexpr std::size_t conv1_parallel_threshold_kernel = 16;  ///< The mimum kernel size before considering parallel convolution
 
@@ -34,4 +45,12 @@ constexpr std::size_t fft1_many_threshold_n          = 768; ///< The mimum size
 constexpr std::size_t fft2_many_threshold_transforms = 16;   ///< The mimum number of transforms to parallelize them
 constexpr std::size_t fft2_many_threshold_n          = 1024; ///< The mimum size of the transforms to parallelize them
 
+constexpr std::size_t fft_four_step_threshold = 64 * 1024 * 1024; ///< The minimum size of a power of two FFT before using the four-step algorithm
+constexpr std::size_t fft_bluestein_threshold = 6;                 ///< The minimum ratio between the largest prime factor of the size of a FFT and its log2 before using the Bluestein algorithm
+
+constexpr std::size_t conv1_ola_min_transform = 2048;      ///< The minimum size of the transforms of the overlap-add convolution
+constexpr std::size_t conv1_ola_max_transform = 32 * 1024; ///< The maximum size of the transforms of the overlap-add convolution, unless required by the kernel
+
+constexpr std::size_t conv4_winograd_min_channels = 32; ///< The minimum number of kernels times channels before preferring the Winograd 4D convolution
+
 } //end of namespace etl
@@ -41,6 +41,12 @@ struct is_sparse_matrix_impl : std::false_type {};
 template <typename V1, sparse_storage V2, std::size_t V3>
 struct is_sparse_matrix_impl<sparse_matrix_impl<V1, V2, V3>> : std::true_type {};
 
+template <typename T>
+struct is_compressed_sparse_matrix_impl : std::false_type {};
+
+template <typename V1, sparse_storage V2, std::size_t V3>
+struct is_compressed_sparse_matrix_impl<sparse_matrix_impl<V1, V2, V3>> : cpp::bool_constant<V2 == sparse_storage::CSR || V2 == sparse_storage::CSC> {};
+
 template <typename T>
 struct is_selected_expr_impl : std::false_type {};
 
@@ -108,6 +114,14 @@ using is_custom_dyn_matrix = traits_detail::is_custom_dyn_matrix_impl<std::decay
 template <typename T>
 using is_sparse_matrix = traits_detail::is_sparse_matrix_impl<std::decay_t<T>>;
 
+/*!
+ * \brief Traits indicating if the given ETL type is a sparse matrix
+ * with compressed storage (CSR or CSC)
+ * \tparam T The type to test
+ */
+template <typename T>
+using is_compressed_sparse_matrix = traits_detail::is_compressed_sparse_matrix_impl<std::decay_t<T>>;
+
 /*!
  * \brief Traits indicating if the given ETL type is a symmetric matrix
  * \tparam T The type to test
@@ -301,6 +315,13 @@ using is_double_precision = is_double_precision_t<typename std::decay_t<T>::valu
 template <typename... E>
 using all_double_precision = cpp::and_c<is_double_precision<E>...>;
 
+/*!
+ * \brief Traits to test if the given type is a floating point type.
+ * \tparam T The type
+ */
+template <typename T>
+using is_floating_t = cpp::or_c<is_single_precision_t<T>, is_double_precision_t<T>>;
+
 /*!
  * \brief Traits to test if the given ETL expresion contains floating point numbers.
  * \tparam T The ETL expression type.
@@ -66,6 +66,9 @@ struct custom_dyn_matrix_impl;
 template <typename T, sparse_storage SS, std::size_t D>
 struct sparse_matrix_impl;
 
+template <typename T, sparse_storage SS = sparse_storage::COO>
+struct sparse_builder;
+
 template <typename Stream>
 struct serializer;
 
@@ -165,4 +168,16 @@ using custom_fast_matrix = custom_fast_matrix_impl<T, cpp::array_wrapper<T>, ord
 template <typename T, std::size_t D = 2>
 using sparse_matrix                 = sparse_matrix_impl<T, sparse_storage::COO, D>;
 
+/*!
+ * \brief A sparse matrix in Compressed Sparse Row (CSR) format, of D dimensions
+ */
+template <typename T, std::size_t D = 2>
+using sparse_csr_matrix = sparse_matrix_impl<T, sparse_storage::CSR, D>;
+
+/*!
+ * \brief A sparse matrix in Compressed Sparse Column (CSC) format, of D dimensions
+ */
+template <typename T, std::size_t D = 2>
+using sparse_csc_matrix = sparse_matrix_impl<T, sparse_storage::CSC, D>;
+
 } //end of namespace etl
@@ -34,6 +34,9 @@
 #define ETL_OUT_INLINE(RRRR)    inline RRRR __attribute__((__always_inline__, __artificial__))
 #endif
 
+// With runtime dispatch, the implementations that are not in the baseline are compiled for their own instruction set
+#include "etl/isa_vectorization.hpp"
+
 //Include al the vector implementation
 #include "etl/avx512_vectorization.hpp"
 #include "etl/avx_vectorization.hpp"
@@ -65,7 +68,9 @@ struct get_vector_impl {
     using type = no_vec; ///< The vector implementation
 };
 
-#ifdef __AVX512F__
+// With runtime dispatch, the vector modes wider than the baseline are also
+// used by the kernels compiled for them
+#if defined(__AVX512F__) || defined(ETL_ISA_AVX512)
 
 /*!
  * \brief get_intrinsic_traits for AVX-512
@@ -83,7 +88,7 @@ struct get_vector_impl<vector_mode_t::AVX512> {
 
 #endif
 
-#ifdef __AVX__
+#if defined(__AVX__) || defined(ETL_ISA_AVX)
 
 /*!
  * \brief get_intrinsic_traits for AVX
@@ -101,7 +106,7 @@ struct get_vector_impl<vector_mode_t::AVX> {
 
 #endif
 
-#ifdef __SSE3__
+#if defined(__SSE3__) || defined(ETL_ISA_AVX512) || defined(ETL_ISA_AVX)
 
 /*!
  * \brief get_intrinsic_traits for SSE
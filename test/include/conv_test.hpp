@@ -45,6 +45,7 @@
 CONV_FUNCTOR(default_conv1_full, c = etl::conv_1d_full(a, b))
 CONV_FUNCTOR(std_conv1_full, c = selected_helper(etl::conv_impl::STD, etl::conv_1d_full(a, b)))
 CONV_FUNCTOR(fft_std_conv1_full, c = selected_helper(etl::conv_impl::FFT_STD, etl::conv_1d_full(a, b)))
+CONV_FUNCTOR(fft_ola_conv1_full, c = selected_helper(etl::conv_impl::FFT_OLA, etl::conv_1d_full(a, b)))
 
 CONV_FUNCTOR(default_conv1_same, c = etl::conv_1d_same(a, b))
 CONV_FUNCTOR(std_conv1_same, c = selected_helper(etl::conv_impl::STD, etl::conv_1d_same(a, b)))
@@ -149,6 +150,7 @@ CONV_FUNCTOR(fft_std_conv2_full_multi_flipped, c = selected_helper(etl::conv_mul
 #define CONV1_FULL_TEST_CASE_SECTION_DEFAULT CONV_TEST_CASE_SECTIONS(default_conv1_full)
 #define CONV1_FULL_TEST_CASE_SECTION_STD CONV_TEST_CASE_SECTIONS(std_conv1_full)
 #define CONV1_FULL_TEST_CASE_SECTION_FFT_STD CONV_TEST_CASE_SECTIONS(fft_std_conv1_full)
+#define CONV1_FULL_TEST_CASE_SECTION_FFT_OLA CONV_TEST_CASE_SECTIONS(fft_ola_conv1_full)
 
 #define CONV1_SAME_TEST_CASE_SECTION_DEFAULT CONV_TEST_CASE_SECTIONS(default_conv1_same)
 #define CONV1_SAME_TEST_CASE_SECTION_STD CONV_TEST_CASE_SECTIONS(std_conv1_same)
@@ -573,6 +575,7 @@ CONV_FUNCTOR(cudnn_conv2_valid_multi_flipped, c = selected_helper(etl::conv_mult
         CONV1_FULL_TEST_CASE_SECTION_STD        \
         CONV1_FULL_TEST_CASE_SECTION_VEC        \
         CONV1_FULL_TEST_CASE_SECTION_FFT_STD    \
+        CONV1_FULL_TEST_CASE_SECTION_FFT_OLA    \
         CONV1_FULL_TEST_CASE_SECTION_FFT_MKL    \
         CONV1_FULL_TEST_CASE_SECTION_FFT_CUFFT  \
     }                                           \
@@ -0,0 +1,175 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEST_CASE("arena/classes", "[arena]") {
+    REQUIRE_EQUALS(etl::arena_class(1), 0UL);
+    REQUIRE_EQUALS(etl::arena_class(64), 0UL);
+    REQUIRE_EQUALS(etl::arena_class_size(0), 64UL);
+
+    for (std::size_t bytes = 1; bytes < 100000; bytes += 7) {
+        auto c = etl::arena_class(bytes);
+
+        REQUIRE_DIRECT(etl::arena_class_size(c) >= bytes);
+
+        if (c > 0) {
+            REQUIRE_DIRECT(etl::arena_class_size(c - 1) < bytes);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("arena/scope/1", "[arena]", Z, float, double) {
+    etl::arena_trim();
+
+    {
+        etl::arena_scope scope;
+
+        REQUIRE_DIRECT(etl::arena_active());
+
+        {
+            etl::dyn_matrix<Z> a(33, 17);
+            a = 1.0;
+        }
+
+        auto cached = etl::arena_cached();
+
+        REQUIRE_DIRECT(cached > 0);
+
+        // The block is reused by an allocation of the same size
+
+        {
+            etl::dyn_matrix<Z> a(33, 17);
+            REQUIRE_EQUALS(etl::arena_cached(), 0UL);
+        }
+
+        REQUIRE_EQUALS(etl::arena_cached(), cached);
+    }
+
+    REQUIRE_DIRECT(!etl::arena_active());
+
+    etl::arena_trim();
+
+    REQUIRE_EQUALS(etl::arena_cached(), 0UL);
+}
+
+TEMPLATE_TEST_CASE_2("arena/scope/2", "[arena]", Z, float, double) {
+    etl::arena_trim();
+
+    etl::dyn_matrix<Z> a(8, 8);
+    etl::dyn_matrix<Z> b(8, 8);
+    etl::dyn_matrix<Z> c(8, 8);
+
+    a = etl::sequence_generator<Z>(1.0);
+    b = 2.0;
+
+    std::size_t cached = 0;
+
+    {
+        etl::arena_scope scope;
+
+        for (std::size_t i = 0; i < 5; ++i) {
+            c = a * b + a;
+
+            // After the first iteration, the temporaries reuse the same blocks
+
+            if (i == 0) {
+                cached = etl::arena_cached();
+                REQUIRE_DIRECT(cached > 0);
+            } else {
+                REQUIRE_EQUALS(etl::arena_cached(), cached);
+            }
+        }
+    }
+
+    REQUIRE_EQUALS(c(0, 0), Z(2.0 * (1 + 2 + 3 + 4 + 5 + 6 + 7 + 8) + 1.0));
+    REQUIRE_EQUALS(c(7, 7), Z(2.0 * (57 + 58 + 59 + 60 + 61 + 62 + 63 + 64) + 64.0));
+
+    etl::arena_trim();
+}
+
+TEMPLATE_TEST_CASE_2("arena/scope/3", "[arena]", Z, float, double) {
+    etl::arena_trim();
+
+    std::unique_ptr<etl::dyn_matrix<Z>> a;
+
+    {
+        etl::arena_scope scope;
+
+        a = std::make_unique<etl::dyn_matrix<Z>>(16, 16);
+        *a = 3.0;
+    }
+
+    // Memory allocated in a scope can outlive it
+
+    REQUIRE_EQUALS((*a)(15, 15), Z(3.0));
+
+    a.reset();
+
+    REQUIRE_EQUALS(etl::arena_cached(), 0UL);
+}
+
+TEST_CASE("arena/max_cached", "[arena]") {
+    etl::arena_trim();
+
+    {
+        etl::arena_scope scope;
+
+        {
+            etl::dyn_vector<float> a(etl::arena_max_cached / sizeof(float) + 1);
+        }
+
+        // The block is too large to be cached
+
+        REQUIRE_EQUALS(etl::arena_cached(), 0UL);
+
+        {
+            etl::dyn_vector<float> a(etl::arena_max_cached / sizeof(float) / 2);
+        }
+
+        REQUIRE_DIRECT(etl::arena_cached() > 0);
+        REQUIRE_DIRECT(etl::arena_cached() <= etl::arena_max_cached);
+    }
+
+    etl::arena_trim();
+}
+
+TEST_CASE("arena/workers", "[arena][parallel]") {
+    const auto threads = etl::parallel_threads();
+
+    etl::set_parallel_threads(3);
+
+    std::atomic<bool> active(true);
+
+    auto fun = [&active](std::size_t first, std::size_t last) {
+        auto buffer = etl::aligned_ptr<float>{etl::aligned_allocator<64>::allocate<float>(256 * (last - first))};
+        buffer.get()[0] = 1.0f;
+
+        // Give the workers the time to claim chunks
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+
+        if (!etl::arena_active()) {
+            active = false;
+        }
+    };
+
+    {
+        etl::arena_scope scope;
+
+        // The workers use their arena while they run the loop
+
+        for (std::size_t i = 0; i < 5; ++i) {
+            etl::thread_pool::instance().parallel_for(0, 300, 1, fun);
+        }
+    }
+
+    etl::set_parallel_threads(threads);
+
+    REQUIRE_DIRECT(active);
+
+    etl::arena_trim();
+}
@@ -70,6 +70,13 @@ ETL_TEST_CASE("assert/dim/4", "[assert]") {
     REQUIRE_THROWS(matrix(1, 5));
     REQUIRE_THROWS(matrix(3, 5));
 }
+
+ETL_TEST_CASE("assert/solve/1", "[assert]") {
+    etl::fast_matrix<double, 3, 3> A{1.0, 2.0, 3.0, 2.0, 4.0, 6.0, 1.0, 0.0, 1.0};
+    etl::fast_vector<double, 3> b{1.0, 2.0, 3.0};
+
+    REQUIRE_THROWS(etl::solve(A, b));
+}
 #endif
 
 #endif
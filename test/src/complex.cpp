@@ -272,6 +272,28 @@ TEMPLATE_TEST_CASE_2("complex/std/15", "[complex]", Z, float, double) {
     REQUIRE_EQUALS_APPROX(a[2].imag(), Z(0.0));
 }
 
+TEMPLATE_TEST_CASE_2("complex/std/16", "[complex]", Z, float, double) {
+    etl::dyn_vector<std::complex<Z>> a(19);
+    etl::dyn_vector<std::complex<Z>> b(19);
+    etl::dyn_vector<std::complex<Z>> c(19);
+    etl::dyn_vector<std::complex<Z>> d(19);
+
+    for (std::size_t i = 0; i < 19; ++i) {
+        a[i] = std::complex<Z>(Z(1.0) + i, Z(2.0) - i);
+        b[i] = std::complex<Z>(Z(0.5) * i + Z(1.0), Z(3.0) + i);
+    }
+
+    c = a >> b;
+    d = a / b;
+
+    for (std::size_t i = 0; i < 19; ++i) {
+        REQUIRE_EQUALS_APPROX(c[i].real(), (a[i] * b[i]).real());
+        REQUIRE_EQUALS_APPROX(c[i].imag(), (a[i] * b[i]).imag());
+        REQUIRE_EQUALS_APPROX(d[i].real(), (a[i] / b[i]).real());
+        REQUIRE_EQUALS_APPROX(d[i].imag(), (a[i] / b[i]).imag());
+    }
+}
+
 TEMPLATE_TEST_CASE_2("complex/etl/13", "[complex]", Z, float, double) {
     etl::fast_vector<etl::complex<Z>, 3> a = {etl::complex<Z>(1.0, 2.0), etl::complex<Z>(-1.0, -2.0), etl::complex<Z>(0.0, 0.5)};
     etl::fast_vector<etl::complex<Z>, 3> b = {etl::complex<Z>(0.33, 0.66), etl::complex<Z>(-1.5, 0.0), etl::complex<Z>(0.5, 0.75)};
@@ -160,6 +160,82 @@ CONV1_FULL_TEST_CASE("convolution_1d/full_8", "convolution_1d_full") {
     REQUIRE_EQUALS_APPROX(c[6], 7.5);
 }
 
+CONV1_FULL_TEST_CASE("convolution_1d/full_9", "convolution_1d_full") {
+    etl::dyn_vector<T> a(20000);
+    etl::dyn_vector<T> b(301);
+    etl::dyn_vector<T> c(20300);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    Impl::apply(a, b, c);
+
+    for (std::size_t i = 0; i < 20300; i += 7) {
+        T ref = 0;
+
+        for (std::size_t j = i < 20000 ? 0 : i - 19999; j < 301 && j <= i; ++j) {
+            ref += a[i - j] * b[j];
+        }
+
+        REQUIRE_EQUALS_APPROX_E(c[i], ref, 1e-3);
+    }
+}
+
+// convolution_1d_filter
+
+TEMPLATE_TEST_CASE_2("convolution_1d/filter_1", "[conv][filter]", Z, float, double) {
+    etl::dyn_vector<Z> a(10000);
+    etl::dyn_vector<Z> b(129);
+    etl::dyn_vector<Z> ref(10128);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    ref = selected_helper(etl::conv_impl::STD, etl::conv_1d_full(a, b));
+
+    auto filter = etl::make_conv_1d_filter(b, 200);
+
+    REQUIRE_EQUALS(filter.kernel_size(), 129UL);
+    REQUIRE_EQUALS(filter.transform_size(), 512UL);
+    REQUIRE_EQUALS(filter.block_size(), 384UL);
+
+    // The signal is processed in place, in chunks of uneven sizes
+
+    etl::dyn_vector<Z> c(10128);
+
+    std::copy(a.begin(), a.end(), c.begin());
+
+    std::size_t first = 0;
+
+    for (std::size_t chunk : {1UL, 7UL, 383UL, 385UL, 1000UL, 3333UL, 100UL}) {
+        filter.process(c.memory_start() + first, chunk, c.memory_start() + first);
+        first += chunk;
+    }
+
+    filter.process(c.memory_start() + first, 10000 - first, c.memory_start() + first);
+    filter.flush(c.memory_start() + 10000);
+
+    for (std::size_t i = 0; i < 10128; ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 1e-3);
+    }
+
+    // After a flush, the filter starts a new signal
+
+    etl::dyn_vector<Z> d(10000);
+    etl::dyn_vector<Z> e(128);
+
+    filter.process(a, d);
+    filter.flush(e);
+
+    for (std::size_t i = 0; i < 10000; ++i) {
+        REQUIRE_EQUALS_APPROX_E(d[i], ref[i], 1e-3);
+    }
+
+    for (std::size_t i = 0; i < 128; ++i) {
+        REQUIRE_EQUALS_APPROX_E(e[i], ref[10000 + i], 1e-3);
+    }
+}
+
 // convolution_1d_same
 
 CONV1_SAME_TEST_CASE("convolution_1d/same_1", "convolution_1d_same") {
@@ -344,6 +420,29 @@ CONV1_VALID_TEST_CASE("convolution_1d/valid_5", "convolution_1d_valid") {
     REQUIRE_EQUALS(c[16], 8036);
 }
 
+CONV1_VALID_TEST_CASE("convolution_1d/valid_6", "convolution_1d_valid") {
+    // 12 outputs: one block of 8 and one block of 4, with an odd kernel
+    // leaving a single tap after the vectorized loops
+    etl::fast_vector<T, 16> a;
+    etl::fast_vector<T, 5> b;
+    etl::fast_vector<T, 12> c;
+
+    a = etl::sequence_generator(1.0);
+    b = etl::sequence_generator(-2.0);
+
+    Impl::apply(a, b, c);
+
+    for (std::size_t i = 0; i < 12; ++i) {
+        T ref = 0;
+
+        for (std::size_t j = 0; j < 5; ++j) {
+            ref += a[i + j] * b[4 - j];
+        }
+
+        REQUIRE_EQUALS_APPROX(c[i], ref);
+    }
+}
+
 // convolution_subs
 
 TEMPLATE_TEST_CASE_2("convolution_1d/sub_1", "convolution_1d_full_sub", Z, float, double) {
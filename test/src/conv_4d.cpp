@@ -199,3 +199,28 @@ CONV4_VALID_FILTER_FLIPPED_TEST_CASE("conv/4d/valid/filter/flipped/1", "[conv][c
         REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 0.05);
     }
 }
+
+TEMPLATE_TEST_CASE_2("conv_4d/full/prepared/1", "[conv][conv4][full]", T, float, double) {
+    etl::fast_matrix<T, 10, 12, 5, 5> I(etl::sequence_generator(10.0) * 4.0);
+    etl::fast_matrix<T, 12, 2, 3, 3> K(etl::sequence_generator(2.0) * 0.3);
+
+    etl::fast_matrix<T, 10, 2, 7, 7> ref;
+    etl::fast_matrix<T, 10, 2, 7, 7> c;
+
+    ref = 0.0;
+    for(std::size_t i = 0; i < etl::dim<0>(I); ++i){
+        for(std::size_t c = 0; c < etl::dim<1>(K); ++c){
+            for(std::size_t k = 0; k < etl::dim<0>(K); ++k){
+                ref(i)(c) += conv_2d_full(I(i)(k), K(k)(c));
+            }
+        }
+    }
+
+    auto prepared = etl::prepare_kernels(K, 7, 7);
+
+    etl::conv_4d_full(I, prepared, c);
+
+    for(std::size_t i = 0; i < ref.size(); ++i){
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
@@ -670,3 +670,110 @@ CONV2_VALID_MULTI_MULTI_FLIPPED_TEST_CASE("conv_2d/valid/multi_multi_flipped/3",
         REQUIRE_EQUALS_APPROX(C[i], C_ref[i]);
     }
 }
+
+// Prepared kernels
+
+TEMPLATE_TEST_CASE_2("conv_2d/full/multi/prepared/1", "[conv][conv2][conv_multi]", T, float, double) {
+    etl::fast_matrix<T, 9, 7> I(0.5 * etl::sequence_generator(42.0));
+    etl::fast_matrix<T, 3, 5, 5> K;
+
+    K(0) = 1.5 * etl::sequence_generator(10.0);
+    K(1) = -2.5 * etl::sequence_generator(5.0);
+    K(2) = 1.3 * etl::sequence_generator(12.0);
+
+    auto prepared = etl::prepare_kernels(K, 13, 11);
+
+    REQUIRE_EQUALS(prepared.dim(0), 3UL);
+    REQUIRE_EQUALS(prepared.conv_dim(0), 13UL);
+    REQUIRE_EQUALS(prepared.conv_dim(1), 11UL);
+
+    // The same prepared kernels are used for several inputs
+    for (std::size_t n = 0; n < 2; ++n) {
+        I = I * -0.5 + 1.0;
+
+        etl::fast_matrix<T, 3, 13, 11> c_1;
+        etl::fast_matrix<T, 3, 13, 11> c_2;
+
+        c_1(0) = conv_2d_full(I, K(0));
+        c_1(1) = conv_2d_full(I, K(1));
+        c_1(2) = conv_2d_full(I, K(2));
+
+        etl::conv_2d_full_multi(I, prepared, c_2);
+
+        for (std::size_t i = 0; i < etl::size(c_1); ++i) {
+            REQUIRE_EQUALS_APPROX(c_2[i], c_1[i]);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_2d/valid/multi/prepared/1", "[conv][conv2][conv_multi]", T, float, double) {
+    etl::fast_matrix<T, 7, 7> I(etl::magic<T>(7));
+    etl::fast_matrix<T, 3, 5, 3> K;
+
+    K(0) = 1.5 * etl::sequence_generator(10.0);
+    K(1) = -2.5 * etl::sequence_generator(5.0);
+    K(2) = 1.3 * etl::sequence_generator(12.0);
+
+    etl::fast_matrix<T, 3, 3, 5> c_1;
+    etl::fast_matrix<T, 3, 3, 5> c_2;
+
+    c_1(0) = conv_2d_valid(I, K(0));
+    c_1(1) = conv_2d_valid(I, K(1));
+    c_1(2) = conv_2d_valid(I, K(2));
+
+    etl::conv_2d_valid_multi(I, etl::prepare_kernels(K, 11, 9), c_2);
+
+    for (std::size_t i = 0; i < etl::size(c_1); ++i) {
+        REQUIRE_EQUALS_APPROX(c_2[i], c_1[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_2d/valid/multi/prepared/2", "[conv][conv2][conv_multi]", T, float, double) {
+    etl::fast_matrix<T, 7, 7> I(etl::magic<T>(7));
+    etl::fast_matrix<T, 3, 5, 3> K;
+
+    K(0) = 1.5 * etl::sequence_generator(10.0);
+    K(1) = -2.5 * etl::sequence_generator(5.0);
+    K(2) = 1.3 * etl::sequence_generator(12.0);
+
+    etl::fast_matrix<T, 3, 3, 7> c_1;
+    etl::fast_matrix<T, 3, 3, 7> c_2;
+
+    c_1(0) = etl::conv_2d_valid<2, 1, 1, 1>(I, K(0));
+    c_1(1) = etl::conv_2d_valid<2, 1, 1, 1>(I, K(1));
+    c_1(2) = etl::conv_2d_valid<2, 1, 1, 1>(I, K(2));
+
+    // Prepared for the full convolution of the padded input
+    auto prepared = etl::prepare_kernels(K, 7 + 5 + 2 - 1, 7 + 3 + 2 - 1);
+
+    etl::conv_2d_valid_multi(I, prepared, c_2, 2, 1, 1, 1);
+
+    for (std::size_t i = 0; i < etl::size(c_1); ++i) {
+        REQUIRE_EQUALS_APPROX(c_2[i], c_1[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_2d/valid/multi_multi/prepared/1", "[conv][conv2][conv_multi_multi]", T, float, double) {
+    etl::fast_matrix<T, 5, 7, 7> I;
+    etl::fast_matrix<T, 3, 5, 3> K;
+
+    etl::fast_matrix<T, 3, 5, 3, 5> C;
+    etl::fast_matrix<T, 3, 5, 3, 5> C_ref;
+
+    I = 0.5 * etl::sequence_generator(1.0);
+    K = 0.123 * etl::sequence_generator(1.0);
+
+    for (size_t k = 0; k < etl::dim<0>(K); ++k) {
+        for (size_t i = 0; i < etl::dim<0>(I); ++i) {
+            C_ref(k)(i) = conv_2d_valid(I(i), K(k));
+        }
+    }
+
+    const auto prepared = etl::prepare_kernels(K, 11, 9);
+
+    etl::conv_2d_valid_multi_multi(I, prepared, C);
+
+    for (std::size_t i = 0; i < etl::size(C_ref); ++i) {
+        REQUIRE_EQUALS_APPROX(C[i], C_ref[i]);
+    }
+}
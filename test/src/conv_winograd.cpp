@@ -0,0 +1,189 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+// F(4x4,3x3) tiles, with border tiles in both dimensions
+
+TEMPLATE_TEST_CASE_2("conv/winograd/conv4/1", "[conv][conv4][winograd]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 4, 12, 11> I(etl::sequence_generator(1.0) * 0.01);
+    etl::fast_matrix<Z, 5, 4, 3, 3> K(etl::sequence_generator(0.5) * 0.03);
+
+    etl::fast_matrix<Z, 3, 5, 10, 9> ref;
+    etl::fast_matrix<Z, 3, 5, 10, 9> c;
+
+    ref = selected_helper(etl::conv4_impl::STD, etl::conv_4d_valid(I, K));
+    c   = selected_helper(etl::conv4_impl::WINOGRAD, etl::conv_4d_valid(I, K));
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+
+    ref = selected_helper(etl::conv4_impl::STD, etl::conv_4d_valid_flipped(I, K));
+    c   = selected_helper(etl::conv4_impl::WINOGRAD, etl::conv_4d_valid_flipped(I, K));
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+// Several blocks of tiles, split between several threads
+
+TEMPLATE_TEST_CASE_2("conv/winograd/conv4/parallel", "[conv][conv4][winograd][parallel]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> I(8, 4, 30, 11);
+    etl::dyn_matrix<Z, 4> K(5, 4, 3, 3);
+
+    etl::dyn_matrix<Z, 4> ref(8, 5, 28, 9);
+    etl::dyn_matrix<Z, 4> c(8, 5, 28, 9);
+
+    I = etl::sequence_generator(1.0) * 0.001;
+    K = etl::sequence_generator(0.5) * 0.03;
+
+    ref = selected_helper(etl::conv4_impl::STD, etl::conv_4d_valid(I, K));
+
+    const auto threads = etl::parallel_threads();
+
+    etl::set_parallel_threads(3);
+
+    PARALLEL_SECTION {
+        c = selected_helper(etl::conv4_impl::WINOGRAD, etl::conv_4d_valid(I, K));
+    }
+
+    etl::set_parallel_threads(threads);
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+// F(2x2,3x3) tiles, with padding
+
+TEMPLATE_TEST_CASE_2("conv/winograd/conv4/2", "[conv][conv4][winograd]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 3, 5, 4> I(etl::sequence_generator(2.0) * 0.1);
+    etl::fast_matrix<Z, 4, 3, 3, 3> K(etl::sequence_generator(1.0) * 0.05);
+
+    etl::fast_matrix<Z, 2, 4, 5, 4> ref;
+    etl::fast_matrix<Z, 2, 4, 5, 4> c;
+
+    ref = selected_helper(etl::conv4_impl::STD, (etl::conv_4d_valid<1, 1, 1, 1>(I, K)));
+    c   = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid<1, 1, 1, 1>(I, K)));
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+
+    ref = selected_helper(etl::conv4_impl::STD, (etl::conv_4d_valid_flipped<1, 1, 1, 1>(I, K)));
+    c   = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid_flipped<1, 1, 1, 1>(I, K)));
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+// The transformed kernels must not be reused once the kernels have changed
+
+TEMPLATE_TEST_CASE_2("conv/winograd/conv4/3", "[conv][conv4][winograd]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> I(2, 3, 9, 9);
+    etl::dyn_matrix<Z, 4> K(4, 3, 3, 3);
+
+    etl::dyn_matrix<Z, 4> ref(2, 4, 7, 7);
+    etl::dyn_matrix<Z, 4> c(2, 4, 7, 7);
+
+    I = etl::sequence_generator(1.0) * 0.02;
+    K = etl::sequence_generator(1.0) * 0.1;
+
+    c = selected_helper(etl::conv4_impl::WINOGRAD, etl::conv_4d_valid(I, K));
+
+    K(1, 2, 1, 1) = 7.0;
+
+    ref = selected_helper(etl::conv4_impl::STD, etl::conv_4d_valid(I, K));
+    c   = selected_helper(etl::conv4_impl::WINOGRAD, etl::conv_4d_valid(I, K));
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+// Enough channels and kernels to select Winograd by default
+
+TEMPLATE_TEST_CASE_2("conv/winograd/conv4/4", "[conv][conv4][winograd]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> I(2, 8, 10, 10);
+    etl::dyn_matrix<Z, 4> K(4, 8, 3, 3);
+
+    etl::dyn_matrix<Z, 4> ref(2, 4, 8, 8);
+    etl::dyn_matrix<Z, 4> c(2, 4, 8, 8);
+
+    I = etl::sequence_generator(1.0) * 0.001;
+    K = etl::sequence_generator(1.0) * 0.01;
+
+    ref = selected_helper(etl::conv4_impl::STD, etl::conv_4d_valid_flipped(I, K));
+    c   = etl::conv_4d_valid_flipped(I, K);
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv/winograd/multi/1", "[conv][conv2][winograd]", Z, float, double) {
+    etl::fast_matrix<Z, 13, 10> I(etl::sequence_generator(1.0) * 0.1);
+    etl::fast_matrix<Z, 3, 3, 3> K(etl::sequence_generator(0.5) * 0.2);
+
+    etl::fast_matrix<Z, 3, 11, 8> ref;
+    etl::fast_matrix<Z, 3, 11, 8> c;
+
+    ref = selected_helper(etl::conv_multi_impl::STD, etl::conv_2d_valid_multi(I, K));
+    c   = selected_helper(etl::conv_multi_impl::WINOGRAD, etl::conv_2d_valid_multi(I, K));
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+
+    ref = selected_helper(etl::conv_multi_impl::STD, etl::conv_2d_valid_multi_flipped(I, K));
+    c   = selected_helper(etl::conv_multi_impl::WINOGRAD, etl::conv_2d_valid_multi_flipped(I, K));
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv/winograd/multi_multi/1", "[conv][conv2][winograd]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 7, 6> I(etl::sequence_generator(1.0) * 0.1);
+    etl::fast_matrix<Z, 4, 3, 3> K(etl::sequence_generator(0.5) * 0.2);
+
+    etl::fast_matrix<Z, 4, 3, 5, 4> ref;
+    etl::fast_matrix<Z, 4, 3, 5, 4> c;
+
+    ref = selected_helper(etl::conv_multi_impl::STD, etl::conv_2d_valid_multi_multi(I, K));
+    c   = selected_helper(etl::conv_multi_impl::WINOGRAD, etl::conv_2d_valid_multi_multi(I, K));
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+
+    ref = selected_helper(etl::conv_multi_impl::STD, etl::conv_2d_valid_multi_multi_flipped(I, K));
+    c   = selected_helper(etl::conv_multi_impl::WINOGRAD, etl::conv_2d_valid_multi_multi_flipped(I, K));
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv/winograd/select/1", "[conv][conv4][winograd]", Z, float, double) {
+    using I = etl::dyn_matrix<Z, 4>;
+
+    //Winograd is only used with enough channels and kernels
+    if (!etl::is_cudnn_enabled) {
+        REQUIRE_DIRECT((etl::detail::select_default_conv4_valid_impl<I, I, I>(true, etl::conv4_winograd_min_channels) == etl::conv4_impl::WINOGRAD));
+    }
+
+    REQUIRE_DIRECT((etl::detail::select_default_conv4_valid_impl<I, I, I>(true, 1) != etl::conv4_impl::WINOGRAD));
+    REQUIRE_DIRECT((etl::detail::select_default_conv4_valid_impl<I, I, I>(false, etl::conv4_winograd_min_channels) != etl::conv4_impl::WINOGRAD));
+
+    REQUIRE_DIRECT(etl::detail::winograd_conv(3, 3, 1, 1));
+    REQUIRE_DIRECT(!etl::detail::winograd_conv(3, 3, 2, 2));
+    REQUIRE_DIRECT(!etl::detail::winograd_conv(5, 5, 1, 1));
+}
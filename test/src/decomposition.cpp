@@ -113,3 +113,264 @@ TEMPLATE_TEST_CASE_2("globals/lu/2", "[globals][LU]", Z, float, double) {
     REQUIRE_EQUALS(P(3, 2), 0.0);
     REQUIRE_EQUALS(P(3, 3), 1.0);
 }
+
+TEMPLATE_TEST_CASE_2("globals/lu/3", "[globals][LU]", Z, float, double) {
+    etl::dyn_matrix<Z> A(150, 150);
+    etl::dyn_matrix<Z> L(150, 150);
+    etl::dyn_matrix<Z> U(150, 150);
+    etl::dyn_matrix<Z> P(150, 150);
+
+    A = etl::uniform_generator(-1.0, 1.0);
+
+    REQUIRE_DIRECT(etl::lu(A, L, U, P));
+
+    etl::dyn_matrix<Z> PA(P * A);
+    etl::dyn_matrix<Z> LU(L * U);
+
+    for (std::size_t i = 0; i < etl::size(A); ++i) {
+        REQUIRE_EQUALS_APPROX_E(PA[i], LU[i], base_eps * 100);
+    }
+
+    for (std::size_t i = 0; i < 150; ++i) {
+        REQUIRE_EQUALS(L(i, i), Z(1.0));
+
+        for (std::size_t j = i + 1; j < 150; ++j) {
+            REQUIRE_EQUALS(L(i, j), Z(0.0));
+            REQUIRE_EQUALS(U(j, i), Z(0.0));
+            REQUIRE_DIRECT(std::abs(L(j, i)) <= Z(1.0));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("globals/lu_factor/1", "[globals][LU]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> A{1, 3, 5, 2, 4, 7, 1, 1, 0};
+    etl::fast_matrix<Z, 3, 3> LU;
+    std::vector<std::size_t> perm;
+
+    REQUIRE_DIRECT(etl::lu_factor(A, LU, perm));
+
+    REQUIRE_EQUALS(perm[0], 1UL);
+    REQUIRE_EQUALS(perm[1], 0UL);
+    REQUIRE_EQUALS(perm[2], 2UL);
+
+    REQUIRE_EQUALS(LU(0, 0), 2.0);
+    REQUIRE_EQUALS(LU(0, 1), 4.0);
+    REQUIRE_EQUALS(LU(0, 2), 7.0);
+    REQUIRE_EQUALS(LU(1, 0), 0.5);
+    REQUIRE_EQUALS(LU(1, 1), 1.0);
+    REQUIRE_EQUALS(LU(1, 2), 1.5);
+    REQUIRE_EQUALS(LU(2, 0), 0.5);
+    REQUIRE_EQUALS(LU(2, 1), -1.0);
+    REQUIRE_EQUALS(LU(2, 2), -2.0);
+
+    etl::fast_vector<Z, 3> b{9.0, 13.0, 2.0};
+
+    etl::lu_solve(LU, perm, b);
+
+    REQUIRE_EQUALS_APPROX(b[0], 1.0);
+    REQUIRE_EQUALS_APPROX(b[1], 1.0);
+    REQUIRE_EQUALS_APPROX(b[2], 1.0);
+}
+
+TEMPLATE_TEST_CASE_2("globals/lu_factor/2", "[globals][LU]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 2> A{1, 2, 2, 4};
+    etl::fast_matrix<Z, 2, 2> LU;
+    std::vector<std::size_t> perm;
+
+    REQUIRE_DIRECT(!etl::lu_factor(A, LU, perm));
+}
+
+TEMPLATE_TEST_CASE_2("globals/solve/1", "[globals][solve]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> A{2, 1, -1, -3, -1, 2, -2, 1, 2};
+    etl::fast_vector<Z, 3> b{8, -11, -3};
+
+    etl::fast_vector<Z, 3> x = etl::solve(A, b);
+
+    REQUIRE_EQUALS_APPROX(x[0], 2.0);
+    REQUIRE_EQUALS_APPROX(x[1], 3.0);
+    REQUIRE_EQUALS_APPROX(x[2], -1.0);
+}
+
+TEMPLATE_TEST_CASE_2("globals/solve/2", "[globals][solve]", Z, float, double) {
+    etl::dyn_matrix<Z> A(200, 200);
+    etl::dyn_matrix<Z> X(200, 7);
+    etl::dyn_matrix<Z> X_cm(200, 7);
+
+    A = etl::uniform_generator(-1.0, 1.0);
+    X = etl::uniform_generator(-1.0, 1.0);
+
+    // Make the matrix well-conditioned
+    for (std::size_t i = 0; i < 200; ++i) {
+        A(i, i) += Z(10.0);
+    }
+
+    etl::dyn_matrix<Z> B(A * X);
+    etl::dyn_matrix_cm<Z> B_cm(200, 7);
+
+    B_cm = B;
+
+    auto Y    = etl::solve(A, B);
+    auto Y_cm = etl::solve(A, B_cm);
+
+    for (std::size_t i = 0; i < 200; ++i) {
+        for (std::size_t j = 0; j < 7; ++j) {
+            REQUIRE_EQUALS_APPROX_E(Y(i, j), X(i, j), base_eps * 100);
+            REQUIRE_EQUALS_APPROX_E(Y_cm(i, j), X(i, j), base_eps * 100);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("globals/cholesky/1", "[globals][cholesky]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> A{4, 12, -16, 12, 37, -43, -16, -43, 98};
+    etl::fast_matrix<Z, 3, 3> L;
+
+    REQUIRE_DIRECT(etl::cholesky(A, L));
+
+    REQUIRE_EQUALS_APPROX(L(0, 0), 2.0);
+    REQUIRE_EQUALS_APPROX(L(0, 1), 0.0);
+    REQUIRE_EQUALS_APPROX(L(0, 2), 0.0);
+    REQUIRE_EQUALS_APPROX(L(1, 0), 6.0);
+    REQUIRE_EQUALS_APPROX(L(1, 1), 1.0);
+    REQUIRE_EQUALS_APPROX(L(1, 2), 0.0);
+    REQUIRE_EQUALS_APPROX(L(2, 0), -8.0);
+    REQUIRE_EQUALS_APPROX(L(2, 1), 5.0);
+    REQUIRE_EQUALS_APPROX(L(2, 2), 3.0);
+}
+
+TEMPLATE_TEST_CASE_2("globals/cholesky/2", "[globals][cholesky]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 2> A{1, 2, 2, 1};
+    etl::fast_matrix<Z, 2, 2> L;
+
+    REQUIRE_DIRECT(!etl::cholesky(A, L));
+}
+
+TEMPLATE_TEST_CASE_2("globals/cholesky/3", "[globals][cholesky]", Z, float, double) {
+    etl::sym_matrix<etl::dyn_matrix<Z>> A(150UL);
+    etl::dyn_matrix<Z> L(150, 150);
+
+    for (std::size_t i = 0; i < 150; ++i) {
+        for (std::size_t j = 0; j < i; ++j) {
+            A(i, j) = Z((i * 7 + j * 13) % 11) * Z(0.1) - Z(0.5);
+        }
+
+        A(i, i) = Z(100.0);
+    }
+
+    REQUIRE_DIRECT(etl::cholesky(A, L));
+
+    etl::dyn_matrix<Z> LL(L * etl::transpose(L));
+
+    for (std::size_t i = 0; i < 150; ++i) {
+        for (std::size_t j = 0; j < 150; ++j) {
+            REQUIRE_EQUALS_APPROX_E(LL(i, j), A(i, j), base_eps * 10);
+
+            if (j > i) {
+                REQUIRE_EQUALS(L(i, j), Z(0.0));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("globals/qr/1", "[globals][qr]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> A{12, -51, 4, 6, 167, -68, -4, 24, -41};
+    etl::fast_matrix<Z, 3, 3> Q;
+    etl::fast_matrix<Z, 3, 3> R;
+
+    REQUIRE_DIRECT(etl::qr(A, Q, R));
+
+    REQUIRE_EQUALS_APPROX(R(0, 0), -14.0);
+    REQUIRE_EQUALS_APPROX(R(0, 1), -21.0);
+    REQUIRE_EQUALS_APPROX(R(0, 2), 14.0);
+    REQUIRE_EQUALS(R(1, 0), 0.0);
+    REQUIRE_EQUALS_APPROX(R(1, 1), -175.0);
+    REQUIRE_EQUALS_APPROX(R(1, 2), 70.0);
+    REQUIRE_EQUALS(R(2, 0), 0.0);
+    REQUIRE_EQUALS(R(2, 1), 0.0);
+    REQUIRE_EQUALS_APPROX(R(2, 2), -35.0);
+
+    REQUIRE_EQUALS_APPROX(Q(0, 0), -6.0 / 7.0);
+    REQUIRE_EQUALS_APPROX(Q(1, 0), -3.0 / 7.0);
+    REQUIRE_EQUALS_APPROX(Q(2, 0), 2.0 / 7.0);
+}
+
+TEMPLATE_TEST_CASE_2("globals/qr/2", "[globals][qr]", Z, float, double) {
+    etl::dyn_matrix<Z> A(157, 141);
+    etl::dyn_matrix<Z> Q(157, 157);
+    etl::dyn_matrix<Z> R(157, 141);
+
+    A = etl::uniform_generator(-1.0, 1.0);
+
+    REQUIRE_DIRECT(etl::qr(A, Q, R));
+
+    etl::dyn_matrix<Z> QR(Q * R);
+    etl::dyn_matrix<Z> QQ(etl::transpose(Q) * Q);
+
+    for (std::size_t i = 0; i < 157; ++i) {
+        for (std::size_t j = 0; j < 141; ++j) {
+            REQUIRE_EQUALS_APPROX_E(QR(i, j), A(i, j), base_eps * 10);
+
+            if (i > j) {
+                REQUIRE_EQUALS(R(i, j), Z(0.0));
+            }
+        }
+
+        for (std::size_t j = 0; j < 157; ++j) {
+            REQUIRE_EQUALS_APPROX_E(QQ(i, j), i == j ? Z(1.0) : Z(0.0), base_eps * 10);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("globals/qr/3", "[globals][qr]", Z, float, double) {
+    etl::dyn_matrix<Z> A(70, 150);
+    etl::dyn_matrix<Z> Q(70, 70);
+    etl::dyn_matrix<Z> R(70, 150);
+
+    A = etl::uniform_generator(-1.0, 1.0);
+
+    REQUIRE_DIRECT(etl::qr(A, Q, R));
+
+    etl::dyn_matrix<Z> QR(Q * R);
+
+    for (std::size_t i = 0; i < 70; ++i) {
+        for (std::size_t j = 0; j < 150; ++j) {
+            REQUIRE_EQUALS_APPROX_E(QR(i, j), A(i, j), base_eps * 10);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("globals/qr/4", "[globals][qr]", Z, float, double) {
+    etl::dyn_matrix<Z> A(300, 200);
+    etl::dyn_matrix<Z> Q(300, 300);
+    etl::dyn_matrix<Z> R(300, 200);
+    etl::dyn_matrix<Z> S(200, 200);
+    etl::dyn_matrix<Z> L(200, 200);
+
+    A = etl::uniform_generator(-1.0, 1.0);
+    S = etl::transpose(A) * A;
+
+    const auto threads = etl::parallel_threads();
+
+    etl::set_parallel_threads(3);
+
+    PARALLEL_SECTION {
+        REQUIRE_DIRECT(etl::qr(A, Q, R));
+        REQUIRE_DIRECT(etl::cholesky(S, L));
+    }
+
+    etl::set_parallel_threads(threads);
+
+    etl::dyn_matrix<Z> QR(Q * R);
+    etl::dyn_matrix<Z> LL(L * etl::transpose(L));
+
+    for (std::size_t i = 0; i < 300; ++i) {
+        for (std::size_t j = 0; j < 200; ++j) {
+            REQUIRE_EQUALS_APPROX_E(QR(i, j), A(i, j), base_eps * 10);
+        }
+    }
+
+    for (std::size_t i = 0; i < 200; ++i) {
+        for (std::size_t j = 0; j < 200; ++j) {
+            REQUIRE_EQUALS_APPROX_E(LL(i, j), S(i, j), base_eps * 10);
+        }
+    }
+}
@@ -504,3 +504,215 @@ TEMPLATE_TEST_CASE_2("fft_1d_many/6", "[fast][fft]", Z, float, double) {
         REQUIRE_EQUALS(c_1[i], c_2[i]);
     }
 }
+
+// FFT plans
+
+TEMPLATE_TEST_CASE_2("fft_plan/1", "[fast][fft]", Z, float, double) {
+    etl::dyn_vector<std::complex<Z>> a(45);
+    etl::dyn_vector<std::complex<Z>> c(45);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    etl::fft_plan<Z> plan(45);
+
+    REQUIRE_EQUALS(plan.size(), 45UL);
+    REQUIRE(plan.direction() == etl::fft_direction::FORWARD);
+
+    // The plan can be applied several times
+    for (std::size_t r = 0; r < 3; ++r) {
+        plan(a, c);
+
+        for (std::size_t k = 0; k < 45; ++k) {
+            std::complex<double> ref(0.0, 0.0);
+
+            for (std::size_t j = 0; j < 45; ++j) {
+                const double theta = -2.0 * M_PI * double((j * k) % 45) / 45.0;
+                ref += std::complex<double>(a[j].real(), a[j].imag()) * std::complex<double>(std::cos(theta), std::sin(theta));
+            }
+
+            REQUIRE_EQUALS_APPROX_E(c[k].real(), ref.real(), 1e-4);
+            REQUIRE_EQUALS_APPROX_E(c[k].imag(), ref.imag(), 1e-4);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("fft_plan/2", "[fast][fft]", Z, float, double) {
+    etl::fast_dyn_matrix<std::complex<Z>, 4, 64> a;
+    etl::fast_dyn_matrix<std::complex<Z>, 4, 64> b;
+    etl::fast_dyn_matrix<std::complex<Z>, 4, 64> c;
+
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    etl::fft_plan<Z> forward(64);
+    etl::fft_plan<Z> inverse(64, etl::fft_direction::INVERSE);
+
+    forward(a, b);
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        c(i) = etl::fft_1d(a(i));
+    }
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i].real(), c[i].real());
+        REQUIRE_EQUALS_APPROX(b[i].imag(), c[i].imag());
+    }
+
+    inverse(b, b);
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i].real(), a[i].real());
+        REQUIRE_EQUALS_APPROX(b[i].imag(), a[i].imag());
+    }
+}
+
+TEMPLATE_TEST_CASE_2("fft_plan/3", "[fast][fft]", Z, float, double) {
+    etl::dyn_vector<Z> a(77);
+    etl::dyn_vector<std::complex<Z>> b(77);
+    etl::dyn_vector<std::complex<Z>> c(77);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    auto plan = etl::get_fft_plan<Z>(77);
+
+    // The cache returns the same plan for the same transform
+    REQUIRE(plan == etl::get_fft_plan<Z>(77));
+    REQUIRE(plan != etl::get_fft_plan<Z>(77, etl::fft_direction::INVERSE));
+
+    plan->execute(a.memory_start(), b.memory_start());
+    etl::get_fft_plan<Z>(77, etl::fft_direction::INVERSE)->execute(b.memory_start(), c.memory_start());
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i].real(), a[i]);
+        REQUIRE_EQUALS_APPROX(c[i].imag(), Z(0));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("fft_plan/4", "[fast][fft]", Z, float, double) {
+    // All the stages of the power of two kernels, compared to a direct DFT
+    for (std::size_t n : {1UL, 2UL, 4UL, 8UL, 16UL, 32UL, 64UL, 128UL, 256UL, 512UL, 1024UL, 2048UL}) {
+        etl::dyn_vector<std::complex<Z>> a(n);
+        etl::dyn_vector<std::complex<Z>> b(n);
+        etl::dyn_vector<std::complex<Z>> c(n);
+
+        a = etl::uniform_generator(-1.0, 1.0);
+
+        etl::get_fft_plan<Z>(n)->execute(a.memory_start(), b.memory_start());
+
+        for (std::size_t k = 0; k < n; ++k) {
+            std::complex<double> ref(0.0, 0.0);
+
+            for (std::size_t j = 0; j < n; ++j) {
+                const double theta = -2.0 * M_PI * double((j * k) % n) / double(n);
+                ref += std::complex<double>(a[j].real(), a[j].imag()) * std::complex<double>(std::cos(theta), std::sin(theta));
+            }
+
+            REQUIRE_EQUALS_APPROX_E(b[k].real(), ref.real(), 1e-3);
+            REQUIRE_EQUALS_APPROX_E(b[k].imag(), ref.imag(), 1e-3);
+        }
+
+        etl::get_fft_plan<Z>(n, etl::fft_direction::INVERSE)->execute(b.memory_start(), c.memory_start());
+
+        for (std::size_t i = 0; i < n; ++i) {
+            REQUIRE_EQUALS_APPROX_E(c[i].real(), a[i].real(), 1e-4);
+            REQUIRE_EQUALS_APPROX_E(c[i].imag(), a[i].imag(), 1e-4);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("fft_plan/5", "[fast][fft]", Z, float, double) {
+    using fft_type = etl::impl::vec::pow2_fft<etl::impl::standard::detail::fft_vec, Z>;
+
+    // The four-step algorithm, forced for small sizes
+    for (std::size_t n : {1024UL, 2048UL, 8192UL, 32768UL}) {
+        etl::dyn_vector<etl::complex<Z>> a(n);
+        etl::dyn_vector<etl::complex<Z>> b(n);
+        etl::dyn_vector<etl::complex<Z>> c(n);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = etl::complex<Z>(Z(std::sin(0.37 * i)), Z(std::cos(0.11 * i)));
+        }
+
+        for (Z sign : {Z(-1), Z(1)}) {
+            fft_type four_step(n, sign, 0);
+            fft_type stockham(n, sign, n + 1);
+
+            std::vector<etl::complex<Z>> tmp(std::max(four_step.work_size(), stockham.work_size()));
+
+            four_step.execute(a.memory_start(), b.memory_start(), tmp.data());
+            stockham.execute(a.memory_start(), c.memory_start(), tmp.data());
+
+            for (std::size_t i = 0; i < n; ++i) {
+                REQUIRE_EQUALS_APPROX_E(b[i].real, c[i].real, 1e-3);
+                REQUIRE_EQUALS_APPROX_E(b[i].imag, c[i].imag, 1e-3);
+            }
+
+            // Inplace
+            std::copy_n(a.memory_start(), n, b.memory_start());
+            four_step.execute(b.memory_start(), b.memory_start(), tmp.data());
+
+            for (std::size_t i = 0; i < n; ++i) {
+                REQUIRE_EQUALS_APPROX_E(b[i].real, c[i].real, 1e-3);
+                REQUIRE_EQUALS_APPROX_E(b[i].imag, c[i].imag, 1e-3);
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("fft_plan/6", "[fast][fft]", Z, float, double) {
+    // Sizes with a large prime factor, computed with the algorithm of Bluestein
+    for (std::size_t n : {67UL, 134UL, 303UL, 1009UL, 4099UL}) {
+        etl::dyn_vector<std::complex<Z>> a(n);
+        etl::dyn_vector<std::complex<Z>> b(n);
+        etl::dyn_vector<std::complex<Z>> c(n);
+
+        a = etl::uniform_generator(-1.0, 1.0);
+
+        etl::get_fft_plan<Z>(n)->execute(a.memory_start(), b.memory_start());
+
+        for (std::size_t k = 0; k < n; ++k) {
+            std::complex<double> ref(0.0, 0.0);
+
+            for (std::size_t j = 0; j < n; ++j) {
+                const double theta = -2.0 * M_PI * double((j * k) % n) / double(n);
+                ref += std::complex<double>(a[j].real(), a[j].imag()) * std::complex<double>(std::cos(theta), std::sin(theta));
+            }
+
+            REQUIRE_EQUALS_APPROX_E(b[k].real(), ref.real(), 1e-3);
+            REQUIRE_EQUALS_APPROX_E(b[k].imag(), ref.imag(), 1e-3);
+        }
+
+        // Inplace
+        c = a;
+        etl::get_fft_plan<Z>(n)->execute(c.memory_start(), c.memory_start());
+
+        for (std::size_t i = 0; i < n; ++i) {
+            REQUIRE_EQUALS_APPROX_E(c[i].real(), b[i].real(), 1e-4);
+            REQUIRE_EQUALS_APPROX_E(c[i].imag(), b[i].imag(), 1e-4);
+        }
+
+        etl::get_fft_plan<Z>(n, etl::fft_direction::INVERSE)->execute(b.memory_start(), c.memory_start());
+
+        for (std::size_t i = 0; i < n; ++i) {
+            REQUIRE_EQUALS_APPROX_E(c[i].real(), a[i].real(), 1e-4);
+            REQUIRE_EQUALS_APPROX_E(c[i].imag(), a[i].imag(), 1e-4);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("fft_plan/7", "[fast][fft]", Z, float, double) {
+    // Large prime sizes, through the real transforms and the batches
+    for (std::size_t n : {10007UL, 2 * 8191UL}) {
+        etl::dyn_matrix<Z> a(3UL, n);
+        etl::dyn_matrix<std::complex<Z>> b(3UL, n / 2 + 1);
+        etl::dyn_matrix<Z> c(3UL, n);
+
+        a = etl::uniform_generator(-1.0, 1.0);
+
+        (*etl::get_rfft_plan<Z>(n))(a, b);
+        (*etl::get_rfft_plan<Z>(n, etl::fft_direction::INVERSE))(b, c);
+
+        for (std::size_t i = 0; i < etl::size(a); ++i) {
+            REQUIRE_EQUALS_APPROX_E(c[i], a[i], 1e-4);
+        }
+    }
+}
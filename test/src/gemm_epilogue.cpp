@@ -0,0 +1,122 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEMPLATE_TEST_CASE_2("gemm_epilogue/traits", "[gemm][epilogue]", Z, float, double) {
+    using M = etl::dyn_matrix<Z>;
+    using V = etl::dyn_vector<Z>;
+
+    M a;
+    M b;
+    M c;
+    V x;
+    V y;
+
+    REQUIRE_DIRECT((etl::detail::is_gemm_epilogue<decltype(etl::sigmoid(c + etl::mul(a, b))), M>::value) != etl::is_cublas_enabled);
+    REQUIRE_DIRECT((etl::detail::is_gemm_epilogue<decltype(Z(2) * etl::mul(a, b) + Z(3) * c), M>::value) != etl::is_cublas_enabled);
+    REQUIRE_DIRECT((etl::detail::is_gemm_epilogue<decltype(etl::tanh(y + etl::mul(a, x))), V>::value) != etl::is_cublas_enabled);
+
+    // Nothing to fuse
+    REQUIRE_DIRECT(!(etl::detail::is_gemm_epilogue<decltype(etl::mul(a, b)), M>::value));
+
+    // Two multiplications
+    REQUIRE_DIRECT(!(etl::detail::is_gemm_epilogue<decltype(etl::mul(a, b) + etl::mul(b, a)), M>::value));
+
+    // The operands need to be evaluated first
+    REQUIRE_DIRECT(!(etl::detail::is_gemm_epilogue<decltype(c + etl::mul(a + b, b)), M>::value));
+}
+
+TEMPLATE_TEST_CASE_2("gemm_epilogue/mm/1", "[gemm][epilogue]", Z, float, double) {
+    etl::dyn_matrix<Z> a(301, 67);
+    etl::dyn_matrix<Z> b(67, 259);
+    etl::dyn_matrix<Z> bias(301, 259);
+
+    a    = etl::sequence_generator(1.0) * 0.0001;
+    b    = etl::sequence_generator(-1.0) * 0.0002;
+    bias = etl::sequence_generator(0.5) * -0.00001;
+
+    etl::dyn_matrix<Z> t(301, 259);
+    etl::dyn_matrix<Z> ref(301, 259);
+    etl::dyn_matrix<Z> c(301, 259);
+
+    t   = etl::mul(a, b);
+    ref = etl::sigmoid(bias + t);
+
+    c = etl::sigmoid(bias + etl::mul(a, b));
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("gemm_epilogue/mm/2", "[gemm][epilogue]", Z, float, double) {
+    etl::dyn_matrix<Z> a(257, 31);
+    etl::dyn_matrix<Z> b(31, 513);
+    etl::dyn_matrix<Z> c(257, 513);
+
+    a = etl::sequence_generator(1.0) * 0.001;
+    b = etl::sequence_generator(1.0) * -0.0001;
+    c = etl::sequence_generator(2.0) * 0.01;
+
+    etl::dyn_matrix<Z> t(257, 513);
+    etl::dyn_matrix<Z> ref(257, 513);
+
+    t   = etl::mul(a, b);
+    ref = Z(0.5) * t + Z(2) * c;
+
+    // The result is also an operand of the elementwise operations
+    c = Z(0.5) * etl::mul(a, b) + Z(2) * c;
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("gemm_epilogue/mm/3", "[gemm][epilogue]", Z, float, double) {
+    etl::dyn_matrix<Z> a(300, 300);
+    etl::dyn_matrix<Z> b(300, 300);
+
+    a = etl::sequence_generator(1.0) * 0.00001;
+    b = etl::sequence_generator(1.0) * -0.00002;
+
+    etl::dyn_matrix<Z> t(300, 300);
+    etl::dyn_matrix<Z> ref(300, 300);
+
+    t   = etl::mul(a, b);
+    ref = etl::tanh(t);
+
+    // The result is an operand of the multiplication
+    a = etl::tanh(etl::mul(a, b));
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(a[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("gemm_epilogue/mv/1", "[gemm][epilogue]", Z, float, double) {
+    etl::dyn_matrix<Z> a(70001, 9);
+    etl::dyn_vector<Z> x(9);
+    etl::dyn_vector<Z> bias(70001);
+
+    a    = etl::sequence_generator(1.0) * 0.00001;
+    x    = etl::sequence_generator(-4.0) * 0.1;
+    bias = etl::sequence_generator(1.0) * 0.0001;
+
+    etl::dyn_vector<Z> t(70001);
+    etl::dyn_vector<Z> ref(70001);
+    etl::dyn_vector<Z> c(70001);
+
+    t   = etl::mul(a, x);
+    ref = etl::relu(bias + t);
+
+    c = etl::relu(bias + etl::mul(a, x));
+
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
@@ -549,3 +549,19 @@ ETL_TEST_CASE("globals/determinant/3", "[globals]") {
     REQUIRE_EQUALS_APPROX(determinant(a), 47.0);
     REQUIRE_EQUALS_APPROX(determinant(b), 45.5);
 }
+
+ETL_TEST_CASE("globals/determinant/4", "[globals]") {
+    etl::dyn_matrix<double> a(100, 100);
+
+    // Upper triangular matrix with the rows in reverse order
+    a = 0.0;
+
+    for (std::size_t i = 0; i < 100; ++i) {
+        for (std::size_t j = i; j < 100; ++j) {
+            a(99 - i, j) = i == j ? (i % 3 == 0 ? 0.5 : 2.0) : 0.25;
+        }
+    }
+
+    // 50 transpositions are needed to restore the triangular matrix
+    REQUIRE_EQUALS_APPROX(determinant(a), std::pow(0.5, 34) * std::pow(2.0, 66));
+}
@@ -121,3 +121,25 @@ ETL_TEST_CASE("inv/7", "[inv]") {
     REQUIRE_EQUALS_APPROX(c[7], 1.0);
     REQUIRE_EQUALS_APPROX(c[8], -1.33333);
 }
+
+TEMPLATE_TEST_CASE_2("inv/8", "[inv]", Z, float, double) {
+    etl::dyn_matrix<Z> a(130, 130);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    // Make the matrix well-conditioned
+    for (std::size_t i = 0; i < 130; ++i) {
+        a(i, i) += Z(10.0);
+    }
+
+    etl::dyn_matrix<Z> c(130, 130);
+    c = inv(a);
+
+    etl::dyn_matrix<Z> id(a * c);
+
+    for (std::size_t i = 0; i < 130; ++i) {
+        for (std::size_t j = 0; j < 130; ++j) {
+            REQUIRE_EQUALS_APPROX_E(id(i, j), i == j ? Z(1.0) : Z(0.0), base_eps * 10);
+        }
+    }
+}
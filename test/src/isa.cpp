@@ -0,0 +1,229 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEST_CASE("isa/cpu", "[isa]") {
+    // The host necessarily supports the instruction set the tests were compiled for
+    REQUIRE_DIRECT(etl::cpu_vector_mode() >= etl::vector_mode);
+    REQUIRE_DIRECT(etl::cpu_vector_mode() == etl::detect_cpu_vector_mode());
+
+    if (!etl::runtime_dispatch) {
+        REQUIRE_DIRECT(!etl::isa_dispatch());
+    }
+}
+
+TEMPLATE_TEST_CASE_2("isa/kernels/1", "[isa]", Z, float, double) {
+    etl::dyn_vector<Z> a(1033);
+    etl::dyn_vector<Z> b(1033);
+    etl::dyn_vector<Z> c(1033);
+
+    a = etl::sequence_generator<Z>(1.0);
+    b = 2.0;
+
+    REQUIRE_EQUALS_APPROX(etl::impl::isa::sum(a.memory_start(), 1033), Z(1033.0 * 1034.0 / 2.0));
+    REQUIRE_EQUALS_APPROX(etl::impl::isa::sum(a.memory_start() + 3, 7), Z(4 + 5 + 6 + 7 + 8 + 9 + 10));
+    REQUIRE_EQUALS_APPROX(etl::impl::isa::dot(a.memory_start(), b.memory_start(), 1033), Z(1033.0 * 1034.0));
+    REQUIRE_EQUALS(etl::impl::isa::sum(a.memory_start(), 0), Z(0));
+
+    etl::impl::isa::add(c.memory_start(), a.memory_start(), b.memory_start(), 1033);
+
+    for (std::size_t i = 0; i < 1033; ++i) {
+        REQUIRE_EQUALS(c[i], Z(i + 3));
+    }
+
+    etl::impl::isa::mul(c.memory_start(), c.memory_start(), b.memory_start(), 1033);
+
+    for (std::size_t i = 0; i < 1033; ++i) {
+        REQUIRE_EQUALS(c[i], Z(2 * (i + 3)));
+    }
+
+    etl::impl::isa::sub(c.memory_start(), c.memory_start(), a.memory_start(), 1033);
+    etl::impl::isa::div(c.memory_start(), c.memory_start(), b.memory_start(), 1033);
+
+    for (std::size_t i = 0; i < 1033; ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], Z(i + 5) / Z(2));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("isa/expr/1", "[isa]", Z, float, double) {
+    etl::dyn_matrix<Z> a(17, 31);
+    etl::dyn_matrix<Z> b(17, 31);
+    etl::dyn_matrix<Z> c(17, 31);
+
+    a = etl::sequence_generator<Z>(1.0);
+    b = 4.0;
+
+    c = a + b;
+    REQUIRE_EQUALS(c(0, 0), Z(5));
+    REQUIRE_EQUALS(c(16, 30), Z(17 * 31 + 4));
+
+    c = a - b;
+    REQUIRE_EQUALS(c(16, 30), Z(17 * 31 - 4));
+
+    c = a >> b;
+    REQUIRE_EQUALS(c(16, 30), Z(17 * 31 * 4));
+
+    c = a / b;
+    REQUIRE_EQUALS_APPROX(c(16, 30), Z(17 * 31) / Z(4));
+
+    c = b;
+    c += a;
+    c -= b;
+    c *= b;
+    c /= a;
+
+    REQUIRE_EQUALS_APPROX(etl::sum(c), Z(17 * 31 * 4));
+    REQUIRE_EQUALS_APPROX(etl::dot(a, b), Z(4.0 * (17 * 31) * (17 * 31 + 1) / 2.0));
+}
+
+TEMPLATE_TEST_CASE_2("isa/expr/2", "[isa]", Z, float, double) {
+    etl::dyn_matrix<Z> a(33, 67);
+    etl::dyn_matrix<Z> b(33, 67);
+    etl::dyn_matrix<Z> c(33, 67);
+
+    a = etl::sequence_generator<Z>(1.0) / Z(1000);
+    b = etl::sequence_generator<Z>(3.0) / Z(500);
+
+    c = (a >> b) + exp(a);
+
+    for (std::size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], a[i] * b[i] + std::exp(a[i]));
+    }
+
+    c += sqrt(b) - a;
+
+    for (std::size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], a[i] * b[i] + std::exp(a[i]) + std::sqrt(b[i]) - a[i]);
+    }
+
+    c /= log(b + Z(1));
+
+    for (std::size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], (a[i] * b[i] + std::exp(a[i]) + std::sqrt(b[i]) - a[i]) / std::log(b[i] + Z(1)));
+    }
+}
+
+#ifdef ETL_VECTORIZE_IMPL
+
+TEMPLATE_TEST_CASE_2("isa/gemm/1", "[isa]", Z, float, double) {
+    etl::dyn_matrix<Z> a(67, 35);
+    etl::dyn_matrix<Z> b(35, 49);
+    etl::dyn_matrix<Z> c(67, 49);
+    etl::dyn_matrix<Z> ref(67, 49);
+
+    a = etl::sequence_generator<Z>(1.0) / Z(1000);
+    b = etl::sequence_generator<Z>(-1.0) / Z(1000);
+
+    c   = selected_helper(etl::gemm_impl::VEC, a * b);
+    ref = selected_helper(etl::gemm_impl::STD, a * b);
+
+    for (std::size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("isa/gemv/1", "[isa]", Z, float, double) {
+    etl::dyn_matrix<Z> a(67, 35);
+    etl::dyn_vector<Z> b(35);
+    etl::dyn_vector<Z> c(67);
+    etl::dyn_vector<Z> ref(67);
+
+    a = etl::sequence_generator<Z>(1.0) / Z(1000);
+    b = etl::sequence_generator<Z>(-1.0) / Z(100);
+
+    c   = selected_helper(etl::gemm_impl::VEC, a * b);
+    ref = selected_helper(etl::gemm_impl::STD, a * b);
+
+    for (std::size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("isa/gevm/1", "[isa]", Z, float, double) {
+    etl::dyn_vector<Z> a(67);
+    etl::dyn_matrix<Z> b(67, 35);
+    etl::dyn_vector<Z> c(35);
+    etl::dyn_vector<Z> ref(35);
+
+    a = etl::sequence_generator<Z>(1.0) / Z(100);
+    b = etl::sequence_generator<Z>(-1.0) / Z(1000);
+
+    c   = selected_helper(etl::gemm_impl::VEC, a * b);
+    ref = selected_helper(etl::gemm_impl::STD, a * b);
+
+    for (std::size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("isa/conv/1", "[isa]", Z, float, double) {
+    etl::dyn_matrix<Z> a(29, 37);
+    etl::dyn_matrix<Z> b(5, 7);
+    etl::dyn_matrix<Z> c(25, 31);
+    etl::dyn_matrix<Z> ref(25, 31);
+
+    a = etl::sequence_generator<Z>(1.0) / Z(1000);
+    b = etl::sequence_generator<Z>(-1.0) / Z(10);
+
+    c   = selected_helper(etl::conv_impl::VEC, etl::conv_2d_valid_flipped(a, b));
+    ref = selected_helper(etl::conv_impl::STD, etl::conv_2d_valid_flipped(a, b));
+
+    for (std::size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+
+    etl::dyn_vector<Z> x(1031);
+    etl::dyn_vector<Z> k(13);
+    etl::dyn_vector<Z> y(1019);
+    etl::dyn_vector<Z> y_ref(1019);
+
+    x = etl::sequence_generator<Z>(1.0) / Z(1000);
+    k = etl::sequence_generator<Z>(-1.0) / Z(10);
+
+    y     = selected_helper(etl::conv_impl::VEC, etl::conv_1d_valid(x, k));
+    y_ref = selected_helper(etl::conv_impl::STD, etl::conv_1d_valid(x, k));
+
+    for (std::size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], y_ref[i]);
+    }
+}
+
+#endif
+
+TEMPLATE_TEST_CASE_2("isa/fft/1", "[isa]", Z, float, double) {
+    // The transforms of etl are compared to the kernels of the baseline
+    for (std::size_t n : {64UL, 1024UL, 97UL}) {
+        etl::dyn_vector<std::complex<Z>> a(n);
+        etl::dyn_vector<std::complex<Z>> b(n);
+        etl::dyn_vector<std::complex<Z>> c(n);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = std::complex<Z>(Z(std::sin(0.37 * i)), Z(std::cos(0.11 * i)));
+        }
+
+        b = etl::fft_1d(a);
+
+        auto* in  = reinterpret_cast<const etl::complex<Z>*>(a.memory_start());
+        auto* out = reinterpret_cast<etl::complex<Z>*>(c.memory_start());
+
+        if (n == 97) {
+            etl::impl::vec::bluestein_fft<etl::impl::standard::detail::fft_vec, Z> kernel(n, Z(-1));
+            std::vector<etl::complex<Z>> tmp(kernel.work_size());
+            kernel.execute(in, out, tmp.data());
+        } else {
+            etl::impl::vec::pow2_fft<etl::impl::standard::detail::fft_vec, Z> kernel(n, Z(-1));
+            std::vector<etl::complex<Z>> tmp(kernel.work_size());
+            kernel.execute(in, out, tmp.data());
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            REQUIRE_EQUALS_APPROX_E(b[i].real(), c[i].real(), 1e-3);
+            REQUIRE_EQUALS_APPROX_E(b[i].imag(), c[i].imag(), 1e-3);
+        }
+    }
+}
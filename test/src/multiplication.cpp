@@ -145,6 +145,135 @@ GEMM_TEST_CASE_PRE("multiplication/mm_mul_8", "[gemm]") {
     }
 }
 
+GEMM_TEST_CASE_PRE("multiplication/mm_mul_9", "[gemm]") {
+    etl::dyn_matrix<T> a(263, 263);
+    etl::dyn_matrix<T> b(263, 263);
+
+    etl::dyn_matrix<T> c(263, 263);
+    etl::dyn_matrix<T> c_ref(263, 263);
+
+    a = 0.01 * etl::sequence_generator(1.0);
+    b = -0.032 * etl::sequence_generator(1.0);
+
+    Impl::apply(a, b, c);
+
+    c_ref = 0;
+
+    for (std::size_t i = 0; i < 263; i++) {
+        for (std::size_t k = 0; k < 263; k++) {
+            for (std::size_t j = 0; j < 263; j++) {
+                c_ref(i, j) += a(i, k) * b(k, j);
+            }
+        }
+    }
+
+    for(size_t i = 0; i < etl::size(c); ++i){
+        REQUIRE_EQUALS_APPROX_E(c[i], c_ref[i], base_eps);
+    }
+}
+
+// Multiplication with transposed operands
+
+GEMM_TEST_CASE("multiplication/trans/1", "[gemm][trans]") {
+    etl::fast_matrix<T, 3, 2> a = {1, 2, 3, 4, 5, 6};
+    etl::fast_matrix<T, 3, 2> b = {7, 8, 9, 10, 11, 12};
+    etl::fast_matrix<T, 2, 2> c;
+
+    Impl::apply(etl::trans(a), b, c);
+
+    REQUIRE_EQUALS(c(0, 0), 89);
+    REQUIRE_EQUALS(c(0, 1), 98);
+    REQUIRE_EQUALS(c(1, 0), 116);
+    REQUIRE_EQUALS(c(1, 1), 128);
+
+    etl::fast_matrix<T, 3, 3> d;
+
+    Impl::apply(a, etl::trans(b), d);
+
+    REQUIRE_EQUALS(d(0, 0), 23);
+    REQUIRE_EQUALS(d(0, 1), 29);
+    REQUIRE_EQUALS(d(0, 2), 35);
+    REQUIRE_EQUALS(d(1, 0), 53);
+    REQUIRE_EQUALS(d(1, 1), 67);
+    REQUIRE_EQUALS(d(1, 2), 81);
+    REQUIRE_EQUALS(d(2, 0), 83);
+    REQUIRE_EQUALS(d(2, 1), 105);
+    REQUIRE_EQUALS(d(2, 2), 127);
+}
+
+GEMM_TEST_CASE_PRE("multiplication/trans/2", "[gemm][trans]") {
+    etl::dyn_matrix<T> a(131, 67);
+    etl::dyn_matrix<T> b(131, 157);
+
+    etl::dyn_matrix<T> c(67, 157);
+    etl::dyn_matrix<T> c_ref(67, 157);
+
+    a = 0.01 * etl::sequence_generator(1.0);
+    b = -0.032 * etl::sequence_generator(1.0);
+
+    Impl::apply(etl::trans(a), b, c);
+
+    c_ref = 0;
+
+    for (std::size_t i = 0; i < 67; i++) {
+        for (std::size_t k = 0; k < 131; k++) {
+            for (std::size_t j = 0; j < 157; j++) {
+                c_ref(i, j) += a(k, i) * b(k, j);
+            }
+        }
+    }
+
+    for(size_t i = 0; i < etl::size(c); ++i){
+        REQUIRE_EQUALS_APPROX_E(c[i], c_ref[i], base_eps);
+    }
+}
+
+GEMM_TEST_CASE_PRE("multiplication/trans/3", "[gemm][trans]") {
+    etl::dyn_matrix<T> a(67, 131);
+    etl::dyn_matrix<T> b(157, 131);
+
+    etl::dyn_matrix<T> c(67, 157);
+    etl::dyn_matrix<T> c_ref(67, 157);
+
+    a = 0.01 * etl::sequence_generator(1.0);
+    b = -0.032 * etl::sequence_generator(1.0);
+
+    Impl::apply(a, etl::trans(b), c);
+
+    c_ref = 0;
+
+    for (std::size_t i = 0; i < 67; i++) {
+        for (std::size_t k = 0; k < 131; k++) {
+            for (std::size_t j = 0; j < 157; j++) {
+                c_ref(i, j) += a(i, k) * b(j, k);
+            }
+        }
+    }
+
+    for(size_t i = 0; i < etl::size(c); ++i){
+        REQUIRE_EQUALS_APPROX_E(c[i], c_ref[i], base_eps);
+    }
+
+    // Both operands transposed, with a row major and a column major result
+
+    etl::dyn_matrix<T> b_t(131, 157);
+
+    b_t = etl::transpose(b);
+
+    etl::dyn_matrix<T> d(157, 67);
+    etl::dyn_matrix_cm<T> e(157, 67);
+
+    Impl::apply(etl::trans(b_t), etl::trans(a), d);
+    Impl::apply(etl::trans(b_t), etl::trans(a), e);
+
+    for (std::size_t i = 0; i < 157; i++) {
+        for (std::size_t j = 0; j < 67; j++) {
+            REQUIRE_EQUALS_APPROX_E(d(i, j), c_ref(j, i), base_eps);
+            REQUIRE_EQUALS_APPROX_E(e(i, j), c_ref(j, i), base_eps);
+        }
+    }
+}
+
 // Matrix-Vector Multiplication
 
 GEMV_TEST_CASE("multiplication/gemv/0", "[gemv]") {
@@ -266,6 +395,31 @@ GEMV_TEST_CASE("multiplication/gemv/6", "[gemv]") {
     }
 }
 
+GEMV_TEST_CASE("multiplication/gemv/trans/1", "[gemv][trans]") {
+    etl::dyn_matrix<T> a(512, 368);
+    etl::dyn_vector<T> b(512);
+
+    etl::dyn_vector<T> c(368);
+    etl::dyn_vector<T> c_ref(368);
+
+    a = 0.01 * etl::sequence_generator(1.0);
+    b = -0.032 * etl::sequence_generator(1.0);
+
+    Impl::apply(etl::trans(a), b, c);
+
+    c_ref = 0;
+
+    for (size_t i = 0; i < 368; i++) {
+        for (size_t k = 0; k < 512; k++) {
+            c_ref(i) += a(k, i) * b(k);
+        }
+    }
+
+    for(size_t i = 0; i < etl::size(c); ++i){
+        REQUIRE_EQUALS_APPROX(c[i], c_ref[i]);
+    }
+}
+
 // Vector-Matrix Multiplication
 
 GEVM_TEST_CASE("multiplication/gevm/0", "[gevm]") {
@@ -365,6 +519,31 @@ GEVM_TEST_CASE("multiplication/gevm/4", "[gevm]") {
     }
 }
 
+GEVM_TEST_CASE("multiplication/gevm/trans/1", "[gevm][trans]") {
+    etl::dyn_matrix<T> a(512, 368);
+    etl::dyn_vector<T> b(368);
+
+    etl::dyn_vector<T> c(512);
+    etl::dyn_vector<T> c_ref(512);
+
+    a = 0.01 * etl::sequence_generator(1.0);
+    b = -0.032 * etl::sequence_generator(1.0);
+
+    Impl::apply(b, etl::trans(a), c);
+
+    c_ref = 0;
+
+    for (size_t k = 0; k < 368; k++) {
+        for (size_t j = 0; j < 512; j++) {
+            c_ref(j) += b(k) * a(j, k);
+        }
+    }
+
+    for(size_t i = 0; i < etl::size(c); ++i){
+        REQUIRE_EQUALS_APPROX(c[i], c_ref[i]);
+    }
+}
+
 //Test using expressions directly
 TEMPLATE_TEST_CASE_2("multiplication/expression", "[gemm]", Z, double, float) {
     etl::fast_matrix<Z, 3, 3> a = {1, 2, 3, 4, 5, 6, 7, 8, 9};
@@ -97,3 +97,128 @@ TEMPLATE_TEST_CASE_2("parallel_section/3", "[fast][parallel]", Z, float, double)
 
     REQUIRE_DIRECT(!etl::local_context().parallel);
 }
+
+TEST_CASE("thread_pool/1", "[parallel]") {
+    auto old_threads = etl::parallel_threads();
+
+    etl::set_parallel_threads(4);
+
+    REQUIRE_EQUALS(etl::parallel_threads(), 4UL);
+
+    std::vector<std::atomic<int>> counts(1013);
+
+    for (auto& count : counts) {
+        count = 0;
+    }
+
+    std::atomic<std::size_t> chunks(0);
+
+    etl::thread_pool::instance().parallel_for(0, counts.size(), 7, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            ++counts[i];
+        }
+
+        ++chunks;
+    });
+
+    for (auto& count : counts) {
+        REQUIRE_EQUALS(count.load(), 1);
+    }
+
+    REQUIRE_EQUALS(chunks.load(), (1013UL + 6UL) / 7UL);
+
+    etl::set_parallel_threads(old_threads);
+}
+
+TEST_CASE("thread_pool/2", "[parallel]") {
+    auto old_threads = etl::parallel_threads();
+
+    etl::set_parallel_threads(3);
+
+    std::atomic<std::size_t> sum(0);
+
+    // Nested parallel loops must not deadlock
+
+    etl::dispatch_1d(true, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            etl::dispatch_1d(true, [&](std::size_t f, std::size_t l) {
+                for (std::size_t j = f; j < l; ++j) {
+                    sum += i * 100 + j;
+                }
+            }, 0, 100);
+        }
+    }, 0, 50);
+
+    std::size_t expected = 0;
+    for (std::size_t i = 0; i < 50; ++i) {
+        for (std::size_t j = 0; j < 100; ++j) {
+            expected += i * 100 + j;
+        }
+    }
+
+    REQUIRE_EQUALS(sum.load(), expected);
+
+    etl::set_parallel_threads(old_threads);
+}
+
+TEST_CASE("thread_pool/3", "[parallel]") {
+    auto old_threads = etl::parallel_threads();
+
+    etl::set_parallel_threads(4);
+
+    // Several application threads share the pool
+
+    std::vector<std::size_t> sums(4, 0);
+    std::vector<std::thread> threads;
+
+    for (std::size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&sums, t] {
+            for (std::size_t r = 0; r < 20; ++r) {
+                etl::dispatch_1d_acc<std::size_t>(true, [](std::size_t first, std::size_t last) {
+                    std::size_t acc = 0;
+                    for (std::size_t i = first; i < last; ++i) {
+                        acc += i;
+                    }
+                    return acc;
+                }, [&sums, t](std::size_t value) { sums[t] += value; }, 0, 1000);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (std::size_t t = 0; t < 4; ++t) {
+        REQUIRE_EQUALS(sums[t], 20UL * 999UL * 1000UL / 2UL);
+    }
+
+    etl::set_parallel_threads(old_threads);
+}
+
+TEST_CASE("thread_pool/4", "[parallel]") {
+    auto old_threads = etl::parallel_threads();
+
+    etl::set_parallel_threads(4);
+
+    bool thrown = false;
+
+    try {
+        etl::dispatch_1d(true, [](std::size_t first, std::size_t last) {
+            if (first <= 500 && 500 < last) {
+                throw std::runtime_error("error");
+            }
+        }, 0, 1000);
+    } catch (const std::runtime_error& e) {
+        thrown = true;
+    }
+
+    REQUIRE_DIRECT(thrown);
+
+    etl::set_parallel_threads(1);
+
+    REQUIRE_EQUALS(etl::parallel_threads(), 1UL);
+    REQUIRE_DIRECT(!etl::select_parallel(1000000, 1));
+
+    etl::set_parallel_threads(old_threads);
+}
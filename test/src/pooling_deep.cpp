@@ -160,3 +160,74 @@ TEMPLATE_TEST_CASE_2("pooling/deep/avg3/1", "[pooling]", Z, float, double) {
     REQUIRE_EQUALS(b(1, 1, 1, 0), 0.875);
     REQUIRE_EQUALS(b(1, 1, 1, 1), 1.0);
 }
+
+TEMPLATE_TEST_CASE_2("pooling/deep/max2/parallel", "[pooling][parallel]", Z, float, double) {
+    auto old_threads = etl::parallel_threads();
+
+    etl::set_parallel_threads(4);
+
+    etl::fast_matrix<Z, 2, 4, 16, 16> a;
+    etl::fast_matrix<Z, 2, 4, 8, 8> b;
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z((i * 37) % 101) - Z(50);
+    }
+
+    PARALLEL_SECTION {
+        b = etl::max_pool_2d<2, 2>(a);
+    }
+
+    for (size_t n = 0; n < 2; ++n) {
+        for (size_t k = 0; k < 4; ++k) {
+            for (size_t i = 0; i < 8; ++i) {
+                for (size_t j = 0; j < 8; ++j) {
+                    auto max = a(n, k, 2 * i, 2 * j);
+                    max = std::max(max, a(n, k, 2 * i, 2 * j + 1));
+                    max = std::max(max, a(n, k, 2 * i + 1, 2 * j));
+                    max = std::max(max, a(n, k, 2 * i + 1, 2 * j + 1));
+
+                    REQUIRE_EQUALS(b(n, k, i, j), max);
+                }
+            }
+        }
+    }
+
+    etl::set_parallel_threads(old_threads);
+}
+
+TEMPLATE_TEST_CASE_2("pooling/deep/avg2/parallel", "[pooling][parallel]", Z, float, double) {
+    auto old_threads = etl::parallel_threads();
+
+    etl::set_parallel_threads(4);
+
+    etl::fast_matrix<Z, 3, 9, 9, 12> a;
+    etl::fast_matrix<Z, 3, 9, 3, 4> b;
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z((i * 13) % 17);
+    }
+
+    PARALLEL_SECTION {
+        b = etl::avg_pool_2d<3, 3>(a);
+    }
+
+    for (size_t n = 0; n < 3; ++n) {
+        for (size_t k = 0; k < 9; ++k) {
+            for (size_t i = 0; i < 3; ++i) {
+                for (size_t j = 0; j < 4; ++j) {
+                    Z avg = 0;
+
+                    for (size_t ii = 0; ii < 3; ++ii) {
+                        for (size_t jj = 0; jj < 3; ++jj) {
+                            avg += a(n, k, 3 * i + ii, 3 * j + jj);
+                        }
+                    }
+
+                    REQUIRE_EQUALS_APPROX(b(n, k, i, j), avg / Z(9));
+                }
+            }
+        }
+    }
+
+    etl::set_parallel_threads(old_threads);
+}
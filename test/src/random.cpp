@@ -0,0 +1,186 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test_light.hpp"
+
+TEST_CASE("random/philox", "[random]") {
+    uint32_t out[4];
+
+    etl::detail::philox4x32(0, 0, 0, out);
+
+    REQUIRE_EQUALS(out[0], 0x6627e8d5U);
+    REQUIRE_EQUALS(out[1], 0xe169c58dU);
+    REQUIRE_EQUALS(out[2], 0xbc57ac4cU);
+    REQUIRE_EQUALS(out[3], 0x9b00dbd8U);
+
+    uint32_t batch[16];
+
+    etl::detail::philox4x32_4(41, 0x123456789ULL, 3, batch);
+
+    for (std::size_t b = 0; b < 4; ++b) {
+        etl::detail::philox4x32(41 + b, 0x123456789ULL, 3, out);
+
+        for (std::size_t j = 0; j < 4; ++j) {
+            REQUIRE_EQUALS(batch[4 * b + j], out[j]);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("random/seed", "[random]", Z, float, double) {
+    etl::dyn_matrix<Z> a(17, 23);
+    etl::dyn_matrix<Z> b(17, 23);
+    etl::dyn_matrix<Z> c(17, 23);
+
+    etl::random_seed(42);
+    a = etl::normal_generator<Z>();
+    c = etl::bernoulli(a);
+
+    etl::random_seed(42);
+    b = etl::normal_generator<Z>();
+
+    REQUIRE_DIRECT(a == b);
+
+    b = etl::bernoulli(a);
+
+    REQUIRE_DIRECT(b == c);
+
+    b = etl::normal_generator<Z>();
+
+    REQUIRE_DIRECT(a != b);
+}
+
+TEMPLATE_TEST_CASE_2("random/normal_generator", "[random]", Z, float, double) {
+    etl::dyn_vector<Z> a(100003);
+
+    a = etl::normal_generator<Z>(1.0, 2.0);
+
+    REQUIRE_EQUALS_APPROX_E(etl::mean(a), Z(1.0), 0.05);
+    REQUIRE_EQUALS_APPROX_E(etl::stddev(a), Z(2.0), 0.05);
+}
+
+TEMPLATE_TEST_CASE_2("random/uniform_generator", "[random]", Z, float, double) {
+    etl::dyn_vector<Z> a(100003);
+
+    a = etl::uniform_generator<Z>(-1.0, 3.0);
+
+    for (auto value : a) {
+        REQUIRE_DIRECT(value >= -1.0);
+        REQUIRE_DIRECT(value <= 3.0);
+    }
+
+    REQUIRE_EQUALS_APPROX_E(etl::mean(a), Z(1.0), 0.05);
+}
+
+TEST_CASE("random/uniform_generator/int", "[random]") {
+    etl::dyn_vector<int> a(10007);
+
+    a = etl::uniform_generator<int>(-2, 2);
+
+    std::size_t counts[5] = {0, 0, 0, 0, 0};
+
+    for (auto value : a) {
+        REQUIRE_DIRECT(value >= -2);
+        REQUIRE_DIRECT(value <= 2);
+        ++counts[value + 2];
+    }
+
+    for (auto count : counts) {
+        REQUIRE_DIRECT(count > 1800);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("random/bernoulli", "[random]", Z, float, double) {
+    etl::dyn_vector<Z> a(100003);
+    etl::dyn_vector<Z> b(100003);
+
+    a = 0.3;
+
+    b = etl::bernoulli(a);
+
+    for (auto value : b) {
+        REQUIRE_DIRECT(value == Z(0.0) || value == Z(1.0));
+    }
+
+    REQUIRE_EQUALS_APPROX_E(etl::mean(b), Z(0.3), 0.05);
+
+    b = etl::r_bernoulli(a);
+
+    REQUIRE_EQUALS_APPROX_E(etl::mean(b), Z(0.7), 0.05);
+}
+
+TEMPLATE_TEST_CASE_2("random/noise", "[random]", Z, float, double) {
+    etl::dyn_vector<Z> a(100003);
+    etl::dyn_vector<Z> b(100003);
+
+    a = 2.0;
+
+    b = etl::uniform_noise(a);
+
+    REQUIRE_EQUALS_APPROX_E(etl::mean(b), Z(2.5), 0.05);
+
+    b = etl::normal_noise(a);
+
+    REQUIRE_EQUALS_APPROX_E(etl::mean(b), Z(2.0), 0.05);
+    REQUIRE_EQUALS_APPROX_E(etl::stddev(b), Z(1.0), 0.05);
+
+    b = etl::logistic_noise(a);
+
+    REQUIRE_EQUALS_APPROX_E(etl::mean(b), Z(2.0), 0.05);
+    REQUIRE_EQUALS_APPROX_E(etl::stddev(b), Z(etl::math::logistic_sigmoid(2.0)), 0.05);
+}
+
+// The values only depend on the index of the elements, not on the way the expression is evaluated
+
+TEMPLATE_TEST_CASE_2("random/index", "[random]", Z, float, double) {
+    etl::dyn_matrix<Z> a(13, 37);
+    etl::dyn_matrix<Z> b(13, 37);
+
+    a = etl::sequence_generator(-200.0) * 0.01;
+
+    auto expr = etl::normal_noise(a);
+
+    b = expr;
+
+    for (std::size_t i = 0; i < etl::dim<0>(b); ++i) {
+        for (std::size_t j = 0; j < etl::dim<1>(b); ++j) {
+            REQUIRE_EQUALS(b(i, j), expr(i, j));
+            REQUIRE_EQUALS(b(i, j), expr[i * etl::dim<1>(b) + j]);
+        }
+    }
+
+    auto gen = etl::normal_generator<Z>();
+
+    b = gen;
+
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS(b[i], gen[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("random/parallel", "[random][parallel]", Z, float, double) {
+    etl::dyn_vector<Z> a(10001);
+    etl::dyn_vector<Z> b(10001);
+    etl::dyn_vector<Z> c(10001);
+
+    a = etl::sequence_generator(-200.0) * 0.01;
+
+    auto expr = etl::normal_noise(a) + etl::bernoulli(a * 0.5) + etl::uniform_generator<Z>(0.0, 2.0);
+
+    b = expr;
+
+    const auto threads = etl::parallel_threads();
+
+    etl::set_parallel_threads(3);
+
+    PARALLEL_SECTION {
+        c = expr;
+    }
+
+    etl::set_parallel_threads(threads);
+
+    REQUIRE_DIRECT(b == c);
+}
@@ -266,3 +266,143 @@ TEMPLATE_TEST_CASE_2("sum_l/fast_matrix_6", "sum_l", Z, float, double) {
     REQUIRE_EQUALS_APPROX(b(3, 0), 45.0);
     REQUIRE_EQUALS_APPROX(b(3, 1), 48.0);
 }
+
+// Tests on large inputs, to go through the kernels
+
+TEMPLATE_TEST_CASE_2("sum_r/large", "sum_r", Z, float, double) {
+    etl::dyn_matrix<Z> a(97, 131);
+    etl::dyn_vector<Z> b(97);
+    etl::dyn_vector<Z> c(97);
+
+    a = etl::sequence_generator(-5000.0) * 0.5;
+
+    b = etl::sum_r(a);
+    c = etl::sum_r(a) * 2.0;
+
+    for (std::size_t i = 0; i < etl::dim<0>(a); ++i) {
+        Z sum = 0;
+        for (std::size_t j = 0; j < etl::dim<1>(a); ++j) {
+            sum += a(i, j);
+        }
+
+        REQUIRE_EQUALS(b(i), sum);
+        REQUIRE_EQUALS(c(i), Z(2) * sum);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("mean_r/large", "mean_r", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(67, 13, 11);
+    etl::dyn_vector<Z> b(67);
+
+    a = etl::sequence_generator(-5000.0) * 0.5;
+
+    b = etl::mean_r(a + a);
+
+    for (std::size_t i = 0; i < etl::dim<0>(a); ++i) {
+        REQUIRE_EQUALS_APPROX(b(i), Z(2) * etl::mean(a(i)));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sum_l/large", "sum_l", Z, float, double) {
+    etl::dyn_matrix<Z> a(131, 97);
+    etl::dyn_vector<Z> b(97);
+    etl::dyn_vector<Z> c(97);
+
+    a = etl::sequence_generator(-5000.0) * 0.5;
+
+    b = etl::sum_l(a);
+    c = etl::sum_l(a) + 1.0;
+
+    for (std::size_t j = 0; j < etl::dim<1>(a); ++j) {
+        Z sum = 0;
+        for (std::size_t i = 0; i < etl::dim<0>(a); ++i) {
+            sum += a(i, j);
+        }
+
+        REQUIRE_EQUALS(b(j), sum);
+        REQUIRE_EQUALS(c(j), sum + Z(1));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sum_l/large_3d", "sum_l", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(29, 7, 37);
+    etl::dyn_matrix<Z> b(7, 37);
+    etl::dyn_matrix<Z> c(7, 37);
+
+    a = etl::sequence_generator(-3000.0) * 0.5;
+
+    b = etl::sum_l(a * 2.0);
+    c = etl::sum_l(a * 2.0) - etl::sum_l(a);
+
+    for (std::size_t j = 0; j < etl::dim<1>(a); ++j) {
+        for (std::size_t k = 0; k < etl::dim<2>(a); ++k) {
+            Z sum = 0;
+            for (std::size_t i = 0; i < etl::dim<0>(a); ++i) {
+                sum += a(i, j, k);
+            }
+
+            REQUIRE_EQUALS(b(j, k), Z(2) * sum);
+            REQUIRE_EQUALS(c(j, k), sum);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("mean_l/large", "mean_l", Z, float, double) {
+    etl::dyn_matrix<Z> a(131, 97);
+    etl::dyn_vector<Z> b(97);
+    etl::dyn_vector<Z> c(97);
+
+    a = etl::sequence_generator(-5000.0) * 0.5;
+
+    b = etl::mean_l(a);
+    c = etl::mean_l(a) * 1.0;
+
+    for (std::size_t j = 0; j < etl::dim<1>(a); ++j) {
+        Z sum = 0;
+        for (std::size_t i = 0; i < etl::dim<0>(a); ++i) {
+            sum += a(i, j);
+        }
+
+        REQUIRE_EQUALS_APPROX(b(j), sum / Z(131));
+        REQUIRE_EQUALS(c(j), b(j));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sum_rl/parallel", "sum_r/sum_l", Z, float, double) {
+    etl::dyn_matrix<Z> a(301, 257);
+    etl::dyn_vector<Z> b_r(301);
+    etl::dyn_vector<Z> c_r(301);
+    etl::dyn_vector<Z> d_r(301);
+    etl::dyn_vector<Z> b_l(257);
+    etl::dyn_vector<Z> c_l(257);
+    etl::dyn_vector<Z> d_l(257);
+
+    // The sums are exact, whatever the order of the additions
+    a = etl::sequence_generator(-40000.0) * 0.0625;
+
+    SERIAL_SECTION {
+        b_r = etl::sum_r(a);
+        b_l = etl::sum_l(a);
+    }
+
+    SELECTED_SECTION(etl::sum_impl::STD) {
+        d_r = etl::sum_r(a);
+        d_l = etl::sum_l(a);
+    }
+
+    const auto threads = etl::parallel_threads();
+
+    etl::set_parallel_threads(3);
+
+    PARALLEL_SECTION {
+        c_r = etl::sum_r(a);
+        c_l = etl::sum_l(a);
+    }
+
+    etl::set_parallel_threads(threads);
+
+    REQUIRE_DIRECT(b_r == c_r);
+    REQUIRE_DIRECT(b_l == c_l);
+    REQUIRE_DIRECT(b_r == d_r);
+    REQUIRE_DIRECT(b_l == d_l);
+}
@@ -0,0 +1,204 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+// rfft_1d
+
+TEMPLATE_TEST_CASE_2("rfft_1d/1", "[fast][fft][rfft]", Z, float, double) {
+    etl::fast_vector<Z, 8> a{1.0, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0};
+    etl::fast_vector<std::complex<Z>, 5> c;
+
+    c = etl::rfft_1d(a);
+
+    REQUIRE_EQUALS_APPROX(c(0).real(), Z(4.0));
+    REQUIRE_EQUALS_APPROX(c(0).imag(), Z(0.0));
+    REQUIRE_EQUALS_APPROX(c(1).real(), Z(1.0));
+    REQUIRE_EQUALS_APPROX(c(1).imag(), Z(-2.41421));
+    REQUIRE_EQUALS_APPROX(c(2).real(), Z(0.0));
+    REQUIRE_EQUALS_APPROX(c(2).imag(), Z(0.0));
+    REQUIRE_EQUALS_APPROX(c(3).real(), Z(1.0));
+    REQUIRE_EQUALS_APPROX(c(3).imag(), Z(-0.41421));
+    REQUIRE_EQUALS_APPROX(c(4).real(), Z(0.0));
+    REQUIRE_EQUALS_APPROX(c(4).imag(), Z(0.0));
+}
+
+TEMPLATE_TEST_CASE_2("rfft_1d/2", "[fast][fft][rfft]", Z, float, double) {
+    etl::fast_vector<Z, 5> a{1.0, 2.0, 3.0, 4.0, 5.0};
+    etl::fast_vector<std::complex<Z>, 3> c;
+
+    etl::rfft_1d(a, c);
+
+    REQUIRE_EQUALS_APPROX(c(0).real(), Z(15.0));
+    REQUIRE_EQUALS_APPROX(c(0).imag(), Z(0.0));
+    REQUIRE_EQUALS_APPROX(c(1).real(), Z(-2.5));
+    REQUIRE_EQUALS_APPROX(c(1).imag(), Z(3.440955));
+    REQUIRE_EQUALS_APPROX(c(2).real(), Z(-2.5));
+    REQUIRE_EQUALS_APPROX(c(2).imag(), Z(0.8123));
+}
+
+TEMPLATE_TEST_CASE_2("rfft_1d/3", "[fast][fft][rfft]", Z, float, double) {
+    for (std::size_t n : {2UL, 6UL, 14UL, 64UL, 90UL, 1000UL, 1001UL}) {
+        etl::dyn_vector<Z> a(n);
+        etl::dyn_vector<std::complex<Z>> a_c(n);
+
+        a = etl::uniform_generator(-1.0, 1.0);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            a_c[i] = a[i];
+        }
+
+        etl::dyn_vector<std::complex<Z>> ref(etl::fft_1d(a_c));
+        etl::dyn_vector<std::complex<Z>> c(etl::rfft_1d(a));
+
+        REQUIRE_EQUALS(etl::size(c), n / 2 + 1);
+
+        for (std::size_t i = 0; i < etl::size(c); ++i) {
+            REQUIRE_EQUALS_APPROX_E(c[i].real(), ref[i].real(), 1e-3);
+            REQUIRE_EQUALS_APPROX_E(c[i].imag(), ref[i].imag(), 1e-3);
+        }
+
+        // The full FFT of real input is computed from the half spectrum
+        etl::dyn_vector<std::complex<Z>> full(etl::fft_1d(a));
+
+        for (std::size_t i = 0; i < n; ++i) {
+            REQUIRE_EQUALS_APPROX_E(full[i].real(), ref[i].real(), 1e-3);
+            REQUIRE_EQUALS_APPROX_E(full[i].imag(), ref[i].imag(), 1e-3);
+        }
+    }
+}
+
+// irfft_1d
+
+TEMPLATE_TEST_CASE_2("irfft_1d/1", "[fast][fft][rfft]", Z, float, double) {
+    etl::fast_vector<Z, 8> a{0.5, 1.5, 3.5, -1.5, 3.9, -5.5, 2.0, 1.0};
+    etl::fast_vector<Z, 8> c;
+
+    c = etl::irfft_1d(etl::rfft_1d(a));
+
+    for (std::size_t i = 0; i < 8; ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], a[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("irfft_1d/2", "[fast][fft][rfft]", Z, float, double) {
+    for (std::size_t n : {1UL, 7UL, 10UL, 128UL, 999UL, 1024UL}) {
+        etl::dyn_vector<Z> a(n);
+        etl::dyn_vector<std::complex<Z>> b(n / 2 + 1);
+        etl::dyn_vector<Z> c(n);
+
+        a = etl::uniform_generator(-1.0, 1.0);
+
+        etl::rfft_1d(a, b);
+        etl::irfft_1d(b, c);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            REQUIRE_EQUALS_APPROX_E(c[i], a[i], 1e-4);
+        }
+    }
+}
+
+// rfft_2d / irfft_2d
+
+TEMPLATE_TEST_CASE_2("rfft_2d/1", "[fast][fft][rfft]", Z, float, double) {
+    etl::fast_matrix<Z, 6, 10> a;
+    etl::fast_matrix<std::complex<Z>, 6, 10> a_c;
+
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    for (std::size_t i = 0; i < etl::size(a); ++i) {
+        a_c[i] = a[i];
+    }
+
+    etl::fast_matrix<std::complex<Z>, 6, 10> ref;
+    etl::fast_matrix<std::complex<Z>, 6, 6> c;
+
+    ref = etl::fft_2d(a_c);
+    c   = etl::rfft_2d(a);
+
+    for (std::size_t i = 0; i < 6; ++i) {
+        for (std::size_t j = 0; j < 6; ++j) {
+            REQUIRE_EQUALS_APPROX(c(i, j).real(), ref(i, j).real());
+            REQUIRE_EQUALS_APPROX(c(i, j).imag(), ref(i, j).imag());
+        }
+    }
+
+    etl::fast_matrix<Z, 6, 10> b;
+
+    b = etl::irfft_2d(c);
+
+    for (std::size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], a[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("rfft_2d/2", "[fast][fft][rfft]", Z, float, double) {
+    etl::dyn_matrix<Z> a(33, 15);
+    etl::dyn_matrix<std::complex<Z>> a_c(33, 15);
+    etl::dyn_matrix<std::complex<Z>> c(33, 8);
+    etl::dyn_matrix<Z> b(33, 15);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    for (std::size_t i = 0; i < etl::size(a); ++i) {
+        a_c[i] = a[i];
+    }
+
+    etl::dyn_matrix<std::complex<Z>> ref(etl::fft_2d(a_c));
+
+    etl::rfft_2d(a, c);
+
+    for (std::size_t i = 0; i < 33; ++i) {
+        for (std::size_t j = 0; j < 8; ++j) {
+            REQUIRE_EQUALS_APPROX_E(c(i, j).real(), ref(i, j).real(), 1e-3);
+            REQUIRE_EQUALS_APPROX_E(c(i, j).imag(), ref(i, j).imag(), 1e-3);
+        }
+    }
+
+    etl::irfft_2d(c, b);
+
+    for (std::size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX_E(b[i], a[i], 1e-4);
+    }
+}
+
+// rfft plans
+
+TEMPLATE_TEST_CASE_2("rfft_plan/1", "[fast][fft][rfft]", Z, float, double) {
+    etl::fast_dyn_matrix<Z, 5, 96> a;
+    etl::fast_dyn_matrix<std::complex<Z>, 5, 49> b;
+    etl::fast_dyn_matrix<Z, 5, 96> c;
+
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    auto forward = etl::get_rfft_plan<Z>(96);
+    auto inverse = etl::get_rfft_plan<Z>(96, etl::fft_direction::INVERSE);
+
+    // The cache returns the same plan for the same transform
+    REQUIRE(forward == etl::get_rfft_plan<Z>(96));
+    REQUIRE(forward != inverse);
+    REQUIRE_EQUALS(forward->spectrum_size(), 49UL);
+
+    (*forward)(a, b);
+
+    for (std::size_t i = 0; i < 5; ++i) {
+        etl::fast_dyn_matrix<std::complex<Z>, 49> ref;
+
+        ref = etl::rfft_1d(a(i));
+
+        for (std::size_t j = 0; j < 49; ++j) {
+            REQUIRE_EQUALS_APPROX(b(i, j).real(), ref(j).real());
+            REQUIRE_EQUALS_APPROX(b(i, j).imag(), ref(j).imag());
+        }
+    }
+
+    (*inverse)(b, c);
+
+    for (std::size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], a[i]);
+    }
+}
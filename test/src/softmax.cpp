@@ -0,0 +1,213 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEMPLATE_TEST_CASE_2("softmax/1", "[softmax]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> c(1037);
+
+    a = etl::sequence_generator(-3.0) * 0.01;
+
+    c = etl::softmax(a);
+
+    Z sum = 0;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        sum += std::exp(a[i]);
+    }
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], std::exp(a[i]) / sum);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("stable_softmax/1", "[softmax]", Z, float, double) {
+    etl::dyn_vector<Z> a(1043);
+    etl::dyn_vector<Z> c(1043);
+
+    // Far too large for the unstable version
+    a = etl::sequence_generator(0.0) * 0.01 + 1000.0;
+    a[517] = 1012.0;
+
+    c = etl::stable_softmax(a);
+
+    Z sum = 0;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        sum += std::exp(a[i] - Z(1012.0));
+    }
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], std::exp(a[i] - Z(1012.0)) / sum, base_eps * 10);
+    }
+
+    REQUIRE_EQUALS_APPROX(etl::sum(c), Z(1.0));
+}
+
+TEMPLATE_TEST_CASE_2("log_softmax/1", "[softmax]", Z, float, double) {
+    etl::dyn_vector<Z> a(1029);
+    etl::dyn_vector<Z> c(1029);
+
+    a = etl::sequence_generator(500.0) * -0.5;
+
+    c = etl::log_softmax(a);
+
+    Z sum = 0;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        sum += std::exp(a[i] - a[0]);
+    }
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], a[i] - a[0] - std::log(sum), base_eps * 10);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("softmax_jacobian_diag/1", "[softmax]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> c(1037);
+    etl::dyn_vector<Z> s(1037);
+
+    a = etl::sequence_generator(-3.0) * 0.01;
+    a[7] = 2.0;
+
+    c = etl::softmax_jacobian_diag(a);
+
+    SELECTED_SECTION(etl::softmax_impl::STD) {
+        s = etl::stable_softmax(a);
+    }
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], s[i] * (Z(1) - s[i]));
+    }
+
+    // The derivative is folded into the gradient of the cross-entropy
+    REQUIRE_EQUALS(etl::softmax_derivative(a), 1.0);
+}
+
+TEMPLATE_TEST_CASE_2("batch_softmax_jacobian_diag/1", "[softmax]", Z, float, double) {
+    etl::dyn_matrix<Z> a(5, 131);
+    etl::dyn_matrix<Z> b(5, 131);
+    etl::dyn_matrix<Z> c(5, 131);
+
+    a = etl::sequence_generator(-10.0) * 0.07;
+
+    SELECTED_SECTION(etl::softmax_impl::STD) {
+        b = etl::batch_softmax_jacobian_diag(a);
+    }
+
+    c = etl::batch_softmax_jacobian_diag(a);
+
+    for (std::size_t i = 0; i < etl::dim<0>(a); ++i) {
+        etl::dyn_vector<Z> s(etl::stable_softmax(a(i)));
+
+        for (std::size_t j = 0; j < etl::dim<1>(a); ++j) {
+            REQUIRE_EQUALS_APPROX(b(i, j), s[j] * (Z(1) - s[j]));
+            REQUIRE_EQUALS_APPROX(c(i, j), s[j] * (Z(1) - s[j]));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("softmax/alias", "[softmax]", Z, float, double) {
+    etl::dyn_matrix<Z> a(9, 13);
+    etl::dyn_matrix<Z> b(9, 13);
+
+    a = etl::sequence_generator(-5.0) * 0.1;
+
+    b = etl::stable_softmax(a);
+    a = etl::stable_softmax(a);
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(a[i], b[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_softmax/1", "[softmax]", Z, float, double) {
+    etl::dyn_matrix<Z> a(7, 131);
+    etl::dyn_matrix<Z> c(7, 131);
+
+    a = etl::sequence_generator(-20.0) * 0.03;
+
+    c = etl::batch_softmax(a);
+
+    for (std::size_t i = 0; i < etl::dim<0>(a); ++i) {
+        Z sum = 0;
+        for (std::size_t j = 0; j < etl::dim<1>(a); ++j) {
+            sum += std::exp(a(i, j));
+        }
+
+        for (std::size_t j = 0; j < etl::dim<1>(a); ++j) {
+            REQUIRE_EQUALS_APPROX(c(i, j), std::exp(a(i, j)) / sum);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_stable_softmax/1", "[softmax]", Z, float, double) {
+    etl::fast_matrix<Z, 5, 67> a;
+    etl::fast_matrix<Z, 5, 67> c;
+
+    a = etl::sequence_generator(100.0) * 1.7;
+
+    c = etl::batch_stable_softmax(a);
+
+    for (std::size_t i = 0; i < etl::dim<0>(a); ++i) {
+        auto m = etl::max(a(i));
+
+        Z sum = 0;
+        for (std::size_t j = 0; j < etl::dim<1>(a); ++j) {
+            sum += std::exp(a(i, j) - m);
+        }
+
+        for (std::size_t j = 0; j < etl::dim<1>(a); ++j) {
+            REQUIRE_EQUALS_APPROX(c(i, j), std::exp(a(i, j) - m) / sum);
+        }
+
+        REQUIRE_EQUALS_APPROX(etl::sum(c(i)), Z(1.0));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_log_softmax/1", "[softmax]", Z, float, double) {
+    etl::dyn_matrix<Z> a(6, 203);
+    etl::dyn_matrix<Z> c(6, 203);
+
+    a = etl::sequence_generator(3.0) * -0.7;
+
+    c = etl::batch_log_softmax(a + a);
+
+    for (std::size_t i = 0; i < etl::dim<0>(a); ++i) {
+        auto m = etl::max(a(i) + a(i));
+
+        Z sum = 0;
+        for (std::size_t j = 0; j < etl::dim<1>(a); ++j) {
+            sum += std::exp(Z(2) * a(i, j) - m);
+        }
+
+        for (std::size_t j = 0; j < etl::dim<1>(a); ++j) {
+            REQUIRE_EQUALS_APPROX_E(c(i, j), Z(2) * a(i, j) - m - std::log(sum), base_eps * 10);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_softmax/parallel", "[softmax]", Z, float, double) {
+    etl::dyn_matrix<Z> a(33, 2017);
+    etl::dyn_matrix<Z> b(33, 2017);
+    etl::dyn_matrix<Z> c(33, 2017);
+
+    a = etl::sequence_generator(-10.0) * 0.003;
+
+    SELECTED_SECTION(etl::softmax_impl::STD) {
+        b = etl::batch_stable_softmax(a);
+    }
+
+    etl::local_context().parallel = true;
+
+    c = etl::batch_stable_softmax(a);
+
+    etl::local_context().parallel = false;
+
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], b[i]);
+    }
+}
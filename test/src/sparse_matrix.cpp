@@ -304,3 +304,273 @@ TEMPLATE_TEST_CASE_2("sparse_matrix/div/1", "[mat][div][sparse]", Z, double, flo
     REQUIRE_EQUALS_APPROX(c.get(2, 0), Z(3.0));
     REQUIRE_EQUALS_APPROX(c.get(2, 1), Z(0.333333));
 }
+
+// Compressed storage (CSR and CSC)
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/csr/init/1", "[mat][init][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 4.0}));
+
+    REQUIRE_DIRECT(etl::is_sparse_matrix<decltype(a)>::value);
+    REQUIRE_DIRECT(etl::is_compressed_sparse_matrix<decltype(a)>::value);
+    REQUIRE_EQUALS(a.rows(), 3UL);
+    REQUIRE_EQUALS(a.columns(), 2UL);
+    REQUIRE_EQUALS(a.non_zeros(), 4UL);
+
+    REQUIRE_EQUALS(a.outer_index()[0], 0UL);
+    REQUIRE_EQUALS(a.outer_index()[1], 1UL);
+    REQUIRE_EQUALS(a.outer_index()[2], 2UL);
+    REQUIRE_EQUALS(a.outer_index()[3], 4UL);
+
+    REQUIRE_EQUALS(a.get(0, 0), Z(1.0));
+    REQUIRE_EQUALS(a.get(0, 1), Z(0.0));
+    REQUIRE_EQUALS(a.get(1, 0), Z(0.0));
+    REQUIRE_EQUALS(a.get(1, 1), Z(2.0));
+    REQUIRE_EQUALS(a.get(2, 0), Z(3.0));
+    REQUIRE_EQUALS(a.get(2, 1), Z(4.0));
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/csc/init/1", "[mat][init][sparse]", Z, double, float) {
+    etl::sparse_csc_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 4.0}));
+
+    REQUIRE_DIRECT(etl::is_compressed_sparse_matrix<decltype(a)>::value);
+    REQUIRE_EQUALS(a.rows(), 3UL);
+    REQUIRE_EQUALS(a.columns(), 2UL);
+    REQUIRE_EQUALS(a.non_zeros(), 4UL);
+
+    REQUIRE_EQUALS(a.outer_index()[0], 0UL);
+    REQUIRE_EQUALS(a.outer_index()[1], 2UL);
+    REQUIRE_EQUALS(a.outer_index()[2], 4UL);
+
+    REQUIRE_EQUALS(a.inner_index()[0], 0UL);
+    REQUIRE_EQUALS(a.inner_index()[1], 2UL);
+    REQUIRE_EQUALS(a.inner_index()[2], 1UL);
+    REQUIRE_EQUALS(a.inner_index()[3], 2UL);
+
+    REQUIRE_EQUALS(a.get(0, 0), Z(1.0));
+    REQUIRE_EQUALS(a.get(0, 1), Z(0.0));
+    REQUIRE_EQUALS(a.get(1, 0), Z(0.0));
+    REQUIRE_EQUALS(a.get(1, 1), Z(2.0));
+    REQUIRE_EQUALS(a.get(2, 0), Z(3.0));
+    REQUIRE_EQUALS(a.get(2, 1), Z(4.0));
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/csr/set/1", "[mat][set][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 3);
+
+    REQUIRE_EQUALS(a.non_zeros(), 0UL);
+
+    a.set(1, 1, 42);
+    a.set(2, 2, 2);
+    a.set(0, 0, 1);
+    a.set(1, 0, 3);
+    a(0, 2) = 5;
+
+    REQUIRE_EQUALS(a.get(0, 0), 1);
+    REQUIRE_EQUALS(a.get(0, 2), 5);
+    REQUIRE_EQUALS(a.get(1, 0), 3);
+    REQUIRE_EQUALS(a.get(1, 1), 42);
+    REQUIRE_EQUALS(a.get(2, 2), 2);
+    REQUIRE_EQUALS(a.get(2, 1), 0);
+    REQUIRE_EQUALS(a.non_zeros(), 5UL);
+
+    a.set(1, 1, 0.0);
+    a(0, 2) = 0.0;
+    a.erase(2, 2);
+    a.erase(2, 1);
+
+    REQUIRE_EQUALS(a.get(0, 0), 1);
+    REQUIRE_EQUALS(a.get(0, 2), 0);
+    REQUIRE_EQUALS(a.get(1, 0), 3);
+    REQUIRE_EQUALS(a.get(1, 1), 0);
+    REQUIRE_EQUALS(a.get(2, 2), 0);
+    REQUIRE_EQUALS(a.non_zeros(), 2UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/csc/set/1", "[mat][set][sparse]", Z, double, float) {
+    etl::sparse_csc_matrix<Z> a(3, 3);
+
+    a.set(1, 1, 42);
+    a.set(2, 2, 2);
+    a.set(0, 0, 1);
+    a.set(1, 0, 3);
+    a(0, 2) = 5;
+
+    REQUIRE_EQUALS(a.get(0, 0), 1);
+    REQUIRE_EQUALS(a.get(0, 2), 5);
+    REQUIRE_EQUALS(a.get(1, 0), 3);
+    REQUIRE_EQUALS(a.get(1, 1), 42);
+    REQUIRE_EQUALS(a.get(2, 2), 2);
+    REQUIRE_EQUALS(a.get(2, 1), 0);
+    REQUIRE_EQUALS(a.non_zeros(), 5UL);
+
+    a.set(1, 1, 0.0);
+    a(0, 2) = 0.0;
+    a.erase(2, 2);
+    a.erase(2, 1);
+
+    REQUIRE_EQUALS(a.get(0, 0), 1);
+    REQUIRE_EQUALS(a.get(0, 2), 0);
+    REQUIRE_EQUALS(a.get(1, 0), 3);
+    REQUIRE_EQUALS(a.get(1, 1), 0);
+    REQUIRE_EQUALS(a.get(2, 2), 0);
+    REQUIRE_EQUALS(a.non_zeros(), 2UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/csr/copy/1", "[mat][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 4.0}));
+    etl::sparse_csr_matrix<Z> b(a);
+
+    a.set(0, 0, 0.0);
+
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+    REQUIRE_EQUALS(b.non_zeros(), 4UL);
+    REQUIRE_EQUALS(b.get(0, 0), Z(1.0));
+    REQUIRE_EQUALS(b.get(2, 1), Z(4.0));
+
+    b = a;
+
+    REQUIRE_EQUALS(b.non_zeros(), 3UL);
+    REQUIRE_EQUALS(b.get(0, 0), Z(0.0));
+    REQUIRE_EQUALS(b.get(1, 1), Z(2.0));
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/csr/add/1", "[mat][add][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 0.0}));
+    etl::sparse_csr_matrix<Z> b(3, 2, std::initializer_list<Z>({2.0, 1.0, 0.0, 3.0, 0.0, 0.0}));
+    etl::sparse_csr_matrix<Z> c(3, 2);
+
+    c = a + b;
+
+    REQUIRE_EQUALS(c.get(0, 0), 3.0);
+    REQUIRE_EQUALS(c.get(0, 1), 1.0);
+    REQUIRE_EQUALS(c.get(1, 0), 0.0);
+    REQUIRE_EQUALS(c.get(1, 1), 5.0);
+    REQUIRE_EQUALS(c.get(2, 0), 3.0);
+    REQUIRE_EQUALS(c.get(2, 1), 0.0);
+    REQUIRE_EQUALS(c.non_zeros(), 4UL);
+}
+
+// Bulk insertion
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/reserve/1", "[mat][sparse]", Z, double, float) {
+    etl::sparse_matrix<Z> a(100, 50);
+
+    a.reserve(1000);
+
+    for (std::size_t i = 0; i < 100; ++i) {
+        for (std::size_t j = 0; j < 50; j += 5) {
+            a.set(99 - i, j, Z(i + j + 1));
+        }
+    }
+
+    REQUIRE_EQUALS(a.non_zeros(), 1000UL);
+
+    for (std::size_t i = 0; i < 100; ++i) {
+        for (std::size_t j = 0; j < 50; ++j) {
+            REQUIRE_EQUALS(a.get(99 - i, j), (j % 5 == 0 ? Z(i + j + 1) : Z(0)));
+        }
+    }
+
+    for (std::size_t i = 0; i < 100; i += 2) {
+        for (std::size_t j = 0; j < 50; j += 5) {
+            a.erase(i, j);
+        }
+    }
+
+    REQUIRE_EQUALS(a.non_zeros(), 500UL);
+
+    for (std::size_t i = 0; i < 100; ++i) {
+        for (std::size_t j = 0; j < 50; ++j) {
+            REQUIRE_EQUALS(a.get(99 - i, j), ((j % 5 == 0 && (99 - i) % 2 == 1) ? Z(i + j + 1) : Z(0)));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/copy/1", "[mat][sparse]", Z, double, float) {
+    etl::sparse_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 4.0}));
+    etl::sparse_matrix<Z> b(a);
+
+    a.set(0, 0, 0.0);
+
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+    REQUIRE_EQUALS(b.non_zeros(), 4UL);
+    REQUIRE_EQUALS(b.get(0, 0), Z(1.0));
+    REQUIRE_EQUALS(b.get(2, 1), Z(4.0));
+
+    b = a;
+
+    REQUIRE_EQUALS(b.non_zeros(), 3UL);
+    REQUIRE_EQUALS(b.get(0, 0), Z(0.0));
+    REQUIRE_EQUALS(b.get(1, 1), Z(2.0));
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/builder/1", "[mat][sparse]", Z, double, float) {
+    etl::sparse_builder<Z> builder(3, 4);
+
+    builder.add(2, 3, 1.0);
+    builder.add(0, 1, 2.0);
+    builder.add(1, 2, 3.0);
+    builder.add(0, 1, 1.5);
+    builder.add(2, 0, 4.0);
+    builder.add(1, 1, 0.0);
+    builder.add(1, 2, -3.0);
+
+    REQUIRE_EQUALS(builder.size(), 7UL);
+
+    auto a = builder.build();
+
+    REQUIRE_EQUALS(a.rows(), 3UL);
+    REQUIRE_EQUALS(a.columns(), 4UL);
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+
+    REQUIRE_EQUALS(a.get(0, 1), Z(3.5));
+    REQUIRE_EQUALS(a.get(1, 1), Z(0.0));
+    REQUIRE_EQUALS(a.get(1, 2), Z(0.0));
+    REQUIRE_EQUALS(a.get(2, 0), Z(4.0));
+    REQUIRE_EQUALS(a.get(2, 3), Z(1.0));
+
+    a.set(1, 0, 5.0);
+
+    REQUIRE_EQUALS(a.get(1, 0), Z(5.0));
+    REQUIRE_EQUALS(a.non_zeros(), 4UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/builder/2", "[mat][sparse]", Z, double, float) {
+    etl::dyn_matrix<Z> ref(17, 23);
+
+    etl::sparse_builder<Z> coo_builder(17, 23);
+    etl::sparse_builder<Z, etl::sparse_storage::CSR> csr_builder(17, 23);
+    etl::sparse_builder<Z, etl::sparse_storage::CSC> csc_builder(17, 23);
+
+    ref = 0;
+
+    for (std::size_t k = 0; k < 200; ++k) {
+        auto i = (k * 7) % 17;
+        auto j = (k * 13) % 23;
+
+        ref(i, j) += Z(k % 9) - Z(2);
+
+        coo_builder.add(i, j, Z(k % 9) - Z(2));
+        csr_builder.add(i, j, Z(k % 9) - Z(2));
+        csc_builder.add(i, j, Z(k % 9) - Z(2));
+    }
+
+    etl::sparse_matrix<Z> a(17, 23);
+    etl::sparse_csr_matrix<Z> b(17, 23);
+    etl::sparse_csc_matrix<Z> c(17, 23);
+
+    coo_builder.build(a);
+    csr_builder.build(b);
+    csc_builder.build(c);
+
+    for (std::size_t i = 0; i < 17; ++i) {
+        for (std::size_t j = 0; j < 23; ++j) {
+            REQUIRE_EQUALS(a.get(i, j), ref(i, j));
+            REQUIRE_EQUALS(b.get(i, j), ref(i, j));
+            REQUIRE_EQUALS(c.get(i, j), ref(i, j));
+        }
+    }
+
+    REQUIRE_EQUALS(a.non_zeros(), b.non_zeros());
+    REQUIRE_EQUALS(a.non_zeros(), c.non_zeros());
+}
@@ -0,0 +1,276 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+namespace {
+
+/*!
+ * \brief Fill a dense matrix with roughly one non-zero every five elements
+ */
+template <typename M>
+void sparse_fill(M& m) {
+    for (std::size_t i = 0; i < etl::size(m); ++i) {
+        m[i] = (i * 7) % 5 == 1 ? etl::value_t<M>(0.1) * etl::value_t<M>((i % 13) + 1) : etl::value_t<M>(0);
+    }
+}
+
+} // end of anonymous namespace
+
+TEMPLATE_TEST_CASE_2("sparse_mul/csr/mm/1", "[mul][sparse]", Z, double, float) {
+    etl::sparse_csr_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 1.0}));
+    etl::dyn_matrix<Z> b(2, 3, etl::values(1.0, 2.0, 3.0, 4.0, 5.0, 6.0));
+    etl::dyn_matrix<Z> c(3, 3);
+
+    c = a * b;
+
+    REQUIRE_EQUALS(c(0, 0), Z(1.0));
+    REQUIRE_EQUALS(c(0, 1), Z(2.0));
+    REQUIRE_EQUALS(c(0, 2), Z(3.0));
+    REQUIRE_EQUALS(c(1, 0), Z(8.0));
+    REQUIRE_EQUALS(c(1, 1), Z(10.0));
+    REQUIRE_EQUALS(c(1, 2), Z(12.0));
+    REQUIRE_EQUALS(c(2, 0), Z(7.0));
+    REQUIRE_EQUALS(c(2, 1), Z(11.0));
+    REQUIRE_EQUALS(c(2, 2), Z(15.0));
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/csc/mm/1", "[mul][sparse]", Z, double, float) {
+    etl::sparse_csc_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 1.0}));
+    etl::dyn_matrix<Z> b(2, 3, etl::values(1.0, 2.0, 3.0, 4.0, 5.0, 6.0));
+    etl::dyn_matrix<Z> c(3, 3);
+
+    c = a * b;
+
+    REQUIRE_EQUALS(c(0, 0), Z(1.0));
+    REQUIRE_EQUALS(c(0, 1), Z(2.0));
+    REQUIRE_EQUALS(c(0, 2), Z(3.0));
+    REQUIRE_EQUALS(c(1, 0), Z(8.0));
+    REQUIRE_EQUALS(c(1, 1), Z(10.0));
+    REQUIRE_EQUALS(c(1, 2), Z(12.0));
+    REQUIRE_EQUALS(c(2, 0), Z(7.0));
+    REQUIRE_EQUALS(c(2, 1), Z(11.0));
+    REQUIRE_EQUALS(c(2, 2), Z(15.0));
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/csr/mm/2", "[mul][sparse]", Z, double, float) {
+    etl::dyn_matrix<Z> ad(67, 45);
+    etl::dyn_matrix<Z> b(45, 39);
+    etl::dyn_matrix<Z> c(67, 39);
+    etl::dyn_matrix<Z> ref(67, 39);
+
+    sparse_fill(ad);
+    b = etl::sequence_generator(-1.0) * 0.01;
+
+    etl::sparse_csr_matrix<Z> a(67, 45);
+    a = ad;
+
+    c   = a * b;
+    ref = ad * b;
+
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/csc/mm/2", "[mul][sparse]", Z, double, float) {
+    etl::dyn_matrix<Z> ad(67, 45);
+    etl::dyn_matrix<Z> b(45, 39);
+    etl::dyn_matrix<Z> c(67, 39);
+    etl::dyn_matrix<Z> ref(67, 39);
+
+    sparse_fill(ad);
+    b = etl::sequence_generator(-1.0) * 0.01;
+
+    etl::sparse_csc_matrix<Z> a(67, 45);
+    a = ad;
+
+    c   = a * b;
+    ref = ad * b;
+
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/csr/mm/3", "[mul][sparse]", Z, double, float) {
+    etl::dyn_matrix<Z> a(31, 45);
+    etl::dyn_matrix<Z> bd(45, 39);
+    etl::dyn_matrix<Z> c(31, 39);
+    etl::dyn_matrix<Z> ref(31, 39);
+
+    a = etl::sequence_generator(-1.0) * 0.01;
+    sparse_fill(bd);
+
+    etl::sparse_csr_matrix<Z> b(45, 39);
+    b = bd;
+
+    c   = a * b;
+    ref = a * bd;
+
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/csc/mm/3", "[mul][sparse]", Z, double, float) {
+    etl::dyn_matrix<Z> a(31, 45);
+    etl::dyn_matrix<Z> bd(45, 39);
+    etl::dyn_matrix<Z> c(31, 39);
+    etl::dyn_matrix<Z> ref(31, 39);
+
+    a = etl::sequence_generator(-1.0) * 0.01;
+    sparse_fill(bd);
+
+    etl::sparse_csc_matrix<Z> b(45, 39);
+    b = bd;
+
+    c   = a * b;
+    ref = a * bd;
+
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/csr/mv/1", "[mul][sparse]", Z, double, float) {
+    etl::dyn_matrix<Z> ad(67, 45);
+    etl::dyn_vector<Z> b(45);
+    etl::dyn_vector<Z> c(67);
+    etl::dyn_vector<Z> ref(67);
+
+    sparse_fill(ad);
+    b = etl::sequence_generator(-1.0) * 0.1;
+
+    etl::sparse_csr_matrix<Z> a(67, 45);
+    a = ad;
+
+    c   = a * b;
+    ref = ad * b;
+
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/csc/mv/1", "[mul][sparse]", Z, double, float) {
+    etl::dyn_matrix<Z> ad(67, 45);
+    etl::dyn_vector<Z> b(45);
+    etl::dyn_vector<Z> c(67);
+    etl::dyn_vector<Z> ref(67);
+
+    sparse_fill(ad);
+    b = etl::sequence_generator(-1.0) * 0.1;
+
+    etl::sparse_csc_matrix<Z> a(67, 45);
+    a = ad;
+
+    c   = a * b;
+    ref = ad * b;
+
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/csr/vm/1", "[mul][sparse]", Z, double, float) {
+    etl::dyn_vector<Z> a(67);
+    etl::dyn_matrix<Z> bd(67, 45);
+    etl::dyn_vector<Z> c(45);
+    etl::dyn_vector<Z> ref(45);
+
+    a = etl::sequence_generator(-1.0) * 0.1;
+    sparse_fill(bd);
+
+    etl::sparse_csr_matrix<Z> b(67, 45);
+    b = bd;
+
+    c   = a * b;
+    ref = a * bd;
+
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/csc/vm/1", "[mul][sparse]", Z, double, float) {
+    etl::dyn_vector<Z> a(67);
+    etl::dyn_matrix<Z> bd(67, 45);
+    etl::dyn_vector<Z> c(45);
+    etl::dyn_vector<Z> ref(45);
+
+    a = etl::sequence_generator(-1.0) * 0.1;
+    sparse_fill(bd);
+
+    etl::sparse_csc_matrix<Z> b(67, 45);
+    b = bd;
+
+    c   = a * b;
+    ref = a * bd;
+
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/csc/mv/2", "[mul][sparse][parallel]", Z, double, float) {
+    etl::dyn_matrix<Z> ad(129, 203);
+    etl::dyn_vector<Z> b(203);
+    etl::dyn_vector<Z> c(129);
+    etl::dyn_vector<Z> ref(129);
+
+    sparse_fill(ad);
+    b = etl::sequence_generator(-1.0) * 0.01;
+
+    etl::sparse_csc_matrix<Z> a(129, 203);
+    a = ad;
+
+    const auto threads = etl::parallel_threads();
+
+    etl::set_parallel_threads(3);
+
+    PARALLEL_SECTION {
+        c = a * b;
+    }
+
+    etl::set_parallel_threads(threads);
+
+    ref = ad * b;
+
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/csr/vm/2", "[mul][sparse][parallel]", Z, double, float) {
+    etl::dyn_vector<Z> a(203);
+    etl::dyn_matrix<Z> bd(203, 129);
+    etl::dyn_vector<Z> c(129);
+    etl::dyn_vector<Z> ref(129);
+
+    a = etl::sequence_generator(-1.0) * 0.01;
+    sparse_fill(bd);
+
+    etl::sparse_csr_matrix<Z> b(203, 129);
+    b = bd;
+
+    const auto threads = etl::parallel_threads();
+
+    etl::set_parallel_threads(3);
+
+    PARALLEL_SECTION {
+        c = a * b;
+    }
+
+    etl::set_parallel_threads(threads);
+
+    ref = a * bd;
+
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
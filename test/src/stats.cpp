@@ -0,0 +1,173 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test_light.hpp"
+
+TEMPLATE_TEST_CASE_2("stats/fast_vector_1", "[stats]", Z, float, double) {
+    etl::fast_vector<Z, 8> a = {1.0, -2.0, 3.0, 9.0, 4.0, 9.0, -2.0, 2.0};
+
+    auto s = etl::stats(a);
+
+    REQUIRE_EQUALS(s.count, 8UL);
+    REQUIRE_EQUALS_APPROX(s.mean, Z(3.0));
+    REQUIRE_EQUALS_APPROX(s.variance(), Z(16.0));
+    REQUIRE_EQUALS_APPROX(s.stddev(), Z(4.0));
+    REQUIRE_EQUALS(s.min, Z(-2.0));
+    REQUIRE_EQUALS(s.max, Z(9.0));
+    REQUIRE_EQUALS(s.argmin, 1UL);
+    REQUIRE_EQUALS(s.argmax, 3UL);
+}
+
+TEMPLATE_TEST_CASE_2("stats/fast_matrix_1", "[stats]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 3> a = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+
+    REQUIRE_EQUALS_APPROX(etl::variance(a), Z(35.0 / 12.0));
+    REQUIRE_EQUALS_APPROX(etl::stddev(a), std::sqrt(Z(35.0 / 12.0)));
+    REQUIRE_EQUALS_APPROX(etl::variance(a * 2.0), Z(35.0 / 3.0));
+    REQUIRE_EQUALS(etl::argmin(a), 0UL);
+    REQUIRE_EQUALS(etl::argmax(a), 5UL);
+    REQUIRE_EQUALS(etl::argmin(-a), 5UL);
+    REQUIRE_EQUALS(etl::argmax(-a), 0UL);
+}
+
+TEMPLATE_TEST_CASE_2("stats/integers", "[stats]", Z, int, long) {
+    etl::dyn_vector<Z> a({5, 1, 4, 1, 9, 2, 9});
+
+    auto s = etl::stats(a);
+
+    REQUIRE_EQUALS(s.count, 7UL);
+    REQUIRE_EQUALS_APPROX(s.mean, 31.0 / 7.0);
+    REQUIRE_EQUALS(s.min, Z(1));
+    REQUIRE_EQUALS(s.max, Z(9));
+    REQUIRE_EQUALS(s.argmin, 1UL);
+    REQUIRE_EQUALS(s.argmax, 4UL);
+    REQUIRE_EQUALS(etl::max(a), Z(9));
+    REQUIRE_EQUALS(etl::min(a), Z(1));
+}
+
+TEMPLATE_TEST_CASE_2("stats/large", "[stats]", Z, float, double) {
+    etl::dyn_vector<Z> a(10001);
+
+    for (std::size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(1000.0) + Z((i * 37) % 101) * Z(0.25);
+    }
+
+    a[7777] = Z(-1.0);
+    a[7778] = Z(-1.0);
+    a[333]  = Z(2000.0);
+    a[9999] = Z(2000.0);
+
+    double mean = 0.0;
+    for (std::size_t i = 0; i < etl::size(a); ++i) {
+        mean += a[i];
+    }
+    mean /= etl::size(a);
+
+    double var = 0.0;
+    for (std::size_t i = 0; i < etl::size(a); ++i) {
+        var += (a[i] - mean) * (a[i] - mean);
+    }
+    var /= etl::size(a);
+
+    auto s = etl::stats(a);
+
+    REQUIRE_EQUALS(s.count, 10001UL);
+    REQUIRE_EQUALS_APPROX_E(s.mean, mean, 1e-3);
+    REQUIRE_EQUALS_APPROX_E(s.variance(), var, 1e-2);
+    REQUIRE_EQUALS(s.min, Z(-1.0));
+    REQUIRE_EQUALS(s.max, Z(2000.0));
+    REQUIRE_EQUALS(s.argmin, 7777UL);
+    REQUIRE_EQUALS(s.argmax, 333UL);
+
+    REQUIRE_EQUALS(etl::argmax(a + 1.0), 333UL);
+    REQUIRE_EQUALS(etl::argmin(a * 2.0), 7777UL);
+    REQUIRE_EQUALS(etl::max(a), Z(2000.0));
+    REQUIRE_EQUALS(etl::min(a), Z(-1.0));
+}
+
+TEMPLATE_TEST_CASE_2("stats/parallel", "[stats]", Z, float, double) {
+    etl::dyn_vector<Z> a(100003);
+
+    for (std::size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z((i * 7919) % 1009) * Z(0.5) - Z(200.0);
+    }
+
+    a[12345] = Z(-500.0);
+    a[99999] = Z(-500.0);
+    a[54321] = Z(600.0);
+
+    double mean = 0.0;
+    for (std::size_t i = 0; i < etl::size(a); ++i) {
+        mean += a[i];
+    }
+    mean /= etl::size(a);
+
+    double var = 0.0;
+    for (std::size_t i = 0; i < etl::size(a); ++i) {
+        var += (a[i] - mean) * (a[i] - mean);
+    }
+    var /= etl::size(a);
+
+    etl::statistics<Z> s;
+
+    SERIAL_SECTION {
+        SELECTED_SECTION(etl::sum_impl::STD) {
+            s = etl::stats(a);
+        }
+    }
+
+    etl::statistics<Z> p;
+
+    const auto threads = etl::parallel_threads();
+
+    etl::set_parallel_threads(3);
+
+    PARALLEL_SECTION {
+        p = etl::stats(a);
+    }
+
+    etl::set_parallel_threads(threads);
+
+    REQUIRE_EQUALS(s.count, 100003UL);
+    REQUIRE_EQUALS(p.count, 100003UL);
+    REQUIRE_EQUALS_APPROX_E(s.mean, mean, 1e-4);
+    REQUIRE_EQUALS_APPROX_E(p.mean, mean, 1e-4);
+    REQUIRE_EQUALS_APPROX_E(s.variance(), var, 1e-4);
+    REQUIRE_EQUALS_APPROX_E(p.variance(), var, 1e-4);
+    REQUIRE_EQUALS(p.min, Z(-500.0));
+    REQUIRE_EQUALS(p.max, Z(600.0));
+    REQUIRE_EQUALS(s.argmin, 12345UL);
+    REQUIRE_EQUALS(p.argmin, 12345UL);
+    REQUIRE_EQUALS(s.argmax, 54321UL);
+    REQUIRE_EQUALS(p.argmax, 54321UL);
+}
+
+TEMPLATE_TEST_CASE_2("stats/expression", "[stats]", Z, float, double) {
+    etl::dyn_vector<Z> a(10007);
+
+    for (std::size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(1.5) * std::sin(Z(0.37) * Z(i));
+    }
+
+    a[4321] = Z(1.7);
+    a[777]  = Z(-1.7);
+
+    // The extrema of the expressions must be found even if the vectorized
+    // and the scalar evaluations of the elements are not exactly the same
+
+    REQUIRE_EQUALS(etl::argmax(etl::exp(a)), 4321UL);
+    REQUIRE_EQUALS(etl::argmin(etl::exp(a)), 777UL);
+    REQUIRE_EQUALS(etl::argmax(etl::tanh(a)), 4321UL);
+    REQUIRE_EQUALS(etl::argmin(etl::tanh(a)), 777UL);
+    REQUIRE_EQUALS(etl::argmax(etl::sigmoid(a)), 4321UL);
+    REQUIRE_EQUALS(etl::argmin(etl::sigmoid(a)), 777UL);
+
+    REQUIRE_EQUALS_APPROX(etl::max(etl::exp(a)), std::exp(Z(1.7)));
+    REQUIRE_EQUALS_APPROX(etl::min(etl::exp(a)), std::exp(Z(-1.7)));
+    REQUIRE_EQUALS_APPROX(etl::max(etl::tanh(a)), std::tanh(Z(1.7)));
+    REQUIRE_EQUALS_APPROX(etl::min(etl::tanh(a)), std::tanh(Z(-1.7)));
+}
@@ -384,9 +384,11 @@ TEMPLATE_TEST_CASE_2("etl_traits/vectorizable", "vectorizable", Z, float, double
     REQUIRE_DIRECT(etl::etl_traits<decltype(a + b)>::template vectorizable<etl::vector_mode>::value);
     REQUIRE_DIRECT(etl::etl_traits<decltype(b + b)>::template vectorizable<etl::vector_mode>::value);
 
-    //abs do not have direct access
-    REQUIRE_DIRECT(!etl::etl_traits<decltype(abs(a))>::template vectorizable<etl::vector_mode>::value);
-    REQUIRE_DIRECT(!etl::etl_traits<decltype(abs(b))>::template vectorizable<etl::vector_mode>::value);
+    //abs is vectorizable as soon as there is a vector mode
+    constexpr bool vec_mode = etl::vector_mode != etl::vector_mode_t::NONE;
+
+    REQUIRE_DIRECT(etl::etl_traits<decltype(abs(a))>::template vectorizable<etl::vector_mode>::value == vec_mode);
+    REQUIRE_DIRECT(etl::etl_traits<decltype(abs(b))>::template vectorizable<etl::vector_mode>::value == vec_mode);
 }
 
 template <typename Z, typename E>
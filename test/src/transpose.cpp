@@ -170,6 +170,88 @@ TEMPLATE_TEST_CASE_2("transpose/dyn_matrix_5", "transpose", Z, float, double) {
     REQUIRE_EQUALS(a(4, 2), 15.0);
 }
 
+TEMPLATE_TEST_CASE_2("transpose/dyn_matrix_6", "transpose", Z, float, double) {
+    etl::dyn_matrix<Z> a(67, 93);
+    etl::dyn_matrix<Z> b(93, 67);
+
+    a = etl::sequence_generator(1.0);
+    b = transpose(a);
+
+    for (std::size_t i = 0; i < 67; ++i) {
+        for (std::size_t j = 0; j < 93; ++j) {
+            REQUIRE_EQUALS(b(j, i), a(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("transpose/dyn_matrix_7", "transpose", Z, float, double) {
+    etl::dyn_matrix_cm<Z> a(67, 93);
+    etl::dyn_matrix_cm<Z> b(93, 67);
+
+    a = etl::sequence_generator(1.0);
+    b = transpose(a);
+
+    for (std::size_t i = 0; i < 67; ++i) {
+        for (std::size_t j = 0; j < 93; ++j) {
+            REQUIRE_EQUALS(b(j, i), a(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("transpose/dyn_matrix_8", "transpose", Z, float, double) {
+    etl::dyn_matrix<Z> a(67, 67);
+    etl::dyn_matrix<Z> b(67, 67);
+
+    a = etl::sequence_generator(1.0);
+    b = a;
+
+    a.transpose_inplace();
+
+    for (std::size_t i = 0; i < 67; ++i) {
+        for (std::size_t j = 0; j < 67; ++j) {
+            REQUIRE_EQUALS(a(j, i), b(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("transpose/dyn_matrix_9", "transpose", Z, float, double) {
+    // gcd(48, 80) = 16 and gcd(37, 91) = 1 exercise the two cases of the inplace algorithm
+
+    etl::dyn_matrix<Z> a(48, 80);
+    etl::dyn_matrix<Z> b(48, 80);
+
+    a = etl::sequence_generator(1.0);
+    b = a;
+
+    a.transpose_inplace();
+
+    REQUIRE_EQUALS(etl::dim<0>(a), 80UL);
+    REQUIRE_EQUALS(etl::dim<1>(a), 48UL);
+
+    for (std::size_t i = 0; i < 48; ++i) {
+        for (std::size_t j = 0; j < 80; ++j) {
+            REQUIRE_EQUALS(a(j, i), b(i, j));
+        }
+    }
+
+    etl::dyn_matrix<Z> c(37, 91);
+    etl::dyn_matrix<Z> d(37, 91);
+
+    c = etl::sequence_generator(1.0);
+    d = c;
+
+    c.transpose_inplace();
+
+    REQUIRE_EQUALS(etl::dim<0>(c), 91UL);
+    REQUIRE_EQUALS(etl::dim<1>(c), 37UL);
+
+    for (std::size_t i = 0; i < 37; ++i) {
+        for (std::size_t j = 0; j < 91; ++j) {
+            REQUIRE_EQUALS(c(j, i), d(i, j));
+        }
+    }
+}
+
 TEMPLATE_TEST_CASE_2("transpose/expr_1", "transpose", Z, float, double) {
     etl::dyn_matrix<Z, 3> a(3, 3, 3, std::initializer_list<Z>({1, 2, 3, 4, 5, 6, 7, 8, 9, 1, 2, 3, 4, 5, 6, 7, 8, 9, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
 
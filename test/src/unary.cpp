@@ -0,0 +1,250 @@
+//=======================================================================
+// Copyright (c) 2014-2016 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test_light.hpp"
+
+// Tests on large inputs, to go through the vectorized implementations
+
+TEMPLATE_TEST_CASE_2("unary/exp", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+
+    a = etl::sequence_generator(-518.0) * 0.15;
+
+    b = etl::exp(a);
+
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], std::exp(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("unary/log", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+
+    a = etl::sequence_generator(1.0) * 3.7;
+    a[0] = 1e-30;
+    a[1] = 0.5;
+
+    b = etl::log(a);
+
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], std::log(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("unary/sin", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+
+    a = etl::sequence_generator(-518.0) * 0.193;
+
+    b = etl::sin(a);
+
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(b[i] + Z(2), std::sin(a[i]) + Z(2), base_eps / 10);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("unary/cos", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+
+    a = etl::sequence_generator(-518.0) * 0.193;
+
+    b = etl::cos(a);
+
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(b[i] + Z(2), std::cos(a[i]) + Z(2), base_eps / 10);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("unary/tan", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+
+    a = etl::sequence_generator(-518.0) * 0.0029;
+
+    b = etl::tan(a);
+
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], std::tan(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("unary/tanh", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+
+    a = etl::sequence_generator(-518.0) * 0.0193;
+    a[0] = 1e-5;
+    a[1] = -1e-5;
+
+    b = etl::tanh(a);
+
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], std::tanh(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("unary/sinh", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+
+    a = etl::sequence_generator(-518.0) * 0.0387;
+    a[0] = 1e-5;
+
+    b = etl::sinh(a);
+
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], std::sinh(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("unary/cosh", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+
+    a = etl::sequence_generator(-518.0) * 0.0387;
+
+    b = etl::cosh(a);
+
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], std::cosh(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("unary/sigmoid", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+
+    a = etl::sequence_generator(-518.0) * 0.058;
+
+    b = etl::sigmoid(a);
+
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], etl::math::logistic_sigmoid(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("unary/fast_sigmoid", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+
+    a = etl::sequence_generator(-518.0) * 0.0193;
+
+    b = etl::fast_sigmoid(a);
+
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(b[i], etl::fast_sigmoid_unary_op<Z>::apply(a[i]), base_eps * 10);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("unary/softplus", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+
+    a = etl::sequence_generator(-518.0) * 0.058;
+
+    // Would overflow with log(1 + exp(x))
+    a[3] = 100.0;
+    a[4] = 500.0;
+
+    b = etl::softplus(a);
+
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], etl::math::softplus(a[i]));
+    }
+
+    REQUIRE_EQUALS_APPROX(b[4], Z(500.0));
+}
+
+TEMPLATE_TEST_CASE_2("unary/abs", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+
+    a = etl::sequence_generator(-518.0) * 0.0193;
+
+    b = etl::abs(a);
+
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS(b[i], std::abs(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("unary/sign", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+
+    a = etl::sequence_generator(-518.0) * 0.0193;
+    a[5] = 0.0;
+
+    b = etl::sign(a);
+
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS(b[i], Z(etl::math::sign(a[i])));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("unary/special", "[unary]", Z, float, double) {
+    const Z nan = std::numeric_limits<Z>::quiet_NaN();
+    const Z inf = std::numeric_limits<Z>::infinity();
+
+    etl::dyn_vector<Z> a(64);
+    etl::dyn_vector<Z> b(64);
+
+    for (std::size_t i = 0; i < a.size(); i += 4) {
+        a[i + 0] = nan;
+        a[i + 1] = inf;
+        a[i + 2] = -inf;
+        a[i + 3] = Z(0);
+    }
+
+    b = etl::exp(a);
+
+    for (std::size_t i = 0; i < a.size(); i += 4) {
+        REQUIRE_DIRECT(std::isnan(b[i + 0]));
+        REQUIRE_EQUALS(b[i + 1], inf);
+        REQUIRE_EQUALS(b[i + 2], Z(0));
+        REQUIRE_EQUALS(b[i + 3], Z(1));
+    }
+
+    b = etl::log(a);
+
+    for (std::size_t i = 0; i < a.size(); i += 4) {
+        REQUIRE_DIRECT(std::isnan(b[i + 0]));
+        REQUIRE_EQUALS(b[i + 1], inf);
+        REQUIRE_DIRECT(std::isnan(b[i + 2]));
+        REQUIRE_EQUALS(b[i + 3], -inf);
+    }
+
+    b = etl::sin(a);
+
+    for (std::size_t i = 0; i < a.size(); i += 4) {
+        REQUIRE_DIRECT(std::isnan(b[i + 0]));
+        REQUIRE_DIRECT(std::isnan(b[i + 1]));
+        REQUIRE_DIRECT(std::isnan(b[i + 2]));
+        REQUIRE_EQUALS(b[i + 3], Z(0));
+    }
+
+    b = etl::cos(a);
+
+    for (std::size_t i = 0; i < a.size(); i += 4) {
+        REQUIRE_DIRECT(std::isnan(b[i + 0]));
+        REQUIRE_DIRECT(std::isnan(b[i + 1]));
+        REQUIRE_DIRECT(std::isnan(b[i + 2]));
+        REQUIRE_EQUALS(b[i + 3], Z(1));
+    }
+
+    b = etl::sigmoid(a);
+
+    for (std::size_t i = 0; i < a.size(); i += 4) {
+        REQUIRE_DIRECT(std::isnan(b[i + 0]));
+        REQUIRE_EQUALS(b[i + 1], Z(1));
+        REQUIRE_EQUALS(b[i + 2], Z(0));
+    }
+}